@@ -0,0 +1,87 @@
+#ifndef MAV_NMPC_TRACKER_BENCHMARK_PROBLEMS_H
+#define MAV_NMPC_TRACKER_BENCHMARK_PROBLEMS_H
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/warm_start.h"
+
+// Tracking problem sequences shared by the solver benchmarks
+
+namespace mav_nmpc_tracker {
+namespace benchmark {
+
+struct Problem {
+    StateVector x0;
+    RefTrajectory yref;
+    TerminalRefVector yref_e;
+};
+
+// Circle at 40 Hz cycles with measurement noise. Every kick_period-th initial state gets a
+// velocity and attitude kick, and every jump_period-th cycle the circle center jumps, 0 for none.
+// The input reference is the feedforward of the circle, as in the tracker.
+inline std::vector<Problem> make_problems(const MpcFormulationParam &param, int n_cycles, int kick_period,
+                                          int jump_period = 0)
+{
+    const double radius = 2.0, omega = 1.0, cycle_dt = 0.025;
+    std::mt19937 rng(42);
+    std::normal_distribution<double> noise(0.0, 0.05);
+    std::uniform_real_distribution<double> kick(-1.0, 1.0);
+
+    std::vector<Problem> problems(n_cycles);
+    Eigen::Vector3d center(0.0, 0.0, 1.0);
+    for (int k = 0; k < n_cycles; k++) {
+        Problem &problem = problems[k];
+        // the state is on the circle before the jump
+        const double t0 = k * cycle_dt;
+        problem.x0.setZero();
+        problem.x0.head<6>() << center(0) + radius * std::cos(omega * t0), center(1) + radius * std::sin(omega * t0),
+            center(2), -radius * omega * std::sin(omega * t0), radius * omega * std::cos(omega * t0), 0.0;
+        for (int i = 0; i < kNx; i++)
+            problem.x0(i) += noise(rng);
+        if (kick_period > 0 && k % kick_period == kick_period - 1) {
+            problem.x0.segment<3>(3) += 8.0 * Eigen::Vector3d(kick(rng), kick(rng), kick(rng));
+            problem.x0.segment<2>(6) += 0.6 * Eigen::Vector2d(kick(rng), kick(rng));
+        }
+
+        if (jump_period > 0 && k % jump_period == jump_period - 1)
+            center += Eigen::Vector3d(2.0 * kick(rng), 2.0 * kick(rng), 0.5 * kick(rng));
+
+        problem.yref.resize(kNy, param.N);
+        for (int iStage = 0; iStage < param.N; iStage++) {
+            const double t = t0 + iStage * param.dt;
+            const Eigen::Vector3d vel(-radius * omega * std::sin(omega * t), radius * omega * std::cos(omega * t), 0.0);
+            const Eigen::Vector3d acc(-radius * omega * omega * std::cos(omega * t),
+                                      -radius * omega * omega * std::sin(omega * t), 0.0);
+            problem.yref.col(iStage) << center(0) + radius * std::cos(omega * t),
+                center(1) + radius * std::sin(omega * t), center(2), vel, feedforward_input(param, acc, vel, 0.0);
+        }
+        problem.yref_e = problem.yref.col(param.N - 1).head<kNyE>();
+    }
+    return problems;
+}
+
+// every stage at x0 with hover thrust
+inline void hover_start(const StateVector &x0, StateTrajectory &x_init, InputTrajectory &u_init)
+{
+    x_init.colwise() = x0;
+    u_init.colwise() = InputVector(0.0, 0.0, 1.0 * g);
+}
+
+// shifted by one stage and the last stage repeated
+inline void shift_start(const StateTrajectory &x_plan, const InputTrajectory &u_plan,
+                        StateTrajectory &x_init, InputTrajectory &u_init)
+{
+    const int N = static_cast<int>(u_plan.cols());
+    x_init.leftCols(N) = x_plan.rightCols(N);
+    x_init.col(N) = x_plan.col(N);
+    u_init.leftCols(N - 1) = u_plan.rightCols(N - 1);
+    u_init.col(N - 1) = u_plan.col(N - 1);
+}
+
+}  // namespace benchmark
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_BENCHMARK_PROBLEMS_H
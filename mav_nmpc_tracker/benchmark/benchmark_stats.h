@@ -0,0 +1,67 @@
+#ifndef MAV_NMPC_TRACKER_BENCHMARK_STATS_H
+#define MAV_NMPC_TRACKER_BENCHMARK_STATS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Latency statistics shared by the solver benchmarks
+
+namespace mav_nmpc_tracker {
+namespace benchmark {
+
+inline double now_ms()
+{
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+class LatencyStats {
+public:
+    void add(double sample_ms) { samples_.push_back(sample_ms); }
+    size_t size() const { return samples_.size(); }
+
+    double percentile(double p) const
+    {
+        if (samples_.empty())
+            return 0.0;
+        std::vector<double> sorted = samples_;
+        std::sort(sorted.begin(), sorted.end());
+        const size_t idx = std::min(sorted.size() - 1, static_cast<size_t>(p / 100.0 * sorted.size()));
+        return sorted[idx];
+    }
+
+    double mean() const
+    {
+        double sum = 0.0;
+        for (double sample : samples_)
+            sum += sample;
+        return samples_.empty() ? 0.0 : sum / samples_.size();
+    }
+
+    double max() const { return samples_.empty() ? 0.0 : *std::max_element(samples_.begin(), samples_.end()); }
+
+    static void print_header(const char *unit = "ms")
+    {
+        char labels[5][16];
+        const char *names[5] = {"mean", "p50", "p90", "p99", "max"};
+        for (int i = 0; i < 5; i++)
+            snprintf(labels[i], sizeof(labels[i]), "%s [%s]", names[i], unit);
+        printf("%-28s %10s %10s %10s %10s %10s\n", "", labels[0], labels[1], labels[2], labels[3], labels[4]);
+    }
+
+    void print(const char *name) const
+    {
+        printf("%-28s %10.3f %10.3f %10.3f %10.3f %10.3f\n", name, mean(), percentile(50), percentile(90),
+               percentile(99), max());
+    }
+
+private:
+    std::vector<double> samples_;
+};
+
+}  // namespace benchmark
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_BENCHMARK_STATS_H
@@ -0,0 +1,175 @@
+// Commands between two solves: the first control of each 25 ms cycle against commands at 400 Hz read off the plan.
+//
+// The circle of the feedforward benchmark in closed loop, the model of the solver integrated at 1 kHz. The simulated
+// MAV is pushed by a constant 0.5 m/s^2 the solver does not know of, for the feedback to correct between the solves.
+// The plan goes through the triple buffer of the tracker at every cycle, as it would to its output thread. The step
+// is the largest change of roll or pitch from one command to the next.
+//
+// usage: command_rate_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mav_nmpc_tracker/command_interpolator.h"
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kOmega = 1.0, kCycleDt = 0.025, kPlantDt = 0.001, kDisturbance = 0.5;
+
+struct Setup {
+    const char *name;
+    double rate;  // Hz, 0 for the command of the cycle
+    CommandInterpolatorParam param;
+};
+
+struct Result {
+    LatencyStats command_time;  // us
+    double squared_error_sum = 0.0;
+    int samples = 0;
+    double max_step = 0.0;  // rad
+    int failures = 0;
+};
+
+Result run(const MpcFormulationParam &param, const Setup &setup, int n_cycles)
+{
+    const int N = param.N;
+    NmpcTrackerSolver solver(param);
+    WarmStart warm_start(param);
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N);
+    RefTrajectory yref(kNy, N);
+    TerminalRefVector yref_e;
+    std::vector<double> stage_times_plan = stage_times(horizon_time_steps(param));
+    CommandInterpolator interpolator(setup.param);
+    TripleBuffer<CommandPlan> handoff;
+
+    auto position = [](double t) {
+        return Eigen::Vector3d(kRadius * std::cos(kOmega * t), kRadius * std::sin(kOmega * t), 1.0);
+    };
+    auto velocity = [](double t) {
+        return Eigen::Vector3d(-kRadius * kOmega * std::sin(kOmega * t), kRadius * kOmega * std::cos(kOmega * t), 0.0);
+    };
+    auto acceleration = [](double t) {
+        return Eigen::Vector3d(-kRadius * kOmega * kOmega * std::cos(kOmega * t),
+                               -kRadius * kOmega * kOmega * std::sin(kOmega * t), 0.0);
+    };
+
+    // the plant, with the disturbance
+    MpcFormulationParam plant = param;
+    plant.disturbance_x = kDisturbance;
+    StateVector x = StateVector::Zero();
+    x.head<3>() = position(0.0);
+    x.segment<3>(3) = velocity(0.0);
+
+    Result result;
+    bool feasible = false;
+    InputVector u_last(0.0, 0.0, 1.0 * g);
+    const int plant_steps = static_cast<int>(std::round(kCycleDt / kPlantDt));
+    const int command_every =
+        setup.rate > 0.0 ? std::max(1, static_cast<int>(std::round(1.0 / (setup.rate * kPlantDt)))) : plant_steps;
+    for (int k = 0; k < n_cycles; k++) {
+        const double t0 = k * kCycleDt;
+        for (int iStage = 0; iStage < N; iStage++) {
+            const double t = t0 + stage_times_plan[iStage];
+            yref.col(iStage) << position(t), velocity(t), feedforward_input(param, acceleration(t), velocity(t), x(8));
+        }
+        yref_e = yref.col(N - 1).head<kNyE>();
+        warm_start.build(feasible, x, x_plan, u_plan, yref, x_init, u_init);
+        solver.set_x0(x);
+        solver.set_yref(yref, yref_e);
+        solver.set_x_init(x_init);
+        solver.set_u_init(u_init);
+        int status = solver.solve();
+        if (status != 0) {
+            x_init.colwise() = x;
+            u_init.colwise() = InputVector(0.0, 0.0, 1.0 * g);
+            solver.set_x_init(x_init);
+            solver.set_u_init(u_init);
+            status = solver.solve();
+        }
+        feasible = (status == 0);
+        if (feasible) {
+            solver.get_x_traj(x_plan);
+            solver.get_u_traj(u_plan);
+        } else {
+            result.failures++;
+        }
+
+        // handed off as by the control cycle
+        CommandPlan &plan = handoff.back();
+        plan.valid = feasible;
+        plan.start_time = t0;
+        plan.stage_times = stage_times_plan;
+        plan.x = x_plan;
+        plan.u = u_plan;
+        plan.fallback = InputVector(0.0, 0.0, 1.0 * g);
+        plan.model = param;
+        handoff.publish();
+        handoff.update();
+
+        // the plant between this solve and the next one, a command every command_every steps
+        for (int i = 0; i < plant_steps; i++) {
+            const double t = t0 + i * kPlantDt;
+            if (i % command_every == 0) {
+                InputVector u;
+                if (setup.rate > 0.0) {
+                    StateSample odom;
+                    odom.time = t;
+                    odom.state = x;
+                    const double t_start = now_ms();
+                    interpolator.command(handoff.front(), t, &odom, u);
+                    result.command_time.add(1000.0 * (now_ms() - t_start));
+                } else {
+                    u = feasible ? InputVector(u_plan.col(0)) : InputVector(0.0, 0.0, 1.0 * g);
+                }
+                if (k > 0)
+                    result.max_step = std::max(result.max_step, (u - u_last).head<2>().cwiseAbs().maxCoeff());
+                u_last = u;
+            }
+            x = integrate_mav_dynamics(plant, x, u_last, kPlantDt);
+            result.squared_error_sum += (x.head<3>() - position(t + kPlantDt)).squaredNorm();
+            result.samples++;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const MpcFormulationParam param;
+
+    CommandInterpolatorParam hold, linear, feedback;
+    hold.linear = false;
+    feedback.kp = 4.0;
+    feedback.kd = 3.0;
+    const Setup setups[] = {
+        {"40 Hz, first control", 0.0, hold},
+        {"400 Hz, held", 400.0, hold},
+        {"400 Hz, linear", 400.0, linear},
+        {"400 Hz, linear + feedback", 400.0, feedback},
+        {"200 Hz, linear + feedback", 200.0, feedback},
+    };
+
+    printf("%d cycles of %.0f ms on a circle of %.0f m at %.1f rad/s, unknown disturbance %.1f m/s^2\n\n", n_cycles,
+           kCycleDt * 1000.0, kRadius, kOmega, kDisturbance);
+    printf("%-28s %12s %12s %12s %12s\n", "", "pos rms [m]", "step [deg]", "command [us]", "failures");
+    for (const Setup &setup : setups) {
+        const Result result = run(param, setup, n_cycles);
+        printf("%-28s %12.4f %12.3f %12.3f %12d\n", setup.name, std::sqrt(result.squared_error_sum / result.samples),
+               result.max_step * 180.0 / M_PI, result.command_time.mean(), result.failures);
+    }
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Lookup time of the distance field over the map size.
+//
+// Maps of 64^3 to 256^3 voxels of 0.1 m with spheres scattered in them are written to /tmp and mapped.
+// Each cycle the stages of the circle of the other benchmarks, moved along by a cycle, are linearized
+// as in the tracker, once through the block cache and once straight from the mapped file. Both should
+// stay flat over the map size. With the file in the page cache, as here, the direct reads are as fast;
+// the block cache keeps the cycles off the mapped pages, which matters once they are not resident.
+//
+// usage: esdf_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mav_nmpc_tracker/esdf_map.h"
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kOmega = 1.0, kCycleDt = 0.025;
+const double kResolution = 0.1, kSafeDistance = 0.5;
+
+// distance to the nearest of random spheres around the circle, centered on the origin
+std::string write_map(int size)
+{
+    std::mt19937 rng(42);
+    const double half = 0.5 * size * kResolution;
+    std::uniform_real_distribution<double> coordinate(-half, half), radius(0.2, 0.6);
+    std::vector<Eigen::Vector4d> spheres(40);
+    for (Eigen::Vector4d &sphere : spheres)
+        sphere << coordinate(rng), coordinate(rng), coordinate(rng), radius(rng);
+
+    const Eigen::Vector3d origin = Eigen::Vector3d::Constant(-half);
+    std::vector<float> distances(static_cast<size_t>(size) * size * size);
+    size_t index = 0;
+    for (int k = 0; k < size; k++) {
+        for (int j = 0; j < size; j++) {
+            for (int i = 0; i < size; i++) {
+                const Eigen::Vector3d p = origin + kResolution * Eigen::Vector3d(i, j, k);
+                double distance = 1e9;
+                for (const Eigen::Vector4d &sphere : spheres)
+                    distance = std::min(distance, (p - sphere.head<3>()).norm() - sphere(3));
+                distances[index++] = static_cast<float>(distance);
+            }
+        }
+    }
+    const std::string path = "/tmp/esdf_benchmark_" + std::to_string(size) + ".esdf";
+    EsdfMap::write(path, Eigen::Vector3i::Constant(size), origin, kResolution, distances);
+    return path;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const MpcFormulationParam param;
+    const int N = param.N;
+
+    const int sizes[] = {64, 128, 256};
+    printf("%d cycles of %.0f ms on a circle, %d stages linearized per cycle\n\n", n_cycles, kCycleDt * 1000.0, N);
+    LatencyStats::print_header("us");
+    for (int size : sizes) {
+        std::string path;
+        try {
+            path = write_map(size);
+        } catch (const std::exception &e) {
+            fprintf(stderr, "%s\n", e.what());
+            return 1;
+        }
+        EsdfMap map(path);
+        LatencyStats cached_time, uncached_time;
+        double checksum = 0.0;
+        for (int k = 0; k < n_cycles; k++) {
+            const double t0 = k * kCycleDt;
+            std::vector<Eigen::Vector3d> points(N + 1);
+            for (int iStage = 0; iStage <= N; iStage++) {
+                const double t = t0 + iStage * param.dt;
+                points[iStage] << kRadius * std::cos(kOmega * t), kRadius * std::sin(kOmega * t), 1.0;
+            }
+            double t_start = now_ms();
+            for (int iStage = 1; iStage <= N; iStage++)
+                checksum += map.linearize(points[iStage], kSafeDistance).bound;
+            cached_time.add(1000.0 * (now_ms() - t_start));
+            t_start = now_ms();
+            Eigen::Vector3d gradient;
+            for (int iStage = 1; iStage <= N; iStage++)
+                checksum -= kSafeDistance - map.distance_uncached(points[iStage], &gradient) +
+                            gradient.dot(points[iStage]);
+            uncached_time.add(1000.0 * (now_ms() - t_start));
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "%d^3, cached", size);
+        cached_time.print(name);
+        snprintf(name, sizeof(name), "%d^3, from the file", size);
+        uncached_time.print(name);
+        const double lookups = static_cast<double>(map.cache_hits() + map.cache_misses());
+        printf("%28s cache hit rate %.3f, cached - uncached %.2e\n", "", map.cache_hits() / lookups, checksum);
+    }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Closed loop tracking of circles with the hover input reference against the feedforward one.
+//
+// The model of the solver is integrated over each 25 ms cycle with the first control of the plan,
+// from the adaptive warm start as in the tracker. Circles of 2 m get faster up to near the roll limit.
+// With the hover input reference the input weights pull the plan upright, the MAV flies inside the
+// circle and behind; the feedforward of the centripetal acceleration is the input the circle needs.
+// The lag is the along-track error over the speed.
+//
+// usage: feedforward_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kCycleDt = 0.025;
+const int kSubsteps = 5;
+
+struct Result {
+    LatencyStats solve_time;
+    double qp_iter_sum = 0.0;
+    double squared_error_sum = 0.0;
+    double lag_sum = 0.0;  // s
+    int failures = 0;
+};
+
+Result run(const MpcFormulationParam &param, double omega, bool feedforward, int n_cycles)
+{
+    const int N = param.N;
+    NmpcTrackerSolver solver(param);
+    WarmStart warm_start(param);
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N);
+    RefTrajectory yref(kNy, N);
+    TerminalRefVector yref_e;
+
+    auto position = [omega](double t) {
+        return Eigen::Vector3d(kRadius * std::cos(omega * t), kRadius * std::sin(omega * t), 1.0);
+    };
+    auto velocity = [omega](double t) {
+        return Eigen::Vector3d(-kRadius * omega * std::sin(omega * t), kRadius * omega * std::cos(omega * t), 0.0);
+    };
+    auto acceleration = [omega](double t) {
+        return Eigen::Vector3d(-kRadius * omega * omega * std::cos(omega * t),
+                               -kRadius * omega * omega * std::sin(omega * t), 0.0);
+    };
+
+    // on the circle, at the attitude flying it
+    StateVector x = StateVector::Zero();
+    x.head<3>() = position(0.0);
+    x.segment<3>(3) = velocity(0.0);
+    const InputVector u_start = feedforward_input(param, acceleration(0.0), velocity(0.0), 0.0);
+    x(6) = param.roll_gain * u_start(0);
+    x(7) = param.pitch_gain * u_start(1);
+
+    Result result;
+    bool feasible = false;
+    for (int k = 0; k < n_cycles; k++) {
+        const double t0 = k * kCycleDt;
+        for (int iStage = 0; iStage < N; iStage++) {
+            const double t = t0 + iStage * param.dt;
+            const InputVector u_ref = feedforward ? feedforward_input(param, acceleration(t), velocity(t), x(8))
+                                                  : InputVector(0.0, 0.0, 1.0 * g);
+            yref.col(iStage) << position(t), velocity(t), u_ref;
+        }
+        yref_e = yref.col(N - 1).head<kNyE>();
+        warm_start.build(feasible, x, x_plan, u_plan, yref, x_init, u_init);
+
+        const double t_start = now_ms();
+        solver.set_x0(x);
+        solver.set_yref(yref, yref_e);
+        solver.set_x_init(x_init);
+        solver.set_u_init(u_init);
+        int status = solver.solve();
+        int qp_iter = solver.get_qp_iter();
+        if (status != 0) {
+            x_init.colwise() = x;
+            u_init.colwise() = InputVector(0.0, 0.0, 1.0 * g);
+            solver.set_x_init(x_init);
+            solver.set_u_init(u_init);
+            status = solver.solve();
+            qp_iter += solver.get_qp_iter();
+        }
+        result.solve_time.add(now_ms() - t_start);
+        result.qp_iter_sum += qp_iter;
+        feasible = (status == 0);
+        InputVector u(0.0, 0.0, 1.0 * g);
+        if (feasible) {
+            solver.get_x_traj(x_plan);
+            solver.get_u_traj(u_plan);
+            u = u_plan.col(0);
+        } else {
+            result.failures++;
+        }
+
+        for (int i = 0; i < kSubsteps; i++)
+            x = integrate_mav_dynamics(param, x, u, kCycleDt / kSubsteps);
+        const double t1 = t0 + kCycleDt;
+        const Eigen::Vector3d error = x.head<3>() - position(t1);
+        result.squared_error_sum += error.squaredNorm();
+        result.lag_sum -= error.dot(velocity(t1)) / velocity(t1).squaredNorm();
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const MpcFormulationParam param;
+    const double omegas[] = {0.5, 1.0, 1.4};
+
+    printf("%d cycles of %.0f ms on circles of %.0f m, N = %d\n\n", n_cycles, kCycleDt * 1000.0, kRadius, param.N);
+    printf("%-28s %12s %12s %12s %12s %12s\n", "", "qp iter mean", "solve [ms]", "pos rms [m]", "lag [ms]",
+           "failures");
+    for (double omega : omegas) {
+        for (int feedforward = 0; feedforward < 2; feedforward++) {
+            const Result result = run(param, omega, feedforward == 1, n_cycles);
+            char name[64];
+            snprintf(name, sizeof(name), "%.1f m/s^2, %s", kRadius * omega * omega,
+                     feedforward ? "feedforward" : "hover");
+            printf("%-28s %12.2f %12.3f %12.4f %12.1f %12d\n", name, result.qp_iter_sum / n_cycles,
+                   result.solve_time.mean(), std::sqrt(result.squared_error_sum / n_cycles),
+                   1000.0 * result.lag_sum / n_cycles, result.failures);
+        }
+    }
+
+    return 0;
+}
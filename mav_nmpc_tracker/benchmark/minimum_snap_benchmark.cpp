@@ -0,0 +1,160 @@
+// Flying home from a distance with the step reference against the minimum snap transition.
+//
+// First the cost of a plan and of evaluating it at the stages, from random states within 20 m, 3 m/s and
+// 3 m/s^2 of home. Then the closed loop, the model of the solver integrated over each 25 ms cycle with the
+// first control of the plan, from rest 2 to 10 m away from [0, 0, 1]. The step reference tiles home over the
+// horizon: the plan leans into the tilt limits, the warm start jumps and solves fail. The transition is
+// planned once at the start, as on entering home in the tracker.
+//
+// usage: minimum_snap_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "mav_nmpc_tracker/minimum_snap.h"
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kCycleDt = 0.025, kArrivalTolerance = 0.1;
+const int kSubsteps = 5;
+
+struct Result {
+    LatencyStats solve_time;
+    double qp_iter_sum = 0.0;
+    double max_tilt = 0.0;  // rad
+    double arrival = -1.0;  // s, within kArrivalTolerance of home from then on, -1 if never
+    int failures = 0;
+};
+
+Result run(const MpcFormulationParam &param, const Eigen::Vector3d &start, bool transition, int n_cycles)
+{
+    const int N = param.N;
+    std::vector<double> stage_offsets = stage_times(horizon_time_steps(param));
+    stage_offsets.pop_back();
+    NmpcTrackerSolver solver(param);
+    WarmStart warm_start(param);
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N);
+    RefTrajectory yref(kNy, N);
+    TerminalRefVector yref_e;
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+
+    const Eigen::Vector3d home(0.0, 0.0, 1.0);
+    MinimumSnapTrajectory trajectory;
+    trajectory.plan(0.0, start, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), home);
+
+    StateVector x = StateVector::Zero();
+    x.head<3>() = start;
+    Result result;
+    bool feasible = false;
+    for (int k = 0; k < n_cycles; k++) {
+        const double t0 = k * kCycleDt;
+        if (transition) {
+            trajectory.evaluate(t0, stage_offsets, positions, velocities, &accelerations);
+        } else {
+            positions = home.replicate(1, N);
+            velocities.setZero(3, N);
+            accelerations.setZero(3, N);
+        }
+        for (int iStage = 0; iStage < N; iStage++)
+            yref.col(iStage) << positions.col(iStage), velocities.col(iStage),
+                feedforward_input(param, accelerations.col(iStage), velocities.col(iStage), x(8));
+        yref_e = yref.col(N - 1).head<kNyE>();
+        warm_start.build(feasible, x, x_plan, u_plan, yref, x_init, u_init);
+
+        const double t_start = now_ms();
+        solver.set_x0(x);
+        solver.set_yref(yref, yref_e);
+        solver.set_x_init(x_init);
+        solver.set_u_init(u_init);
+        int status = solver.solve();
+        int qp_iter = solver.get_qp_iter();
+        if (status != 0) {
+            x_init.colwise() = x;
+            u_init.colwise() = InputVector(0.0, 0.0, 1.0 * g);
+            solver.set_x_init(x_init);
+            solver.set_u_init(u_init);
+            status = solver.solve();
+            qp_iter += solver.get_qp_iter();
+        }
+        result.solve_time.add(now_ms() - t_start);
+        result.qp_iter_sum += qp_iter;
+        feasible = (status == 0);
+        InputVector u(0.0, 0.0, 1.0 * g);
+        if (feasible) {
+            solver.get_x_traj(x_plan);
+            solver.get_u_traj(u_plan);
+            u = u_plan.col(0);
+        } else {
+            result.failures++;
+        }
+
+        for (int i = 0; i < kSubsteps; i++)
+            x = integrate_mav_dynamics(param, x, u, kCycleDt / kSubsteps);
+        result.max_tilt = std::max(result.max_tilt, std::max(std::abs(x(6)), std::abs(x(7))));
+        if ((x.head<3>() - home).norm() > kArrivalTolerance)
+            result.arrival = -1.0;
+        else if (result.arrival < 0.0)
+            result.arrival = t0 + kCycleDt;
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 800;
+    const MpcFormulationParam param;
+    std::vector<double> stage_offsets = stage_times(horizon_time_steps(param));
+    stage_offsets.pop_back();
+
+    // plan and evaluation
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    LatencyStats plan_time, evaluate_time;
+    MinimumSnapTrajectory trajectory;
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    for (int i = 0; i < 10000; i++) {
+        const Eigen::Vector3d p0 = 20.0 * Eigen::Vector3d(unit(rng), unit(rng), unit(rng));
+        const Eigen::Vector3d v0 = 3.0 / std::sqrt(3.0) * Eigen::Vector3d(unit(rng), unit(rng), unit(rng));
+        const Eigen::Vector3d a0 = 3.0 / std::sqrt(3.0) * Eigen::Vector3d(unit(rng), unit(rng), unit(rng));
+        double t_start = now_ms();
+        trajectory.plan(0.0, p0, v0, a0, Eigen::Vector3d(0.0, 0.0, 1.0));
+        plan_time.add(1000.0 * (now_ms() - t_start));
+        t_start = now_ms();
+        trajectory.evaluate(0.5 * trajectory.end_time(), stage_offsets, positions, velocities, &accelerations);
+        evaluate_time.add(1000.0 * (now_ms() - t_start));
+    }
+    LatencyStats::print_header("us");
+    plan_time.print("plan");
+    evaluate_time.print("evaluate at the stages");
+
+    // closed loop
+    printf("\n%d cycles of %.0f ms from rest to home, N = %d\n\n", n_cycles, kCycleDt * 1000.0, param.N);
+    printf("%-28s %12s %12s %12s %12s %12s\n", "", "qp iter mean", "solve [ms]", "tilt [deg]", "arrival [s]",
+           "failures");
+    const double distances[] = {2.0, 5.0, 10.0};
+    for (double distance : distances) {
+        const Eigen::Vector3d start = Eigen::Vector3d(0.0, 0.0, 1.0) + distance * Eigen::Vector3d(0.8, 0.6, 0.0);
+        for (int transition = 0; transition < 2; transition++) {
+            const Result result = run(param, start, transition == 1, n_cycles);
+            char name[64];
+            snprintf(name, sizeof(name), "%.0f m, %s", distance, transition ? "minimum snap" : "step");
+            printf("%-28s %12.2f %12.3f %12.1f %12.2f %12d\n", name, result.qp_iter_sum / n_cycles,
+                   result.solve_time.mean(), result.max_tilt * 180.0 / M_PI, result.arrival, result.failures);
+        }
+    }
+
+    return 0;
+}
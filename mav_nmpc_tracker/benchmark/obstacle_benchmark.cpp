@@ -0,0 +1,192 @@
+// Preselection and solve time of the moving obstacle constraints over the number of obstacles.
+//
+// 0 to 1000 spheres of 0.3 to 0.8 m radius move at under 1 m/s in a 60 x 60 x 3 m box around the
+// circle of the other benchmarks. Each cycle the kObstacleSlots nearest obstacles of every stage are
+// picked from the grid index and, for comparison, by testing all of them. With a solver generated with
+//   scripts/nmpc_tracker_solver.py --variant obstacles --obstacle_slots 4
+// the circle is flown in closed loop with the model through them, at 40 Hz cycles with the first
+// control of each plan held in between. The constraint count is fixed, so the solve time should not
+// grow with the obstacles; the grid preselection grows with those nearby only.
+//
+// usage: obstacle_benchmark [n_cycles] [variant.json]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/obstacles.h"
+#include "mav_nmpc_tracker/solver_library.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kOmega = 1.0, kCycleDt = 0.025;
+const double kMargin = 0.2;
+
+Eigen::Matrix<double, 6, 1> circle(double t)
+{
+    Eigen::Matrix<double, 6, 1> pos_vel;
+    pos_vel << kRadius * std::cos(kOmega * t), kRadius * std::sin(kOmega * t), 1.0,
+        -kRadius * kOmega * std::sin(kOmega * t), kRadius * kOmega * std::cos(kOmega * t), 0.0;
+    return pos_vel;
+}
+
+std::vector<Obstacle> make_obstacles(int count)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> horizontal(-30.0, 30.0), vertical(0.0, 3.0);
+    std::uniform_real_distribution<double> speed(-0.6, 0.6), radius(0.3, 0.8);
+    std::vector<Obstacle> obstacles(count);
+    for (Obstacle &obstacle : obstacles) {
+        obstacle.position << horizontal(rng), horizontal(rng), vertical(rng);
+        obstacle.velocity << speed(rng), speed(rng), 0.0;
+        obstacle.radii.setConstant(radius(rng));
+    }
+    return obstacles;
+}
+
+struct CountResult {
+    LatencyStats index_time;
+    LatencyStats brute_force_time;
+    LatencyStats solve_time;
+    double tests_sum = 0.0;  // per stage, of the grid
+    int failures = 0;
+    int collisions = 0;      // cycles with the state inside an obstacle
+    double squared_error_sum = 0.0;
+};
+
+CountResult run_count(const MpcFormulationParam &param, std::shared_ptr<const SolverLibrary> library, int count,
+                      int n_cycles)
+{
+    const int N = param.N;
+    std::unique_ptr<NmpcTrackerSolver> solver;
+    if (library)
+        solver.reset(new NmpcTrackerSolver(param, library, horizon_time_steps(param)));
+    WarmStart warm_start(param);
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N);
+    RefTrajectory yref(kNy, N);
+    std::vector<ObstacleSlots> slots(N + 1, empty_obstacle_slots());
+
+    const std::vector<Obstacle> obstacles = make_obstacles(count);
+    ObstacleIndex index;
+    index.set_obstacles(obstacles);
+
+    CountResult result;
+    StateVector x = StateVector::Zero();
+    x.head<6>() = circle(0.0);
+    bool feasible = false;
+    for (int k = 0; k < n_cycles; k++) {
+        const double t0 = k * kCycleDt;
+        for (int iStage = 0; iStage < N; iStage++)
+            yref.col(iStage) << circle(t0 + iStage * param.dt), 0.0, 0.0, g;
+        const TerminalRefVector yref_e = yref.col(N - 1).head<kNyE>();
+
+        // preselection, as in the tracker from the reference of each stage
+        double t_start = now_ms();
+        for (int iStage = 1; iStage <= N; iStage++) {
+            const double time = t0 + iStage * param.dt;
+            const std::vector<int> &nearest =
+                index.nearest(yref.col(std::min(iStage, N - 1)).head<3>(), time, kObstacleSlots);
+            result.tests_sum += index.tests();
+            slots[iStage] = empty_obstacle_slots();
+            for (size_t iSlot = 0; iSlot < nearest.size(); iSlot++)
+                set_obstacle_slot(slots[iStage], static_cast<int>(iSlot), obstacles[nearest[iSlot]], time, kMargin);
+        }
+        result.index_time.add(now_ms() - t_start);
+        t_start = now_ms();
+        for (int iStage = 1; iStage <= N; iStage++)
+            index.nearest_brute_force(yref.col(std::min(iStage, N - 1)).head<3>(), t0 + iStage * param.dt,
+                                      kObstacleSlots);
+        result.brute_force_time.add(now_ms() - t_start);
+
+        // closed loop with the model
+        InputVector u(0.0, 0.0, 1.0 * g);
+        if (solver) {
+            warm_start.build(feasible, x, x_plan, u_plan, yref, x_init, u_init);
+            t_start = now_ms();
+            for (int iStage = 0; iStage <= N; iStage++)
+                solver->set_stage_obstacles(iStage, slots[iStage]);
+            solver->set_x0(x);
+            solver->set_yref(yref, yref_e);
+            solver->set_x_init(x_init);
+            solver->set_u_init(u_init);
+            const int status = solver->solve();
+            result.solve_time.add(now_ms() - t_start);
+            feasible = (status == 0);
+            if (feasible) {
+                solver->get_x_traj(x_plan);
+                solver->get_u_traj(u_plan);
+                u = u_plan.col(0);
+            } else {
+                result.failures++;
+            }
+        }
+        for (int iStep = 0; iStep < 5; iStep++)
+            x = integrate_mav_dynamics(param, x, u, kCycleDt / 5);
+        result.squared_error_sum += (x.head<3>() - circle(t0 + kCycleDt).head<3>()).squaredNorm();
+        for (const Obstacle &obstacle : obstacles) {
+            const Eigen::Vector3d offset = x.head<3>() - obstacle.position_at(t0 + kCycleDt);
+            if (offset.cwiseQuotient(obstacle.radii).squaredNorm() < 1.0) {
+                result.collisions++;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+    // the linked solver if it has the obstacle constraints, else the variant given
+    std::shared_ptr<const SolverLibrary> library = SolverLibrary::linked();
+    if (argc > 2) {
+        try {
+            library = SolverLibrary::load(read_solver_descriptor(argv[2]));
+        } catch (const std::exception &e) {
+            fprintf(stderr, "%s not loaded: %s\n", argv[2], e.what());
+            return 1;
+        }
+    }
+    MpcFormulationParam param;
+    if (library->descriptor().nh != kObstacleSlots) {
+        printf("The solver has no obstacle constraints, only the preselection is timed.\n");
+        library.reset();
+    }
+
+    const int counts[] = {0, 10, 50, 100, 200, 500, 1000};
+    printf("%d cycles of %.0f ms on a circle, %d stages, %d slots per stage\n\n", n_cycles, kCycleDt * 1000.0,
+           param.N, kObstacleSlots);
+    LatencyStats::print_header();
+    for (int count : counts) {
+        const CountResult result = run_count(param, library, count, n_cycles);
+        char name[64];
+        snprintf(name, sizeof(name), "%d obstacles, grid", count);
+        result.index_time.print(name);
+        snprintf(name, sizeof(name), "%d obstacles, all tested", count);
+        result.brute_force_time.print(name);
+        if (library) {
+            snprintf(name, sizeof(name), "%d obstacles, solve", count);
+            result.solve_time.print(name);
+        }
+        printf("%28s tests per stage %.1f, failures %d, collisions %d, pos error rms %.4f m\n", "",
+               result.tests_sum / (static_cast<double>(n_cycles) * param.N), result.failures, result.collisions,
+               std::sqrt(result.squared_error_sum / n_cycles));
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Cost per cycle of evaluating a piecewise polynomial reference at the stage times.
+//
+// A trajectory of 10 segments of 0.5 to 1.5 s with random coefficients of 4 to 10 terms is evaluated at
+// the stages of the uniform and of a geometric grid, position, velocity and acceleration, each cycle
+// 25 ms later. Horner's scheme over the stages of a segment at once is compared to evaluating the
+// powers stage by stage.
+//
+// usage: polynomial_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/polynomial_trajectory.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kCycleDt = 0.025;
+
+std::vector<PolynomialSegment> make_segments(int n_coeffs)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> duration(0.5, 1.5), coefficient(-1.0, 1.0);
+    std::vector<PolynomialSegment> segments(10);
+    for (PolynomialSegment &segment : segments) {
+        segment.duration = duration(rng);
+        segment.coefficients.resize(3, n_coeffs);
+        for (int k = 0; k < n_coeffs; k++)
+            segment.coefficients.col(k) << coefficient(rng), coefficient(rng), coefficient(rng);
+    }
+    return segments;
+}
+
+// stage by stage, the segment searched from the start and the powers of its time
+void evaluate_powers(const std::vector<PolynomialSegment> &segments, double t0, const std::vector<double> &offsets,
+                     Eigen::Matrix3Xd &positions, Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd &accelerations)
+{
+    const int n = static_cast<int>(offsets.size());
+    positions.setZero(3, n);
+    velocities.setZero(3, n);
+    accelerations.setZero(3, n);
+    for (int i = 0; i < n; i++) {
+        double start = 0.0;
+        size_t iSegment = 0;
+        while (iSegment + 1 < segments.size() && t0 + offsets[i] >= start + segments[iSegment].duration)
+            start += segments[iSegment++].duration;
+        const double t = std::min(t0 + offsets[i] - start, segments[iSegment].duration);
+        const Eigen::Matrix<double, 3, Eigen::Dynamic> &c = segments[iSegment].coefficients;
+        for (int k = 0; k < c.cols(); k++) {
+            positions.col(i) += c.col(k) * std::pow(t, k);
+            if (k >= 1)
+                velocities.col(i) += k * c.col(k) * std::pow(t, k - 1);
+            if (k >= 2)
+                accelerations.col(i) += k * (k - 1) * c.col(k) * std::pow(t, k - 2);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const MpcFormulationParam param;
+    std::vector<double> uniform_times = stage_times(horizon_time_steps(param));
+    uniform_times.pop_back();
+    std::vector<double> geometric_times = stage_times(geometric_time_steps(10, param.Tf, 1.2));
+    geometric_times.pop_back();
+
+    printf("%d cycles of %.0f ms, 10 segments\n\n", n_cycles, kCycleDt * 1000.0);
+    LatencyStats::print_header("us");
+    const int coeff_counts[] = {4, 6, 8, 10};
+    for (int n_coeffs : coeff_counts) {
+        const std::vector<PolynomialSegment> segments = make_segments(n_coeffs);
+        PolynomialTrajectory trajectory;
+        trajectory.set(0.0, segments);
+        LatencyStats horner_time, geometric_time, powers_time;
+        Eigen::Matrix3Xd positions, velocities, accelerations;
+        Eigen::Matrix3Xd positions_powers, velocities_powers, accelerations_powers;
+        double max_difference = 0.0;
+        for (int k = 0; k < n_cycles; k++) {
+            const double t0 = std::fmod(k * kCycleDt, trajectory.end_time());
+            double t_start = now_ms();
+            trajectory.evaluate(t0, uniform_times, positions, velocities, &accelerations);
+            horner_time.add(1000.0 * (now_ms() - t_start));
+            t_start = now_ms();
+            evaluate_powers(segments, t0, uniform_times, positions_powers, velocities_powers, accelerations_powers);
+            powers_time.add(1000.0 * (now_ms() - t_start));
+            max_difference = std::max(max_difference, (positions - positions_powers).cwiseAbs().maxCoeff());
+            t_start = now_ms();
+            trajectory.evaluate(t0, geometric_times, positions, velocities, &accelerations);
+            geometric_time.add(1000.0 * (now_ms() - t_start));
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "%d coeffs, Horner", n_coeffs);
+        horner_time.print(name);
+        snprintf(name, sizeof(name), "%d coeffs, Horner geometric", n_coeffs);
+        geometric_time.print(name);
+        snprintf(name, sizeof(name), "%d coeffs, powers", n_coeffs);
+        powers_time.print(name);
+        printf("%28s max difference %.2e m\n", "", max_difference);
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Solve time, QP iterations and tracking error of the QP solvers over the horizon length.
+//
+// The linked solver (full condensing qpOASES) and the generated variants given by their json,
+// e.g. PARTIAL_CONDENSING_HPIPM from
+//   scripts/nmpc_tracker_solver.py --variant hpipm --qp_solver PARTIAL_CONDENSING_HPIPM --cond_N 5
+// are created with N in {10, 20, 40, 80} uniform steps of dt and fly the circle in closed loop
+// with the model, at 40 Hz cycles with the first control of each plan held in between.
+//
+// usage: qp_solver_benchmark [n_cycles] [variant.json ...]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/solver_library.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kOmega = 1.0, kCycleDt = 0.025;
+
+Eigen::Matrix<double, 6, 1> circle(double t)
+{
+    Eigen::Matrix<double, 6, 1> pos_vel;
+    pos_vel << kRadius * std::cos(kOmega * t), kRadius * std::sin(kOmega * t), 1.0,
+        -kRadius * kOmega * std::sin(kOmega * t), kRadius * kOmega * std::cos(kOmega * t), 0.0;
+    return pos_vel;
+}
+
+struct HorizonResult {
+    LatencyStats solve_time;
+    double qp_iter_sum = 0.0;
+    int qp_iter_max = 0;
+    int failures = 0;
+    double squared_error_sum = 0.0;  // position
+};
+
+HorizonResult run_horizon(const MpcFormulationParam &param, std::shared_ptr<const SolverLibrary> library,
+                          int N, int n_cycles)
+{
+    MpcFormulationParam horizon_param = param;
+    horizon_param.N = N;
+    horizon_param.Tf = N * param.dt;
+    horizon_param.time_steps.assign(N, param.dt);
+    NmpcTrackerSolver solver(horizon_param, library, horizon_param.time_steps);
+    WarmStart warm_start(horizon_param);
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N);
+    RefTrajectory yref(kNy, N);
+
+    HorizonResult result;
+    StateVector x = StateVector::Zero();
+    x.head<6>() = circle(0.0);
+    bool feasible = false;
+    for (int k = 0; k < n_cycles; k++) {
+        const double t0 = k * kCycleDt;
+        for (int iStage = 0; iStage < N; iStage++)
+            yref.col(iStage) << circle(t0 + iStage * param.dt), 0.0, 0.0, g;
+        const TerminalRefVector yref_e = yref.col(N - 1).head<kNyE>();
+        warm_start.build(feasible, x, x_plan, u_plan, yref, x_init, u_init);
+
+        const double t_start = now_ms();
+        solver.set_x0(x);
+        solver.set_yref(yref, yref_e);
+        solver.set_x_init(x_init);
+        solver.set_u_init(u_init);
+        const int status = solver.solve();
+        result.solve_time.add(now_ms() - t_start);
+        result.qp_iter_sum += solver.get_qp_iter();
+        result.qp_iter_max = std::max(result.qp_iter_max, solver.get_qp_iter());
+
+        feasible = (status == 0);
+        InputVector u(0.0, 0.0, 1.0 * g);
+        if (feasible) {
+            solver.get_x_traj(x_plan);
+            solver.get_u_traj(u_plan);
+            u = u_plan.col(0);
+        } else {
+            result.failures++;
+        }
+        for (int iStep = 0; iStep < 5; iStep++)
+            x = integrate_mav_dynamics(param, x, u, kCycleDt / 5);
+        result.squared_error_sum += (x.head<3>() - circle(t0 + kCycleDt).head<3>()).squaredNorm();
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+    std::vector<std::shared_ptr<const SolverLibrary>> libraries{SolverLibrary::linked()};
+    for (int iArg = 2; iArg < argc; iArg++) {
+        try {
+            libraries.push_back(SolverLibrary::load(read_solver_descriptor(argv[iArg])));
+        } catch (const std::exception &e) {
+            fprintf(stderr, "%s not loaded: %s\n", argv[iArg], e.what());
+            return 1;
+        }
+    }
+
+    MpcFormulationParam param;
+    const int horizons[] = {10, 20, 40, 80};
+    printf("%d cycles of %.0f ms on a circle, steps of %.0f ms\n\n", n_cycles, kCycleDt * 1000.0,
+           param.dt * 1000.0);
+    LatencyStats::print_header();
+    for (const std::shared_ptr<const SolverLibrary> &library : libraries) {
+        for (int N : horizons) {
+            const HorizonResult result = run_horizon(param, library, N, n_cycles);
+            // FULL_CONDENSING_QPOASES as "FULL QPOASES"
+            std::string qp_solver = library->descriptor().qp_solver;
+            const size_t condensing = qp_solver.find("_CONDENSING_");
+            if (condensing != std::string::npos)
+                qp_solver.replace(condensing, 12, " ");
+            char name[64];
+            snprintf(name, sizeof(name), "%s, N = %d", qp_solver.c_str(), N);
+            result.solve_time.print(name);
+            printf("%28s qp iter mean %.2f max %d, failures %d, pos error rms %.4f m\n", "",
+                   result.qp_iter_sum / n_cycles, result.qp_iter_max, result.failures,
+                   std::sqrt(result.squared_error_sum / n_cycles));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+// Latency of the serial warm-then-reset solve against the speculative parallel solve.
+//
+// Both run the same sequence of circle tracking problems, where every kick_period-th
+// initial state gets a velocity and attitude kick to provoke failed warm starts.
+//
+// The speculative solve waits for the warm answer, or takes the reset one past deadline_ms, 0 for none.
+//
+// usage: speculative_solve_benchmark [n_cycles] [kick_period] [cpu_warm] [cpu_cold] [deadline_ms]
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/speculative_solver.h"
+#include "benchmark_problems.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 4000;
+    const int kick_period = argc > 2 ? std::atoi(argv[2]) : 50;
+    const int cpu_warm = argc > 3 ? std::atoi(argv[3]) : -1;
+    const int cpu_cold = argc > 4 ? std::atoi(argv[4]) : -1;
+    const double deadline_ms = argc > 5 ? std::atof(argv[5]) : 0.0;
+
+    MpcFormulationParam param;
+    const std::vector<Problem> problems = make_problems(param, n_cycles, kick_period);
+    const int N = param.N;
+
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1), x_cold(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N), u_cold(kNu, N);
+
+    // serial, the reset problem is solved only after the warm start failed
+    LatencyStats serial_stats;
+    int serial_retries = 0, serial_failures = 0;
+    {
+        NmpcTrackerSolver solver(param);
+        bool feasible = false;
+        for (const Problem &problem : problems) {
+            if (feasible)
+                shift_start(x_plan, u_plan, x_init, u_init);
+            else
+                hover_start(problem.x0, x_init, u_init);
+            const double t_start = now_ms();
+            solver.set_x0(problem.x0);
+            solver.set_yref(problem.yref, problem.yref_e);
+            solver.set_x_init(x_init);
+            solver.set_u_init(u_init);
+            int status = solver.solve();
+            if (status != 0) {
+                serial_retries++;
+                hover_start(problem.x0, x_init, u_init);
+                solver.set_x_init(x_init);
+                solver.set_u_init(u_init);
+                status = solver.solve();
+            }
+            serial_stats.add(now_ms() - t_start);
+            feasible = (status == 0);
+            serial_failures += feasible ? 0 : 1;
+            if (feasible) {
+                solver.get_x_traj(x_plan);
+                solver.get_u_traj(u_plan);
+            }
+        }
+    }
+
+    // speculative, both problems in parallel
+    LatencyStats speculative_stats;
+    int speculative_cold_used = 0, speculative_failures = 0;
+    {
+        SpeculativeSolver solver(param, cpu_warm, cpu_cold, deadline_ms / 1000.0);
+        bool feasible = false;
+        for (const Problem &problem : problems) {
+            hover_start(problem.x0, x_cold, u_cold);
+            if (feasible)
+                shift_start(x_plan, u_plan, x_init, u_init);
+            else
+                hover_start(problem.x0, x_init, u_init);
+            const double t_start = now_ms();
+            const NmpcTrackerSolver *result = solver.solve(problem.x0, problem.yref, problem.yref_e,
+                                                           x_init, u_init, x_cold, u_cold);
+            speculative_stats.add(now_ms() - t_start);
+            feasible = (result != nullptr);
+            speculative_failures += feasible ? 0 : 1;
+            if (feasible) {
+                speculative_cold_used += solver.last_used_cold() ? 1 : 0;
+                result->get_x_traj(x_plan);
+                result->get_u_traj(u_plan);
+            }
+        }
+    }
+
+    printf("%d cycles, N = %d, kick every %d cycles, deadline %.2f ms\n\n", n_cycles, N, kick_period, deadline_ms);
+    LatencyStats::print_header();
+    serial_stats.print("serial warm then reset");
+    speculative_stats.print("speculative warm | reset");
+    printf("\nserial: %d reset retries, %d failures\n", serial_retries, serial_failures);
+    printf("speculative: %d reset answers used, %d failures\n", speculative_cold_used, speculative_failures);
+    printf("p99 latency saved: %.3f ms\n", serial_stats.percentile(99) - speculative_stats.percentile(99));
+
+    return 0;
+}
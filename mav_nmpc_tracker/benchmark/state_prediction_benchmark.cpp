@@ -0,0 +1,117 @@
+// Cost per cycle of the odometry delay prediction with the acados sim solver.
+//
+// The state is predicted over delays of 5 to 80 ms with commands sent at cmd_rate, against
+// the hand written RK4 of the model with one step per command, and both are compared to a
+// finely stepped RK4 for the prediction error.
+//
+// usage: state_prediction_benchmark [n_cycles] [cmd_rate]
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "mav_nmpc_tracker/state_predictor.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+struct CommandSample {
+    double t;
+    InputVector u;
+};
+
+// piecewise constant commands from t_meas to t_target, nsub RK4 steps per piece
+StateVector predict_rk4(const MpcFormulationParam &param, const std::vector<CommandSample> &commands,
+                        const StateVector &x_meas, double t_meas, double t_target, int nsub)
+{
+    StateVector x = x_meas;
+    double t = t_meas;
+    // commands[0] is the one in effect at t_meas
+    for (size_t i = 0; i < commands.size() && t < t_target; i++) {
+        const double t_next = i + 1 < commands.size() ? std::min(commands[i + 1].t, t_target) : t_target;
+        if (t_next <= t)
+            continue;
+        const double dt = (t_next - t) / nsub;
+        for (int j = 0; j < nsub; j++)
+            x = integrate_mav_dynamics(param, x, commands[i].u, dt);
+        t = t_next;
+    }
+    return x;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 5000;
+    const double cmd_rate = argc > 2 ? std::atof(argv[2]) : 40.0;
+
+    MpcFormulationParam param;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    const double delays[] = {0.005, 0.01, 0.02, 0.04, 0.08};
+
+    printf("%d cycles, commands at %.0f Hz\n\n", n_cycles, cmd_rate);
+    LatencyStats::print_header("us");
+    for (double delay : delays) {
+        // one command stream for the whole run
+        std::vector<CommandSample> commands;
+        for (double t = 0.0; t <= 1.0 + n_cycles * 0.025; t += 1.0 / cmd_rate) {
+            CommandSample command;
+            command.t = t;
+            command.u << 0.3 * uniform(rng), 0.3 * uniform(rng), g + 3.0 * uniform(rng);
+            commands.push_back(command);
+        }
+
+        StatePredictor predictor(0.2);
+        LatencyStats sim_stats, rk4_stats;
+        double sim_error = 0.0, rk4_error = 0.0;
+        int steps = 0;
+        size_t n_sent = 0, i_first = 0;
+        std::vector<CommandSample> window;
+
+        for (int k = 0; k < n_cycles; k++) {
+            // the state measured delay before now, with the commands sent until now
+            const double t_now = 1.0 + k * 0.025;
+            const double t_meas = t_now - delay;
+            for (; n_sent < commands.size() && commands[n_sent].t <= t_now; n_sent++)
+                predictor.add_command(commands[n_sent].t, commands[n_sent].u);
+            while (i_first + 1 < n_sent && commands[i_first + 1].t <= t_meas)
+                i_first++;
+            window.assign(commands.begin() + i_first, commands.begin() + n_sent);
+
+            StateVector x_meas;
+            x_meas << uniform(rng), uniform(rng), 1.0, 2.0 * uniform(rng), 2.0 * uniform(rng),
+                0.5 * uniform(rng), 0.2 * uniform(rng), 0.2 * uniform(rng), M_PI * uniform(rng);
+
+            double t_start = now_ms();
+            const StateVector x_sim = predictor.predict(x_meas, t_meas, t_now);
+            sim_stats.add((now_ms() - t_start) * 1000.0);
+            steps += predictor.last_steps();
+
+            t_start = now_ms();
+            const StateVector x_rk4 = predict_rk4(param, window, x_meas, t_meas, t_now, 1);
+            rk4_stats.add((now_ms() - t_start) * 1000.0);
+
+            const StateVector x_true = predict_rk4(param, window, x_meas, t_meas, t_now, 50);
+            sim_error += (x_sim - x_true).head<6>().norm();
+            rk4_error += (x_rk4 - x_true).head<6>().norm();
+        }
+
+        char name[64];
+        snprintf(name, sizeof(name), "acados sim, %2.0f ms", delay * 1000.0);
+        sim_stats.print(name);
+        snprintf(name, sizeof(name), "rk4 one step, %2.0f ms", delay * 1000.0);
+        rk4_stats.print(name);
+        printf("%28s %.2f sim_solve calls per cycle, pos/vel error sim %.2e, rk4 %.2e\n", "",
+               static_cast<double>(steps) / n_cycles, sim_error / n_cycles, rk4_error / n_cycles);
+    }
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Reference error and cost of the time-indexed trajectory buffer against the points copied by index.
+//
+// The circle of the other benchmarks is published as points dt apart, each message late by 0 to 50 ms.
+// Copied by index, as the tracker did before, the first point is taken as now and the reference lags
+// by the delay; from the buffer it is evaluated at the stage times, on the uniform and on a geometric
+// grid. The error left there is of the last stages, past the end of a late message and held. Once the
+// whole circle is sent in one message instead, a cycle parses nothing.
+//
+// usage: trajectory_buffer_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/trajectory_buffer.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kOmega = 1.0, kCycleDt = 0.025;
+
+TrajectorySample circle(double t)
+{
+    TrajectorySample sample;
+    sample.time = t;
+    sample.position << kRadius * std::cos(kOmega * t), kRadius * std::sin(kOmega * t), 1.0;
+    sample.velocity << -kRadius * kOmega * std::sin(kOmega * t), kRadius * kOmega * std::cos(kOmega * t), 0.0;
+    return sample;
+}
+
+std::vector<TrajectorySample> message(double start, int points, double dt)
+{
+    std::vector<TrajectorySample> samples(points);
+    for (int i = 0; i < points; i++)
+        samples[i] = circle(start + i * dt);
+    return samples;
+}
+
+struct Result {
+    LatencyStats time;  // us per cycle, message insertion and evaluation
+    double squared_error_sum = 0.0;
+    int count = 0;
+};
+
+void add_error(Result &result, double t0, const std::vector<double> &times, const Eigen::Matrix3Xd &positions)
+{
+    for (size_t i = 0; i < times.size(); i++) {
+        result.squared_error_sum += (positions.col(i) - circle(t0 + times[i]).position).squaredNorm();
+        result.count++;
+    }
+}
+
+void print(const char *name, const Result &result)
+{
+    result.time.print(name);
+    printf("%28s pos error rms %.4f m\n", "", std::sqrt(result.squared_error_sum / std::max(result.count, 1)));
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const MpcFormulationParam param;
+    const int N = param.N;
+    // the start times of the stages, without the end of the horizon, as in the tracker
+    std::vector<double> uniform_times = stage_times(horizon_time_steps(param));
+    uniform_times.pop_back();
+    std::vector<double> geometric_times = stage_times(geometric_time_steps(10, param.Tf, 1.2));
+    geometric_times.pop_back();
+
+    const double delays[] = {0.0, 0.01, 0.025, 0.05};
+    printf("%d cycles of %.0f ms on a circle, %d points %.2f s apart per message\n\n", n_cycles,
+           kCycleDt * 1000.0, N, param.dt);
+    LatencyStats::print_header("us");
+    for (double delay : delays) {
+        Result by_index, uniform, geometric;
+        TrajectoryBuffer buffer;
+        Eigen::Matrix3Xd positions(3, N), velocities(3, N);
+        for (int k = 0; k < n_cycles; k++) {
+            const double t0 = k * kCycleDt;
+            // the message of a planner delay ago, points dt apart from its stamp
+            const std::vector<TrajectorySample> samples = message(t0 - delay, N, param.dt);
+
+            positions.resize(3, N);
+            double t_start = now_ms();
+            for (int iStage = 0; iStage < N; iStage++)
+                positions.col(iStage) = samples[iStage].position;
+            by_index.time.add(1000.0 * (now_ms() - t_start));
+            add_error(by_index, t0, uniform_times, positions);
+
+            t_start = now_ms();
+            buffer.insert(samples);
+            buffer.drop_before(t0);
+            buffer.evaluate(t0, uniform_times, positions, velocities);
+            uniform.time.add(1000.0 * (now_ms() - t_start));
+            add_error(uniform, t0, uniform_times, positions);
+
+            t_start = now_ms();
+            buffer.evaluate(t0, geometric_times, positions, velocities);
+            geometric.time.add(1000.0 * (now_ms() - t_start));
+            add_error(geometric, t0, geometric_times, positions);
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "%.0f ms late, by index", delay * 1000.0);
+        print(name, by_index);
+        snprintf(name, sizeof(name), "%.0f ms late, buffer", delay * 1000.0);
+        print(name, uniform);
+        snprintf(name, sizeof(name), "%.0f ms late, buffer geometric", delay * 1000.0);
+        print(name, geometric);
+    }
+
+    // the whole circle once, the cycles only evaluate
+    Result once;
+    const int points = static_cast<int>((n_cycles * kCycleDt + param.Tf) / param.dt) + 2;
+    TrajectoryBuffer buffer(points);
+    buffer.insert(message(0.0, points, param.dt));
+    Eigen::Matrix3Xd positions(3, N), velocities(3, N);
+    for (int k = 0; k < n_cycles; k++) {
+        const double t0 = k * kCycleDt;
+        const double t_start = now_ms();
+        buffer.drop_before(t0);
+        buffer.evaluate(t0, uniform_times, positions, velocities);
+        once.time.add(1000.0 * (now_ms() - t_start));
+        add_error(once, t0, uniform_times, positions);
+    }
+    print("sent once, buffer", once);
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Cost of playing a pre-planned mission from a memory-mapped trajectory library.
+//
+// Missions of 10^5 to 10^7 samples of the circle of the other benchmarks, 10 ms apart with a segment
+// per minute, are written to /tmp. Opening one maps it and reads the segment index only; reading the
+// whole file into memory is timed against it. Each cycle, 25 ms later, the uniform stages are evaluated
+// with their acceleration and yaw, walking on from the last cycle; every 100th cycle seeks to a random
+// mission time first, which needs a binary search. Both should stay flat over the mission length.
+//
+// usage: trajectory_library_benchmark [n_cycles]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/trajectory_library.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+const double kRadius = 2.0, kOmega = 1.0, kCycleDt = 0.025, kSampleDt = 0.01;
+const int kSegmentSamples = 6000;
+
+LibrarySample circle(double t)
+{
+    LibrarySample sample;
+    const double c = std::cos(kOmega * t), s = std::sin(kOmega * t);
+    sample.time = t;
+    sample.position[0] = kRadius * c;
+    sample.position[1] = kRadius * s;
+    sample.position[2] = 1.0;
+    sample.velocity[0] = -kRadius * kOmega * s;
+    sample.velocity[1] = kRadius * kOmega * c;
+    sample.velocity[2] = 0.0;
+    sample.acceleration[0] = -kRadius * kOmega * kOmega * c;
+    sample.acceleration[1] = -kRadius * kOmega * kOmega * s;
+    sample.acceleration[2] = 0.0;
+    sample.yaw = std::atan2(sample.velocity[1], sample.velocity[0]);
+    return sample;
+}
+
+std::string write_library(long long sample_count)
+{
+    std::vector<LibrarySample> samples(sample_count);
+    std::vector<int64_t> segment_starts;
+    for (long long i = 0; i < sample_count; i++) {
+        samples[i] = circle(i * kSampleDt);
+        if (i % kSegmentSamples == 0)
+            segment_starts.push_back(i);
+    }
+    const std::string path = "/tmp/trajectory_library_benchmark_" + std::to_string(sample_count) + ".traj";
+    TrajectoryLibrary::write(path, samples, segment_starts);
+    return path;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const MpcFormulationParam param;
+    std::vector<double> uniform_times = stage_times(horizon_time_steps(param));
+    uniform_times.pop_back();
+
+    printf("%d cycles of %.0f ms, samples %.0f ms apart, a seek every 100 cycles\n\n", n_cycles,
+           kCycleDt * 1000.0, kSampleDt * 1000.0);
+    LatencyStats::print_header("us");
+    const long long sample_counts[] = {100000, 1000000, 10000000};
+    for (long long sample_count : sample_counts) {
+        const std::string path = write_library(sample_count);
+
+        double t_start = now_ms();
+        TrajectoryLibrary library(path);
+        const double open_time = now_ms() - t_start;
+        t_start = now_ms();
+        std::ifstream file(path, std::ios::binary);
+        const std::vector<char> loaded((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const double load_time = now_ms() - t_start;
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> mission_time(library.start_time(), library.end_time());
+        LatencyStats cycle_time, seek_time;
+        Eigen::Matrix3Xd positions, velocities, accelerations;
+        Eigen::VectorXd yaws;
+        double squared_error_sum = 0.0;
+        double t0 = 0.0;
+        for (int k = 0; k < n_cycles; k++) {
+            const bool seek = k % 100 == 0;
+            t0 = seek ? mission_time(rng) : t0 + kCycleDt;
+            t_start = now_ms();
+            library.evaluate(t0, uniform_times, positions, velocities, &accelerations, &yaws);
+            (seek ? seek_time : cycle_time).add(1000.0 * (now_ms() - t_start));
+            for (size_t i = 0; i < uniform_times.size(); i++) {
+                const LibrarySample expected = circle(std::min(t0 + uniform_times[i], library.end_time()));
+                squared_error_sum += (positions.col(i) - Eigen::Map<const Eigen::Vector3d>(expected.position))
+                                         .squaredNorm();
+            }
+        }
+        printf("%lld samples, %.0f MB: open %.3f ms, read into memory %.1f ms\n", sample_count,
+               loaded.size() / 1e6, open_time, load_time);
+        cycle_time.print("cycle");
+        seek_time.print("cycle after a seek");
+        printf("%28s pos error rms %.2e m, %lu binary searches\n", "",
+               std::sqrt(squared_error_sum / (n_cycles * uniform_times.size())), library.searches());
+        std::remove(path.c_str());
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+// QP iterations and infeasible returns per cycle of the warm start strategies.
+//
+// All strategies run the same sequence of circle tracking problems with state kicks every
+// kick_period-th cycle and reference jumps every jump_period-th cycle. A failed solve is
+// retried from the hover reset, as in the tracker.
+//
+// usage: warm_start_benchmark [n_cycles] [kick_period] [jump_period]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/warm_start.h"
+#include "benchmark_problems.h"
+#include "benchmark_stats.h"
+
+using namespace mav_nmpc_tracker;
+using namespace mav_nmpc_tracker::benchmark;
+
+namespace {
+
+enum class Method { kLegacy, kShift, kReference, kAdaptive };
+
+struct MethodResult {
+    LatencyStats solve_time;
+    double qp_iter_sum = 0.0;
+    int qp_iter_max = 0;
+    int infeasible = 0;  // first solve of the cycle infeasible
+    int failures = 0;    // infeasible after the retry as well
+};
+
+MethodResult run_method(Method method, const MpcFormulationParam &param, const std::vector<Problem> &problems)
+{
+    const int N = param.N;
+    NmpcTrackerSolver solver(param);
+    WarmStart warm_start(param);
+    StateTrajectory x_plan(kNx, N + 1), x_init(kNx, N + 1);
+    InputTrajectory u_plan(kNu, N), u_init(kNu, N);
+
+    MethodResult result;
+    bool feasible = false;
+    for (const Problem &problem : problems) {
+        switch (method) {
+        case Method::kLegacy:
+            // the python tracker, the last stage repeated
+            if (feasible)
+                shift_start(x_plan, u_plan, x_init, u_init);
+            else
+                hover_start(problem.x0, x_init, u_init);
+            break;
+        case Method::kShift:
+            warm_start.build_strategy(feasible ? WarmStartStrategy::kShift : WarmStartStrategy::kHover, problem.x0,
+                                      x_plan, u_plan, problem.yref, x_init, u_init);
+            break;
+        case Method::kReference:
+            warm_start.build_strategy(WarmStartStrategy::kReference, problem.x0, x_plan, u_plan, problem.yref,
+                                      x_init, u_init);
+            break;
+        case Method::kAdaptive:
+            warm_start.build(feasible, problem.x0, x_plan, u_plan, problem.yref, x_init, u_init);
+            break;
+        }
+
+        const double t_start = now_ms();
+        solver.set_x0(problem.x0);
+        solver.set_yref(problem.yref, problem.yref_e);
+        solver.set_x_init(x_init);
+        solver.set_u_init(u_init);
+        int status = solver.solve();
+        int qp_iter = solver.get_qp_iter();
+        if (status != 0) {
+            result.infeasible++;
+            hover_start(problem.x0, x_init, u_init);
+            solver.set_x_init(x_init);
+            solver.set_u_init(u_init);
+            status = solver.solve();
+            qp_iter += solver.get_qp_iter();
+        }
+        result.solve_time.add(now_ms() - t_start);
+        result.qp_iter_sum += qp_iter;
+        result.qp_iter_max = std::max(result.qp_iter_max, qp_iter);
+
+        feasible = (status == 0);
+        result.failures += feasible ? 0 : 1;
+        if (feasible) {
+            solver.get_x_traj(x_plan);
+            solver.get_u_traj(u_plan);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const int n_cycles = argc > 1 ? std::atoi(argv[1]) : 4000;
+    const int kick_period = argc > 2 ? std::atoi(argv[2]) : 80;
+    const int jump_period = argc > 3 ? std::atoi(argv[3]) : 120;
+
+    MpcFormulationParam param;
+    const std::vector<Problem> problems = make_problems(param, n_cycles, kick_period, jump_period);
+
+    const Method methods[] = {Method::kLegacy, Method::kShift, Method::kReference, Method::kAdaptive};
+    const char *names[] = {"shift, last stage repeated", "shift, last stage integrated", "reference",
+                           "adaptive"};
+    std::vector<MethodResult> results;
+    for (Method method : methods)
+        results.push_back(run_method(method, param, problems));
+
+    printf("%d cycles, N = %d, kick every %d, reference jump every %d cycles\n\n", n_cycles, param.N,
+           kick_period, jump_period);
+    printf("%-28s %12s %12s %12s %12s\n", "", "qp iter mean", "qp iter max", "infeasible", "failures");
+    for (size_t i = 0; i < results.size(); i++)
+        printf("%-28s %12.2f %12d %12d %12d\n", names[i], results[i].qp_iter_sum / n_cycles,
+               results[i].qp_iter_max, results[i].infeasible, results[i].failures);
+    printf("\n");
+    LatencyStats::print_header();
+    for (size_t i = 0; i < results.size(); i++)
+        results[i].solve_time.print(names[i]);
+
+    return 0;
+}
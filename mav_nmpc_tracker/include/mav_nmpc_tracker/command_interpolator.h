@@ -0,0 +1,106 @@
+#ifndef MAV_NMPC_TRACKER_COMMAND_INTERPOLATOR_H
+#define MAV_NMPC_TRACKER_COMMAND_INTERPOLATOR_H
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+// Commands between two solves, read off the last plan at the time they are sent instead of holding its
+// first control for the whole cycle, with an optional feedback of the odometry on the planned state.
+// The plan and the odometry reach the output thread through triple buffers, neither side waits.
+
+namespace mav_nmpc_tracker {
+
+// Latest value from one writer thread to one reader thread without locks. The writer fills back() and
+// publishes it, the reader takes the newest one published with update(); each owns its own buffer and
+// the third one is swapped between them.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : middle_(1), back_(2), front_(0) {}
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // writer
+    T &back() { return buffers_[back_]; }
+    void publish() { back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & kIndex; }
+
+    // reader, true if a newer value was published since the last update
+    bool update()
+    {
+        if (!(middle_.load(std::memory_order_acquire) & kFresh))
+            return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndex;
+        return true;
+    }
+    const T &front() const { return buffers_[front_]; }
+
+private:
+    static constexpr int kIndex = 3;
+    static constexpr int kFresh = 4;
+
+    T buffers_[3];
+    std::atomic<int> middle_;  // index of the buffer in between, kFresh if published and not taken yet
+    int back_;                 // of the writer
+    int front_;                // of the reader
+};
+
+// The plan of one control cycle, handed to the output thread
+struct CommandPlan {
+    bool valid = false;               // a feasible plan, else the fallback is held
+    double start_time = 0.0;          // s, of the first stage, the time the plan starts from its initial state
+    std::vector<double> stage_times;  // from the first stage, N + 1 entries with the end of the horizon
+    StateTrajectory x;                // N + 1 stages
+    InputTrajectory u;                // N stages
+    InputVector fallback = InputVector(0.0, 0.0, g);  // the command of the cycle, model units
+    double yaw_ref = 0.0;             // rad
+    double yawrate_cmd = 0.0;         // rad/s, of the cycle, held with the fallback without fresh odometry
+    double thrust_cmd_scale = 1.0;    // thrust command per mass divided thrust, mass / thrust_scale
+    MpcFormulationParam model;        // the model the plan was solved with, of the feedback
+};
+
+// A state measured at a time, the odometry for the output thread
+struct StateSample {
+    double time = -std::numeric_limits<double>::infinity();  // s
+    StateVector state = StateVector::Zero();
+};
+
+struct CommandInterpolatorParam {
+    // controls linearly interpolated between the stages, else held over each stage as in the plan
+    bool linear = true;
+    // acceleration of the feedback on the planned state, 1/s^2 of the position and 1/s of the velocity
+    // error, through the attitude and thrust of the flat model; 0 for none
+    double kp = 0.0;
+    double kd = 0.0;
+};
+
+class CommandInterpolator {
+public:
+    explicit CommandInterpolator(const CommandInterpolatorParam &param = CommandInterpolatorParam())
+        : param_(param)
+    {
+    }
+
+    // Command at time in model units, within the input limits of the plan's model. The measured state, if
+    // not nullptr, is compared with the plan at its own time. Returns false and the fallback for a plan
+    // that is not valid or has run out.
+    bool command(const CommandPlan &plan, double time, const StateSample *measured, InputVector &u) const;
+
+    // planned state at time, linearly interpolated between the stages, held at both ends
+    static StateVector plan_state(const CommandPlan &plan, double time);
+
+    const CommandInterpolatorParam &param() const { return param_; }
+
+private:
+    // stage of time and the ratio into it, clamped to the stages of the plan
+    static void locate(const std::vector<double> &stage_times, double time, int &iStage, double &ratio);
+
+    CommandInterpolatorParam param_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_COMMAND_INTERPOLATOR_H
@@ -0,0 +1,55 @@
+#ifndef MAV_NMPC_TRACKER_CORRIDOR_H
+#define MAV_NMPC_TRACKER_CORRIDOR_H
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+// Safe flight corridors as polytopes A p <= b of the position, at most kCorridorFaces faces, and
+// their assignment to the stages of the horizon.
+
+namespace mav_nmpc_tracker {
+
+// general linear constraints per stage of a solver generated with --corridor_faces
+constexpr int kCorridorFaces = 6;
+
+struct Corridor {
+    Eigen::Matrix<double, kCorridorFaces, 3> A = Eigen::Matrix<double, kCorridorFaces, 3>::Zero();
+    Eigen::Matrix<double, kCorridorFaces, 1> b = Eigen::Matrix<double, kCorridorFaces, 1>::Zero();
+    int faces = 0;  // rows of A and b in use
+
+    // largest of A p - b over the faces, <= 0 inside
+    double violation(const Eigen::Vector3d &p) const;
+    bool contains(const Eigen::Vector3d &p, double margin = 0.0) const { return violation(p) <= -margin; }
+    bool operator==(const Corridor &other) const;
+};
+
+// box of the given center, orientation and edge lengths, a CUBE marker
+Corridor box_corridor(const Eigen::Vector3d &center, const Eigen::Quaterniond &orientation,
+                      const Eigen::Vector3d &size);
+
+// Corridors in the order of the path, the stages assigned to them in order as well. Each cycle
+// starts from the corridor of the first stage of the last one and only moves forward along the path,
+// a few corridors at most, so a stage is tested against one or two corridors, not all of them.
+class CorridorAssigner {
+public:
+    void set_corridors(const std::vector<Corridor> &corridors);
+    const std::vector<Corridor> &corridors() const { return corridors_; }
+
+    // index of the corridor of each position, -1 without corridors; a position outside of all of them
+    // keeps the corridor of the stage before it
+    const std::vector<int> &assign(const Eigen::Matrix3Xd &positions);
+    // corridor tests of the last assign(), for the benchmarks
+    int tests() const { return tests_; }
+
+private:
+    std::vector<Corridor> corridors_;
+    std::vector<int> stage_corridors_;
+    int first_corridor_ = 0;
+    int tests_ = 0;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_CORRIDOR_H
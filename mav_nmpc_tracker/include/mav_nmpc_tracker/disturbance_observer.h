@@ -0,0 +1,44 @@
+#ifndef MAV_NMPC_TRACKER_DISTURBANCE_OBSERVER_H
+#define MAV_NMPC_TRACKER_DISTURBANCE_OBSERVER_H
+
+#include <Eigen/Core>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+// Constant acceleration offset, wind or a payload, from the velocity the model predicts with the
+// command sent against the one measured. One RK4 step per odometry sample.
+
+namespace mav_nmpc_tracker {
+
+struct DisturbanceObserverParam {
+    double gain = 0.05;             // per sample, of the velocity prediction error
+    double max_sample_dt = 0.2;     // s, a longer gap between two samples skips the update
+    double disturbance_max = 3.0;   // m/s^2, per axis
+};
+
+class DisturbanceObserver {
+public:
+    explicit DisturbanceObserver(const MpcFormulationParam &param,
+                                 const DisturbanceObserverParam &observer_param = DisturbanceObserverParam());
+
+    // state measured at time t, u the command in model units held since the previous sample
+    void update(double t, const StateVector &x, const InputVector &u);
+    void reset();
+    // model without the disturbance fields, e.g. with the identified parameters
+    void set_model(const MpcFormulationParam &param);
+
+    // mass divided force
+    const Eigen::Vector3d &disturbance() const { return disturbance_; }
+
+private:
+    MpcFormulationParam param_;
+    DisturbanceObserverParam observer_param_;
+    Eigen::Vector3d disturbance_;
+    bool has_last_;
+    double last_time_;
+    StateVector last_x_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_DISTURBANCE_OBSERVER_H
@@ -0,0 +1,107 @@
+#ifndef MAV_NMPC_TRACKER_ESDF_MAP_H
+#define MAV_NMPC_TRACKER_ESDF_MAP_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+// Euclidean signed distance field on a dense grid in a memory-mapped file, looked up with trilinear
+// interpolation and its analytic gradient. The voxel blocks touched are copied into a small cache kept
+// between the cycles, the stages of consecutive RTI iterations fall into the same few blocks.
+//
+// File: EsdfHeader, then size x * y * z float32 distances in m, x fastest. Voxel (i, j, k) is at
+// origin + resolution * (i, j, k).
+
+namespace mav_nmpc_tracker {
+
+// general linear constraints per stage of a solver generated with --esdf_rows, after the corridor faces
+constexpr int kEsdfRows = 1;
+
+// the distance of a stage linearized at a point, gradient . p >= bound, none if not active
+struct EsdfConstraint {
+    Eigen::Vector3d gradient = Eigen::Vector3d::Zero();
+    double bound = 0.0;
+    bool active = false;
+
+    bool operator==(const EsdfConstraint &other) const
+    {
+        return active == other.active && (!active || (gradient == other.gradient && bound == other.bound));
+    }
+};
+
+struct EsdfHeader {
+    char magic[8];     // "ESDF0001"
+    int32_t size[3];
+    int32_t reserved;
+    double origin[3];  // m
+    double resolution; // m
+};
+
+class EsdfMap {
+public:
+    // maps the file read only, cache_blocks blocks of kBlock^3 cells are cached, rounded up to a power
+    // of 2; throws std::runtime_error if it cannot be mapped or is not a distance field
+    explicit EsdfMap(const std::string &path, int cache_blocks = 256);
+    ~EsdfMap();
+
+    EsdfMap(const EsdfMap &) = delete;
+    EsdfMap &operator=(const EsdfMap &) = delete;
+
+    // writes a map file, throws std::runtime_error on failure
+    static void write(const std::string &path, const Eigen::Vector3i &size, const Eigen::Vector3d &origin,
+                      double resolution, const std::vector<float> &distances);
+
+    // distance at p and its gradient, p is clamped to the map
+    double distance(const Eigen::Vector3d &p, Eigen::Vector3d *gradient = nullptr);
+    // same straight from the mapped file, for the benchmarks
+    double distance_uncached(const Eigen::Vector3d &p, Eigen::Vector3d *gradient = nullptr) const;
+
+    // distance >= safe_distance linearized at p
+    EsdfConstraint linearize(const Eigen::Vector3d &p, double safe_distance);
+
+    const Eigen::Vector3i &size() const { return size_; }
+    const Eigen::Vector3d &origin() const { return origin_; }
+    double resolution() const { return resolution_; }
+    unsigned long cache_hits() const { return cache_hits_; }
+    unsigned long cache_misses() const { return cache_misses_; }
+
+    // cells per block edge
+    static constexpr int kBlockBits = 3;
+    static constexpr int kBlock = 1 << kBlockBits;
+
+private:
+    // the kBlock + 1 voxels per edge of the cells of a block, the last ones shared with the next block
+    static constexpr int kBlockVoxels = kBlock + 1;
+    struct CachedBlock {
+        long long tag = -1;
+        float values[kBlockVoxels * kBlockVoxels * kBlockVoxels];
+    };
+
+    // cell of p and the position in it, 0..1 per axis
+    void locate(const Eigen::Vector3d &p, Eigen::Vector3i &cell, Eigen::Vector3d &fraction) const;
+    float voxel(int i, int j, int k) const
+    {
+        return voxels_[i + static_cast<size_t>(size_(0)) * (j + static_cast<size_t>(size_(1)) * k)];
+    }
+    const CachedBlock &block(const Eigen::Vector3i &block_index);
+    // trilinear interpolation of the 8 corner values, x fastest
+    double interpolate(const float corners[8], const Eigen::Vector3d &fraction, Eigen::Vector3d *gradient) const;
+
+    void *mapping_;
+    size_t mapping_size_;
+    const float *voxels_;
+    Eigen::Vector3i size_;
+    Eigen::Vector3d origin_;
+    double resolution_;
+    Eigen::Vector3i blocks_;  // per axis
+    std::vector<CachedBlock> cache_;
+    long long cache_mask_;    // entries - 1
+    unsigned long cache_hits_;
+    unsigned long cache_misses_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_ESDF_MAP_H
@@ -0,0 +1,40 @@
+#ifndef MAV_NMPC_TRACKER_HORIZON_IO_H
+#define MAV_NMPC_TRACKER_HORIZON_IO_H
+
+#include "acados_solver_mav_nmpc_tracker_model.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Whole-horizon I/O of the generated mav_nmpc_tracker_model solver, one contiguous buffer per field.
+ * Written for this package, not generated: it reads and writes the acados vectors of the capsule.
+ *
+ * Buffers are stage major: the values of stage i start at i*NX, i*NU or i*NY, which is
+ * the column-major layout of an NX x (N+1), NU x N or NY x N matrix. N is the number of
+ * shooting intervals the capsule was created with. The stage loops write directly into
+ * the acados vectors instead of dispatching on the field name for every stage.
+ * All functions return 0 on success.
+ */
+
+// stage 0 equality bounds, lbx = ubx = x0, size NX
+int mav_nmpc_tracker_horizon_set_x0(mav_nmpc_tracker_model_solver_capsule *capsule, const double *x0);
+
+// initial guess, x_traj of size (N+1)*NX and u_traj of size N*NU
+int mav_nmpc_tracker_horizon_set_x_traj(mav_nmpc_tracker_model_solver_capsule *capsule, const double *x_traj);
+int mav_nmpc_tracker_horizon_set_u_traj(mav_nmpc_tracker_model_solver_capsule *capsule, const double *u_traj);
+
+// LINEAR_LS references, yref_traj of size N*NY and yref_e of size NYN
+int mav_nmpc_tracker_horizon_set_yref_traj(mav_nmpc_tracker_model_solver_capsule *capsule,
+                                                const double *yref_traj, const double *yref_e);
+
+// solution, x_traj of size (N+1)*NX and u_traj of size N*NU
+int mav_nmpc_tracker_horizon_get_x_traj(mav_nmpc_tracker_model_solver_capsule *capsule, double *x_traj);
+int mav_nmpc_tracker_horizon_get_u_traj(mav_nmpc_tracker_model_solver_capsule *capsule, double *u_traj);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // MAV_NMPC_TRACKER_HORIZON_IO_H
@@ -0,0 +1,64 @@
+#ifndef MAV_NMPC_TRACKER_MINIMUM_SNAP_H
+#define MAV_NMPC_TRACKER_MINIMUM_SNAP_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+// Minimum snap transition from a state of the MAV to a target at rest, planned on board in closed form.
+// One segment of degree 7 per axis: position, velocity and acceleration of the start, zero jerk there, and
+// the target with zero velocity, acceleration and jerk at the end. Its four free coefficients are a fixed
+// 4 x 4 inverse applied to the mismatch of the start at the end, so a plan costs a few microseconds. The
+// duration is the shortest keeping the sampled speed and acceleration within the limits, or the one
+// exceeding them least when the acceleration of the start does not allow that.
+
+namespace mav_nmpc_tracker {
+
+struct MinimumSnapLimits {
+    double velocity = 1.0;      // m/s, peak speed
+    double acceleration = 2.0;  // m/s^2, peak acceleration
+    double min_duration = 0.5;  // s
+};
+
+class MinimumSnapTrajectory {
+public:
+    // from position p0, velocity v0 and acceleration a0 at start_time (s) to target at rest; limits below
+    // the speed and acceleration of the start are raised to them
+    void plan(double start_time, const Eigen::Vector3d &p0, const Eigen::Vector3d &v0, const Eigen::Vector3d &a0,
+              const Eigen::Vector3d &target, const MinimumSnapLimits &limits = MinimumSnapLimits());
+    void clear() { empty_ = true; }
+
+    bool empty() const { return empty_; }
+    double start_time() const { return start_time_; }
+    double end_time() const { return start_time_ + duration_; }
+    const Eigen::Vector3d &target() const { return target_; }
+
+    // position, velocity and, if not nullptr, acceleration at t0 plus each of the offsets, one column each;
+    // held still at the start position before the start and at the target after the end. Not empty.
+    void evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                  Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations = nullptr) const;
+
+    // at rest at the target from time on
+    bool stationary(double time) const { return time >= end_time(); }
+
+private:
+    // normalized coefficients of the start and the target over a duration, ascending powers of
+    // (t - start_time) / duration
+    static Eigen::Matrix<double, 3, 8> normalized_coefficients(const Eigen::Vector3d &p0, const Eigen::Vector3d &v0,
+                                                               const Eigen::Vector3d &a0,
+                                                               const Eigen::Vector3d &target, double duration);
+
+    bool empty_ = true;
+    double start_time_ = 0.0;
+    double duration_ = 0.0;
+    Eigen::Vector3d start_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d target_ = Eigen::Vector3d::Zero();
+    // of the position and its first two derivatives, powers of the time from the start, 8, 7 and 6 columns
+    Eigen::Matrix3Xd coefficients_;
+    Eigen::Matrix3Xd velocity_coefficients_;
+    Eigen::Matrix3Xd acceleration_coefficients_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_MINIMUM_SNAP_H
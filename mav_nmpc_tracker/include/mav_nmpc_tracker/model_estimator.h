@@ -0,0 +1,112 @@
+#ifndef MAV_NMPC_TRACKER_MODEL_ESTIMATOR_H
+#define MAV_NMPC_TRACKER_MODEL_ESTIMATOR_H
+
+#include <Eigen/Core>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+// Online identification of the model from the odometry and the commands sent, the recursive
+// counterpart of mav_fake_simulator/identification. Fixed size, no allocation per sample.
+
+namespace mav_nmpc_tracker {
+
+// Recursive least squares with exponential forgetting, y = phi' theta
+template <int Dim>
+class RecursiveLeastSquares {
+public:
+    typedef Eigen::Matrix<double, Dim, 1> Vector;
+    typedef Eigen::Matrix<double, Dim, Dim> Matrix;
+
+    // p0: initial covariance of each parameter, max_trace bounds the covariance while the
+    // regressor is not excited, against windup
+    RecursiveLeastSquares(const Vector &theta0, double p0, double forgetting, double max_trace)
+        : theta_(theta0), P_(Matrix::Identity() * p0), forgetting_(forgetting), max_trace_(max_trace), count_(0)
+    {
+    }
+
+    void update(const Vector &phi, double y)
+    {
+        const Vector P_phi = P_ * phi;
+        const Vector gain = P_phi / (forgetting_ + phi.dot(P_phi));
+        theta_ += gain * (y - phi.dot(theta_));
+        P_ = (P_ - gain * P_phi.transpose()) / forgetting_;
+        P_ = 0.5 * (P_ + P_.transpose());
+        const double trace = P_.trace();
+        if (trace > max_trace_)
+            P_ *= max_trace_ / trace;
+        count_++;
+    }
+
+    const Vector &theta() const { return theta_; }
+    unsigned long count() const { return count_; }
+
+private:
+    Vector theta_;
+    Matrix P_;
+    double forgetting_;
+    double max_trace_;
+    unsigned long count_;
+};
+
+struct ModelEstimatorParam {
+    double forgetting = 0.998;      // per sample, about 500 samples of memory
+    double min_sample_dt = 0.02;    // s, odometry closer than that is skipped, for the finite differences
+    double max_sample_dt = 0.2;     // s, a longer gap restarts the differences
+    unsigned long min_samples = 200;  // before the estimates are used
+    double bound_ratio = 2.0;       // estimates stay within nominal / ratio and nominal * ratio
+    double drag_max = 0.1;
+};
+
+// The estimated fields of MpcFormulationParam
+struct ModelEstimate {
+    double thrust_scale;
+    double drag_coefficient_x;
+    double drag_coefficient_y;
+    double roll_time_constant;
+    double roll_gain;
+    double pitch_time_constant;
+    double pitch_gain;
+    bool converged = false;  // min_samples reached
+
+    // copies the estimates into param
+    void apply(MpcFormulationParam &param) const;
+};
+
+class ModelEstimator {
+public:
+    // starts from the nominal model of param
+    explicit ModelEstimator(const MpcFormulationParam &param,
+                            const ModelEstimatorParam &estimator_param = ModelEstimatorParam());
+
+    // command as sent at time t, thrust normalized as in the thrust_scale of the model
+    void add_command(double t, double roll_cmd, double pitch_cmd, double thrust_cmd);
+    // state measured at time t
+    void add_odometry(double t, const StateVector &x);
+
+    ModelEstimate estimate() const;
+    unsigned long samples() const { return thrust_.count(); }
+
+private:
+    MpcFormulationParam nominal_;
+    ModelEstimatorParam estimator_param_;
+
+    // the first order attitude models, theta = [gain / tau, 1 / tau]
+    RecursiveLeastSquares<2> roll_;
+    RecursiveLeastSquares<2> pitch_;
+    RecursiveLeastSquares<1> thrust_;
+    RecursiveLeastSquares<1> drag_x_;
+    RecursiveLeastSquares<1> drag_y_;
+
+    // the last two commands, the measurement may be older than the newest one
+    double command_time_[2];
+    Eigen::Vector3d command_[2];
+    int command_count_;
+
+    bool has_last_;
+    double last_time_;
+    StateVector last_x_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_MODEL_ESTIMATOR_H
@@ -0,0 +1,104 @@
+#ifndef MAV_NMPC_TRACKER_MOVING_HORIZON_ESTIMATOR_H
+#define MAV_NMPC_TRACKER_MOVING_HORIZON_ESTIMATOR_H
+
+#include <memory>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/solver_library.h"
+
+// Moving horizon estimation of the state and an external disturbance over the last N + 1 odometry
+// samples, with the MHE generated by scripts/nmpc_tracker_solver.py --mhe from the dynamics of the
+// MPC. One RTI iteration per sample, warm started with the shifted previous window.
+
+namespace mav_nmpc_tracker {
+
+constexpr int kMheNx = kNx + 3;                 // state, disturbance acceleration
+constexpr int kMheNw = kMheNx;                  // process noise, the controls of the MHE
+constexpr int kMheNy = kNx + kMheNw;            // measured state, process noise
+constexpr int kMheNy0 = kMheNy + kMheNx;        // and the arrival cost
+constexpr int kMheNp = kNu + kNumModelParams;   // command held over the stage, model parameters
+
+typedef Eigen::Matrix<double, kMheNx, 1> MheStateVector;
+typedef Eigen::Matrix<double, kMheNx, Eigen::Dynamic> MheStateTrajectory;
+typedef Eigen::Matrix<double, kMheNw, Eigen::Dynamic> MheNoiseTrajectory;
+
+struct MheParam {
+    // measurement weights, inverse variances of the odometry
+    double r_pos = 1e4;
+    double r_vel = 1e2;
+    double r_att = 1e3;
+    // process noise weights, on the state derivative and the drift of the disturbance
+    double q_pos = 1e4;
+    double q_vel = 1e1;
+    double q_att = 1e1;
+    double q_dist = 1e0;
+    // arrival cost, on the estimate of the stage that left the window
+    double p0_state = 1e2;
+    double p0_dist = 1e0;
+    double max_sample_dt = 0.2;  // s, a longer gap between two samples restarts the window
+};
+
+class MovingHorizonEstimator {
+public:
+    // loads the generated MHE of the json, throws std::runtime_error if it is not there or not an MHE
+    // of this model
+    MovingHorizonEstimator(const std::string &json_file, const MpcFormulationParam &param,
+                           const MheParam &mhe_param = MheParam());
+    ~MovingHorizonEstimator();
+
+    MovingHorizonEstimator(const MovingHorizonEstimator &) = delete;
+    MovingHorizonEstimator &operator=(const MovingHorizonEstimator &) = delete;
+
+    // odometry y measured at time t, u the command in model units held since the previous sample
+    void add_measurement(double t, const StateVector &y, const InputVector &u);
+    // one RTI iteration over the window, the acados status, -1 while the window is filling
+    int update();
+    void reset();
+    // the window is full
+    bool ready() const { return samples_ > N_; }
+
+    // estimate at the last sample, the measurement itself until an update succeeded
+    const StateVector &state() const { return state_; }
+    // mass divided force
+    const Eigen::Vector3d &disturbance() const { return disturbance_; }
+
+    void set_model_params(const ModelParamVector &p);
+    int N() const { return N_; }
+    double get_time_tot() const;
+
+private:
+    void set_weights(const MheParam &mhe_param);
+
+    int N_;
+    MheParam mhe_param_;
+    std::shared_ptr<const SolverLibrary> library_;
+    SolverLibrary::Capsule *capsule_;
+    ocp_nlp_config *nlp_config_;
+    ocp_nlp_dims *nlp_dims_;
+    ocp_nlp_in *nlp_in_;
+    ocp_nlp_out *nlp_out_;
+    ocp_nlp_solver *nlp_solver_;
+    void *nlp_opts_;
+
+    // window, oldest sample first
+    int samples_;
+    Eigen::VectorXd t_window_;
+    StateTrajectory y_window_;
+    InputTrajectory u_window_;
+    ModelParamVector model_params_;
+
+    // initial guess, the shifted last solution, and the prior of its first stage
+    MheStateTrajectory x_init_;
+    MheNoiseTrajectory w_init_;
+    MheStateVector x_prior_;
+
+    StateVector state_;
+    Eigen::Vector3d disturbance_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_MOVING_HORIZON_ESTIMATOR_H
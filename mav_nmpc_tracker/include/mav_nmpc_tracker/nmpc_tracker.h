@@ -0,0 +1,392 @@
+#ifndef MAV_NMPC_TRACKER_NMPC_TRACKER_H
+#define MAV_NMPC_TRACKER_NMPC_TRACKER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ros/ros.h>
+#include <geometry_msgs/PointStamped.h>
+#include <nav_msgs/Odometry.h>
+#include <mav_msgs/RollPitchYawrateThrust.h>
+#include <mav_planning_msgs/PolynomialTrajectory4D.h>
+#include <mavros_msgs/AttitudeTarget.h>
+#include <trajectory_msgs/MultiDOFJointTrajectory.h>
+#include <visualization_msgs/Marker.h>
+#include <visualization_msgs/MarkerArray.h>
+#include <std_msgs/Float64MultiArray.h>
+#include <std_msgs/String.h>
+
+#include "mav_nmpc_tracker/TrajectoryLibraryPlayback.h"
+#include "mav_nmpc_tracker/command_interpolator.h"
+#include "mav_nmpc_tracker/disturbance_observer.h"
+#include "mav_nmpc_tracker/minimum_snap.h"
+#include "mav_nmpc_tracker/model_estimator.h"
+#include "mav_nmpc_tracker/moving_horizon_estimator.h"
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "mav_nmpc_tracker/polynomial_trajectory.h"
+#include "mav_nmpc_tracker/speculative_solver.h"
+#include "mav_nmpc_tracker/state_predictor.h"
+#include "mav_nmpc_tracker/trajectory_buffer.h"
+#include "mav_nmpc_tracker/trajectory_library.h"
+#include "mav_nmpc_tracker/warm_start.h"
+
+// The frame by default is NWU
+
+namespace mav_nmpc_tracker {
+
+// where the trajectory reference comes from, the last kind of message received or the library started
+enum class ReferenceSource {
+    kPoints = 0,      // /command/trajectory
+    kPolynomial = 1,  // /command/polynomial_trajectory
+    kLibrary = 2,     // trajectory_library, played through /mpc/trajectory_library
+    kGoto = 3,        // /command/goto, a minimum snap transition to the point
+};
+
+// Runtime settings of the native tracker, not part of the MPC formulation
+struct NmpcTrackerOptions {
+    // run the RTI preparation phase right after a command is published, and only the
+    // feedback phase once the next odometry is in
+    bool rti_split = false;
+    // timer: fixed rate loop; odometry: every odom_decimation-th odometry message starts a cycle
+    std::string control_trigger = "timer";
+    int odom_decimation = 1;
+    // solve the warm started and the reset problem in parallel on two capsules and use the warm
+    // answer if feasible, instead of the reset solve after a failed warm start
+    bool speculative_solve = false;
+    int speculative_cpu_warm = -1;   // cores the two solver threads are pinned to, -1 for none
+    int speculative_cpu_cold = -1;
+    double speculative_deadline = 0.0;  // s, the reset answer is used past it, 0 to wait for the warm one
+    // thresholds of the warm start strategy
+    WarmStartParam warm_start;
+    // integrate the odometry over its transport delay and the solve time with the commands sent
+    bool predict_delay = false;
+    double predict_max_horizon = 0.1;  // s
+    // samples of /command/trajectory kept, the longest trajectory that can be sent at once
+    int traj_buffer_size = 4096;
+    // input reference of every stage from the reference acceleration through the flat model, the
+    // settled attitude and thrust flying it, instead of hover; also the initial guess of the inputs
+    bool input_feedforward = true;
+    // generated solver variants, name -> ACADOS_*_solver.json, loaded at startup next to the linked
+    // solver named "default"; solver_variant is the one used first
+    std::map<std::string, std::string> solver_variants;
+    std::string solver_variant = "default";
+    // a second, shorter horizon of N steps of dt on the linked solver, used instead of the variant
+    // while the reference is constant, in hover and home or on a trajectory standing still; 0 for none
+    int stationary_N = 0;
+    double stationary_dt = 0.05;
+    // identify thrust scale, drag and the attitude responses online from the odometry and the
+    // commands sent, and use them once converged
+    bool estimate_model = false;
+    ModelEstimatorParam model_estimator;
+    // ACADOS_nmpc_tracker_mhe.json of scripts/nmpc_tracker_solver.py --mhe, filters the odometry and
+    // estimates a disturbance with it; empty for none
+    std::string mhe_solver;
+    MheParam mhe;
+    // offset-free tracking: the disturbance, of the MHE or else of a disturbance observer, enters the
+    // model parameters and shifts the hover input reference
+    bool offset_free = false;
+    DisturbanceObserverParam disturbance_observer;
+    // the CUBE markers of /traj_opt/corridors, in the order of the path, as soft position constraints
+    // of a solver generated with --corridor_faces 6, shrunk by corridor_margin (m)
+    bool corridors = false;
+    double corridor_margin = 0.3;
+    // the SPHERE markers of /traj_opt/obstacles, each message the whole set, moving at the velocity of the
+    // last two positions of the same marker, as
+    // soft keep-out ellipsoids of a solver generated with --obstacle_slots 4, grown by obstacle_margin (m);
+    // the kObstacleSlots nearest within obstacle_index.range of each stage are constrained
+    bool obstacles = false;
+    double obstacle_margin = 0.3;
+    ObstacleIndexParam obstacle_index;
+    // distance field file of EsdfMap, empty for none, as a soft distance of at least esdf_distance (m) of a
+    // solver generated with --esdf_rows 1, linearized at the last plan each cycle; esdf_cache_blocks
+    // blocks of the map are cached
+    std::string esdf_map;
+    double esdf_distance = 0.5;
+    int esdf_cache_blocks = 256;
+    // mission file of TrajectoryLibrary, empty for none, played back on the start, pause and seek
+    // commands of the /mpc/trajectory_library service
+    std::string trajectory_library;
+    // minimum snap transitions on entering hover, braking to a stop, and home, flying to [0, 0, 1], instead
+    // of a step reference; the ones of /command/goto as well, within the same peak speed and acceleration
+    bool transitions = true;
+    MinimumSnapLimits transition_limits;
+    // commands sent at command_rate (Hz) by an output thread, read off the last plan at the time they are
+    // sent and corrected by the odometry, instead of once per cycle; 0 for the command of each cycle only
+    double command_rate = 0.0;
+    CommandInterpolatorParam command_interpolator;
+};
+
+// Wall-clock timings of the last control cycle in ms, and solver statistics
+struct NmpcTrackerTiming {
+    double preparation = 0.0;   // RTI preparation phase, run after the previous command
+    double feedback = 0.0;      // RTI feedback phase, or the full solve including a retry
+    double odom_to_cmd = 0.0;   // from odometry reception to the command being ready
+    double odom_age = 0.0;      // from odometry reception to the cycle start, the phase to the odometry
+    unsigned long missed_deadlines = 0;  // odometry triggers skipped while a cycle was still running
+    int qp_iter = 0;                     // QP iterations of the cycle, including a retry
+    WarmStartStrategy warm_start = WarmStartStrategy::kHover;
+    double odom_delay = 0.0;    // estimated transport delay of the odometry, from the header stamps
+    double traj_delay = 0.0;    // same for the trajectory
+    double prediction = 0.0;    // time the odometry was predicted over, 0 without predict_delay
+};
+
+class MavNmpcTracker {
+public:
+    // tracking_mode: track, hover, home; yaw_command_mode: yaw, yawrate
+    MavNmpcTracker(ros::NodeHandle &nh, const MpcFormulationParam &mpc_form_param,
+                   const std::string &tracking_mode, const std::string &yaw_command_mode,
+                   const NmpcTrackerOptions &options = NmpcTrackerOptions());
+    ~MavNmpcTracker();
+
+    void set_odom(const nav_msgs::Odometry::ConstPtr &odom_msg);
+    void set_traj_ref(const trajectory_msgs::MultiDOFJointTrajectory::ConstPtr &traj_msg);
+    void set_polynomial_ref(const mav_planning_msgs::PolynomialTrajectory4D::ConstPtr &polynomial_msg);
+    void set_goto(const geometry_msgs::PointStamped::ConstPtr &goto_msg);
+    // switches to the named solver variant between two control cycles, from any thread
+    void request_solver_variant(const std::string &name);
+    void set_solver_variant(const std_msgs::String::ConstPtr &variant_msg);
+    void set_corridors(const visualization_msgs::MarkerArray::ConstPtr &corridors_msg);
+    void set_obstacles(const visualization_msgs::MarkerArray::ConstPtr &obstacles_msg);
+    bool set_library_playback(TrajectoryLibraryPlayback::Request &request,
+                              TrajectoryLibraryPlayback::Response &response);
+
+    // solve and publish once, called by the timer loop or the odometry-triggered control thread
+    void control_cycle();
+
+    void calculate_roll_pitch_yawrate_thrust_cmd();
+    // RTI preparation for the next cycle, to be called once the command is published
+    void prepare_acados_solver();
+    void pub_roll_pitch_yawrate_thrust_cmd();
+    void pub_roll_pitch_yaw_thrust_cmd();
+    // the plan of the cycle to the output thread, with command_rate
+    void hand_off_command_plan();
+    void pub_mpc_traj_plan_vis();
+    // [preparation, feedback, odom_to_cmd, odom_age] in ms, missed_deadlines, qp_iter, the warm
+    // start strategy as its WarmStartStrategy value, and [odom_delay, traj_delay, prediction] in ms,
+    // see NmpcTrackerTiming
+    void pub_solver_timing();
+    // [thrust_scale, drag_coefficient_x, drag_coefficient_y, roll_time_constant, roll_gain,
+    // pitch_time_constant, pitch_gain, samples], with estimate_model
+    void pub_model_estimate();
+    // [state, disturbance force in N, status, solve time in ms], with mhe_solver
+    void pub_mhe_estimate();
+    // disturbance force in N, with offset_free
+    void pub_disturbance();
+
+private:
+    // latest odometry and trajectory from the callbacks into the cycle variables
+    bool fetch_latest_data();
+    void control_thread_loop();
+    // sends the commands of the last plan handed off, at command_rate
+    void command_thread_loop();
+    void publish_roll_pitch_yawrate_thrust(const Eigen::Vector4d &cmd);
+    void publish_roll_pitch_yaw_thrust(const Eigen::Vector4d &cmd);
+    // solver variants, the plan is resampled onto the stages of the new one
+    void load_solver_variants();
+    void activate_solver_variant(int index);
+    // the stationary horizon or the variant in use for tracking, switched to if needed
+    void select_horizon(const std::string &mode, double time);
+    void resize_mpc_variables();
+    // a new odometry sample through the MHE, its estimate as the current state
+    void run_mhe();
+    void run_disturbance_observer();
+    // the identified parameters and the disturbance into the solvers, the predictor and the MHE
+    void update_model();
+    // the odometry integrated up to the expected command time, with predict_delay
+    void predict_current_state(const ros::Time &time_now);
+    const std::string &select_tracking_mode(const ros::Time &time_now) const;
+    // of the reference source in use, -inf without a trajectory
+    double traj_end_time() const;
+    // the transition of hover or home from the current state, once on entering the mode, with transitions
+    void plan_transition(const std::string &mode, double time);
+    // sets the references of the stages from time on and builds the solver references from them
+    void set_mpc_ref(const std::string &mode, const ros::Time &time);
+    // initial guess at the current state with the input reference
+    void build_cold_start(StateTrajectory &x_init, InputTrajectory &u_init) const;
+    void reset_acados_solver();
+    void initialize_acados_solver();
+    // corridors of the stages at their reference position, with options_.corridors
+    void set_corridor_constraints();
+    // the nearest obstacles of the stages at their reference position and time, with options_.obstacles
+    void set_obstacle_constraints(const ros::Time &start_time);
+    // the distance field linearized at the positions of the initial guess mpc_x_init_, with
+    // options_.esdf_map
+    void set_esdf_constraints();
+    // stage and terminal references from mpc_pos_ref_, mpc_vel_ref_ and mpc_u_ref_
+    void build_solver_ref();
+    void set_acados_solver_ref();
+    void run_acados_solver();
+    void run_speculative_acados_solver();
+
+    // MPC formulation settings
+    MpcFormulationParam mpc_form_param_;
+
+    // mode
+    std::string tracking_mode_;     // track, hover, home
+    std::string yaw_command_mode_;  // yaw, yawrate
+    NmpcTrackerOptions options_;
+
+    // mav mass, and settings
+    double mass_;
+    double thrust_scale_;
+    double odom_time_out_;
+    double traj_time_out_;  // after the end of the trajectory
+
+    // state
+    StateVector mav_state_current_;
+
+    // MPC settings, of the active solver variant
+    double mpc_dt_;  // first step
+    int mpc_N_;
+    double mpc_Tf_;
+    double mpc_start_time_;  // s, of the first stage of the last solve
+    std::vector<double> mpc_stage_times_;  // from the first stage, N entries
+
+    // MPC variables
+    Eigen::Matrix3Xd mpc_pos_ref_;
+    Eigen::Matrix3Xd mpc_vel_ref_;
+    Eigen::Matrix3Xd mpc_acc_ref_;
+    InputTrajectory mpc_u_ref_;
+    StateTrajectory mpc_x_plan_;
+    InputTrajectory mpc_u_plan_;
+    RefTrajectory mpc_yref_;
+    TerminalRefVector mpc_yref_e_;
+    StateTrajectory mpc_x_init_;
+    InputTrajectory mpc_u_init_;
+    StateTrajectory mpc_x_cold_;
+    InputTrajectory mpc_u_cold_;
+    StateVector mpc_x_next_;
+    InputVector mpc_u_now_;
+    bool mpc_feasible_;
+    bool mpc_success_;
+    bool mpc_prepared_;  // preparation phase done, only the feedback phase left
+    ros::Time mpc_prepared_time_;  // of the first stage of the prepared reference
+    std::unique_ptr<WarmStart> mpc_warm_start_;
+    NmpcTrackerTiming mpc_timing_;
+
+    // MPC solver, one of the variants, mpc_speculative_solver_ instead with speculative_solve
+    std::vector<std::string> mpc_solver_names_;
+    std::vector<std::unique_ptr<NmpcTrackerSolver>> mpc_solvers_;
+    NmpcTrackerSolver *mpc_solver_;
+    int mpc_solver_index_;
+    int mpc_track_solver_index_;       // the variant selected, used while tracking
+    int mpc_stationary_solver_index_;  // -1 without stationary_N
+    std::unique_ptr<SpeculativeSolver> mpc_speculative_solver_;
+
+    // latency compensation, with predict_delay
+    std::unique_ptr<StatePredictor> state_predictor_;
+    DelayEstimator solve_delay_;  // from the prediction to the command being sent
+    DelayEstimator cycle_period_;  // between the starts of two control cycles, of the RTI split
+    ros::Time last_cycle_start_time_;
+
+    // state and disturbance estimation, with mhe_solver
+    std::unique_ptr<MovingHorizonEstimator> mhe_;
+    ros::Time mhe_stamp_;       // of the last sample
+    InputVector last_command_;  // the last command sent, in model units
+    int mhe_status_;
+    double mhe_time_;           // ms
+
+    // offset-free tracking, with offset_free
+    std::unique_ptr<DisturbanceObserver> disturbance_observer_;  // without the MHE
+    ros::Time disturbance_stamp_;
+    Eigen::Vector3d disturbance_;  // mass divided force
+
+    // the model of the solvers, the formulation with the identified parameters and the disturbance
+    MpcFormulationParam model_param_;
+
+    // online model identification, with estimate_model
+    ModelEstimate model_estimate_;
+    unsigned long model_estimate_samples_;
+    ros::Time model_estimate_applied_time_;
+
+    // ROS subscriber
+    ros::Subscriber odom_sub_;
+    bool received_first_odom_;
+    ros::Time odom_received_time_;
+    ros::Time odom_stamp_time_;  // header stamp, the time the state was measured
+    ros::Subscriber traj_sub_;
+    ros::Subscriber polynomial_sub_;
+    ros::Subscriber goto_sub_;
+    // the trajectory by time, evaluated at the stage times, of the points or the polynomials
+    ReferenceSource traj_source_;
+    TrajectoryBuffer traj_buffer_;
+    PolynomialTrajectory traj_polynomial_;
+    std::unique_ptr<TrajectoryLibrary> traj_library_;
+    LibraryPlayback traj_playback_;
+    MinimumSnapTrajectory traj_goto_;
+    double traj_yaw_ref_;  // of the library at the first stage, 0 for the other sources, kept in hover and home
+    double traj_horizon_;  // of the longest solver variant
+    bool traj_stationary_;
+    // of hover and home, transition_mode_ the mode it was planned for, empty while tracking
+    MinimumSnapTrajectory transition_;
+    std::string transition_mode_;
+    ros::ServiceServer library_service_;
+    ros::Subscriber solver_variant_sub_;
+    ros::Subscriber corridor_sub_;
+    CorridorAssigner corridor_assigner_;
+    ros::Subscriber obstacle_sub_;
+    ObstacleIndex obstacle_index_;
+    std::map<std::pair<std::string, int>, Obstacle> obstacle_tracks_;  // by marker ns and id, of the callback
+    std::unique_ptr<EsdfMap> esdf_map_;
+
+    // written by the callbacks, guarded by data_mutex_
+    std::mutex data_mutex_;
+    StateVector odom_state_;
+    ros::Time odom_time_;
+    ros::Time odom_stamp_;
+    int odom_count_;
+    DelayEstimator odom_delay_;
+    DelayEstimator traj_delay_;
+    std::vector<std::vector<TrajectorySample>> traj_msgs_;  // since the last cycle, in order
+    std::vector<PolynomialSegment> polynomial_msg_;
+    double polynomial_msg_start_;
+    bool polynomial_updated_;
+    ReferenceSource traj_source_msg_;
+    LibraryPlayback library_playback_msg_;
+    Eigen::Vector3d goto_msg_;
+    bool goto_updated_;
+    std::string solver_variant_request_;
+    std::unique_ptr<ModelEstimator> model_estimator_;
+    std::vector<Corridor> corridors_msg_;
+    bool corridors_updated_;
+    std::vector<Obstacle> obstacles_msg_;
+    bool obstacles_updated_;
+
+    // odometry-triggered control, guarded by control_mutex_
+    std::mutex control_mutex_;
+    std::condition_variable control_cv_;
+    std::thread control_thread_;
+    bool control_running_;
+    bool control_triggered_;
+    bool control_busy_;
+
+    // high-rate commands, with command_rate; written by the control cycle and the odometry callback
+    CommandInterpolator command_interpolator_;
+    TripleBuffer<CommandPlan> plan_handoff_;
+    TripleBuffer<StateSample> odom_handoff_;
+    std::thread command_thread_;
+    std::atomic<bool> command_running_;
+
+    // ROS publisher
+    Eigen::Vector4d roll_pitch_yawrate_thrust_cmd_;
+    ros::Publisher roll_pitch_yawrate_thrust_cmd_pub_;
+    Eigen::Vector4d roll_pitch_yaw_thrust_cmd_;
+    ros::Publisher roll_pitch_yaw_thrust_cmd_pub_;
+
+    ros::Publisher mpc_traj_plan_vis_pub_;
+    ros::Publisher mpc_timing_pub_;
+    ros::Publisher model_estimate_pub_;
+    ros::Publisher mhe_estimate_pub_;
+    ros::Publisher disturbance_pub_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_NMPC_TRACKER_H
@@ -0,0 +1,203 @@
+#ifndef MAV_NMPC_TRACKER_NMPC_TRACKER_SOLVER_H
+#define MAV_NMPC_TRACKER_NMPC_TRACKER_SOLVER_H
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <Eigen/Core>
+
+#include "acados_solver_mav_nmpc_tracker_model.h"
+#include "mav_nmpc_tracker/horizon_io.h"
+#include "mav_nmpc_tracker/corridor.h"
+#include "mav_nmpc_tracker/esdf_map.h"
+#include "mav_nmpc_tracker/obstacles.h"
+#include "mav_nmpc_tracker/solver_library.h"
+
+// NMPC trajectory tracking solver, thin wrapper of the generated acados capsule
+
+namespace mav_nmpc_tracker {
+
+// Constants
+constexpr double g = 9.8066;
+
+constexpr int kNx = MAV_NMPC_TRACKER_MODEL_NX;    // px, py, pz, vx, vy, vz, roll, pitch, yaw
+constexpr int kNu = MAV_NMPC_TRACKER_MODEL_NU;    // roll_cmd, pitch_cmd, thrust_cmd (mass divided)
+constexpr int kNy = MAV_NMPC_TRACKER_MODEL_NY;    // tracking pos, vel, and making u smaller
+constexpr int kNyE = MAV_NMPC_TRACKER_MODEL_NYN;  // tracking terminal pos, vel
+constexpr int kNp = MAV_NMPC_TRACKER_MODEL_NP;    // stage parameters of the generated model, the model
+                                                  // parameters and the obstacle slots if generated with them
+// roll_time_constant, roll_gain, pitch_time_constant, pitch_gain, drag_coefficient_x, drag_coefficient_y,
+// thrust_gain, disturbance_x, disturbance_y, disturbance_z, MODEL_PARAM_FIELDS of nmpc_tracker_solver.py
+constexpr int kNumModelParams = 10;
+
+typedef Eigen::Matrix<double, kNx, 1> StateVector;
+typedef Eigen::Matrix<double, kNu, 1> InputVector;
+typedef Eigen::Matrix<double, kNx, Eigen::Dynamic> StateTrajectory;
+typedef Eigen::Matrix<double, kNu, Eigen::Dynamic> InputTrajectory;
+typedef Eigen::Matrix<double, kNy, 1> RefVector;
+typedef Eigen::Matrix<double, kNyE, 1> TerminalRefVector;
+typedef Eigen::Matrix<double, kNy, Eigen::Dynamic> RefTrajectory;
+typedef Eigen::Map<const StateVector> StateView;
+typedef Eigen::Map<const InputVector> InputView;
+typedef Eigen::Matrix<double, kNumModelParams, 1> ModelParamVector;
+
+// Same fields and defaults as MPC_Formulation_Param in nmpc_tracker_solver.py
+struct MpcFormulationParam {
+    double mass = 1.56;
+    double thrust_scale = 20.0;
+    // horizon
+    double dt = 0.05;
+    int N = 20;
+    double Tf = N * dt;
+    // native only, the N steps of a non-uniform horizon summing to Tf, N steps of dt when empty
+    std::vector<double> time_steps;
+    // dynamics
+    double roll_time_constant = 0.3;
+    double roll_gain = 1.0;
+    double pitch_time_constant = 0.3;
+    double pitch_gain = 1.0;
+    double drag_coefficient_x = 0.01;
+    double drag_coefficient_y = 0.01;
+    double thrust_gain = 1.0;    // actual over commanded thrust
+    // constant external acceleration, mass divided force, of the disturbance observer
+    double disturbance_x = 0.0;
+    double disturbance_y = 0.0;
+    double disturbance_z = 0.0;
+    // control bound
+    double roll_max = 25.0 * M_PI / 180.0;
+    double pitch_max = 25.0 * M_PI / 180.0;
+    double thrust_min = 0.5 * g;    // mass divided
+    double thrust_max = 1.5 * g;
+    double K_yaw = 1.8;
+    double yawrate_max = 90.0 * M_PI / 180.0;
+    // cost weights
+    double q_x = 80;
+    double q_y = 80;
+    double q_z = 120;
+    double q_vx = 80;
+    double q_vy = 80;
+    double q_vz = 100;
+    double r_roll = 50;
+    double r_pitch = 50;
+    double r_thrust = 1;
+    // penalties of the corridor slacks, linear and quadratic
+    double corridor_slack_l1 = 1000;
+    double corridor_slack_l2 = 100;
+    // penalties of the distance field slacks, linear and quadratic
+    double esdf_slack_l1 = 1000;
+    double esdf_slack_l2 = 100;
+    // penalties of the obstacle slacks, linear and quadratic
+    double obstacle_slack_l1 = 1000;
+    double obstacle_slack_l2 = 100;
+};
+
+// time steps of the horizon of param, time_steps or N steps of dt
+std::vector<double> horizon_time_steps(const MpcFormulationParam &param);
+// N steps over horizon, each ratio times the one before
+std::vector<double> geometric_time_steps(int N, double horizon, double ratio);
+// counts[i] steps of steps[i], in order
+std::vector<double> piecewise_time_steps(const std::vector<int> &counts, const std::vector<double> &steps);
+// start time of each stage and the end of the horizon, N + 1 entries
+std::vector<double> stage_times(const std::vector<double> &time_steps);
+// the dynamics fields of param in the order of the stage parameters
+ModelParamVector model_params(const MpcFormulationParam &param);
+
+class NmpcTrackerSolver {
+public:
+    // Creates the capsule with the time steps of param, and overwrites the code-generated
+    // weights, control bounds and model parameters with the ones in param. Throws std::runtime_error on failure.
+    explicit NmpcTrackerSolver(const MpcFormulationParam &param);
+    // Same with the solver of library and its time steps, param.N and param.dt are not used
+    NmpcTrackerSolver(const MpcFormulationParam &param, std::shared_ptr<const SolverLibrary> library,
+                      const std::vector<double> &time_steps);
+    ~NmpcTrackerSolver();
+
+    NmpcTrackerSolver(const NmpcTrackerSolver &) = delete;
+    NmpcTrackerSolver &operator=(const NmpcTrackerSolver &) = delete;
+
+    int N() const { return N_; }
+    const std::vector<double> &time_steps() const { return time_steps_; }
+    const SolverLibrary &library() const { return *library_; }
+
+    void set_weights(const MpcFormulationParam &param);
+    void set_control_bounds(const MpcFormulationParam &param);
+    // false for a solver generated before the model had parameters, with its dynamics baked in
+    bool has_model_params() const;
+    // model parameters of every stage, or of one of 0..N; stages already at p are skipped, so
+    // calling it every cycle is cheap. Returns false without has_model_params().
+    bool set_model_params(const ModelParamVector &p);
+    bool set_stage_model_params(int stage, const ModelParamVector &p);
+    // false for a solver generated without the kCorridorFaces soft linear constraints per stage
+    bool has_corridor_constraints() const;
+    // the position of a stage of 0..N within the corridor, a corridor without faces for none; stages
+    // already in it are skipped. Returns false without has_corridor_constraints().
+    bool set_stage_corridor(int stage, const Corridor &corridor);
+    // false for a solver generated without the kEsdfRows soft linear constraint per stage
+    bool has_esdf_constraints() const;
+    // the linearized distance of a stage of 0..N, an inactive one for none; stages already at it are
+    // skipped. Returns false without has_esdf_constraints().
+    bool set_stage_esdf(int stage, const EsdfConstraint &constraint);
+    // false for a solver generated without the kObstacleSlots soft ellipsoid constraints per stage
+    bool has_obstacle_constraints() const;
+    // the position of a stage of 0..N outside the ellipsoids of the slots, empty_obstacle_slots() for
+    // none; stages already at them are skipped. Returns false without has_obstacle_constraints().
+    bool set_stage_obstacles(int stage, const ObstacleSlots &slots);
+    // penalties of the corridor, distance field and obstacle slacks
+    void set_slack_penalties(const MpcFormulationParam &param);
+
+    // initial condition, stage 0 lbx = ubx = x0
+    void set_x0(const StateVector &x0);
+    // initial guess of the whole plan, kNx x (N+1) and kNu x N
+    void set_x_init(const StateTrajectory &x_traj);
+    void set_u_init(const InputTrajectory &u_traj);
+    // stage references kNy x N and the terminal reference
+    void set_yref(const RefTrajectory &yref_traj, const TerminalRefVector &yref_e);
+
+    // returns the acados status, 0 on success
+    int solve();
+    // SQP_RTI split, prepare() linearizes and condenses around the current guess and
+    // references, feedback() then only solves the QP with the x0 set afterwards
+    int prepare();
+    int feedback();
+
+    // whole solution, kNx x (N+1) and kNu x N, resized if needed
+    void get_x_traj(StateTrajectory &x_traj) const;
+    void get_u_traj(InputTrajectory &u_traj) const;
+    // zero-copy views into the solution of one stage, valid until the next solve
+    StateView x_view(int stage) const;
+    InputView u_view(int stage) const;
+    // total time of the last call to solve() in seconds
+    double get_time_tot() const;
+    // QP solver iterations of the last call
+    int get_qp_iter() const;
+
+private:
+    int N_;
+    std::vector<double> time_steps_;
+    std::shared_ptr<const SolverLibrary> library_;
+    mav_nmpc_tracker_model_solver_capsule *capsule_;
+    ocp_nlp_config *nlp_config_;
+    ocp_nlp_dims *nlp_dims_;
+    ocp_nlp_in *nlp_in_;
+    ocp_nlp_out *nlp_out_;
+    ocp_nlp_solver *nlp_solver_;
+    void *nlp_opts_;
+    std::vector<ModelParamVector> stage_params_;  // last set, N + 1 entries
+    std::vector<Corridor> stage_corridors_;       // same
+    std::vector<EsdfConstraint> stage_esdf_;      // same
+    std::vector<ObstacleSlots> stage_obstacles_;  // same
+    std::vector<double> stage_param_values_;      // np, all parameters of a stage
+    std::vector<double> stage_C_values_;          // ng x nx, column major, the general constraints of a stage
+    std::vector<double> stage_lg_values_;         // ng
+    std::vector<double> stage_ug_values_;         // ng
+
+    // the model parameters and the obstacle slots of a stage into the solver
+    bool update_stage_params(int stage);
+    // the corridor faces and the distance field row of a stage into the solver
+    void update_stage_constraints(int stage);
+    int solve_rti_phase(int rti_phase);
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_NMPC_TRACKER_SOLVER_H
@@ -0,0 +1,83 @@
+#ifndef MAV_NMPC_TRACKER_OBSTACLES_H
+#define MAV_NMPC_TRACKER_OBSTACLES_H
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+// Moving obstacles as axis-aligned ellipsoids at constant velocity, and the preselection of the few
+// nearest of them for the keep-out constraints of each stage from a uniform grid.
+
+namespace mav_nmpc_tracker {
+
+// nonlinear keep-out constraints per stage of a solver generated with --obstacle_slots
+constexpr int kObstacleSlots = 4;
+// stage parameters of a slot, after the model parameters: center, semi-axes
+constexpr int kObstacleSlotParams = 6;
+constexpr int kNumObstacleParams = kObstacleSlots * kObstacleSlotParams;
+
+typedef Eigen::Matrix<double, kObstacleSlotParams, kObstacleSlots> ObstacleSlots;
+
+struct Obstacle {
+    Eigen::Vector3d position = Eigen::Vector3d::Zero();  // at stamp
+    Eigen::Vector3d velocity = Eigen::Vector3d::Zero();
+    Eigen::Vector3d radii = Eigen::Vector3d::Ones();     // semi-axes
+    double stamp = 0.0;
+
+    Eigen::Vector3d position_at(double time) const { return position + (time - stamp) * velocity; }
+    // center distance less the largest semi-axis, a lower bound of the distance to the surface
+    double distance(const Eigen::Vector3d &p, double time) const
+    {
+        return (p - position_at(time)).norm() - radii.maxCoeff();
+    }
+};
+
+// every slot far away, with large semi-axes so that its constraint is inactive and nearly flat
+ObstacleSlots empty_obstacle_slots();
+// slot of the obstacle at time, its semi-axes grown by margin
+void set_obstacle_slot(ObstacleSlots &slots, int slot, const Obstacle &obstacle, double time, double margin);
+
+struct ObstacleIndexParam {
+    double cell_size = 2.0;  // m, edge of the grid cells
+    double range = 4.0;      // m, obstacles further from a stage than this are not constrained
+};
+
+// Obstacles bucketed in a uniform grid by their position at the stamp of the set. A query only visits
+// the cells within the range, grown by the largest semi-axis and by what the fastest obstacle covers
+// until the query time, so its cost depends on the obstacles nearby and not on how many there are.
+class ObstacleIndex {
+public:
+    explicit ObstacleIndex(const ObstacleIndexParam &param = ObstacleIndexParam());
+
+    void set_obstacles(const std::vector<Obstacle> &obstacles);
+    const std::vector<Obstacle> &obstacles() const { return obstacles_; }
+
+    // the at most max_count obstacles nearest to p at time and within the range, nearest first
+    const std::vector<int> &nearest(const Eigen::Vector3d &p, double time, int max_count);
+    // same testing every obstacle, for the benchmarks
+    const std::vector<int> &nearest_brute_force(const Eigen::Vector3d &p, double time, int max_count);
+    // obstacles tested by the last query
+    int tests() const { return tests_; }
+
+private:
+    Eigen::Vector3i cell_of(const Eigen::Vector3d &p) const;
+    static long long cell_key(const Eigen::Vector3i &cell);
+    void test(int index, const Eigen::Vector3d &p, double time);
+    const std::vector<int> &select(int max_count);
+
+    ObstacleIndexParam param_;
+    std::vector<Obstacle> obstacles_;
+    std::vector<std::pair<long long, int>> cells_;  // cell key and obstacle, sorted by key
+    double stamp_;       // newest stamp of the obstacles, the time of the grid positions
+    double max_speed_;
+    double max_radius_;
+    // scratch of the queries
+    std::vector<std::pair<double, int>> candidates_;
+    std::vector<int> nearest_;
+    int tests_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_OBSTACLES_H
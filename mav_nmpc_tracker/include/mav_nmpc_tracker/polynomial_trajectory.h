@@ -0,0 +1,54 @@
+#ifndef MAV_NMPC_TRACKER_POLYNOMIAL_TRAJECTORY_H
+#define MAV_NMPC_TRACKER_POLYNOMIAL_TRAJECTORY_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+// Piecewise polynomial trajectory of the position, as sent once per replan by a planner instead of a
+// stream of sampled points, evaluated on board at the stage times. The stages falling into a segment
+// are evaluated together, Horner's scheme over an array of their times.
+
+namespace mav_nmpc_tracker {
+
+struct PolynomialSegment {
+    double duration = 0.0;  // s
+    // per axis, ascending powers of the time from the start of the segment
+    Eigen::Matrix<double, 3, Eigen::Dynamic> coefficients;
+};
+
+class PolynomialTrajectory {
+public:
+    // the segments one after the other from start_time (s); segments without coefficients or duration
+    // are rejected, returns false then and keeps the last trajectory
+    bool set(double start_time, const std::vector<PolynomialSegment> &segments);
+    void clear();
+
+    bool empty() const { return segments_.empty(); }
+    double start_time() const { return start_times_.empty() ? 0.0 : start_times_.front(); }
+    double end_time() const { return start_times_.empty() ? 0.0 : start_times_.back(); }
+
+    // position, velocity and, if not nullptr, acceleration at t0 plus each of the increasing offsets,
+    // one column each; held still at the first position before the start and the last one after the
+    // end. Not empty.
+    void evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                  Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations = nullptr) const;
+
+    // moves less than tolerance (m, m/s) from its position at from until to, sampled every step (s)
+    bool stationary(double from, double to, double tolerance, double step = 0.05) const;
+
+private:
+    // Horner's scheme of coefficients at the times of a row, into the columns of values
+    static void horner(const Eigen::Matrix<double, 3, Eigen::Dynamic> &coefficients, const Eigen::ArrayXd &times,
+                       Eigen::Ref<Eigen::Matrix3Xd> values);
+
+    std::vector<PolynomialSegment> segments_;
+    // and of their first and second derivatives
+    std::vector<Eigen::Matrix<double, 3, Eigen::Dynamic>> velocity_coefficients_;
+    std::vector<Eigen::Matrix<double, 3, Eigen::Dynamic>> acceleration_coefficients_;
+    std::vector<double> start_times_;  // of the segments and the end, segments + 1 entries
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_POLYNOMIAL_TRAJECTORY_H
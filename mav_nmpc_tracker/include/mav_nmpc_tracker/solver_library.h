@@ -0,0 +1,81 @@
+#ifndef MAV_NMPC_TRACKER_SOLVER_LIBRARY_H
+#define MAV_NMPC_TRACKER_SOLVER_LIBRARY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "acados_solver_mav_nmpc_tracker_model.h"
+
+// Generated acados solvers as function tables, the one linked into the node or ones loaded at
+// runtime with dlopen from their ACADOS_*_solver.json descriptors. Variants have to be generated
+// from the same model, with other horizons, integrators or QP solvers: their capsules are used
+// through the mav_nmpc_tracker_model capsule type, whose leading acados objects are the same.
+// Solvers of other models, the MHE, are opened without that check and their capsules are only
+// passed through the function table and the acados objects it returns.
+
+namespace mav_nmpc_tracker {
+
+// What a generated solver was built with, read from its json
+struct SolverDescriptor {
+    std::string json_file;
+    std::string library_path;  // libacados_ocp_solver_<model>.so
+    std::string model_name;
+    int N = 0;
+    double tf = 0.0;
+    std::vector<double> time_steps;
+    int nx = 0, nu = 0, ny = 0, ny_e = 0;
+    int np = 0;  // stage parameters, kNumModelParams, and kNumObstacleParams more with the obstacles, or 0
+    int ng = 0;  // general linear constraints per stage, kCorridorFaces or 0 for one generated without
+    int nh = 0;  // nonlinear constraints per stage, kObstacleSlots or 0 for one generated without
+    std::string qp_solver;
+    std::string integrator_type;
+    std::string nlp_solver_type;
+};
+
+// Reads the descriptor, throws std::runtime_error if the json or the library is not there.
+// The library is looked up in code_export_directory, then in solver/ next to the json.
+SolverDescriptor read_solver_descriptor(const std::string &json_file);
+
+class SolverLibrary {
+public:
+    typedef mav_nmpc_tracker_model_solver_capsule Capsule;
+
+    // the solver linked into the node
+    static std::shared_ptr<const SolverLibrary> linked();
+    // dlopen()s the library of the descriptor, throws std::runtime_error on failure or if its
+    // dimensions are not the ones of the linked model
+    static std::shared_ptr<const SolverLibrary> load(const SolverDescriptor &descriptor);
+    // dlopen()s the library of the descriptor whatever its model, throws std::runtime_error on failure
+    static std::shared_ptr<const SolverLibrary> open(const SolverDescriptor &descriptor);
+    ~SolverLibrary();
+
+    SolverLibrary(const SolverLibrary &) = delete;
+    SolverLibrary &operator=(const SolverLibrary &) = delete;
+
+    // generated functions, <model>_acados_*
+    Capsule *(*create_capsule)();
+    int (*free_capsule)(Capsule *);
+    int (*create_with_discretization)(Capsule *, int, double *);
+    int (*solve)(Capsule *);
+    int (*free_solver)(Capsule *);
+    int (*update_params)(Capsule *, int, double *, int);
+    ocp_nlp_in *(*get_nlp_in)(Capsule *);
+    ocp_nlp_out *(*get_nlp_out)(Capsule *);
+    ocp_nlp_solver *(*get_nlp_solver)(Capsule *);
+    ocp_nlp_config *(*get_nlp_config)(Capsule *);
+    void *(*get_nlp_opts)(Capsule *);
+    ocp_nlp_dims *(*get_nlp_dims)(Capsule *);
+
+    const SolverDescriptor &descriptor() const { return descriptor_; }
+
+private:
+    SolverLibrary();
+
+    void *handle_;  // nullptr for the linked one
+    SolverDescriptor descriptor_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_SOLVER_LIBRARY_H
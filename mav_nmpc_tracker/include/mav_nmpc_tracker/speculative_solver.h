@@ -0,0 +1,65 @@
+#ifndef MAV_NMPC_TRACKER_SPECULATIVE_SOLVER_H
+#define MAV_NMPC_TRACKER_SPECULATIVE_SOLVER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+// Speculative NMPC solve: the warm started and the reset problem are solved in parallel on
+// two capsules, instead of solving the reset problem only after the warm start failed
+
+namespace mav_nmpc_tracker {
+
+class SpeculativeSolver {
+public:
+    // cpu_warm / cpu_cold: cores the two solver threads are pinned to, negative for no pinning
+    // deadline: s from the start of a solve after which a feasible reset answer is taken over the warm
+    // solve still running, 0 to always wait for the warm one
+    SpeculativeSolver(const MpcFormulationParam &param, int cpu_warm = -1, int cpu_cold = -1,
+                      double deadline = 0.0);
+    ~SpeculativeSolver();
+
+    SpeculativeSolver(const SpeculativeSolver &) = delete;
+    SpeculativeSolver &operator=(const SpeculativeSolver &) = delete;
+
+    int N() const { return warm_.solver->N(); }
+
+    // Solves both problems and returns the solver of the warm started one if it is feasible, of the
+    // reset one if the warm solve failed or missed the deadline, nullptr if both failed. The solve not
+    // used may still be running, it is waited for on the next call.
+    const NmpcTrackerSolver *solve(const StateVector &x0, const RefTrajectory &yref_traj,
+                                   const TerminalRefVector &yref_e,
+                                   const StateTrajectory &x_warm, const InputTrajectory &u_warm,
+                                   const StateTrajectory &x_cold, const InputTrajectory &u_cold);
+
+    // the reset problem gave the answer of the last call
+    bool last_used_cold() const { return last_used_cold_; }
+
+private:
+    struct Worker {
+        std::unique_ptr<NmpcTrackerSolver> solver;
+        std::thread thread;
+        bool job = false;    // guarded by mutex_
+        bool done = true;    // guarded by mutex_
+        int status = 0;      // guarded by mutex_
+    };
+
+    void worker_loop(Worker *worker, int cpu);
+    void wait_idle(std::unique_lock<std::mutex> &lock);
+
+    Worker warm_;
+    Worker cold_;
+    std::mutex mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+    double deadline_;  // s, 0 for none
+    bool running_;
+    bool last_used_cold_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_SPECULATIVE_SOLVER_H
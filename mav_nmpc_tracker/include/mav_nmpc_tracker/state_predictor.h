@@ -0,0 +1,87 @@
+#ifndef MAV_NMPC_TRACKER_STATE_PREDICTOR_H
+#define MAV_NMPC_TRACKER_STATE_PREDICTOR_H
+
+#include <array>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+#include "acados_sim_solver_mav_nmpc_tracker_model.h"
+
+// Latency compensation, the measured state is integrated with the generated acados sim solver
+// over the commands already sent, up to the time the next command takes effect
+
+namespace mav_nmpc_tracker {
+
+// Online estimate of one delay, exponentially weighted mean of the samples in seconds
+class DelayEstimator {
+public:
+    // weight of a new sample, 1 / number of samples averaged over
+    explicit DelayEstimator(double alpha = 0.05) : alpha_(alpha), estimate_(0.0), count_(0) {}
+
+    void add(double delay)
+    {
+        delay = delay > 0.0 ? delay : 0.0;
+        // the plain mean until the weights catch up, to not start from 0
+        const double weight = count_ * alpha_ < 1.0 ? 1.0 / (count_ + 1) : alpha_;
+        estimate_ += weight * (delay - estimate_);
+        count_++;
+    }
+    double estimate() const { return estimate_; }
+    unsigned long count() const { return count_; }
+
+private:
+    double alpha_;
+    double estimate_;
+    unsigned long count_;
+};
+
+class StatePredictor {
+public:
+    // Creates the sim capsule, throws std::runtime_error on failure.
+    // max_horizon: longest prediction in seconds, longer ones are cut
+    explicit StatePredictor(double max_horizon = 0.1);
+    ~StatePredictor();
+
+    StatePredictor(const StatePredictor &) = delete;
+    StatePredictor &operator=(const StatePredictor &) = delete;
+
+    // model parameters of the sim solver, returns false for one generated without them
+    bool set_model_params(const ModelParamVector &p);
+
+    // command sent at time t, in model units (roll, pitch, mass divided thrust), held until the next one;
+    // times are increasing, an earlier one clears the history
+    void add_command(double t, const InputVector &u);
+
+    // x_meas measured at t_meas integrated to t_target with the commands in between,
+    // the command before the first one sent is hover
+    StateVector predict(const StateVector &x_meas, double t_meas, double t_target);
+
+    // sim_solve calls of the last prediction
+    int last_steps() const { return last_steps_; }
+
+private:
+    struct Command {
+        double t;
+        InputVector u;
+    };
+    static constexpr int kHistory = 64;
+    // command in effect at time t
+    int command_index(double t) const;
+    void integrate(StateVector &x, const InputVector &u, double T);
+
+    double max_horizon_;
+    // ring buffer, oldest at head_
+    std::array<Command, kHistory> commands_;
+    int head_;
+    int size_;
+    int last_steps_;
+
+    sim_solver_capsule *capsule_;
+    sim_config *sim_config_;
+    void *sim_dims_;
+    sim_in *sim_in_;
+    sim_out *sim_out_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_STATE_PREDICTOR_H
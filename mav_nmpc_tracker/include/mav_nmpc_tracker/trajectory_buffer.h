@@ -0,0 +1,70 @@
+#ifndef MAV_NMPC_TRACKER_TRAJECTORY_BUFFER_H
+#define MAV_NMPC_TRACKER_TRAJECTORY_BUFFER_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+// Trajectory reference indexed by absolute time. The samples of the messages are kept in a ring
+// buffer that slides with the clock, and the reference is evaluated at any time with cubic Hermite
+// interpolation of the positions and velocities, so the stage times need not match the sample times
+// and a trajectory only has to be sent once.
+
+namespace mav_nmpc_tracker {
+
+struct TrajectorySample {
+    double time = 0.0;  // s, header stamp plus time_from_start
+    Eigen::Vector3d position = Eigen::Vector3d::Zero();
+    Eigen::Vector3d velocity = Eigen::Vector3d::Zero();
+};
+
+// central differences of the positions for samples without velocities, zero for a single one
+void estimate_velocities(std::vector<TrajectorySample> &samples);
+
+class TrajectoryBuffer {
+public:
+    // capacity: samples kept, the longest trajectory; keep_past: s, samples older than that before the
+    // time of a drop_before() are dropped
+    explicit TrajectoryBuffer(int capacity = 4096, double keep_past = 0.5);
+
+    // a message, its samples in increasing time, replaces the samples from its first one on; as many as
+    // there is room for are kept, returns their number
+    int insert(const std::vector<TrajectorySample> &samples);
+    void clear();
+    void drop_before(double time);
+
+    bool empty() const { return size_ == 0; }
+    int size() const { return size_; }
+    double start_time() const { return at(0).time; }
+    double end_time() const { return at(size_ - 1).time; }
+
+    // position, velocity and acceleration at time, any of them may be nullptr; the first position is
+    // held still before the start and the last one after the end. Not empty.
+    void evaluate(double time, Eigen::Vector3d *position, Eigen::Vector3d *velocity = nullptr,
+                  Eigen::Vector3d *acceleration = nullptr) const;
+    // same at t0 plus each of the increasing offsets, one column each, the accelerations if not nullptr;
+    // the segments are walked forward from the one of the first time instead of searched for every offset
+    void evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                  Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations = nullptr) const;
+
+    // moves less than tolerance (m, m/s) from its position at from until to
+    bool stationary(double from, double to, double tolerance) const;
+
+private:
+    const TrajectorySample &at(int i) const { return samples_[(head_ + i) % samples_.size()]; }
+    TrajectorySample &at(int i) { return samples_[(head_ + i) % samples_.size()]; }
+    // last sample at or before time, -1 before the start
+    int segment(double time) const;
+    void interpolate(int iSegment, double time, Eigen::Vector3d *position, Eigen::Vector3d *velocity,
+                     Eigen::Vector3d *acceleration) const;
+
+    // ring buffer, oldest at head_
+    std::vector<TrajectorySample> samples_;
+    int head_;
+    int size_;
+    double keep_past_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_TRAJECTORY_BUFFER_H
@@ -0,0 +1,132 @@
+#ifndef MAV_NMPC_TRACKER_TRAJECTORY_LIBRARY_H
+#define MAV_NMPC_TRACKER_TRAJECTORY_LIBRARY_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+// Pre-planned mission in a memory-mapped file, a table of samples by mission time, played back on board
+// instead of streamed. Only the pages of the samples looked up are read: the window of a cycle is found
+// by walking on from the last one, and after a seek by a binary search of the segment index, then of
+// the samples of the segment. Between two samples the position is the quintic Hermite polynomial of
+// their positions, velocities and accelerations.
+//
+// File: TrajectoryLibraryHeader, segment_count LibrarySegment, then sample_count LibrarySample with
+// increasing times. The segments, the legs of the mission, split the samples; the first one starts at
+// the first sample.
+
+namespace mav_nmpc_tracker {
+
+struct TrajectoryLibraryHeader {
+    char magic[8];  // "TRAJLIB1"
+    int64_t sample_count;
+    int64_t segment_count;
+    int64_t reserved;
+};
+
+struct LibrarySegment {
+    double start_time;  // s, of its first sample
+    int64_t first_sample;
+};
+
+struct LibrarySample {
+    double time;  // s, mission time
+    double position[3];
+    double velocity[3];
+    double acceleration[3];
+    double yaw;   // rad
+};
+
+class TrajectoryLibrary {
+public:
+    // maps the file read only; throws std::runtime_error if it cannot be mapped or is not a library
+    explicit TrajectoryLibrary(const std::string &path);
+    ~TrajectoryLibrary();
+
+    TrajectoryLibrary(const TrajectoryLibrary &) = delete;
+    TrajectoryLibrary &operator=(const TrajectoryLibrary &) = delete;
+
+    // writes a library file, the segments by their first sample, throws std::runtime_error on failure
+    static void write(const std::string &path, const std::vector<LibrarySample> &samples,
+                      const std::vector<int64_t> &segment_starts);
+
+    long long sample_count() const { return sample_count_; }
+    int segment_count() const { return static_cast<int>(segment_count_); }
+    double start_time() const { return samples_[0].time; }
+    double end_time() const { return samples_[sample_count_ - 1].time; }
+    // segment of the mission time, -1 before the start
+    int segment(double time) const;
+
+    // position, velocity and, if not nullptr, acceleration and yaw at t0 plus each of the increasing
+    // offsets, one column or entry each; held still at the first sample before the start and the last one
+    // after the end
+    void evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                  Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations = nullptr,
+                  Eigen::VectorXd *yaws = nullptr);
+
+    // moves less than tolerance (m, m/s) from its position at from until to
+    bool stationary(double from, double to, double tolerance);
+
+    // lookups that needed a binary search, the others walked on from the last one
+    unsigned long searches() const { return searches_; }
+
+private:
+    // last sample at or before time, -1 before the start; walked on from the cursor if close
+    long long find(double time);
+    long long search(double time) const;
+    void interpolate(long long iSample, double time, Eigen::Vector3d *position, Eigen::Vector3d *velocity,
+                     Eigen::Vector3d *acceleration, double *yaw) const;
+
+    void *mapping_;
+    size_t mapping_size_;
+    const LibrarySegment *segments_;
+    const LibrarySample *samples_;
+    long long sample_count_;
+    long long segment_count_;
+    long long cursor_;  // last sample found
+    unsigned long searches_;
+};
+
+// Mission time of the library over the clock, advancing while playing
+class LibraryPlayback {
+public:
+    bool playing() const { return playing_; }
+    // s, at the clock time
+    double mission_time(double time) const { return playing_ ? mission_time_ + time - time_ : mission_time_; }
+    // clock time the mission time is reached at, +inf while paused
+    double clock_time(double mission_time) const
+    {
+        return playing_ ? time_ + mission_time - mission_time_ : std::numeric_limits<double>::infinity();
+    }
+
+    void start(double time)
+    {
+        mission_time_ = mission_time(time);
+        time_ = time;
+        playing_ = true;
+    }
+    void pause(double time)
+    {
+        mission_time_ = mission_time(time);
+        time_ = time;
+        playing_ = false;
+    }
+    // playing or paused as before
+    void seek(double mission_time, double time)
+    {
+        mission_time_ = mission_time;
+        time_ = time;
+    }
+
+private:
+    bool playing_ = false;
+    double mission_time_ = 0.0;
+    double time_ = 0.0;  // clock time of mission_time_
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_TRAJECTORY_LIBRARY_H
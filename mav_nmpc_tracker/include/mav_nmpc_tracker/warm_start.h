@@ -0,0 +1,107 @@
+#ifndef MAV_NMPC_TRACKER_WARM_START_H
+#define MAV_NMPC_TRACKER_WARM_START_H
+
+#include <vector>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+// Initial guesses of the NMPC plan, chosen from the last solve and how far the reference jumped
+
+namespace mav_nmpc_tracker {
+
+enum class WarmStartStrategy {
+    kShift,      // last plan shifted by one stage, terminal stage integrated with the input reference
+    kBlend,      // convex blend of kShift and kReference
+    kReference,  // reference positions and velocities, attitude and thrust of its input reference
+    kHover,      // every stage at the current state with the hover input of the model, the old reset
+};
+
+const char *warm_start_strategy_name(WarmStartStrategy strategy);
+
+struct WarmStartParam {
+    // largest change of the reference, over pos [m] and vel [m/s] of one stage, between two cycles
+    // up to which the shifted plan is used, and from which the reference alone is used
+    double jump_small = 0.3;
+    double jump_large = 1.5;
+};
+
+// explicit model of nmpc_tracker_solver.py, x_dot = f(x, u)
+StateVector mav_dynamics(const MpcFormulationParam &param, const StateVector &x, const InputVector &u);
+// one RK4 step of dt with u held
+StateVector integrate_mav_dynamics(const MpcFormulationParam &param, const StateVector &x,
+                                   const InputVector &u, double dt);
+// roll, pitch and mass divided thrust of the acceleration acc against gravity at yaw, without drag
+Eigen::Vector3d acceleration_attitude(const Eigen::Vector3d &acc, double yaw);
+// inputs of the model, flat in position, flying the acceleration acc at the velocity vel and yaw with
+// the attitude settled: through the gains, against the drag and the disturbance of param, within the
+// input limits
+InputVector feedforward_input(const MpcFormulationParam &param, const Eigen::Vector3d &acc,
+                              const Eigen::Vector3d &vel, double yaw);
+
+// Plan on the stages of one horizon onto the stages of another: states linearly interpolated in
+// time, controls held, both held past the end of the old horizon
+void resample_plan(const std::vector<double> &time_steps_from, const StateTrajectory &x_from,
+                   const InputTrajectory &u_from, const std::vector<double> &time_steps_to,
+                   StateTrajectory &x_to, InputTrajectory &u_to);
+
+// Same for a stage reference, linearly interpolated and held past the end of the old horizon
+void resample_reference(const std::vector<double> &time_steps_from, const RefTrajectory &yref_from,
+                        const std::vector<double> &time_steps_to, RefTrajectory &yref_to);
+
+class WarmStart {
+public:
+    // on the time steps of param, horizon_time_steps(), the plan is shifted by the first one
+    WarmStart(const MpcFormulationParam &param, const WarmStartParam &warm_param = WarmStartParam());
+
+    // Picks the strategy from the feasibility of the last solve and the jump of yref_traj against
+    // the reference of the last call, and builds the guess into x_init and u_init.
+    // x_plan and u_plan are the last solution, only read when it was feasible.
+    WarmStartStrategy build(bool last_feasible, const StateVector &x0, const StateTrajectory &x_plan,
+                            const InputTrajectory &u_plan, const RefTrajectory &yref_traj,
+                            StateTrajectory &x_init, InputTrajectory &u_init);
+    // builds with a given strategy, the reference is remembered for the next jump as well
+    void build_strategy(WarmStartStrategy strategy, const StateVector &x0, const StateTrajectory &x_plan,
+                        const InputTrajectory &u_plan, const RefTrajectory &yref_traj,
+                        StateTrajectory &x_init, InputTrajectory &u_init);
+
+    // reference the next jump is measured against, of a previous horizon resampled onto this one
+    void set_last_reference(const RefTrajectory &yref_traj);
+    // model of the guesses, e.g. with the identified parameters or the disturbance; the horizon stays
+    // the one of construction
+    void set_model(const MpcFormulationParam &param);
+
+    // jump of the reference of the last call, and the weight of the reference in kBlend
+    double last_jump() const { return last_jump_; }
+    double blend_weight() const { return blend_weight_; }
+    WarmStartStrategy last_strategy() const { return last_strategy_; }
+
+private:
+    double reference_jump(const RefTrajectory &yref_traj) const;
+    // where stage iStage lands in the last plan, one first step later
+    void shifted_stage(int iStage, int &iFrom, double &ratio) const;
+    void build_shift(const StateTrajectory &x_plan, const InputTrajectory &u_plan, const RefTrajectory &yref_traj,
+                     StateTrajectory &x_init, InputTrajectory &u_init) const;
+    void build_reference(const StateVector &x0, const RefTrajectory &yref_traj,
+                         StateTrajectory &x_init, InputTrajectory &u_init) const;
+    void build_hover(const StateVector &x0, StateTrajectory &x_init, InputTrajectory &u_init) const;
+
+    MpcFormulationParam param_;
+    WarmStartParam warm_param_;
+    int N_;
+    std::vector<double> time_steps_;
+    std::vector<double> stage_times_;  // N + 1 entries
+
+    RefTrajectory last_yref_;
+    bool has_last_yref_;
+    double last_jump_;
+    double blend_weight_;
+    WarmStartStrategy last_strategy_;
+
+    // scratch for kBlend
+    StateTrajectory x_ref_;
+    InputTrajectory u_ref_;
+};
+
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_WARM_START_H
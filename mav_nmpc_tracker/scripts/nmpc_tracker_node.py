@@ -10,7 +10,7 @@ from trajectory_msgs.msg import MultiDOFJointTrajectory
 from geometry_msgs.msg import Point
 from visualization_msgs.msg import Marker
 from nmpc_tracker_solver import MPC_Formulation_Param
-from nmpc_tracker_solver import acados_mpc_solver_generation
+from nmpc_tracker_solver import cached_acados_mpc_solver
 
 g = 9.8066
 
@@ -55,7 +55,7 @@ class Mav_Nmpc_Tracker:
         self.mpc_success_ = False
 
         # MPC solver
-        self.mpc_solver_ = acados_mpc_solver_generation(self.mpc_form_param_)
+        self.mpc_solver_ = cached_acados_mpc_solver(self.mpc_form_param_)
 
         # ROS subscriber
         # self.odom_sub_ = rospy.Subscriber("/mav_sim_odom", Odometry, self.set_odom)
@@ -357,6 +357,7 @@ def nmpc_tracker_control():
     mpc_form_param.pitch_gain = rospy.get_param("~pitch_gain")
     mpc_form_param.drag_coefficient_x = rospy.get_param("~drag_coefficient_x")
     mpc_form_param.drag_coefficient_y = rospy.get_param("~drag_coefficient_y")
+    mpc_form_param.thrust_gain = rospy.get_param("~thrust_gain", 1.0)
     # control bound
     mpc_form_param.roll_max = np.deg2rad(rospy.get_param("~roll_max"))
     mpc_form_param.pitch_max = np.deg2rad(rospy.get_param("~pitch_max"))
@@ -1,3 +1,8 @@
+import fcntl
+import hashlib
+import inspect
+import os
+import time
 import numpy as np
 from dataclasses import dataclass
 import casadi as cd
@@ -29,6 +34,11 @@ class MPC_Formulation_Param:
     pitch_gain = 1.0
     drag_coefficient_x = 0.01
     drag_coefficient_y = 0.01
+    thrust_gain = 1.0               # actual over commanded thrust
+    # constant external acceleration, mass divided force, of the disturbance observer
+    disturbance_x = 0.0
+    disturbance_y = 0.0
+    disturbance_z = 0.0
     # control bound
     roll_max = np.deg2rad(25)
     pitch_max = np.deg2rad(25)
@@ -44,13 +54,55 @@ class MPC_Formulation_Param:
     r_roll = 50
     r_pitch = 50
     r_thrust = 1
+    # penalties of the corridor slacks, linear and quadratic
+    corridor_slack_l1 = 1000
+    corridor_slack_l2 = 100
+    # penalties of the distance field slacks, linear and quadratic
+    esdf_slack_l1 = 1000
+    esdf_slack_l2 = 100
+    # penalties of the obstacle slacks, linear and quadratic
+    obstacle_slack_l1 = 1000
+    obstacle_slack_l2 = 100
 
 
-def acados_mpc_solver_generation(mpc_form_param):
-    # Acados model
-    model = AcadosModel()
-    model.name = "mav_nmpc_tracker_model"
+# Fields baked into the generated code, the weights, control bounds and model parameters are set at runtime
+SOLVER_CODE_FIELDS = ('dt', 'N', 'Tf')
+# Module constants baked into the generated code, defined below
+SOLVER_CODE_CONSTANTS = ('g', 'MODEL_PARAM_FIELDS', 'OBSTACLE_SLOT_FIELDS', 'EMPTY_OBSTACLE_SLOT')
+
+# Stage parameters of the model, in this order
+MODEL_PARAM_FIELDS = ('roll_time_constant', 'roll_gain', 'pitch_time_constant', 'pitch_gain',
+                      'drag_coefficient_x', 'drag_coefficient_y', 'thrust_gain',
+                      'disturbance_x', 'disturbance_y', 'disturbance_z')
+
+
+# Stage parameters of an obstacle slot, after the model parameters: center, semi-axes
+OBSTACLE_SLOT_FIELDS = ('center_x', 'center_y', 'center_z', 'radius_x', 'radius_y', 'radius_z')
+# an empty slot, far away and large so that its constraint is inactive and nearly flat
+EMPTY_OBSTACLE_SLOT = (1e4, 1e4, 1e4, 1e3, 1e3, 1e3)
+
+
+def model_param_values(mpc_form_param):
+    return np.array([getattr(mpc_form_param, field) for field in MODEL_PARAM_FIELDS], dtype=float)
+
 
+def empty_obstacle_values(obstacle_slots):
+    return np.tile(np.array(EMPTY_OBSTACLE_SLOT, dtype=float), obstacle_slots)
+
+
+def slack_penalties(mpc_form_param, corridor_faces, esdf_rows, obstacle_slots):
+    # linear and quadratic, in the order of acados, the general then the nonlinear constraints
+    z = np.concatenate((mpc_form_param.corridor_slack_l1 * np.ones(corridor_faces),
+                        mpc_form_param.esdf_slack_l1 * np.ones(esdf_rows),
+                        mpc_form_param.obstacle_slack_l1 * np.ones(obstacle_slots)))
+    Z = np.concatenate((mpc_form_param.corridor_slack_l2 * np.ones(corridor_faces),
+                        mpc_form_param.esdf_slack_l2 * np.ones(esdf_rows),
+                        mpc_form_param.obstacle_slack_l2 * np.ones(obstacle_slots)))
+    return z, Z
+
+
+def mav_dynamics():
+    # The MAV model shared by the MPC and the MHE: state, control, model parameters and explicit dynamics
     # state
     px = cd.MX.sym('px')
     py = cd.MX.sym('py')
@@ -81,26 +133,51 @@ def acados_mpc_solver_generation(mpc_form_param):
     yaw_dot = cd.MX.sym('yaw_dot')
     x_dot = cd.vertcat(px_dot, py_dot, pz_dot, vx_dot, vy_dot, vz_dot, roll_dot, pitch_dot, yaw_dot)
 
+    # model parameters, MODEL_PARAM_FIELDS, set per stage at runtime
+    roll_time_constant = cd.MX.sym('roll_time_constant')
+    roll_gain = cd.MX.sym('roll_gain')
+    pitch_time_constant = cd.MX.sym('pitch_time_constant')
+    pitch_gain = cd.MX.sym('pitch_gain')
+    drag_coefficient_x = cd.MX.sym('drag_coefficient_x')
+    drag_coefficient_y = cd.MX.sym('drag_coefficient_y')
+    thrust_gain = cd.MX.sym('thrust_gain')
+    disturbance_x = cd.MX.sym('disturbance_x')
+    disturbance_y = cd.MX.sym('disturbance_y')
+    disturbance_z = cd.MX.sym('disturbance_z')
+    p = cd.vertcat(roll_time_constant, roll_gain, pitch_time_constant, pitch_gain,
+                   drag_coefficient_x, drag_coefficient_y, thrust_gain, disturbance_x, disturbance_y, disturbance_z)
+    thrust = thrust_gain * thrust_cmd
+
     # drag
-    drag_acc_x = np.cos(pitch)*np.cos(yaw)*mpc_form_param.drag_coefficient_x*thrust_cmd*vx \
-                 - np.cos(pitch)*np.sin(yaw)*mpc_form_param.drag_coefficient_x*thrust_cmd*vy \
-                 + np.sin(pitch)*mpc_form_param.drag_coefficient_x*thrust_cmd*vz
-    drag_acc_y = (np.cos(roll)*np.sin(yaw) - np.cos(yaw)*np.sin(pitch)*np.sin(roll))*mpc_form_param.drag_coefficient_y*thrust_cmd*vx \
-                 - (np.cos(roll)*np.cos(yaw) + np.sin(pitch)*np.sin(roll)*np.sin(yaw))*mpc_form_param.drag_coefficient_y*thrust_cmd*vy \
-                 - np.cos(pitch)*np.sin(roll)*mpc_form_param.drag_coefficient_y*thrust_cmd*vz
+    drag_acc_x = np.cos(pitch)*np.cos(yaw)*drag_coefficient_x*thrust*vx \
+                 - np.cos(pitch)*np.sin(yaw)*drag_coefficient_x*thrust*vy \
+                 + np.sin(pitch)*drag_coefficient_x*thrust*vz
+    drag_acc_y = (np.cos(roll)*np.sin(yaw) - np.cos(yaw)*np.sin(pitch)*np.sin(roll))*drag_coefficient_y*thrust*vx \
+                 - (np.cos(roll)*np.cos(yaw) + np.sin(pitch)*np.sin(roll)*np.sin(yaw))*drag_coefficient_y*thrust*vy \
+                 - np.cos(pitch)*np.sin(roll)*drag_coefficient_y*thrust*vz
 
     # dynamics
     dyn_f_expl = cd.vertcat(
         vx,
         vy,
         vz,
-        (cd.cos(roll) * cd.cos(yaw) * cd.sin(pitch) + cd.sin(roll) * cd.sin(yaw)) * thrust_cmd  - drag_acc_x,
-        (cd.cos(roll) * cd.sin(pitch) * cd.sin(yaw) - cd.cos(yaw) * cd.sin(roll)) * thrust_cmd  - drag_acc_y,
-        -g + cd.cos(pitch) * cd.cos(roll) * thrust_cmd,
-        (mpc_form_param.roll_gain * roll_cmd - roll) / mpc_form_param.roll_time_constant,
-        (mpc_form_param.pitch_gain * pitch_cmd - pitch) / mpc_form_param.pitch_time_constant,
+        (cd.cos(roll) * cd.cos(yaw) * cd.sin(pitch) + cd.sin(roll) * cd.sin(yaw)) * thrust  - drag_acc_x + disturbance_x,
+        (cd.cos(roll) * cd.sin(pitch) * cd.sin(yaw) - cd.cos(yaw) * cd.sin(roll)) * thrust  - drag_acc_y + disturbance_y,
+        -g + cd.cos(pitch) * cd.cos(roll) * thrust + disturbance_z,
+        (roll_gain * roll_cmd - roll) / roll_time_constant,
+        (pitch_gain * pitch_cmd - pitch) / pitch_time_constant,
         0
     )
+    return x, u, x_dot, p, dyn_f_expl
+
+
+def acados_mpc_solver_generation(mpc_form_param, code_export_directory=None, json_file='ACADOS_nmpc_tracker_solver.json',
+                                 qp_solver='FULL_CONDENSING_QPOASES', integrator_type='ERK', qp_solver_cond_N=5,
+                                 corridor_faces=0, esdf_rows=0, obstacle_slots=0):
+    # Acados model
+    model = AcadosModel()
+    model.name = "mav_nmpc_tracker_model"
+    x, u, x_dot, p, dyn_f_expl = mav_dynamics()
     dyn_f_impl = x_dot - dyn_f_expl
 
     # acados mpc model
@@ -109,6 +186,9 @@ def acados_mpc_solver_generation(mpc_form_param):
     model.xdot = x_dot
     model.f_expl_expr = dyn_f_expl
     model.f_impl_expr = dyn_f_impl
+    # obstacle slots after the model parameters, an ellipsoid per slot set per stage in real time
+    p_obstacles = cd.MX.sym('p_obstacles', len(OBSTACLE_SLOT_FIELDS) * obstacle_slots)
+    model.p = cd.vertcat(p, p_obstacles)
 
     # Acados ocp
     ocp = AcadosOcp()
@@ -123,6 +203,8 @@ def acados_mpc_solver_generation(mpc_form_param):
 
     # initial condition, can be changed in real time
     ocp.constraints.x0 = np.zeros(nx)
+    # model parameters, can be changed in real time
+    ocp.parameter_values = np.concatenate((model_param_values(mpc_form_param), empty_obstacle_values(obstacle_slots)))
 
     # cost terms
     ocp.cost.cost_type = "LINEAR_LS"
@@ -157,12 +239,57 @@ def acados_mpc_solver_generation(mpc_form_param):
     ocp.constraints.ubu = np.array([mpc_form_param.roll_max, mpc_form_param.pitch_max, mpc_form_param.thrust_max])
     ocp.constraints.idxbu = np.array(range(nu))
 
+    # safe corridor, C x <= ug on the position with the faces of a polytope per stage, then the distance
+    # field linearized per stage, C x >= lg, all set in real time and soft with the slacks penalized
+    ng = corridor_faces + esdf_rows
+    if ng > 0:
+        C = np.zeros((ng, nx))
+        ocp.constraints.C = C
+        ocp.constraints.D = np.zeros((ng, nu))
+        ocp.constraints.lg = -1e9 * np.ones(ng)
+        ocp.constraints.ug = 1e9 * np.ones(ng)
+        ocp.constraints.C_e = C
+        ocp.constraints.lg_e = -1e9 * np.ones(ng)
+        ocp.constraints.ug_e = 1e9 * np.ones(ng)
+        ocp.constraints.idxsg = np.array(range(ng))
+        ocp.constraints.idxsg_e = np.array(range(ng))
+
+    # moving obstacles, the position outside the ellipsoid of each slot, ((p - c) / r)^2 >= 1, soft with the
+    # slacks penalized
+    if obstacle_slots > 0:
+        n_fields = len(OBSTACLE_SLOT_FIELDS)
+        h = []
+        for iSlot in range(obstacle_slots):
+            center = p_obstacles[n_fields * iSlot:n_fields * iSlot + 3]
+            radii = p_obstacles[n_fields * iSlot + 3:n_fields * (iSlot + 1)]
+            h.append(cd.sumsqr((x[:3] - center) / radii))
+        model.con_h_expr = cd.vertcat(*h)
+        model.con_h_expr_e = cd.vertcat(*h)
+        ocp.constraints.lh = np.ones(obstacle_slots)
+        ocp.constraints.uh = 1e9 * np.ones(obstacle_slots)
+        ocp.constraints.lh_e = np.ones(obstacle_slots)
+        ocp.constraints.uh_e = 1e9 * np.ones(obstacle_slots)
+        ocp.constraints.idxsh = np.array(range(obstacle_slots))
+        ocp.constraints.idxsh_e = np.array(range(obstacle_slots))
+
+    # slack penalties, the defaults of the generated code, set again at runtime
+    if ng + obstacle_slots > 0:
+        z, Z = slack_penalties(mpc_form_param, corridor_faces, esdf_rows, obstacle_slots)
+        ocp.cost.zl = z
+        ocp.cost.zu = z
+        ocp.cost.Zl = Z
+        ocp.cost.Zu = Z
+        ocp.cost.zl_e = z
+        ocp.cost.zu_e = z
+        ocp.cost.Zl_e = Z
+        ocp.cost.Zu_e = Z
+
     # solver options
     # horizon
     ocp.solver_options.tf = mpc_form_param.Tf
     # qp solver
-    ocp.solver_options.qp_solver = 'FULL_CONDENSING_QPOASES'    # PARTIAL_CONDENSING_HPIPM
-    ocp.solver_options.qp_solver_cond_N = 5
+    ocp.solver_options.qp_solver = qp_solver    # FULL_CONDENSING_QPOASES, PARTIAL_CONDENSING_HPIPM
+    ocp.solver_options.qp_solver_cond_N = min(qp_solver_cond_N, mpc_form_param.N)    # PARTIAL_CONDENSING_* only
     ocp.solver_options.qp_solver_iter_max = 50
     ocp.solver_options.qp_solver_warm_start = 1
     # nlp solver
@@ -175,22 +302,257 @@ def acados_mpc_solver_generation(mpc_form_param):
     # hessian
     ocp.solver_options.hessian_approx = "GAUSS_NEWTON"
     # integrator
-    ocp.solver_options.integrator_type = "ERK"
+    ocp.solver_options.integrator_type = integrator_type    # ERK, IRK
     ocp.solver_options.sim_method_num_stages = 4
     ocp.solver_options.sim_method_num_steps = 3
     # print
     ocp.solver_options.print_level = 0
     # solver generation
-    ocp.code_export_directory = str(GPARENT) + '/solver/'
+    if code_export_directory is None:
+        code_export_directory = str(GPARENT) + '/solver/'
+    ocp.code_export_directory = code_export_directory
 
     # Acados solver
     print("Starting solver generation...")
-    solver = AcadosOcpSolver(ocp, json_file='ACADOS_nmpc_tracker_solver.json')
+    solver = AcadosOcpSolver(ocp, json_file=json_file)
     print("Solver generated.")
 
     return solver
 
 
+@dataclass
+class MHE_Formulation_Param:
+    # window of N + 1 odometry samples, dt apart nominally, the steps are set at runtime
+    dt = 0.025
+    N = 20
+    # measurement weights, inverse variances of the odometry
+    r_pos = 1e4
+    r_vel = 1e2
+    r_att = 1e3
+    # process noise weights, on the state derivative and the drift of the disturbance
+    q_pos = 1e4
+    q_vel = 1e1
+    q_att = 1e1
+    q_dist = 1e0
+    # arrival cost
+    p0_state = 1e2
+    p0_dist = 1e0
+
+
+# Stage parameters of the MHE: the command held over the stage, then the model parameters
+MHE_PARAM_FIELDS = ('roll_cmd', 'pitch_cmd', 'thrust_cmd') + MODEL_PARAM_FIELDS
+
+
+def acados_mhe_solver_generation(mhe_form_param, mpc_form_param, code_export_directory=None,
+                                 json_file='ACADOS_nmpc_tracker_mhe.json', qp_solver='FULL_CONDENSING_QPOASES'):
+    # Moving horizon estimation of the state and an external disturbance with the dynamics of the MPC.
+    # The commands sent are parameters, the controls are the process noise on every state derivative.
+    model = AcadosModel()
+    model.name = "mav_nmpc_tracker_mhe"
+    x, u, x_dot, p, dyn_f_expl = mav_dynamics()
+
+    # disturbance, mass divided force, a random walk, in place of the disturbance parameters of the model
+    dist_x = cd.MX.sym('dist_x')
+    dist_y = cd.MX.sym('dist_y')
+    dist_z = cd.MX.sym('dist_z')
+    dist = cd.vertcat(dist_x, dist_y, dist_z)
+    dist_dot = cd.MX.sym('dist_dot', 3)
+    nx = 12
+    nx_mav = 9
+    w = cd.MX.sym('w', nx)
+
+    # acados mhe model
+    model.x = cd.vertcat(x, dist)
+    model.u = w
+    model.xdot = cd.vertcat(x_dot, dist_dot)
+    model.f_expl_expr = cd.vertcat(dyn_f_expl + cd.vertcat(0, 0, 0, dist, 0, 0, 0), 0, 0, 0) + w
+    model.f_impl_expr = model.xdot - model.f_expl_expr
+    model.p = cd.vertcat(u, p)
+
+    # Acados ocp
+    ocp = AcadosOcp()
+    ocp.model = model
+    ocp.dims.N = mhe_form_param.N
+    nw = nx
+    ny = nx_mav + nw            # measured state, process noise
+    ny_0 = ny + nx              # and the arrival cost
+    ny_e = nx_mav
+    ocp.parameter_values = np.concatenate((np.array([0.0, 0.0, g]), model_param_values(mpc_form_param)))
+
+    # cost terms, no initial state constraint
+    ocp.cost.cost_type_0 = "LINEAR_LS"
+    ocp.cost.cost_type = "LINEAR_LS"
+    ocp.cost.cost_type_e = "LINEAR_LS"
+    Vx = np.zeros((ny, nx))
+    Vx[:nx_mav, :nx_mav] = np.eye(nx_mav)
+    ocp.cost.Vx = Vx
+    Vu = np.zeros((ny, nw))
+    Vu[nx_mav:, :] = np.eye(nw)
+    ocp.cost.Vu = Vu
+    Vx_0 = np.zeros((ny_0, nx))
+    Vx_0[:nx_mav, :nx_mav] = np.eye(nx_mav)
+    Vx_0[ny:, :] = np.eye(nx)
+    ocp.cost.Vx_0 = Vx_0
+    Vu_0 = np.zeros((ny_0, nw))
+    Vu_0[nx_mav:ny, :] = np.eye(nw)
+    ocp.cost.Vu_0 = Vu_0
+    ocp.cost.Vx_e = np.eye(ny_e, nx)
+    # weights, changed in real time
+    r = [mhe_form_param.r_pos] * 3 + [mhe_form_param.r_vel] * 3 + [mhe_form_param.r_att] * 3
+    q = [mhe_form_param.q_pos] * 3 + [mhe_form_param.q_vel] * 3 + [mhe_form_param.q_att] * 3 + \
+        [mhe_form_param.q_dist] * 3
+    p0 = [mhe_form_param.p0_state] * nx_mav + [mhe_form_param.p0_dist] * 3
+    ocp.cost.W_0 = np.diag(r + q + p0)
+    ocp.cost.W = np.diag(r + q)
+    ocp.cost.W_e = np.diag(r)
+    # measurements and the prior, changed in real time
+    ocp.cost.yref_0 = np.zeros(ny_0)
+    ocp.cost.yref = np.zeros(ny)
+    ocp.cost.yref_e = np.zeros(ny_e)
+
+    # solver options
+    ocp.solver_options.tf = mhe_form_param.N * mhe_form_param.dt
+    ocp.solver_options.qp_solver = qp_solver
+    ocp.solver_options.qp_solver_iter_max = 50
+    ocp.solver_options.qp_solver_warm_start = 1
+    ocp.solver_options.nlp_solver_type = "SQP_RTI"
+    ocp.solver_options.hessian_approx = "GAUSS_NEWTON"
+    ocp.solver_options.integrator_type = "ERK"
+    ocp.solver_options.sim_method_num_stages = 4
+    ocp.solver_options.sim_method_num_steps = 1
+    ocp.solver_options.print_level = 0
+    if code_export_directory is None:
+        code_export_directory = str(GPARENT) + '/solver_mhe/solver/'
+    ocp.code_export_directory = code_export_directory
+
+    print("Starting MHE generation...")
+    solver = AcadosOcpSolver(ocp, json_file=json_file)
+    print("MHE generated.")
+
+    return solver
+
+
+def solver_code_hash(mpc_form_param, **generation_options):
+    # everything the generated code depends on: the baked in fields and constants, the options of the
+    # generation with their defaults, the model and ocp definition, and the acados it is compiled against
+    content = hashlib.sha256()
+    for field in SOLVER_CODE_FIELDS:
+        content.update(('%s=%r;' % (field, float(getattr(mpc_form_param, field)))).encode())
+    for name in SOLVER_CODE_CONSTANTS:
+        content.update(('%s=%r;' % (name, globals()[name])).encode())
+    arguments = inspect.signature(acados_mpc_solver_generation).bind(mpc_form_param, **generation_options)
+    arguments.apply_defaults()
+    for name, value in sorted(arguments.arguments.items()):
+        if name not in ('mpc_form_param', 'code_export_directory', 'json_file'):
+            content.update(('%s=%r;' % (name, value)).encode())
+    for function in (mav_dynamics, model_param_values, empty_obstacle_values, acados_mpc_solver_generation):
+        content.update(inspect.getsource(function).encode())
+    content.update(os.environ.get('ACADOS_SOURCE_DIR', '').encode())
+    return content.hexdigest()[:16]
+
+
+def set_solver_model_params(solver, mpc_form_param):
+    p = model_param_values(mpc_form_param)
+    for iStage in range(mpc_form_param.N + 1):
+        solver.set(iStage, 'p', p)
+
+
+def set_solver_weights_and_bounds(solver, mpc_form_param, corridor_faces=0, esdf_rows=0, obstacle_slots=0):
+    # the constraint counts are the ones the solver was generated with
+    W = np.diag([mpc_form_param.q_x, mpc_form_param.q_y, mpc_form_param.q_z,
+                 mpc_form_param.q_vx, mpc_form_param.q_vy, mpc_form_param.q_vz,
+                 mpc_form_param.r_roll, mpc_form_param.r_pitch, mpc_form_param.r_thrust])
+    lbu = np.array([-mpc_form_param.roll_max, -mpc_form_param.pitch_max, mpc_form_param.thrust_min])
+    ubu = np.array([mpc_form_param.roll_max, mpc_form_param.pitch_max, mpc_form_param.thrust_max])
+    for iStage in range(mpc_form_param.N):
+        solver.cost_set(iStage, 'W', W)
+        solver.constraints_set(iStage, 'lbu', lbu)
+        solver.constraints_set(iStage, 'ubu', ubu)
+    solver.cost_set(mpc_form_param.N, 'W', W[:6, :6])
+    if corridor_faces + esdf_rows + obstacle_slots > 0:
+        z, Z = slack_penalties(mpc_form_param, corridor_faces, esdf_rows, obstacle_slots)
+        for iStage in range(mpc_form_param.N + 1):
+            solver.cost_set(iStage, 'zl', z)
+            solver.cost_set(iStage, 'zu', z)
+            solver.cost_set(iStage, 'Zl', Z)
+            solver.cost_set(iStage, 'Zu', Z)
+
+
+def cached_acados_mpc_solver(mpc_form_param, cache_dir=None, **generation_options):
+    # The generated solver is kept under the hash of what its code depends on, a matching one is
+    # loaded without the casadi model, code generation and compilation. generation_options are the
+    # keyword arguments of acados_mpc_solver_generation after json_file
+    if cache_dir is None:
+        ros_home = os.environ.get('ROS_HOME', os.path.join(os.path.expanduser('~'), '.ros'))
+        cache_dir = os.path.join(ros_home, 'mav_nmpc_tracker_solver_cache')
+    solver_dir = os.path.join(cache_dir, solver_code_hash(mpc_form_param, **generation_options))
+    json_file = os.path.join(solver_dir, 'ACADOS_nmpc_tracker_solver.json')
+    complete_file = os.path.join(solver_dir, 'complete')
+    os.makedirs(solver_dir, exist_ok=True)
+
+    time_start = time.time()
+    # one generation at a time, a second node waits for it and loads the result
+    with open(solver_dir + '.lock', 'w') as lock_file:
+        fcntl.flock(lock_file, fcntl.LOCK_EX)
+        if os.path.exists(complete_file):
+            solver = AcadosOcpSolver(None, json_file=json_file, build=False, generate=False)
+            print("Solver loaded from %s in %.3f s." % (solver_dir, time.time() - time_start))
+        else:
+            solver = acados_mpc_solver_generation(mpc_form_param, solver_dir + '/solver/', json_file,
+                                                  **generation_options)
+            # written last, a generation that was interrupted is redone
+            with open(complete_file, 'w') as f:
+                f.write(solver_code_hash(mpc_form_param, **generation_options) + '\n')
+            print("Solver generated into %s in %.3f s." % (solver_dir, time.time() - time_start))
+
+    set_solver_weights_and_bounds(solver, mpc_form_param,
+                                  **{name: generation_options.get(name, 0)
+                                     for name in ('corridor_faces', 'esdf_rows', 'obstacle_slots')})
+    set_solver_model_params(solver, mpc_form_param)
+    return solver
+
+
 if __name__ == "__main__":
+    import argparse
+    parser = argparse.ArgumentParser(description="Generate the solver, a variant for solver_variants or the MHE")
+    parser.add_argument('--variant', help="generate into solver_variants/VARIANT/ instead of solver/")
+    parser.add_argument('--mhe', action='store_true', help="generate the moving horizon estimator into solver_mhe/")
+    parser.add_argument('--N', type=int)
+    parser.add_argument('--dt', type=float)
+    parser.add_argument('--qp_solver', default='FULL_CONDENSING_QPOASES')
+    parser.add_argument('--integrator', default='ERK')
+    parser.add_argument('--cond_N', type=int, default=5, help="stages after partial condensing")
+    parser.add_argument('--corridor_faces', type=int, default=6,
+                        help="soft linear constraints per stage for the corridors, as the native tracker expects")
+    parser.add_argument('--esdf_rows', type=int, default=1,
+                        help="soft linear constraints per stage for the distance field, as the native tracker expects")
+    parser.add_argument('--obstacle_slots', type=int, default=4,
+                        help="soft ellipsoid constraints per stage for moving obstacles, as the native tracker expects")
+    args = parser.parse_args()
+
     param = MPC_Formulation_Param()
-    acados_mpc_solver_generation(param)
+    if args.mhe:
+        mhe_param = MHE_Formulation_Param()
+        mhe_param.N = args.N if args.N is not None else mhe_param.N
+        mhe_param.dt = args.dt if args.dt is not None else mhe_param.dt
+        mhe_dir = str(GPARENT) + '/solver_mhe/'
+        os.makedirs(mhe_dir, exist_ok=True)
+        acados_mhe_solver_generation(mhe_param, param, mhe_dir + 'solver/', mhe_dir + 'ACADOS_nmpc_tracker_mhe.json',
+                                     qp_solver=args.qp_solver)
+        raise SystemExit(0)
+
+    param.N = args.N if args.N is not None else param.N
+    param.dt = args.dt if args.dt is not None else param.dt
+    param.Tf = param.N * param.dt
+    if args.variant is None:
+        acados_mpc_solver_generation(param, qp_solver=args.qp_solver, integrator_type=args.integrator,
+                                     qp_solver_cond_N=args.cond_N, corridor_faces=args.corridor_faces,
+                                     esdf_rows=args.esdf_rows, obstacle_slots=args.obstacle_slots)
+    else:
+        # the json next to solver/, as the node looks for the library there
+        variant_dir = str(GPARENT) + '/solver_variants/' + args.variant + '/'
+        os.makedirs(variant_dir, exist_ok=True)
+        acados_mpc_solver_generation(param, variant_dir + 'solver/', variant_dir + 'ACADOS_nmpc_tracker_solver.json',
+                                     qp_solver=args.qp_solver, integrator_type=args.integrator,
+                                     qp_solver_cond_N=args.cond_N, corridor_faces=args.corridor_faces,
+                                     esdf_rows=args.esdf_rows, obstacle_slots=args.obstacle_slots)
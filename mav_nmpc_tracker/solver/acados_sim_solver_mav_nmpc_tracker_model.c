@@ -156,6 +156,43 @@ int mav_nmpc_tracker_model_acados_sim_create(sim_solver_capsule * capsule)
     capsule->acados_sim_solver = mav_nmpc_tracker_model_sim_solver;
 
 
+    /* initialize parameter values */
+    double* p = calloc(np, sizeof(double));
+    p[0] = 0.3;
+    p[1] = 1.0;
+    p[2] = 0.3;
+    p[3] = 1.0;
+    p[4] = 0.01;
+    p[5] = 0.01;
+    p[6] = 1.0;
+    p[10] = 10000.0;
+    p[11] = 10000.0;
+    p[12] = 10000.0;
+    p[13] = 1000.0;
+    p[14] = 1000.0;
+    p[15] = 1000.0;
+    p[16] = 10000.0;
+    p[17] = 10000.0;
+    p[18] = 10000.0;
+    p[19] = 1000.0;
+    p[20] = 1000.0;
+    p[21] = 1000.0;
+    p[22] = 10000.0;
+    p[23] = 10000.0;
+    p[24] = 10000.0;
+    p[25] = 1000.0;
+    p[26] = 1000.0;
+    p[27] = 1000.0;
+    p[28] = 10000.0;
+    p[29] = 10000.0;
+    p[30] = 10000.0;
+    p[31] = 1000.0;
+    p[32] = 1000.0;
+    p[33] = 1000.0;
+
+    mav_nmpc_tracker_model_acados_sim_update_params(capsule, p, np);
+    free(p);
+
 
     /* initialize input */
     // x
@@ -40,7 +40,7 @@
 #define MAV_NMPC_TRACKER_MODEL_NX     9
 #define MAV_NMPC_TRACKER_MODEL_NZ     0
 #define MAV_NMPC_TRACKER_MODEL_NU     3
-#define MAV_NMPC_TRACKER_MODEL_NP     0
+#define MAV_NMPC_TRACKER_MODEL_NP     34
 
 #ifdef __cplusplus
 extern "C" {
@@ -43,8 +43,10 @@
 #include "mav_nmpc_tracker_model_model/mav_nmpc_tracker_model_model.h"
 
 
+#include "mav_nmpc_tracker_model_constraints/mav_nmpc_tracker_model_h_constraint.h"
 
 
+#include "mav_nmpc_tracker_model_constraints/mav_nmpc_tracker_model_h_e_constraint.h"
 
 #include "acados_solver_mav_nmpc_tracker_model.h"
 
@@ -274,6 +276,8 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
 
     for (int i = 0; i < N; i++)
     {
+        ocp_nlp_dims_set_constraints(nlp_config, nlp_dims, i, "nh", &nh[i]);
+        ocp_nlp_dims_set_constraints(nlp_config, nlp_dims, i, "nsh", &nsh[i]);
     }
     ocp_nlp_dims_set_constraints(nlp_config, nlp_dims, N, "nh", &nh[N]);
     ocp_nlp_dims_set_constraints(nlp_config, nlp_dims, N, "nsh", &nsh[N]);
@@ -297,7 +301,7 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
         capsule->forw_vde_casadi[i].casadi_sparsity_in = &mav_nmpc_tracker_model_expl_vde_forw_sparsity_in;
         capsule->forw_vde_casadi[i].casadi_sparsity_out = &mav_nmpc_tracker_model_expl_vde_forw_sparsity_out;
         capsule->forw_vde_casadi[i].casadi_work = &mav_nmpc_tracker_model_expl_vde_forw_work;
-        external_function_param_casadi_create(&capsule->forw_vde_casadi[i], 0);
+        external_function_param_casadi_create(&capsule->forw_vde_casadi[i], 34);
     }
 
     capsule->expl_ode_fun = (external_function_param_casadi *) malloc(sizeof(external_function_param_casadi)*N);
@@ -308,10 +312,51 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
         capsule->expl_ode_fun[i].casadi_sparsity_in = &mav_nmpc_tracker_model_expl_ode_fun_sparsity_in;
         capsule->expl_ode_fun[i].casadi_sparsity_out = &mav_nmpc_tracker_model_expl_ode_fun_sparsity_out;
         capsule->expl_ode_fun[i].casadi_work = &mav_nmpc_tracker_model_expl_ode_fun_work;
-        external_function_param_casadi_create(&capsule->expl_ode_fun[i], 0);
+        external_function_param_casadi_create(&capsule->expl_ode_fun[i], 34);
     }
 
 
+    // constraints.constr_type == "BGH" and dims.nh > 0
+    capsule->nl_constr_h_fun_jac = (external_function_param_casadi *) malloc(sizeof(external_function_param_casadi)*N);
+    for (int i = 0; i < N; i++) {
+        capsule->nl_constr_h_fun_jac[i].casadi_fun = &mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt;
+        capsule->nl_constr_h_fun_jac[i].casadi_n_in = &mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_n_in;
+        capsule->nl_constr_h_fun_jac[i].casadi_n_out = &mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_n_out;
+        capsule->nl_constr_h_fun_jac[i].casadi_sparsity_in = &mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_sparsity_in;
+        capsule->nl_constr_h_fun_jac[i].casadi_sparsity_out = &mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_sparsity_out;
+        capsule->nl_constr_h_fun_jac[i].casadi_work = &mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_work;
+        external_function_param_casadi_create(&capsule->nl_constr_h_fun_jac[i], 34);
+    }
+    capsule->nl_constr_h_fun = (external_function_param_casadi *) malloc(sizeof(external_function_param_casadi)*N);
+    for (int i = 0; i < N; i++) {
+        capsule->nl_constr_h_fun[i].casadi_fun = &mav_nmpc_tracker_model_constr_h_fun;
+        capsule->nl_constr_h_fun[i].casadi_n_in = &mav_nmpc_tracker_model_constr_h_fun_n_in;
+        capsule->nl_constr_h_fun[i].casadi_n_out = &mav_nmpc_tracker_model_constr_h_fun_n_out;
+        capsule->nl_constr_h_fun[i].casadi_sparsity_in = &mav_nmpc_tracker_model_constr_h_fun_sparsity_in;
+        capsule->nl_constr_h_fun[i].casadi_sparsity_out = &mav_nmpc_tracker_model_constr_h_fun_sparsity_out;
+        capsule->nl_constr_h_fun[i].casadi_work = &mav_nmpc_tracker_model_constr_h_fun_work;
+        external_function_param_casadi_create(&capsule->nl_constr_h_fun[i], 34);
+    }
+
+
+
+    // constraints.constr_type_e == "BGH" and dims.nh_e > 0
+    capsule->nl_constr_h_e_fun_jac.casadi_fun = &mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt;
+    capsule->nl_constr_h_e_fun_jac.casadi_n_in = &mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt_n_in;
+    capsule->nl_constr_h_e_fun_jac.casadi_n_out = &mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt_n_out;
+    capsule->nl_constr_h_e_fun_jac.casadi_sparsity_in = &mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt_sparsity_in;
+    capsule->nl_constr_h_e_fun_jac.casadi_sparsity_out = &mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt_sparsity_out;
+    capsule->nl_constr_h_e_fun_jac.casadi_work = &mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt_work;
+    external_function_param_casadi_create(&capsule->nl_constr_h_e_fun_jac, 34);
+
+    capsule->nl_constr_h_e_fun.casadi_fun = &mav_nmpc_tracker_model_constr_h_e_fun;
+    capsule->nl_constr_h_e_fun.casadi_n_in = &mav_nmpc_tracker_model_constr_h_e_fun_n_in;
+    capsule->nl_constr_h_e_fun.casadi_n_out = &mav_nmpc_tracker_model_constr_h_e_fun_n_out;
+    capsule->nl_constr_h_e_fun.casadi_sparsity_in = &mav_nmpc_tracker_model_constr_h_e_fun_sparsity_in;
+    capsule->nl_constr_h_e_fun.casadi_sparsity_out = &mav_nmpc_tracker_model_constr_h_e_fun_sparsity_out;
+    capsule->nl_constr_h_e_fun.casadi_work = &mav_nmpc_tracker_model_constr_h_e_fun_work;
+    external_function_param_casadi_create(&capsule->nl_constr_h_e_fun, 34);
+
 
     /************************************************
     *  nlp_in
@@ -346,15 +391,15 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
 
     double* W_0 = calloc(NY0*NY0, sizeof(double));
     // change only the non-zero elements:
-    W_0[0+(NY0) * 0] = 10;
-    W_0[1+(NY0) * 1] = 10;
-    W_0[2+(NY0) * 2] = 10;
-    W_0[3+(NY0) * 3] = 10;
-    W_0[4+(NY0) * 4] = 10;
-    W_0[5+(NY0) * 5] = 10;
-    W_0[6+(NY0) * 6] = 100;
-    W_0[7+(NY0) * 7] = 100;
-    W_0[8+(NY0) * 8] = 100;
+    W_0[0+(NY0) * 0] = 80;
+    W_0[1+(NY0) * 1] = 80;
+    W_0[2+(NY0) * 2] = 120;
+    W_0[3+(NY0) * 3] = 80;
+    W_0[4+(NY0) * 4] = 80;
+    W_0[5+(NY0) * 5] = 100;
+    W_0[6+(NY0) * 6] = 50;
+    W_0[7+(NY0) * 7] = 50;
+    W_0[8+(NY0) * 8] = 1;
     ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, 0, "W", W_0);
     free(W_0);
 
@@ -368,15 +413,15 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
     double* W = calloc(NY*NY, sizeof(double));
     // change only the non-zero elements:
     
-    W[0+(NY) * 0] = 10;
-    W[1+(NY) * 1] = 10;
-    W[2+(NY) * 2] = 10;
-    W[3+(NY) * 3] = 10;
-    W[4+(NY) * 4] = 10;
-    W[5+(NY) * 5] = 10;
-    W[6+(NY) * 6] = 100;
-    W[7+(NY) * 7] = 100;
-    W[8+(NY) * 8] = 100;
+    W[0+(NY) * 0] = 80;
+    W[1+(NY) * 1] = 80;
+    W[2+(NY) * 2] = 120;
+    W[3+(NY) * 3] = 80;
+    W[4+(NY) * 4] = 80;
+    W[5+(NY) * 5] = 100;
+    W[6+(NY) * 6] = 50;
+    W[7+(NY) * 7] = 50;
+    W[8+(NY) * 8] = 1;
 
     double* yref = calloc(NY, sizeof(double));
     // change only the non-zero elements:
@@ -446,6 +491,65 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
 
 
 
+    double* zlumem = calloc(4*NS, sizeof(double));
+    double* Zl = zlumem+NS*0;
+    double* Zu = zlumem+NS*1;
+    double* zl = zlumem+NS*2;
+    double* zu = zlumem+NS*3;
+    // change only the non-zero elements:
+    Zl[0] = 100.0;
+    Zl[1] = 100.0;
+    Zl[2] = 100.0;
+    Zl[3] = 100.0;
+    Zl[4] = 100.0;
+    Zl[5] = 100.0;
+    Zl[6] = 100.0;
+    Zl[7] = 100.0;
+    Zl[8] = 100.0;
+    Zl[9] = 100.0;
+    Zl[10] = 100.0;
+    Zu[0] = 100.0;
+    Zu[1] = 100.0;
+    Zu[2] = 100.0;
+    Zu[3] = 100.0;
+    Zu[4] = 100.0;
+    Zu[5] = 100.0;
+    Zu[6] = 100.0;
+    Zu[7] = 100.0;
+    Zu[8] = 100.0;
+    Zu[9] = 100.0;
+    Zu[10] = 100.0;
+    zl[0] = 1000.0;
+    zl[1] = 1000.0;
+    zl[2] = 1000.0;
+    zl[3] = 1000.0;
+    zl[4] = 1000.0;
+    zl[5] = 1000.0;
+    zl[6] = 1000.0;
+    zl[7] = 1000.0;
+    zl[8] = 1000.0;
+    zl[9] = 1000.0;
+    zl[10] = 1000.0;
+    zu[0] = 1000.0;
+    zu[1] = 1000.0;
+    zu[2] = 1000.0;
+    zu[3] = 1000.0;
+    zu[4] = 1000.0;
+    zu[5] = 1000.0;
+    zu[6] = 1000.0;
+    zu[7] = 1000.0;
+    zu[8] = 1000.0;
+    zu[9] = 1000.0;
+    zu[10] = 1000.0;
+
+    for (int i = 0; i < N; i++)
+    {
+        ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, i, "Zl", Zl);
+        ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, i, "Zu", Zu);
+        ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, i, "zl", zl);
+        ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, i, "zu", zu);
+    }
+    free(zlumem);
 
 
     // terminal cost
@@ -460,12 +564,12 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
     double* W_e = calloc(NYN*NYN, sizeof(double));
     // change only the non-zero elements:
     
-    W_e[0+(NYN) * 0] = 10;
-    W_e[1+(NYN) * 1] = 10;
-    W_e[2+(NYN) * 2] = 10;
-    W_e[3+(NYN) * 3] = 10;
-    W_e[4+(NYN) * 4] = 10;
-    W_e[5+(NYN) * 5] = 10;
+    W_e[0+(NYN) * 0] = 80;
+    W_e[1+(NYN) * 1] = 80;
+    W_e[2+(NYN) * 2] = 120;
+    W_e[3+(NYN) * 3] = 80;
+    W_e[4+(NYN) * 4] = 80;
+    W_e[5+(NYN) * 5] = 100;
     ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, N, "W", W_e);
     free(W_e);
     double* Vx_e = calloc(NYN*NX, sizeof(double));
@@ -482,6 +586,64 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
 
 
 
+    double* zluemem = calloc(4*NSN, sizeof(double));
+    double* Zl_e = zluemem+NSN*0;
+    double* Zu_e = zluemem+NSN*1;
+    double* zl_e = zluemem+NSN*2;
+    double* zu_e = zluemem+NSN*3;
+    // change only the non-zero elements:
+    Zl_e[0] = 100.0;
+    Zl_e[1] = 100.0;
+    Zl_e[2] = 100.0;
+    Zl_e[3] = 100.0;
+    Zl_e[4] = 100.0;
+    Zl_e[5] = 100.0;
+    Zl_e[6] = 100.0;
+    Zl_e[7] = 100.0;
+    Zl_e[8] = 100.0;
+    Zl_e[9] = 100.0;
+    Zl_e[10] = 100.0;
+    Zu_e[0] = 100.0;
+    Zu_e[1] = 100.0;
+    Zu_e[2] = 100.0;
+    Zu_e[3] = 100.0;
+    Zu_e[4] = 100.0;
+    Zu_e[5] = 100.0;
+    Zu_e[6] = 100.0;
+    Zu_e[7] = 100.0;
+    Zu_e[8] = 100.0;
+    Zu_e[9] = 100.0;
+    Zu_e[10] = 100.0;
+    zl_e[0] = 1000.0;
+    zl_e[1] = 1000.0;
+    zl_e[2] = 1000.0;
+    zl_e[3] = 1000.0;
+    zl_e[4] = 1000.0;
+    zl_e[5] = 1000.0;
+    zl_e[6] = 1000.0;
+    zl_e[7] = 1000.0;
+    zl_e[8] = 1000.0;
+    zl_e[9] = 1000.0;
+    zl_e[10] = 1000.0;
+    zu_e[0] = 1000.0;
+    zu_e[1] = 1000.0;
+    zu_e[2] = 1000.0;
+    zu_e[3] = 1000.0;
+    zu_e[4] = 1000.0;
+    zu_e[5] = 1000.0;
+    zu_e[6] = 1000.0;
+    zu_e[7] = 1000.0;
+    zu_e[8] = 1000.0;
+    zu_e[9] = 1000.0;
+    zu_e[10] = 1000.0;
+
+    ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, N, "Zl", Zl_e);
+    ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, N, "Zu", Zu_e);
+    ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, N, "zl", zl_e);
+    ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, N, "zu", zu_e);
+    free(zluemem);
+
+
     /**** Constraints ****/
 
     // bounds for initial stage
@@ -540,10 +702,10 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
     double* lbu = lubu;
     double* ubu = lubu + NBU;
     
-    lbu[0] = -0.2617993877991494;
-    ubu[0] = 0.2617993877991494;
-    lbu[1] = -0.2617993877991494;
-    ubu[1] = 0.2617993877991494;
+    lbu[0] = -0.4363323129985824;
+    ubu[0] = 0.4363323129985824;
+    lbu[1] = -0.4363323129985824;
+    ubu[1] = 0.4363323129985824;
     lbu[2] = 4.9033;
     ubu[2] = 14.7099;
 
@@ -557,35 +719,214 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
     free(lubu);
 
 
+    // set up soft bounds for general linear constraints
+    int* idxsg = malloc(NSG * sizeof(int));
+    
+    idxsg[0] = 0;
+    idxsg[1] = 1;
+    idxsg[2] = 2;
+    idxsg[3] = 3;
+    idxsg[4] = 4;
+    idxsg[5] = 5;
+    idxsg[6] = 6;
+    double* lusg = calloc(2*NSG, sizeof(double));
+    double* lsg = lusg;
+    double* usg = lusg + NSG;
+    
 
+    for (int i = 0; i < N; i++)
+    {
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "idxsg", idxsg);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "lsg", lsg);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "usg", usg);
+    }
+    free(idxsg);
+    free(lusg);
 
 
+    // set up soft bounds for nonlinear constraints
+    int* idxsh = malloc(NSH * sizeof(int));
+    
+    idxsh[0] = 0;
+    idxsh[1] = 1;
+    idxsh[2] = 2;
+    idxsh[3] = 3;
+    double* lush = calloc(2*NSH, sizeof(double));
+    double* lsh = lush;
+    double* ush = lush + NSH;
+    
 
+    for (int i = 0; i < N; i++)
+    {
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "idxsh", idxsh);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "lsh", lsh);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "ush", ush);
+    }
+    free(idxsh);
+    free(lush);
 
 
 
 
 
+    // set up general constraints for stage 0 to N-1 
+    double* D = calloc(NG*NU, sizeof(double));
+    double* C = calloc(NG*NX, sizeof(double));
+    double* lug = calloc(2*NG, sizeof(double));
+    double* lg = lug;
+    double* ug = lug + NG;
 
+    
+    lg[0] = -1000000000.0;
+    lg[1] = -1000000000.0;
+    lg[2] = -1000000000.0;
+    lg[3] = -1000000000.0;
+    lg[4] = -1000000000.0;
+    lg[5] = -1000000000.0;
+    lg[6] = -1000000000.0;
+    ug[0] = 1000000000.0;
+    ug[1] = 1000000000.0;
+    ug[2] = 1000000000.0;
+    ug[3] = 1000000000.0;
+    ug[4] = 1000000000.0;
+    ug[5] = 1000000000.0;
+    ug[6] = 1000000000.0;
 
+    for (int i = 0; i < N; i++)
+    {
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "D", D);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "C", C);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "lg", lg);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "ug", ug);
+    }
+    free(D);
+    free(C);
+    free(lug);
 
+    // set up nonlinear constraints for stage 0 to N-1
+    double* luh = calloc(2*NH, sizeof(double));
+    double* lh = luh;
+    double* uh = luh + NH;
 
+    
+    lh[0] = 1.0;
+    lh[1] = 1.0;
+    lh[2] = 1.0;
+    lh[3] = 1.0;
+    uh[0] = 1000000000.0;
+    uh[1] = 1000000000.0;
+    uh[2] = 1000000000.0;
+    uh[3] = 1000000000.0;
 
+    for (int i = 0; i < N; i++)
+    {
+        // nonlinear constraints for stages 0 to N-1
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "nl_constr_h_fun_jac",
+                                      &capsule->nl_constr_h_fun_jac[i]);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "nl_constr_h_fun",
+                                      &capsule->nl_constr_h_fun[i]);
+        
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "lh", lh);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, i, "uh", uh);
+    }
+    free(luh);
 
 
-    /* terminal constraints */
 
+    /* terminal constraints */
 
 
 
+    // set up soft bounds for general linear constraints
+    int* idxsg_e = calloc(NSGN, sizeof(int));
+    // change only the non-zero elements:
+    idxsg_e[0] = 0;
+    idxsg_e[1] = 1;
+    idxsg_e[2] = 2;
+    idxsg_e[3] = 3;
+    idxsg_e[4] = 4;
+    idxsg_e[5] = 5;
+    idxsg_e[6] = 6;
+    double* lusg_e = calloc(2*NSGN, sizeof(double));
+    double* lsg_e = lusg_e;
+    double* usg_e = lusg_e + NSGN;
+    
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "idxsg", idxsg_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "lsg", lsg_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "usg", usg_e);
+    free(idxsg_e);
+    free(lusg_e);
 
 
+    // set up soft bounds for nonlinear constraints
+    int* idxsh_e = calloc(NSHN, sizeof(int));
+    // change only the non-zero elements:
+    idxsh_e[0] = 0;
+    idxsh_e[1] = 1;
+    idxsh_e[2] = 2;
+    idxsh_e[3] = 3;
+    double* lush_e = calloc(2*NSHN, sizeof(double));
+    double* lsh_e = lush_e;
+    double* ush_e = lush_e + NSHN;
+    
 
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "idxsh", idxsh_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "lsh", lsh_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "ush", ush_e);
+    free(idxsh_e);
+    free(lush_e);
 
 
 
+    // set up general constraints for last stage
+    double* C_e = calloc(NGN*NX, sizeof(double));
+    double* lug_e = calloc(2*NGN, sizeof(double));
+    double* lg_e = lug_e;
+    double* ug_e = lug_e + NGN;
 
+    
+    lg_e[0] = -1000000000.0;
+    lg_e[1] = -1000000000.0;
+    lg_e[2] = -1000000000.0;
+    lg_e[3] = -1000000000.0;
+    lg_e[4] = -1000000000.0;
+    lg_e[5] = -1000000000.0;
+    lg_e[6] = -1000000000.0;
+    ug_e[0] = 1000000000.0;
+    ug_e[1] = 1000000000.0;
+    ug_e[2] = 1000000000.0;
+    ug_e[3] = 1000000000.0;
+    ug_e[4] = 1000000000.0;
+    ug_e[5] = 1000000000.0;
+    ug_e[6] = 1000000000.0;
+
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "C", C_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "lg", lg_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "ug", ug_e);
+    free(C_e);
+    free(lug_e);
+
+    // set up nonlinear constraints for last stage
+    double* luh_e = calloc(2*NHN, sizeof(double));
+    double* lh_e = luh_e;
+    double* uh_e = luh_e + NHN;
 
+    
+    lh_e[0] = 1.0;
+    lh_e[1] = 1.0;
+    lh_e[2] = 1.0;
+    lh_e[3] = 1.0;
+    uh_e[0] = 1000000000.0;
+    uh_e[1] = 1000000000.0;
+    uh_e[2] = 1000000000.0;
+    uh_e[3] = 1000000000.0;
+
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "nl_constr_h_fun_jac", &capsule->nl_constr_h_e_fun_jac);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "nl_constr_h_fun", &capsule->nl_constr_h_e_fun);
+    
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "lh", lh_e);
+    ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, N, "uh", uh_e);
+    free(luh_e);
 
 
 
@@ -679,6 +1020,46 @@ int mav_nmpc_tracker_model_acados_create_with_discretization(mav_nmpc_tracker_mo
 
 
 
+    // initialize parameters to nominal value
+    double* p = calloc(NP, sizeof(double));
+    p[0] = 0.3;
+    p[1] = 1.0;
+    p[2] = 0.3;
+    p[3] = 1.0;
+    p[4] = 0.01;
+    p[5] = 0.01;
+    p[6] = 1.0;
+    p[10] = 10000.0;
+    p[11] = 10000.0;
+    p[12] = 10000.0;
+    p[13] = 1000.0;
+    p[14] = 1000.0;
+    p[15] = 1000.0;
+    p[16] = 10000.0;
+    p[17] = 10000.0;
+    p[18] = 10000.0;
+    p[19] = 1000.0;
+    p[20] = 1000.0;
+    p[21] = 1000.0;
+    p[22] = 10000.0;
+    p[23] = 10000.0;
+    p[24] = 10000.0;
+    p[25] = 1000.0;
+    p[26] = 1000.0;
+    p[27] = 1000.0;
+    p[28] = 10000.0;
+    p[29] = 10000.0;
+    p[30] = 10000.0;
+    p[31] = 1000.0;
+    p[32] = 1000.0;
+    p[33] = 1000.0;
+
+
+    for (int i = 0; i <= N; i++)
+    {
+        mav_nmpc_tracker_model_acados_update_params(capsule, i, p, NP);
+    }
+    free(p);
 
     status = ocp_nlp_precompute(capsule->nlp_solver, nlp_in, nlp_out);
 
@@ -696,12 +1077,43 @@ int mav_nmpc_tracker_model_acados_update_params(mav_nmpc_tracker_model_solver_ca
 {
     int solver_status = 0;
 
-    int casadi_np = 0;
+    int casadi_np = 34;
     if (casadi_np != np) {
         printf("acados_update_params: trying to set %i parameters for external functions."
             " External function has %i parameters. Exiting.\n", np, casadi_np);
         exit(1);
     }
+    const int N = capsule->nlp_solver_plan->N;
+    if (stage < N && stage >= 0)
+    {
+        capsule->forw_vde_casadi[stage].set_param(capsule->forw_vde_casadi+stage, p);
+        capsule->expl_ode_fun[stage].set_param(capsule->expl_ode_fun+stage, p);
+    
+
+        // constraints
+    
+        capsule->nl_constr_h_fun_jac[stage].set_param(capsule->nl_constr_h_fun_jac+stage, p);
+        capsule->nl_constr_h_fun[stage].set_param(capsule->nl_constr_h_fun+stage, p);
+
+        // cost
+        if (stage == 0)
+        {
+        }
+        else // 0 < stage < N
+        {
+        }
+    }
+
+    else // stage == N
+    {
+        // terminal shooting node has no dynamics
+        // cost
+        // constraints
+    
+        capsule->nl_constr_h_e_fun_jac.set_param(&capsule->nl_constr_h_e_fun_jac, p);
+        capsule->nl_constr_h_e_fun.set_param(&capsule->nl_constr_h_e_fun, p);
+    }
+
 
     return solver_status;
 }
@@ -744,6 +1156,15 @@ int mav_nmpc_tracker_model_acados_free(mav_nmpc_tracker_model_solver_capsule * c
     // cost
 
     // constraints
+    for (int i = 0; i < N; i++)
+    {
+        external_function_param_casadi_free(&capsule->nl_constr_h_fun_jac[i]);
+        external_function_param_casadi_free(&capsule->nl_constr_h_fun[i]);
+    }
+    free(capsule->nl_constr_h_fun_jac);
+    free(capsule->nl_constr_h_fun);
+    external_function_param_casadi_free(&capsule->nl_constr_h_e_fun_jac);
+    external_function_param_casadi_free(&capsule->nl_constr_h_e_fun);
 
     return 0;
 }
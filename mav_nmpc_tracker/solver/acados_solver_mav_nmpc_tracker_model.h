@@ -40,31 +40,31 @@
 #define MAV_NMPC_TRACKER_MODEL_NX     9
 #define MAV_NMPC_TRACKER_MODEL_NZ     0
 #define MAV_NMPC_TRACKER_MODEL_NU     3
-#define MAV_NMPC_TRACKER_MODEL_NP     0
+#define MAV_NMPC_TRACKER_MODEL_NP     34
 #define MAV_NMPC_TRACKER_MODEL_NBX    0
 #define MAV_NMPC_TRACKER_MODEL_NBX0   9
 #define MAV_NMPC_TRACKER_MODEL_NBU    3
 #define MAV_NMPC_TRACKER_MODEL_NSBX   0
 #define MAV_NMPC_TRACKER_MODEL_NSBU   0
-#define MAV_NMPC_TRACKER_MODEL_NSH    0
-#define MAV_NMPC_TRACKER_MODEL_NSG    0
+#define MAV_NMPC_TRACKER_MODEL_NSH    4
+#define MAV_NMPC_TRACKER_MODEL_NSG    7
 #define MAV_NMPC_TRACKER_MODEL_NSPHI  0
-#define MAV_NMPC_TRACKER_MODEL_NSHN   0
-#define MAV_NMPC_TRACKER_MODEL_NSGN   0
+#define MAV_NMPC_TRACKER_MODEL_NSHN   4
+#define MAV_NMPC_TRACKER_MODEL_NSGN   7
 #define MAV_NMPC_TRACKER_MODEL_NSPHIN 0
 #define MAV_NMPC_TRACKER_MODEL_NSBXN  0
-#define MAV_NMPC_TRACKER_MODEL_NS     0
-#define MAV_NMPC_TRACKER_MODEL_NSN    0
-#define MAV_NMPC_TRACKER_MODEL_NG     0
+#define MAV_NMPC_TRACKER_MODEL_NS     11
+#define MAV_NMPC_TRACKER_MODEL_NSN    11
+#define MAV_NMPC_TRACKER_MODEL_NG     7
 #define MAV_NMPC_TRACKER_MODEL_NBXN   0
-#define MAV_NMPC_TRACKER_MODEL_NGN    0
+#define MAV_NMPC_TRACKER_MODEL_NGN    7
 #define MAV_NMPC_TRACKER_MODEL_NY0    9
 #define MAV_NMPC_TRACKER_MODEL_NY     9
 #define MAV_NMPC_TRACKER_MODEL_NYN    6
 #define MAV_NMPC_TRACKER_MODEL_N      20
-#define MAV_NMPC_TRACKER_MODEL_NH     0
+#define MAV_NMPC_TRACKER_MODEL_NH     4
 #define MAV_NMPC_TRACKER_MODEL_NPHI   0
-#define MAV_NMPC_TRACKER_MODEL_NHN    0
+#define MAV_NMPC_TRACKER_MODEL_NHN    4
 #define MAV_NMPC_TRACKER_MODEL_NPHIN  0
 #define MAV_NMPC_TRACKER_MODEL_NR     0
 
@@ -105,9 +105,13 @@ typedef struct mav_nmpc_tracker_model_solver_capsule
 
 
     // constraints
+    external_function_param_casadi *nl_constr_h_fun_jac;
+    external_function_param_casadi *nl_constr_h_fun;
 
 
 
+    external_function_param_casadi nl_constr_h_e_fun_jac;
+    external_function_param_casadi nl_constr_h_e_fun;
 
 } mav_nmpc_tracker_model_solver_capsule;
 
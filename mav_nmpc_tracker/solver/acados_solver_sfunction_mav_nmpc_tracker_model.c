@@ -54,7 +54,7 @@ static void mdlInitializeSizes (SimStruct *S)
     // specify the number of continuous and discrete states
     ssSetNumContStates(S, 0);
     ssSetNumDiscStates(S, 0);// specify the number of input ports
-    if ( !ssSetNumInputPorts(S, 7) )
+    if ( !ssSetNumInputPorts(S, 12) )
         return;
 
     // specify the number of output ports
@@ -66,16 +66,26 @@ static void mdlInitializeSizes (SimStruct *S)
     ssSetInputPortVectorDimension(S, 0, 9);
     // ubx_0
     ssSetInputPortVectorDimension(S, 1, 9);
+    // parameters
+    ssSetInputPortVectorDimension(S, 2, (20+1) * 34);
     // y_ref_0
-    ssSetInputPortVectorDimension(S, 2, 9);
+    ssSetInputPortVectorDimension(S, 3, 9);
     // y_ref
-    ssSetInputPortVectorDimension(S, 3, 171);
+    ssSetInputPortVectorDimension(S, 4, 171);
     // y_ref_e
-    ssSetInputPortVectorDimension(S, 4, 6);
+    ssSetInputPortVectorDimension(S, 5, 6);
     // lbu
-    ssSetInputPortVectorDimension(S, 5, 60);
+    ssSetInputPortVectorDimension(S, 6, 60);
     // ubu
-    ssSetInputPortVectorDimension(S, 6, 60);/* specify dimension information for the OUTPUT ports */
+    ssSetInputPortVectorDimension(S, 7, 60);
+    // lg
+    ssSetInputPortVectorDimension(S, 8, 140);
+    // ug
+    ssSetInputPortVectorDimension(S, 9, 140);
+    // lh
+    ssSetInputPortVectorDimension(S, 10, 80);
+    // uh
+    ssSetInputPortVectorDimension(S, 11, 80);/* specify dimension information for the OUTPUT ports */
     ssSetOutputPortVectorDimension(S, 0, 3 );
     ssSetOutputPortVectorDimension(S, 1, 1 );
     ssSetOutputPortVectorDimension(S, 2, 1 );
@@ -92,6 +102,11 @@ static void mdlInitializeSizes (SimStruct *S)
     ssSetInputPortDirectFeedThrough(S, 4, 1);
     ssSetInputPortDirectFeedThrough(S, 5, 1);
     ssSetInputPortDirectFeedThrough(S, 6, 1);
+    ssSetInputPortDirectFeedThrough(S, 7, 1);
+    ssSetInputPortDirectFeedThrough(S, 8, 1);
+    ssSetInputPortDirectFeedThrough(S, 9, 1);
+    ssSetInputPortDirectFeedThrough(S, 10, 1);
+    ssSetInputPortDirectFeedThrough(S, 11, 1);
 
     // one sample time
     ssSetNumSampleTimes(S, 1);
@@ -145,7 +160,7 @@ static void mdlOutputs(SimStruct *S, int_T tid)
     InputRealPtrsType in_sign;      
 
     // local buffer
-    real_t buffer[9];
+    real_t buffer[34];
 
     /* go through inputs */
     // lbx_0
@@ -160,9 +175,20 @@ static void mdlOutputs(SimStruct *S, int_T tid)
         buffer[i] = (double)(*in_sign[i]);
     ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, 0, "ubx", buffer);
 
+    // parameters - stage-variant !!!
+    in_sign = ssGetInputPortRealSignalPtrs(S, 2);
+
+    // update value of parameters
+    for (int ii = 0; ii <= 20; ii++)
+    {
+        for (int jj = 0; jj < 34; jj++)
+            buffer[jj] = (double)(*in_sign[ii*34+jj]);
+        mav_nmpc_tracker_model_acados_update_params(capsule, ii, buffer, 34);
+    }
+
   
     // y_ref_0
-    in_sign = ssGetInputPortRealSignalPtrs(S, 2);
+    in_sign = ssGetInputPortRealSignalPtrs(S, 3);
 
     for (int i = 0; i < 9; i++)
         buffer[i] = (double)(*in_sign[i]);
@@ -171,7 +197,7 @@ static void mdlOutputs(SimStruct *S, int_T tid)
 
   
     // y_ref - for stages 1 to N-1
-    in_sign = ssGetInputPortRealSignalPtrs(S, 3);
+    in_sign = ssGetInputPortRealSignalPtrs(S, 4);
 
     for (int ii = 1; ii < 20; ii++)
     {
@@ -182,14 +208,14 @@ static void mdlOutputs(SimStruct *S, int_T tid)
 
   
     // y_ref_e
-    in_sign = ssGetInputPortRealSignalPtrs(S, 4);
+    in_sign = ssGetInputPortRealSignalPtrs(S, 5);
 
     for (int i = 0; i < 6; i++)
         buffer[i] = (double)(*in_sign[i]);
 
     ocp_nlp_cost_model_set(nlp_config, nlp_dims, nlp_in, 20, "yref", (void *) buffer);
     // lbu
-    in_sign = ssGetInputPortRealSignalPtrs(S, 5);
+    in_sign = ssGetInputPortRealSignalPtrs(S, 6);
     for (int ii = 0; ii < 20; ii++)
     {
         for (int jj = 0; jj < 3; jj++)
@@ -197,7 +223,7 @@ static void mdlOutputs(SimStruct *S, int_T tid)
         ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, ii, "lbu", (void *) buffer);
     }
     // ubu
-    in_sign = ssGetInputPortRealSignalPtrs(S, 6);
+    in_sign = ssGetInputPortRealSignalPtrs(S, 7);
     for (int ii = 0; ii < 20; ii++)
     {
         for (int jj = 0; jj < 3; jj++)
@@ -205,6 +231,43 @@ static void mdlOutputs(SimStruct *S, int_T tid)
         ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, ii, "ubu", (void *) buffer);
     }
 
+    // lg
+    in_sign = ssGetInputPortRealSignalPtrs(S, 8);
+
+    for (int ii = 0; ii < 20; ii++)
+    {
+        for (int jj = 0; jj < 7; jj++)
+            buffer[jj] = (double)(*in_sign[ii*7+jj]);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, ii, "lg", buffer);
+    }
+    // ug
+    in_sign = ssGetInputPortRealSignalPtrs(S, 9);
+
+    for (int ii = 0; ii < 20; ii++)
+    {
+        for (int jj = 0; jj < 7; jj++)
+            buffer[jj] = (double)(*in_sign[ii*7+jj]);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, ii, "ug", buffer);
+    }
+    // lh
+    in_sign = ssGetInputPortRealSignalPtrs(S, 10);
+
+    for (int ii = 0; ii < 20; ii++)
+    {
+        for (int jj = 0; jj < 4; jj++)
+            buffer[jj] = (double)(*in_sign[ii*4+jj]);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, ii, "lh", buffer);
+    }
+    // uh
+    in_sign = ssGetInputPortRealSignalPtrs(S, 11);
+
+    for (int ii = 0; ii < 20; ii++)
+    {
+        for (int jj = 0; jj < 4; jj++)
+            buffer[jj] = (double)(*in_sign[ii*4+jj]);
+        ocp_nlp_constraints_model_set(nlp_config, nlp_dims, nlp_in, ii, "uh", buffer);
+    }
+
     /* call solver */
     int rti_phase = 0;
     ocp_nlp_solver_opts_set(nlp_config, capsule->nlp_opts, "rti_phase", &rti_phase);
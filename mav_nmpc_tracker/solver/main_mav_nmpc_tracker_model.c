@@ -151,6 +151,48 @@ int main()
     u0[1] = 0.0;
     u0[2] = 0.0;
 
+    // set parameters
+    double p[NP];
+    p[0] = 0.3;
+    p[1] = 1.0;
+    p[2] = 0.3;
+    p[3] = 1.0;
+    p[4] = 0.01;
+    p[5] = 0.01;
+    p[6] = 1.0;
+    p[7] = 0.0;
+    p[8] = 0.0;
+    p[9] = 0.0;
+    p[10] = 10000.0;
+    p[11] = 10000.0;
+    p[12] = 10000.0;
+    p[13] = 1000.0;
+    p[14] = 1000.0;
+    p[15] = 1000.0;
+    p[16] = 10000.0;
+    p[17] = 10000.0;
+    p[18] = 10000.0;
+    p[19] = 1000.0;
+    p[20] = 1000.0;
+    p[21] = 1000.0;
+    p[22] = 10000.0;
+    p[23] = 10000.0;
+    p[24] = 10000.0;
+    p[25] = 1000.0;
+    p[26] = 1000.0;
+    p[27] = 1000.0;
+    p[28] = 10000.0;
+    p[29] = 10000.0;
+    p[30] = 10000.0;
+    p[31] = 1000.0;
+    p[32] = 1000.0;
+    p[33] = 1000.0;
+
+    for (int ii = 0; ii <= N; ii++)
+    {
+        mav_nmpc_tracker_model_acados_update_params(acados_ocp_capsule, ii, p, NP);
+    }
+
     // prepare evaluation
     int NTIMINGS = 1;
     double min_time = 1e12;
@@ -34,6 +34,10 @@
 SOURCES = { ...
             'mav_nmpc_tracker_model_model/mav_nmpc_tracker_model_expl_ode_fun.c', ...
             'mav_nmpc_tracker_model_model/mav_nmpc_tracker_model_expl_vde_forw.c',...
+            'mav_nmpc_tracker_model_constraints/mav_nmpc_tracker_model_constr_h_fun.c', ...
+            'mav_nmpc_tracker_model_constraints/mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt.c', ...
+            'mav_nmpc_tracker_model_constraints/mav_nmpc_tracker_model_constr_h_e_fun.c', ...
+            'mav_nmpc_tracker_model_constraints/mav_nmpc_tracker_model_constr_h_e_fun_jac_uxt_zt.c', ...
             'acados_solver_sfunction_mav_nmpc_tracker_model.c', ...
             'acados_solver_mav_nmpc_tracker_model.c'
           };
@@ -85,6 +89,9 @@ i_in = i_in + 1;
 input_note = strcat(input_note, num2str(i_in), ') ubx_0 - upper bound on x for stage 0,',...
                     ' size [9]\n ');
 i_in = i_in + 1;
+input_note = strcat(input_note, num2str(i_in), ') parameters - concatenated for all shooting nodes 0 to N,',...
+                    ' size [714]\n ');
+i_in = i_in + 1;
 input_note = strcat(input_note, num2str(i_in), ') y_ref_0, size [9]\n ');
 i_in = i_in + 1;
 input_note = strcat(input_note, num2str(i_in), ') y_ref - concatenated for shooting nodes 1 to N-1,',...
@@ -96,6 +103,14 @@ input_note = strcat(input_note, num2str(i_in), ') lbu for shooting nodes 0 to N-
 i_in = i_in + 1;
 input_note = strcat(input_note, num2str(i_in), ') ubu for shooting nodes 0 to N-1, size [60]\n ');
 i_in = i_in + 1;
+input_note = strcat(input_note, num2str(i_in), ') lg for shooting nodes 0 to N-1, size [140]\n ');
+i_in = i_in + 1;
+input_note = strcat(input_note, num2str(i_in), ') ug for shooting nodes 0 to N-1, size [140]\n ');
+i_in = i_in + 1;
+input_note = strcat(input_note, num2str(i_in), ') lh for shooting nodes 0 to N-1, size [80]\n ');
+i_in = i_in + 1;
+input_note = strcat(input_note, num2str(i_in), ') uh for shooting nodes 0 to N-1, size [80]\n ');
+i_in = i_in + 1;
 
 fprintf(input_note)
 
@@ -0,0 +1,297 @@
+/* This file was automatically generated by CasADi.
+   The CasADi copyright holders make no ownership claim of its contents. */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* How to prefix internal symbols */
+#ifdef CASADI_CODEGEN_PREFIX
+  #define CASADI_NAMESPACE_CONCAT(NS, ID) _CASADI_NAMESPACE_CONCAT(NS, ID)
+  #define _CASADI_NAMESPACE_CONCAT(NS, ID) NS ## ID
+  #define CASADI_PREFIX(ID) CASADI_NAMESPACE_CONCAT(CODEGEN_PREFIX, ID)
+#else
+  #define CASADI_PREFIX(ID) mav_nmpc_tracker_model_constr_h_fun_ ## ID
+#endif
+
+#include <math.h>
+
+#ifndef casadi_real
+#define casadi_real double
+#endif
+
+#ifndef casadi_int
+#define casadi_int int
+#endif
+
+/* Add prefix to internal symbols */
+#define casadi_f0 CASADI_PREFIX(f0)
+#define casadi_s0 CASADI_PREFIX(s0)
+#define casadi_s1 CASADI_PREFIX(s1)
+#define casadi_s2 CASADI_PREFIX(s2)
+#define casadi_s3 CASADI_PREFIX(s3)
+#define casadi_s4 CASADI_PREFIX(s4)
+#define casadi_sq CASADI_PREFIX(sq)
+
+/* Symbol visibility in DLLs */
+#ifndef CASADI_SYMBOL_EXPORT
+  #if defined(_WIN32) || defined(__WIN32__) || defined(__CYGWIN__)
+    #if defined(STATIC_LINKED)
+      #define CASADI_SYMBOL_EXPORT
+    #else
+      #define CASADI_SYMBOL_EXPORT __declspec(dllexport)
+    #endif
+  #elif defined(__GNUC__) && defined(GCC_HASCLASSVISIBILITY)
+    #define CASADI_SYMBOL_EXPORT __attribute__ ((visibility ("default")))
+  #else
+    #define CASADI_SYMBOL_EXPORT
+  #endif
+#endif
+
+casadi_real casadi_sq(casadi_real x) { return x*x;}
+
+static const casadi_int casadi_s0[13] = {9, 1, 0, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const casadi_int casadi_s1[7] = {3, 1, 0, 3, 0, 1, 2};
+static const casadi_int casadi_s2[3] = {0, 0, 0};
+static const casadi_int casadi_s3[38] = {34, 1, 0, 34, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33};
+static const casadi_int casadi_s4[8] = {4, 1, 0, 4, 0, 1, 2, 3};
+
+/* mav_nmpc_tracker_model_constr_h_fun:(i0[9],i1[3],i2[],i3[34])->(o0[4]) */
+static int casadi_f0(const casadi_real** arg, casadi_real** res, casadi_int* iw, casadi_real* w, int mem) {
+  casadi_real w0, w1, w2, w3, w4, w5;
+  /* #0: @0 = input[0][0] */
+  w0 = arg[0] ? arg[0][0] : 0;
+  /* #1: @1 = input[3][10] */
+  w1 = arg[3] ? arg[3][10] : 0;
+  /* #2: @1 = (@0-@1) */
+  w1 = (w0-w1);
+  /* #3: @2 = input[3][13] */
+  w2 = arg[3] ? arg[3][13] : 0;
+  /* #4: @1 = (@1/@2) */
+  w1 /= w2;
+  /* #5: @1 = sq(@1) */
+  w1 = casadi_sq( w1 );
+  /* #6: @2 = input[0][1] */
+  w2 = arg[0] ? arg[0][1] : 0;
+  /* #7: @3 = input[3][11] */
+  w3 = arg[3] ? arg[3][11] : 0;
+  /* #8: @3 = (@2-@3) */
+  w3 = (w2-w3);
+  /* #9: @4 = input[3][14] */
+  w4 = arg[3] ? arg[3][14] : 0;
+  /* #10: @3 = (@3/@4) */
+  w3 /= w4;
+  /* #11: @3 = sq(@3) */
+  w3 = casadi_sq( w3 );
+  /* #12: @1 = (@1+@3) */
+  w1 += w3;
+  /* #13: @3 = input[0][2] */
+  w3 = arg[0] ? arg[0][2] : 0;
+  /* #14: @4 = input[3][12] */
+  w4 = arg[3] ? arg[3][12] : 0;
+  /* #15: @4 = (@3-@4) */
+  w4 = (w3-w4);
+  /* #16: @5 = input[3][15] */
+  w5 = arg[3] ? arg[3][15] : 0;
+  /* #17: @4 = (@4/@5) */
+  w4 /= w5;
+  /* #18: @4 = sq(@4) */
+  w4 = casadi_sq( w4 );
+  /* #19: @1 = (@1+@4) */
+  w1 += w4;
+  /* #20: output[0][0] = @1 */
+  if (res[0]) res[0][0] = w1;
+  /* #21: @1 = input[3][16] */
+  w1 = arg[3] ? arg[3][16] : 0;
+  /* #22: @1 = (@0-@1) */
+  w1 = (w0-w1);
+  /* #23: @4 = input[3][19] */
+  w4 = arg[3] ? arg[3][19] : 0;
+  /* #24: @1 = (@1/@4) */
+  w1 /= w4;
+  /* #25: @1 = sq(@1) */
+  w1 = casadi_sq( w1 );
+  /* #26: @4 = input[3][17] */
+  w4 = arg[3] ? arg[3][17] : 0;
+  /* #27: @4 = (@2-@4) */
+  w4 = (w2-w4);
+  /* #28: @5 = input[3][20] */
+  w5 = arg[3] ? arg[3][20] : 0;
+  /* #29: @4 = (@4/@5) */
+  w4 /= w5;
+  /* #30: @4 = sq(@4) */
+  w4 = casadi_sq( w4 );
+  /* #31: @1 = (@1+@4) */
+  w1 += w4;
+  /* #32: @4 = input[3][18] */
+  w4 = arg[3] ? arg[3][18] : 0;
+  /* #33: @4 = (@3-@4) */
+  w4 = (w3-w4);
+  /* #34: @5 = input[3][21] */
+  w5 = arg[3] ? arg[3][21] : 0;
+  /* #35: @4 = (@4/@5) */
+  w4 /= w5;
+  /* #36: @4 = sq(@4) */
+  w4 = casadi_sq( w4 );
+  /* #37: @1 = (@1+@4) */
+  w1 += w4;
+  /* #38: output[0][1] = @1 */
+  if (res[0]) res[0][1] = w1;
+  /* #39: @1 = input[3][22] */
+  w1 = arg[3] ? arg[3][22] : 0;
+  /* #40: @1 = (@0-@1) */
+  w1 = (w0-w1);
+  /* #41: @4 = input[3][25] */
+  w4 = arg[3] ? arg[3][25] : 0;
+  /* #42: @1 = (@1/@4) */
+  w1 /= w4;
+  /* #43: @1 = sq(@1) */
+  w1 = casadi_sq( w1 );
+  /* #44: @4 = input[3][23] */
+  w4 = arg[3] ? arg[3][23] : 0;
+  /* #45: @4 = (@2-@4) */
+  w4 = (w2-w4);
+  /* #46: @5 = input[3][26] */
+  w5 = arg[3] ? arg[3][26] : 0;
+  /* #47: @4 = (@4/@5) */
+  w4 /= w5;
+  /* #48: @4 = sq(@4) */
+  w4 = casadi_sq( w4 );
+  /* #49: @1 = (@1+@4) */
+  w1 += w4;
+  /* #50: @4 = input[3][24] */
+  w4 = arg[3] ? arg[3][24] : 0;
+  /* #51: @4 = (@3-@4) */
+  w4 = (w3-w4);
+  /* #52: @5 = input[3][27] */
+  w5 = arg[3] ? arg[3][27] : 0;
+  /* #53: @4 = (@4/@5) */
+  w4 /= w5;
+  /* #54: @4 = sq(@4) */
+  w4 = casadi_sq( w4 );
+  /* #55: @1 = (@1+@4) */
+  w1 += w4;
+  /* #56: output[0][2] = @1 */
+  if (res[0]) res[0][2] = w1;
+  /* #57: @1 = input[3][28] */
+  w1 = arg[3] ? arg[3][28] : 0;
+  /* #58: @0 = (@0-@1) */
+  w0 -= w1;
+  /* #59: @1 = input[3][31] */
+  w1 = arg[3] ? arg[3][31] : 0;
+  /* #60: @0 = (@0/@1) */
+  w0 /= w1;
+  /* #61: @0 = sq(@0) */
+  w0 = casadi_sq( w0 );
+  /* #62: @1 = input[3][29] */
+  w1 = arg[3] ? arg[3][29] : 0;
+  /* #63: @2 = (@2-@1) */
+  w2 -= w1;
+  /* #64: @1 = input[3][32] */
+  w1 = arg[3] ? arg[3][32] : 0;
+  /* #65: @2 = (@2/@1) */
+  w2 /= w1;
+  /* #66: @2 = sq(@2) */
+  w2 = casadi_sq( w2 );
+  /* #67: @0 = (@0+@2) */
+  w0 += w2;
+  /* #68: @2 = input[3][30] */
+  w2 = arg[3] ? arg[3][30] : 0;
+  /* #69: @3 = (@3-@2) */
+  w3 -= w2;
+  /* #70: @2 = input[3][33] */
+  w2 = arg[3] ? arg[3][33] : 0;
+  /* #71: @3 = (@3/@2) */
+  w3 /= w2;
+  /* #72: @3 = sq(@3) */
+  w3 = casadi_sq( w3 );
+  /* #73: @0 = (@0+@3) */
+  w0 += w3;
+  /* #74: output[0][3] = @0 */
+  if (res[0]) res[0][3] = w0;
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun(const casadi_real** arg, casadi_real** res, casadi_int* iw, casadi_real* w, int mem){
+  return casadi_f0(arg, res, iw, w, mem);
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_alloc_mem(void) {
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_init_mem(int mem) {
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_free_mem(int mem) {
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_checkout(void) {
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_release(int mem) {
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_incref(void) {
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_decref(void) {
+}
+
+CASADI_SYMBOL_EXPORT casadi_int mav_nmpc_tracker_model_constr_h_fun_n_in(void) { return 4;}
+
+CASADI_SYMBOL_EXPORT casadi_int mav_nmpc_tracker_model_constr_h_fun_n_out(void) { return 1;}
+
+CASADI_SYMBOL_EXPORT casadi_real mav_nmpc_tracker_model_constr_h_fun_default_in(casadi_int i){
+  switch (i) {
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const char* mav_nmpc_tracker_model_constr_h_fun_name_in(casadi_int i){
+  switch (i) {
+    case 0: return "i0";
+    case 1: return "i1";
+    case 2: return "i2";
+    case 3: return "i3";
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const char* mav_nmpc_tracker_model_constr_h_fun_name_out(casadi_int i){
+  switch (i) {
+    case 0: return "o0";
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_constr_h_fun_sparsity_in(casadi_int i) {
+  switch (i) {
+    case 0: return casadi_s0;
+    case 1: return casadi_s1;
+    case 2: return casadi_s2;
+    case 3: return casadi_s3;
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_constr_h_fun_sparsity_out(casadi_int i) {
+  switch (i) {
+    case 0: return casadi_s4;
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_work(casadi_int *sz_arg, casadi_int* sz_res, casadi_int *sz_iw, casadi_int *sz_w) {
+  if (sz_arg) *sz_arg = 4;
+  if (sz_res) *sz_res = 1;
+  if (sz_iw) *sz_iw = 0;
+  if (sz_w) *sz_w = 6;
+  return 0;
+}
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,405 @@
+/* This file was automatically generated by CasADi.
+   The CasADi copyright holders make no ownership claim of its contents. */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* How to prefix internal symbols */
+#ifdef CASADI_CODEGEN_PREFIX
+  #define CASADI_NAMESPACE_CONCAT(NS, ID) _CASADI_NAMESPACE_CONCAT(NS, ID)
+  #define _CASADI_NAMESPACE_CONCAT(NS, ID) NS ## ID
+  #define CASADI_PREFIX(ID) CASADI_NAMESPACE_CONCAT(CODEGEN_PREFIX, ID)
+#else
+  #define CASADI_PREFIX(ID) mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_ ## ID
+#endif
+
+#include <math.h>
+
+#ifndef casadi_real
+#define casadi_real double
+#endif
+
+#ifndef casadi_int
+#define casadi_int int
+#endif
+
+/* Add prefix to internal symbols */
+#define casadi_f0 CASADI_PREFIX(f0)
+#define casadi_s0 CASADI_PREFIX(s0)
+#define casadi_s1 CASADI_PREFIX(s1)
+#define casadi_s2 CASADI_PREFIX(s2)
+#define casadi_s3 CASADI_PREFIX(s3)
+#define casadi_s4 CASADI_PREFIX(s4)
+#define casadi_s5 CASADI_PREFIX(s5)
+#define casadi_s6 CASADI_PREFIX(s6)
+#define casadi_sq CASADI_PREFIX(sq)
+
+/* Symbol visibility in DLLs */
+#ifndef CASADI_SYMBOL_EXPORT
+  #if defined(_WIN32) || defined(__WIN32__) || defined(__CYGWIN__)
+    #if defined(STATIC_LINKED)
+      #define CASADI_SYMBOL_EXPORT
+    #else
+      #define CASADI_SYMBOL_EXPORT __declspec(dllexport)
+    #endif
+  #elif defined(__GNUC__) && defined(GCC_HASCLASSVISIBILITY)
+    #define CASADI_SYMBOL_EXPORT __attribute__ ((visibility ("default")))
+  #else
+    #define CASADI_SYMBOL_EXPORT
+  #endif
+#endif
+
+casadi_real casadi_sq(casadi_real x) { return x*x;}
+
+static const casadi_int casadi_s0[13] = {9, 1, 0, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const casadi_int casadi_s1[7] = {3, 1, 0, 3, 0, 1, 2};
+static const casadi_int casadi_s2[3] = {0, 0, 0};
+static const casadi_int casadi_s3[38] = {34, 1, 0, 34, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33};
+static const casadi_int casadi_s4[8] = {4, 1, 0, 4, 0, 1, 2, 3};
+static const casadi_int casadi_s5[19] = {12, 4, 0, 3, 6, 9, 12, 3, 4, 5, 3, 4, 5, 3, 4, 5, 3, 4, 5};
+static const casadi_int casadi_s6[3] = {4, 0, 0};
+
+/* mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt:(i0[9],i1[3],i2[],i3[34])->(o0[4],o1[12x4,12nz],o2[4x0]) */
+static int casadi_f0(const casadi_real** arg, casadi_real** res, casadi_int* iw, casadi_real* w, int mem) {
+  casadi_real w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15, w16, w17, w18, w19, w20, w21, w22, w23, w24, w25;
+  /* #0: @0 = input[0][0] */
+  w0 = arg[0] ? arg[0][0] : 0;
+  /* #1: @1 = input[3][10] */
+  w1 = arg[3] ? arg[3][10] : 0;
+  /* #2: @1 = (@0-@1) */
+  w1 = (w0-w1);
+  /* #3: @2 = input[3][13] */
+  w2 = arg[3] ? arg[3][13] : 0;
+  /* #4: @1 = (@1/@2) */
+  w1 /= w2;
+  /* #5: @3 = sq(@1) */
+  w3 = casadi_sq( w1 );
+  /* #6: @4 = input[0][1] */
+  w4 = arg[0] ? arg[0][1] : 0;
+  /* #7: @5 = input[3][11] */
+  w5 = arg[3] ? arg[3][11] : 0;
+  /* #8: @5 = (@4-@5) */
+  w5 = (w4-w5);
+  /* #9: @6 = input[3][14] */
+  w6 = arg[3] ? arg[3][14] : 0;
+  /* #10: @5 = (@5/@6) */
+  w5 /= w6;
+  /* #11: @7 = sq(@5) */
+  w7 = casadi_sq( w5 );
+  /* #12: @3 = (@3+@7) */
+  w3 += w7;
+  /* #13: @7 = input[0][2] */
+  w7 = arg[0] ? arg[0][2] : 0;
+  /* #14: @8 = input[3][12] */
+  w8 = arg[3] ? arg[3][12] : 0;
+  /* #15: @8 = (@7-@8) */
+  w8 = (w7-w8);
+  /* #16: @9 = input[3][15] */
+  w9 = arg[3] ? arg[3][15] : 0;
+  /* #17: @8 = (@8/@9) */
+  w8 /= w9;
+  /* #18: @10 = sq(@8) */
+  w10 = casadi_sq( w8 );
+  /* #19: @3 = (@3+@10) */
+  w3 += w10;
+  /* #20: output[0][0] = @3 */
+  if (res[0]) res[0][0] = w3;
+  /* #21: @3 = input[3][16] */
+  w3 = arg[3] ? arg[3][16] : 0;
+  /* #22: @3 = (@0-@3) */
+  w3 = (w0-w3);
+  /* #23: @10 = input[3][19] */
+  w10 = arg[3] ? arg[3][19] : 0;
+  /* #24: @3 = (@3/@10) */
+  w3 /= w10;
+  /* #25: @11 = sq(@3) */
+  w11 = casadi_sq( w3 );
+  /* #26: @12 = input[3][17] */
+  w12 = arg[3] ? arg[3][17] : 0;
+  /* #27: @12 = (@4-@12) */
+  w12 = (w4-w12);
+  /* #28: @13 = input[3][20] */
+  w13 = arg[3] ? arg[3][20] : 0;
+  /* #29: @12 = (@12/@13) */
+  w12 /= w13;
+  /* #30: @14 = sq(@12) */
+  w14 = casadi_sq( w12 );
+  /* #31: @11 = (@11+@14) */
+  w11 += w14;
+  /* #32: @14 = input[3][18] */
+  w14 = arg[3] ? arg[3][18] : 0;
+  /* #33: @14 = (@7-@14) */
+  w14 = (w7-w14);
+  /* #34: @15 = input[3][21] */
+  w15 = arg[3] ? arg[3][21] : 0;
+  /* #35: @14 = (@14/@15) */
+  w14 /= w15;
+  /* #36: @16 = sq(@14) */
+  w16 = casadi_sq( w14 );
+  /* #37: @11 = (@11+@16) */
+  w11 += w16;
+  /* #38: output[0][1] = @11 */
+  if (res[0]) res[0][1] = w11;
+  /* #39: @11 = input[3][22] */
+  w11 = arg[3] ? arg[3][22] : 0;
+  /* #40: @11 = (@0-@11) */
+  w11 = (w0-w11);
+  /* #41: @16 = input[3][25] */
+  w16 = arg[3] ? arg[3][25] : 0;
+  /* #42: @11 = (@11/@16) */
+  w11 /= w16;
+  /* #43: @17 = sq(@11) */
+  w17 = casadi_sq( w11 );
+  /* #44: @18 = input[3][23] */
+  w18 = arg[3] ? arg[3][23] : 0;
+  /* #45: @18 = (@4-@18) */
+  w18 = (w4-w18);
+  /* #46: @19 = input[3][26] */
+  w19 = arg[3] ? arg[3][26] : 0;
+  /* #47: @18 = (@18/@19) */
+  w18 /= w19;
+  /* #48: @20 = sq(@18) */
+  w20 = casadi_sq( w18 );
+  /* #49: @17 = (@17+@20) */
+  w17 += w20;
+  /* #50: @20 = input[3][24] */
+  w20 = arg[3] ? arg[3][24] : 0;
+  /* #51: @20 = (@7-@20) */
+  w20 = (w7-w20);
+  /* #52: @21 = input[3][27] */
+  w21 = arg[3] ? arg[3][27] : 0;
+  /* #53: @20 = (@20/@21) */
+  w20 /= w21;
+  /* #54: @22 = sq(@20) */
+  w22 = casadi_sq( w20 );
+  /* #55: @17 = (@17+@22) */
+  w17 += w22;
+  /* #56: output[0][2] = @17 */
+  if (res[0]) res[0][2] = w17;
+  /* #57: @17 = input[3][28] */
+  w17 = arg[3] ? arg[3][28] : 0;
+  /* #58: @0 = (@0-@17) */
+  w0 -= w17;
+  /* #59: @17 = input[3][31] */
+  w17 = arg[3] ? arg[3][31] : 0;
+  /* #60: @0 = (@0/@17) */
+  w0 /= w17;
+  /* #61: @22 = sq(@0) */
+  w22 = casadi_sq( w0 );
+  /* #62: @23 = input[3][29] */
+  w23 = arg[3] ? arg[3][29] : 0;
+  /* #63: @4 = (@4-@23) */
+  w4 -= w23;
+  /* #64: @23 = input[3][32] */
+  w23 = arg[3] ? arg[3][32] : 0;
+  /* #65: @4 = (@4/@23) */
+  w4 /= w23;
+  /* #66: @24 = sq(@4) */
+  w24 = casadi_sq( w4 );
+  /* #67: @22 = (@22+@24) */
+  w22 += w24;
+  /* #68: @24 = input[3][30] */
+  w24 = arg[3] ? arg[3][30] : 0;
+  /* #69: @7 = (@7-@24) */
+  w7 -= w24;
+  /* #70: @24 = input[3][33] */
+  w24 = arg[3] ? arg[3][33] : 0;
+  /* #71: @7 = (@7/@24) */
+  w7 /= w24;
+  /* #72: @25 = sq(@7) */
+  w25 = casadi_sq( w7 );
+  /* #73: @22 = (@22+@25) */
+  w22 += w25;
+  /* #74: output[0][3] = @22 */
+  if (res[0]) res[0][3] = w22;
+  /* #75: @22 = 2 */
+  w22 = 2.0000000000000000e+00;
+  /* #76: @1 = (@22*@1) */
+  w1 = (w22*w1);
+  /* #77: @25 = 1 */
+  w25 = 1.0000000000000000e+00;
+  /* #78: @2 = (@25/@2) */
+  w2 = (w25/w2);
+  /* #79: @1 = (@1*@2) */
+  w1 *= w2;
+  /* #80: output[1][0] = @1 */
+  if (res[1]) res[1][0] = w1;
+  /* #81: @5 = (@22*@5) */
+  w5 = (w22*w5);
+  /* #82: @6 = (@25/@6) */
+  w6 = (w25/w6);
+  /* #83: @5 = (@5*@6) */
+  w5 *= w6;
+  /* #84: output[1][1] = @5 */
+  if (res[1]) res[1][1] = w5;
+  /* #85: @8 = (@22*@8) */
+  w8 = (w22*w8);
+  /* #86: @9 = (@25/@9) */
+  w9 = (w25/w9);
+  /* #87: @8 = (@8*@9) */
+  w8 *= w9;
+  /* #88: output[1][2] = @8 */
+  if (res[1]) res[1][2] = w8;
+  /* #89: @3 = (@22*@3) */
+  w3 = (w22*w3);
+  /* #90: @10 = (@25/@10) */
+  w10 = (w25/w10);
+  /* #91: @3 = (@3*@10) */
+  w3 *= w10;
+  /* #92: output[1][3] = @3 */
+  if (res[1]) res[1][3] = w3;
+  /* #93: @12 = (@22*@12) */
+  w12 = (w22*w12);
+  /* #94: @13 = (@25/@13) */
+  w13 = (w25/w13);
+  /* #95: @12 = (@12*@13) */
+  w12 *= w13;
+  /* #96: output[1][4] = @12 */
+  if (res[1]) res[1][4] = w12;
+  /* #97: @14 = (@22*@14) */
+  w14 = (w22*w14);
+  /* #98: @15 = (@25/@15) */
+  w15 = (w25/w15);
+  /* #99: @14 = (@14*@15) */
+  w14 *= w15;
+  /* #100: output[1][5] = @14 */
+  if (res[1]) res[1][5] = w14;
+  /* #101: @11 = (@22*@11) */
+  w11 = (w22*w11);
+  /* #102: @16 = (@25/@16) */
+  w16 = (w25/w16);
+  /* #103: @11 = (@11*@16) */
+  w11 *= w16;
+  /* #104: output[1][6] = @11 */
+  if (res[1]) res[1][6] = w11;
+  /* #105: @18 = (@22*@18) */
+  w18 = (w22*w18);
+  /* #106: @19 = (@25/@19) */
+  w19 = (w25/w19);
+  /* #107: @18 = (@18*@19) */
+  w18 *= w19;
+  /* #108: output[1][7] = @18 */
+  if (res[1]) res[1][7] = w18;
+  /* #109: @20 = (@22*@20) */
+  w20 = (w22*w20);
+  /* #110: @21 = (@25/@21) */
+  w21 = (w25/w21);
+  /* #111: @20 = (@20*@21) */
+  w20 *= w21;
+  /* #112: output[1][8] = @20 */
+  if (res[1]) res[1][8] = w20;
+  /* #113: @0 = (@22*@0) */
+  w0 = (w22*w0);
+  /* #114: @17 = (@25/@17) */
+  w17 = (w25/w17);
+  /* #115: @0 = (@0*@17) */
+  w0 *= w17;
+  /* #116: output[1][9] = @0 */
+  if (res[1]) res[1][9] = w0;
+  /* #117: @4 = (@22*@4) */
+  w4 = (w22*w4);
+  /* #118: @23 = (@25/@23) */
+  w23 = (w25/w23);
+  /* #119: @4 = (@4*@23) */
+  w4 *= w23;
+  /* #120: output[1][10] = @4 */
+  if (res[1]) res[1][10] = w4;
+  /* #121: @22 = (@22*@7) */
+  w22 *= w7;
+  /* #122: @25 = (@25/@24) */
+  w25 /= w24;
+  /* #123: @22 = (@22*@25) */
+  w22 *= w25;
+  /* #124: output[1][11] = @22 */
+  if (res[1]) res[1][11] = w22;
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt(const casadi_real** arg, casadi_real** res, casadi_int* iw, casadi_real* w, int mem){
+  return casadi_f0(arg, res, iw, w, mem);
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_alloc_mem(void) {
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_init_mem(int mem) {
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_free_mem(int mem) {
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_checkout(void) {
+  return 0;
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_release(int mem) {
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_incref(void) {
+}
+
+CASADI_SYMBOL_EXPORT void mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_decref(void) {
+}
+
+CASADI_SYMBOL_EXPORT casadi_int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_n_in(void) { return 4;}
+
+CASADI_SYMBOL_EXPORT casadi_int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_n_out(void) { return 3;}
+
+CASADI_SYMBOL_EXPORT casadi_real mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_default_in(casadi_int i){
+  switch (i) {
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const char* mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_name_in(casadi_int i){
+  switch (i) {
+    case 0: return "i0";
+    case 1: return "i1";
+    case 2: return "i2";
+    case 3: return "i3";
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const char* mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_name_out(casadi_int i){
+  switch (i) {
+    case 0: return "o0";
+    case 1: return "o1";
+    case 2: return "o2";
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_sparsity_in(casadi_int i) {
+  switch (i) {
+    case 0: return casadi_s0;
+    case 1: return casadi_s1;
+    case 2: return casadi_s2;
+    case 3: return casadi_s3;
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_sparsity_out(casadi_int i) {
+  switch (i) {
+    case 0: return casadi_s4;
+    case 1: return casadi_s5;
+    case 2: return casadi_s6;
+    default: return 0;
+  }
+}
+
+CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_constr_h_fun_jac_uxt_zt_work(casadi_int *sz_arg, casadi_int* sz_res, casadi_int *sz_iw, casadi_int *sz_w) {
+  if (sz_arg) *sz_arg = 4;
+  if (sz_res) *sz_res = 3;
+  if (sz_iw) *sz_iw = 0;
+  if (sz_w) *sz_w = 26;
+  return 0;
+}
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -46,11 +46,11 @@ extern "C" {
 
 static const casadi_int casadi_s0[13] = {9, 1, 0, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
 static const casadi_int casadi_s1[7] = {3, 1, 0, 3, 0, 1, 2};
-static const casadi_int casadi_s2[3] = {0, 0, 0};
+static const casadi_int casadi_s2[38] = {34, 1, 0, 34, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33};
 
-/* mav_nmpc_tracker_model_expl_ode_fun:(i0[9],i1[3],i2[])->(o0[9]) */
+/* mav_nmpc_tracker_model_expl_ode_fun:(i0[9],i1[3],i2[34])->(o0[9]) */
 static int casadi_f0(const casadi_real** arg, casadi_real** res, casadi_int* iw, casadi_real* w, int mem) {
-  casadi_real w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11;
+  casadi_real w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15, w16;
   /* #0: @0 = input[0][3] */
   w0 = arg[0] ? arg[0][3] : 0;
   /* #1: output[0][0] = @0 */
@@ -71,212 +71,172 @@ static int casadi_f0(const casadi_real** arg, casadi_real** res, casadi_int* iw,
   w5 = arg[0] ? arg[0][8] : 0;
   /* #9: @6 = cos(@5) */
   w6 = cos( w5 );
-  /* #10: @4 = (@4*@6) */
-  w4 *= w6;
-  /* #11: @6 = input[0][7] */
-  w6 = arg[0] ? arg[0][7] : 0;
-  /* #12: @7 = sin(@6) */
-  w7 = sin( w6 );
-  /* #13: @4 = (@4*@7) */
-  w4 *= w7;
-  /* #14: @7 = sin(@3) */
-  w7 = sin( w3 );
-  /* #15: @8 = sin(@5) */
-  w8 = sin( w5 );
-  /* #16: @7 = (@7*@8) */
-  w7 *= w8;
-  /* #17: @4 = (@4+@7) */
-  w4 += w7;
-  /* #18: @7 = input[1][2] */
-  w7 = arg[1] ? arg[1][2] : 0;
-  /* #19: @4 = (@4*@7) */
-  w4 *= w7;
-  /* #20: @8 = 0.001 */
-  w8 = 1.0000000000000000e-03;
-  /* #21: @9 = cos(@6) */
-  w9 = cos( w6 );
-  /* #22: @10 = cos(@5) */
-  w10 = cos( w5 );
-  /* #23: @9 = (@9*@10) */
-  w9 *= w10;
-  /* #24: @8 = (@8*@9) */
-  w8 *= w9;
-  /* #25: @8 = (@8*@7) */
-  w8 *= w7;
-  /* #26: @8 = (@8*@0) */
-  w8 *= w0;
-  /* #27: @9 = 0.001 */
-  w9 = 1.0000000000000000e-03;
-  /* #28: @10 = cos(@6) */
-  w10 = cos( w6 );
-  /* #29: @11 = sin(@5) */
-  w11 = sin( w5 );
-  /* #30: @10 = (@10*@11) */
-  w10 *= w11;
-  /* #31: @9 = (@9*@10) */
-  w9 *= w10;
-  /* #32: @9 = (@9*@7) */
-  w9 *= w7;
-  /* #33: @9 = (@9*@1) */
-  w9 *= w1;
-  /* #34: @8 = (@8-@9) */
-  w8 -= w9;
-  /* #35: @9 = 0.001 */
-  w9 = 1.0000000000000000e-03;
-  /* #36: @10 = sin(@6) */
-  w10 = sin( w6 );
-  /* #37: @9 = (@9*@10) */
-  w9 *= w10;
-  /* #38: @9 = (@9*@7) */
-  w9 *= w7;
-  /* #39: @9 = (@9*@2) */
-  w9 *= w2;
-  /* #40: @8 = (@8+@9) */
-  w8 += w9;
-  /* #41: @4 = (@4-@8) */
-  w4 -= w8;
-  /* #42: output[0][3] = @4 */
-  if (res[0]) res[0][3] = w4;
-  /* #43: @4 = cos(@3) */
-  w4 = cos( w3 );
-  /* #44: @8 = sin(@6) */
-  w8 = sin( w6 );
-  /* #45: @4 = (@4*@8) */
-  w4 *= w8;
-  /* #46: @8 = sin(@5) */
-  w8 = sin( w5 );
-  /* #47: @4 = (@4*@8) */
-  w4 *= w8;
-  /* #48: @8 = cos(@5) */
-  w8 = cos( w5 );
-  /* #49: @9 = sin(@3) */
-  w9 = sin( w3 );
-  /* #50: @8 = (@8*@9) */
-  w8 *= w9;
-  /* #51: @4 = (@4-@8) */
-  w4 -= w8;
-  /* #52: @4 = (@4*@7) */
-  w4 *= w7;
-  /* #53: @8 = 0.001 */
-  w8 = 1.0000000000000000e-03;
-  /* #54: @9 = cos(@3) */
-  w9 = cos( w3 );
-  /* #55: @10 = sin(@5) */
-  w10 = sin( w5 );
-  /* #56: @9 = (@9*@10) */
-  w9 *= w10;
-  /* #57: @10 = cos(@5) */
-  w10 = cos( w5 );
-  /* #58: @11 = sin(@6) */
-  w11 = sin( w6 );
-  /* #59: @10 = (@10*@11) */
-  w10 *= w11;
-  /* #60: @11 = sin(@3) */
-  w11 = sin( w3 );
-  /* #61: @10 = (@10*@11) */
-  w10 *= w11;
-  /* #62: @9 = (@9-@10) */
-  w9 -= w10;
-  /* #63: @8 = (@8*@9) */
-  w8 *= w9;
-  /* #64: @8 = (@8*@7) */
-  w8 *= w7;
-  /* #65: @8 = (@8*@0) */
-  w8 *= w0;
-  /* #66: @0 = 0.001 */
-  w0 = 1.0000000000000000e-03;
-  /* #67: @9 = cos(@3) */
-  w9 = cos( w3 );
-  /* #68: @10 = cos(@5) */
-  w10 = cos( w5 );
-  /* #69: @9 = (@9*@10) */
-  w9 *= w10;
-  /* #70: @10 = sin(@6) */
-  w10 = sin( w6 );
-  /* #71: @11 = sin(@3) */
+  /* #10: @7 = (@4*@6) */
+  w7 = (w4*w6);
+  /* #11: @8 = input[0][7] */
+  w8 = arg[0] ? arg[0][7] : 0;
+  /* #12: @9 = sin(@8) */
+  w9 = sin( w8 );
+  /* #13: @10 = (@7*@9) */
+  w10 = (w7*w9);
+  /* #14: @11 = sin(@3) */
   w11 = sin( w3 );
-  /* #72: @10 = (@10*@11) */
-  w10 *= w11;
-  /* #73: @5 = sin(@5) */
+  /* #15: @5 = sin(@5) */
   w5 = sin( w5 );
-  /* #74: @10 = (@10*@5) */
+  /* #16: @12 = (@11*@5) */
+  w12 = (w11*w5);
+  /* #17: @10 = (@10+@12) */
+  w10 += w12;
+  /* #18: @12 = input[2][6] */
+  w12 = arg[2] ? arg[2][6] : 0;
+  /* #19: @13 = input[1][2] */
+  w13 = arg[1] ? arg[1][2] : 0;
+  /* #20: @12 = (@12*@13) */
+  w12 *= w13;
+  /* #21: @10 = (@10*@12) */
+  w10 *= w12;
+  /* #22: @13 = cos(@8) */
+  w13 = cos( w8 );
+  /* #23: @14 = (@13*@6) */
+  w14 = (w13*w6);
+  /* #24: @15 = input[2][4] */
+  w15 = arg[2] ? arg[2][4] : 0;
+  /* #25: @14 = (@14*@15) */
+  w14 *= w15;
+  /* #26: @14 = (@14*@12) */
+  w14 *= w12;
+  /* #27: @14 = (@14*@0) */
+  w14 *= w0;
+  /* #28: @16 = (@13*@5) */
+  w16 = (w13*w5);
+  /* #29: @16 = (@16*@15) */
+  w16 *= w15;
+  /* #30: @16 = (@16*@12) */
+  w16 *= w12;
+  /* #31: @16 = (@16*@1) */
+  w16 *= w1;
+  /* #32: @14 = (@14-@16) */
+  w14 -= w16;
+  /* #33: @15 = (@9*@15) */
+  w15 = (w9*w15);
+  /* #34: @15 = (@15*@12) */
+  w15 *= w12;
+  /* #35: @15 = (@15*@2) */
+  w15 *= w2;
+  /* #36: @14 = (@14+@15) */
+  w14 += w15;
+  /* #37: @10 = (@10-@14) */
+  w10 -= w14;
+  /* #38: @14 = input[2][7] */
+  w14 = arg[2] ? arg[2][7] : 0;
+  /* #39: @10 = (@10+@14) */
+  w10 += w14;
+  /* #40: output[0][3] = @10 */
+  if (res[0]) res[0][3] = w10;
+  /* #41: @10 = (@4*@9) */
+  w10 = (w4*w9);
+  /* #42: @10 = (@10*@5) */
   w10 *= w5;
-  /* #75: @9 = (@9+@10) */
-  w9 += w10;
-  /* #76: @0 = (@0*@9) */
-  w0 *= w9;
-  /* #77: @0 = (@0*@7) */
-  w0 *= w7;
-  /* #78: @0 = (@0*@1) */
-  w0 *= w1;
-  /* #79: @8 = (@8-@0) */
-  w8 -= w0;
-  /* #80: @0 = 0.001 */
-  w0 = 1.0000000000000000e-03;
-  /* #81: @1 = cos(@6) */
-  w1 = cos( w6 );
-  /* #82: @9 = sin(@3) */
-  w9 = sin( w3 );
-  /* #83: @1 = (@1*@9) */
-  w1 *= w9;
-  /* #84: @0 = (@0*@1) */
-  w0 *= w1;
-  /* #85: @0 = (@0*@7) */
-  w0 *= w7;
-  /* #86: @0 = (@0*@2) */
-  w0 *= w2;
-  /* #87: @8 = (@8-@0) */
-  w8 -= w0;
-  /* #88: @4 = (@4-@8) */
-  w4 -= w8;
-  /* #89: output[0][4] = @4 */
-  if (res[0]) res[0][4] = w4;
-  /* #90: @4 = -9.8066 */
-  w4 = -9.8065999999999995e+00;
-  /* #91: @8 = cos(@6) */
-  w8 = cos( w6 );
-  /* #92: @0 = cos(@3) */
-  w0 = cos( w3 );
-  /* #93: @8 = (@8*@0) */
-  w8 *= w0;
-  /* #94: @8 = (@8*@7) */
-  w8 *= w7;
-  /* #95: @4 = (@4+@8) */
-  w4 += w8;
-  /* #96: output[0][5] = @4 */
-  if (res[0]) res[0][5] = w4;
-  /* #97: @4 = 1.0234 */
-  w4 = 1.0234000000000001e+00;
-  /* #98: @8 = input[1][0] */
-  w8 = arg[1] ? arg[1][0] : 0;
-  /* #99: @4 = (@4*@8) */
-  w4 *= w8;
-  /* #100: @4 = (@4-@3) */
-  w4 -= w3;
-  /* #101: @3 = 0.3256 */
-  w3 = 3.2560000000000000e-01;
-  /* #102: @4 = (@4/@3) */
-  w4 /= w3;
-  /* #103: output[0][6] = @4 */
-  if (res[0]) res[0][6] = w4;
-  /* #104: @4 = 1.0266 */
-  w4 = 1.0266000000000000e+00;
-  /* #105: @3 = input[1][1] */
+  /* #43: @14 = (@6*@11) */
+  w14 = (w6*w11);
+  /* #44: @10 = (@10-@14) */
+  w10 -= w14;
+  /* #45: @10 = (@10*@12) */
+  w10 *= w12;
+  /* #46: @14 = (@4*@5) */
+  w14 = (w4*w5);
+  /* #47: @6 = (@6*@9) */
+  w6 *= w9;
+  /* #48: @6 = (@6*@11) */
+  w6 *= w11;
+  /* #49: @14 = (@14-@6) */
+  w14 -= w6;
+  /* #50: @6 = input[2][5] */
+  w6 = arg[2] ? arg[2][5] : 0;
+  /* #51: @14 = (@14*@6) */
+  w14 *= w6;
+  /* #52: @14 = (@14*@12) */
+  w14 *= w12;
+  /* #53: @14 = (@14*@0) */
+  w14 *= w0;
+  /* #54: @9 = (@9*@11) */
+  w9 *= w11;
+  /* #55: @9 = (@9*@5) */
+  w9 *= w5;
+  /* #56: @7 = (@7+@9) */
+  w7 += w9;
+  /* #57: @7 = (@7*@6) */
+  w7 *= w6;
+  /* #58: @7 = (@7*@12) */
+  w7 *= w12;
+  /* #59: @7 = (@7*@1) */
+  w7 *= w1;
+  /* #60: @14 = (@14-@7) */
+  w14 -= w7;
+  /* #61: @11 = (@13*@11) */
+  w11 = (w13*w11);
+  /* #62: @11 = (@11*@6) */
+  w11 *= w6;
+  /* #63: @11 = (@11*@12) */
+  w11 *= w12;
+  /* #64: @11 = (@11*@2) */
+  w11 *= w2;
+  /* #65: @14 = (@14-@11) */
+  w14 -= w11;
+  /* #66: @10 = (@10-@14) */
+  w10 -= w14;
+  /* #67: @14 = input[2][8] */
+  w14 = arg[2] ? arg[2][8] : 0;
+  /* #68: @10 = (@10+@14) */
+  w10 += w14;
+  /* #69: output[0][4] = @10 */
+  if (res[0]) res[0][4] = w10;
+  /* #70: @10 = -9.8066 */
+  w10 = -9.8065999999999995e+00;
+  /* #71: @13 = (@13*@4) */
+  w13 *= w4;
+  /* #72: @13 = (@13*@12) */
+  w13 *= w12;
+  /* #73: @10 = (@10+@13) */
+  w10 += w13;
+  /* #74: @13 = input[2][9] */
+  w13 = arg[2] ? arg[2][9] : 0;
+  /* #75: @10 = (@10+@13) */
+  w10 += w13;
+  /* #76: output[0][5] = @10 */
+  if (res[0]) res[0][5] = w10;
+  /* #77: @10 = input[2][1] */
+  w10 = arg[2] ? arg[2][1] : 0;
+  /* #78: @13 = input[1][0] */
+  w13 = arg[1] ? arg[1][0] : 0;
+  /* #79: @10 = (@10*@13) */
+  w10 *= w13;
+  /* #80: @10 = (@10-@3) */
+  w10 -= w3;
+  /* #81: @3 = input[2][0] */
+  w3 = arg[2] ? arg[2][0] : 0;
+  /* #82: @10 = (@10/@3) */
+  w10 /= w3;
+  /* #83: output[0][6] = @10 */
+  if (res[0]) res[0][6] = w10;
+  /* #84: @10 = input[2][3] */
+  w10 = arg[2] ? arg[2][3] : 0;
+  /* #85: @3 = input[1][1] */
   w3 = arg[1] ? arg[1][1] : 0;
-  /* #106: @4 = (@4*@3) */
-  w4 *= w3;
-  /* #107: @4 = (@4-@6) */
-  w4 -= w6;
-  /* #108: @6 = 0.3249 */
-  w6 = 3.2490000000000002e-01;
-  /* #109: @4 = (@4/@6) */
-  w4 /= w6;
-  /* #110: output[0][7] = @4 */
-  if (res[0]) res[0][7] = w4;
-  /* #111: @4 = 0 */
-  w4 = 0.;
-  /* #112: output[0][8] = @4 */
-  if (res[0]) res[0][8] = w4;
+  /* #86: @10 = (@10*@3) */
+  w10 *= w3;
+  /* #87: @10 = (@10-@8) */
+  w10 -= w8;
+  /* #88: @8 = input[2][2] */
+  w8 = arg[2] ? arg[2][2] : 0;
+  /* #89: @10 = (@10/@8) */
+  w10 /= w8;
+  /* #90: output[0][7] = @10 */
+  if (res[0]) res[0][7] = w10;
+  /* #91: @10 = 0 */
+  w10 = 0.;
+  /* #92: output[0][8] = @10 */
+  if (res[0]) res[0][8] = w10;
   return 0;
 }
 
@@ -351,10 +311,10 @@ CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_expl_ode_fun_spars
 }
 
 CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_expl_ode_fun_work(casadi_int *sz_arg, casadi_int* sz_res, casadi_int *sz_iw, casadi_int *sz_w) {
-  if (sz_arg) *sz_arg = 5;
-  if (sz_res) *sz_res = 2;
+  if (sz_arg) *sz_arg = 3;
+  if (sz_res) *sz_res = 1;
   if (sz_iw) *sz_iw = 0;
-  if (sz_w) *sz_w = 12;
+  if (sz_w) *sz_w = 17;
   return 0;
 }
 
@@ -24,11 +24,7 @@ extern "C" {
 #endif
 
 /* Add prefix to internal symbols */
-#define casadi_clear CASADI_PREFIX(clear)
-#define casadi_copy CASADI_PREFIX(copy)
 #define casadi_f0 CASADI_PREFIX(f0)
-#define casadi_fill CASADI_PREFIX(fill)
-#define casadi_project CASADI_PREFIX(project)
 #define casadi_s0 CASADI_PREFIX(s0)
 #define casadi_s1 CASADI_PREFIX(s1)
 #define casadi_s2 CASADI_PREFIX(s2)
@@ -36,9 +32,6 @@ extern "C" {
 #define casadi_s4 CASADI_PREFIX(s4)
 #define casadi_s5 CASADI_PREFIX(s5)
 #define casadi_s6 CASADI_PREFIX(s6)
-#define casadi_s7 CASADI_PREFIX(s7)
-#define casadi_s8 CASADI_PREFIX(s8)
-#define casadi_trans CASADI_PREFIX(trans)
 
 /* Symbol visibility in DLLs */
 #ifndef CASADI_SYMBOL_EXPORT
@@ -55,76 +48,17 @@ extern "C" {
   #endif
 #endif
 
-void casadi_copy(const casadi_real* x, casadi_int n, casadi_real* y) {
-  casadi_int i;
-  if (y) {
-    if (x) {
-      for (i=0; i<n; ++i) *y++ = *x++;
-    } else {
-      for (i=0; i<n; ++i) *y++ = 0.;
-    }
-  }
-}
-
-void casadi_clear(casadi_real* x, casadi_int n) {
-  casadi_int i;
-  if (x) {
-    for (i=0; i<n; ++i) *x++ = 0;
-  }
-}
-
-void casadi_fill(casadi_real* x, casadi_int n, casadi_real alpha) {
-  casadi_int i;
-  if (x) {
-    for (i=0; i<n; ++i) *x++ = alpha;
-  }
-}
-
-void casadi_trans(const casadi_real* x, const casadi_int* sp_x, casadi_real* y,
-    const casadi_int* sp_y, casadi_int* tmp) {
-  casadi_int ncol_x, nnz_x, ncol_y, k;
-  const casadi_int* row_x, *colind_y;
-  ncol_x = sp_x[1];
-  nnz_x = sp_x[2 + ncol_x];
-  row_x = sp_x + 2 + ncol_x+1;
-  ncol_y = sp_y[1];
-  colind_y = sp_y+2;
-  for (k=0; k<ncol_y; ++k) tmp[k] = colind_y[k];
-  for (k=0; k<nnz_x; ++k) {
-    y[tmp[row_x[k]]++] = x[k];
-  }
-}
-
-void casadi_project(const casadi_real* x, const casadi_int* sp_x, casadi_real* y, const casadi_int* sp_y, casadi_real* w) {
-  casadi_int ncol_x, ncol_y, i, el;
-  const casadi_int *colind_x, *row_x, *colind_y, *row_y;
-  ncol_x = sp_x[1];
-  colind_x = sp_x+2; row_x = sp_x + 2 + ncol_x+1;
-  ncol_y = sp_y[1];
-  colind_y = sp_y+2; row_y = sp_y + 2 + ncol_y+1;
-  for (i=0; i<ncol_x; ++i) {
-    for (el=colind_y[i]; el<colind_y[i+1]; ++el) w[row_y[el]] = 0;
-    for (el=colind_x[i]; el<colind_x[i+1]; ++el) w[row_x[el]] = x[el];
-    for (el=colind_y[i]; el<colind_y[i+1]; ++el) y[el] = w[row_y[el]];
-  }
-}
-
-static const casadi_int casadi_s0[11] = {9, 3, 0, 1, 2, 5, 6, 7, 3, 4, 5};
-static const casadi_int casadi_s1[17] = {3, 9, 0, 0, 0, 0, 1, 2, 3, 4, 5, 5, 2, 2, 2, 0, 1};
-static const casadi_int casadi_s2[30] = {9, 3, 0, 8, 16, 24, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
-static const casadi_int casadi_s3[13] = {9, 1, 0, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
-static const casadi_int casadi_s4[93] = {9, 9, 0, 9, 18, 27, 36, 45, 54, 63, 72, 81, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8};
-static const casadi_int casadi_s5[33] = {9, 3, 0, 9, 18, 27, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8};
-static const casadi_int casadi_s6[7] = {3, 1, 0, 3, 0, 1, 2};
-static const casadi_int casadi_s7[3] = {0, 0, 0};
-static const casadi_int casadi_s8[84] = {9, 9, 0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+static const casadi_int casadi_s0[13] = {9, 1, 0, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const casadi_int casadi_s1[93] = {9, 9, 0, 9, 18, 27, 36, 45, 54, 63, 72, 81, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const casadi_int casadi_s2[33] = {9, 3, 0, 9, 18, 27, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const casadi_int casadi_s3[7] = {3, 1, 0, 3, 0, 1, 2};
+static const casadi_int casadi_s4[38] = {34, 1, 0, 34, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33};
+static const casadi_int casadi_s5[84] = {9, 9, 0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+static const casadi_int casadi_s6[30] = {9, 3, 0, 8, 16, 24, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
 
-/* mav_nmpc_tracker_model_expl_vde_forw:(i0[9],i1[9x9],i2[9x3],i3[3],i4[])->(o0[9],o1[9x9,72nz],o2[9x3,24nz]) */
+/* mav_nmpc_tracker_model_expl_vde_forw:(i0[9],i1[9x9],i2[9x3],i3[3],i4[34])->(o0[9],o1[9x9,72nz],o2[9x3,24nz]) */
 static int casadi_f0(const casadi_real** arg, casadi_real** res, casadi_int* iw, casadi_real* w, int mem) {
-  casadi_int i;
-  casadi_real *rr, *ss;
-  const casadi_real *cs;
-  casadi_real w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15, w16, w17, w18, w19, w20, w21, w22, w23, w24, w25, w26, w27, w28, w29, w30, w31, w32, w33, w34, w35, w36, w37, w38, w39, w40, w41, w42, w43, w44, w45, w46, w47, w48, w49, w50, w51, w52, w53, w54, w55, w56, w57, w58, w59, w60, w61, w62, w63, *w64=w+73, *w65=w+154, *w66=w+163, *w67=w+172, *w68=w+181, *w69=w+190, *w70=w+199, *w71=w+208, *w72=w+217, *w73=w+226, w74, w75, w76, w77, w78, w79, w80, w81, w82, w83, w84, w85, w86, w87, w88, w89, w90, w91, w92, w93, w94, w95, w96, w97, w98, w99, w100, w101, w102, w103, w104, w105, w106, w107, w108, w109, w110, w111, w112, *w113=w+274, *w117=w+279, *w119=w+282, *w120=w+287, *w121=w+292, *w122=w+316, *w123=w+343, *w124=w+351, *w125=w+359, *w126=w+367;
+  casadi_real w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15, w16, w17, w18, w19, w20, w21, w22, w23, w24, w25, w26, w27, w28, w29, w30, w31, w32, w33, w34, w35, w36, w37, w38, w39, w40, w41, w42, w43, w44, w45, w46, w47, w48, w49, w50, w51;
   /* #0: @0 = input[0][3] */
   w0 = arg[0] ? arg[0][3] : 0;
   /* #1: output[0][0] = @0 */
@@ -146,3776 +80,2967 @@ static int casadi_f0(const casadi_real** arg, casadi_real** res, casadi_int* iw,
   /* #9: @6 = cos(@5) */
   w6 = cos( w5 );
   /* #10: @7 = (@4*@6) */
-  w7  = (w4*w6);
+  w7 = (w4*w6);
   /* #11: @8 = input[0][7] */
   w8 = arg[0] ? arg[0][7] : 0;
   /* #12: @9 = sin(@8) */
   w9 = sin( w8 );
   /* #13: @10 = (@7*@9) */
-  w10  = (w7*w9);
+  w10 = (w7*w9);
   /* #14: @11 = sin(@3) */
   w11 = sin( w3 );
-  /* #15: @12 = sin(@5) */
-  w12 = sin( w5 );
-  /* #16: @13 = (@11*@12) */
-  w13  = (w11*w12);
-  /* #17: @10 = (@10+@13) */
-  w10 += w13;
-  /* #18: @13 = input[3][2] */
+  /* #15: @5 = sin(@5) */
+  w5 = sin( w5 );
+  /* #16: @12 = (@11*@5) */
+  w12 = (w11*w5);
+  /* #17: @10 = (@10+@12) */
+  w10 += w12;
+  /* #18: @12 = input[4][6] */
+  w12 = arg[4] ? arg[4][6] : 0;
+  /* #19: @13 = input[3][2] */
   w13 = arg[3] ? arg[3][2] : 0;
-  /* #19: @14 = (@10*@13) */
-  w14  = (w10*w13);
-  /* #20: @15 = 0.001 */
-  w15 = 1.0000000000000000e-03;
-  /* #21: @16 = cos(@8) */
-  w16 = cos( w8 );
-  /* #22: @17 = cos(@5) */
-  w17 = cos( w5 );
-  /* #23: @18 = (@16*@17) */
-  w18  = (w16*w17);
-  /* #24: @18 = (@15*@18) */
-  w18  = (w15*w18);
-  /* #25: @19 = (@18*@13) */
-  w19  = (w18*w13);
-  /* #26: @20 = (@19*@0) */
-  w20  = (w19*w0);
-  /* #27: @21 = 0.001 */
-  w21 = 1.0000000000000000e-03;
-  /* #28: @22 = cos(@8) */
-  w22 = cos( w8 );
-  /* #29: @23 = sin(@5) */
-  w23 = sin( w5 );
-  /* #30: @24 = (@22*@23) */
-  w24  = (w22*w23);
-  /* #31: @24 = (@21*@24) */
-  w24  = (w21*w24);
-  /* #32: @25 = (@24*@13) */
-  w25  = (w24*w13);
-  /* #33: @26 = (@25*@1) */
-  w26  = (w25*w1);
-  /* #34: @20 = (@20-@26) */
-  w20 -= w26;
-  /* #35: @26 = 0.001 */
-  w26 = 1.0000000000000000e-03;
-  /* #36: @27 = sin(@8) */
-  w27 = sin( w8 );
-  /* #37: @27 = (@26*@27) */
-  w27  = (w26*w27);
-  /* #38: @28 = (@27*@13) */
-  w28  = (w27*w13);
-  /* #39: @29 = (@28*@2) */
-  w29  = (w28*w2);
-  /* #40: @20 = (@20+@29) */
-  w20 += w29;
-  /* #41: @14 = (@14-@20) */
-  w14 -= w20;
-  /* #42: output[0][3] = @14 */
+  /* #20: @13 = (@12*@13) */
+  w13 = (w12*w13);
+  /* #21: @14 = (@10*@13) */
+  w14 = (w10*w13);
+  /* #22: @15 = cos(@8) */
+  w15 = cos( w8 );
+  /* #23: @16 = (@15*@6) */
+  w16 = (w15*w6);
+  /* #24: @17 = input[4][4] */
+  w17 = arg[4] ? arg[4][4] : 0;
+  /* #25: @16 = (@16*@17) */
+  w16 *= w17;
+  /* #26: @18 = (@16*@13) */
+  w18 = (w16*w13);
+  /* #27: @19 = (@18*@0) */
+  w19 = (w18*w0);
+  /* #28: @20 = (@15*@5) */
+  w20 = (w15*w5);
+  /* #29: @20 = (@20*@17) */
+  w20 *= w17;
+  /* #30: @21 = (@20*@13) */
+  w21 = (w20*w13);
+  /* #31: @22 = (@21*@1) */
+  w22 = (w21*w1);
+  /* #32: @19 = (@19-@22) */
+  w19 -= w22;
+  /* #33: @22 = (@9*@17) */
+  w22 = (w9*w17);
+  /* #34: @23 = (@22*@13) */
+  w23 = (w22*w13);
+  /* #35: @24 = (@23*@2) */
+  w24 = (w23*w2);
+  /* #36: @19 = (@19+@24) */
+  w19 += w24;
+  /* #37: @14 = (@14-@19) */
+  w14 -= w19;
+  /* #38: @19 = input[4][7] */
+  w19 = arg[4] ? arg[4][7] : 0;
+  /* #39: @14 = (@14+@19) */
+  w14 += w19;
+  /* #40: output[0][3] = @14 */
   if (res[0]) res[0][3] = w14;
-  /* #43: @14 = cos(@3) */
-  w14 = cos( w3 );
-  /* #44: @20 = sin(@8) */
-  w20 = sin( w8 );
-  /* #45: @29 = (@14*@20) */
-  w29  = (w14*w20);
-  /* #46: @30 = sin(@5) */
-  w30 = sin( w5 );
-  /* #47: @31 = (@29*@30) */
-  w31  = (w29*w30);
-  /* #48: @32 = cos(@5) */
-  w32 = cos( w5 );
-  /* #49: @33 = sin(@3) */
-  w33 = sin( w3 );
-  /* #50: @34 = (@32*@33) */
-  w34  = (w32*w33);
-  /* #51: @31 = (@31-@34) */
-  w31 -= w34;
-  /* #52: @34 = (@31*@13) */
-  w34  = (w31*w13);
-  /* #53: @35 = 0.001 */
-  w35 = 1.0000000000000000e-03;
-  /* #54: @36 = cos(@3) */
-  w36 = cos( w3 );
-  /* #55: @37 = sin(@5) */
-  w37 = sin( w5 );
-  /* #56: @38 = (@36*@37) */
-  w38  = (w36*w37);
-  /* #57: @39 = cos(@5) */
-  w39 = cos( w5 );
-  /* #58: @40 = sin(@8) */
-  w40 = sin( w8 );
-  /* #59: @41 = (@39*@40) */
-  w41  = (w39*w40);
-  /* #60: @42 = sin(@3) */
-  w42 = sin( w3 );
-  /* #61: @43 = (@41*@42) */
-  w43  = (w41*w42);
-  /* #62: @38 = (@38-@43) */
-  w38 -= w43;
-  /* #63: @38 = (@35*@38) */
-  w38  = (w35*w38);
-  /* #64: @43 = (@38*@13) */
-  w43  = (w38*w13);
-  /* #65: @44 = (@43*@0) */
-  w44  = (w43*w0);
-  /* #66: @45 = 0.001 */
-  w45 = 1.0000000000000000e-03;
-  /* #67: @46 = cos(@3) */
-  w46 = cos( w3 );
-  /* #68: @47 = cos(@5) */
-  w47 = cos( w5 );
-  /* #69: @48 = (@46*@47) */
-  w48  = (w46*w47);
-  /* #70: @49 = sin(@8) */
-  w49 = sin( w8 );
-  /* #71: @50 = sin(@3) */
-  w50 = sin( w3 );
-  /* #72: @51 = (@49*@50) */
-  w51  = (w49*w50);
-  /* #73: @52 = sin(@5) */
-  w52 = sin( w5 );
-  /* #74: @53 = (@51*@52) */
-  w53  = (w51*w52);
-  /* #75: @48 = (@48+@53) */
-  w48 += w53;
-  /* #76: @48 = (@45*@48) */
-  w48  = (w45*w48);
-  /* #77: @53 = (@48*@13) */
-  w53  = (w48*w13);
-  /* #78: @54 = (@53*@1) */
-  w54  = (w53*w1);
-  /* #79: @44 = (@44-@54) */
-  w44 -= w54;
-  /* #80: @54 = 0.001 */
-  w54 = 1.0000000000000000e-03;
-  /* #81: @55 = cos(@8) */
-  w55 = cos( w8 );
-  /* #82: @56 = sin(@3) */
-  w56 = sin( w3 );
-  /* #83: @57 = (@55*@56) */
-  w57  = (w55*w56);
-  /* #84: @57 = (@54*@57) */
-  w57  = (w54*w57);
-  /* #85: @58 = (@57*@13) */
-  w58  = (w57*w13);
-  /* #86: @59 = (@58*@2) */
-  w59  = (w58*w2);
-  /* #87: @44 = (@44-@59) */
-  w44 -= w59;
-  /* #88: @34 = (@34-@44) */
-  w34 -= w44;
-  /* #89: output[0][4] = @34 */
-  if (res[0]) res[0][4] = w34;
-  /* #90: @34 = -9.8066 */
-  w34 = -9.8065999999999995e+00;
-  /* #91: @44 = cos(@8) */
-  w44 = cos( w8 );
-  /* #92: @59 = cos(@3) */
-  w59 = cos( w3 );
-  /* #93: @60 = (@44*@59) */
-  w60  = (w44*w59);
-  /* #94: @61 = (@60*@13) */
-  w61  = (w60*w13);
-  /* #95: @34 = (@34+@61) */
-  w34 += w61;
-  /* #96: output[0][5] = @34 */
-  if (res[0]) res[0][5] = w34;
-  /* #97: @34 = 1.0234 */
-  w34 = 1.0234000000000001e+00;
-  /* #98: @61 = input[3][0] */
-  w61 = arg[3] ? arg[3][0] : 0;
-  /* #99: @61 = (@34*@61) */
-  w61  = (w34*w61);
-  /* #100: @61 = (@61-@3) */
-  w61 -= w3;
-  /* #101: @62 = 0.3256 */
-  w62 = 3.2560000000000000e-01;
-  /* #102: @61 = (@61/@62) */
-  w61 /= w62;
-  /* #103: output[0][6] = @61 */
-  if (res[0]) res[0][6] = w61;
-  /* #104: @61 = 1.0266 */
-  w61 = 1.0266000000000000e+00;
-  /* #105: @62 = input[3][1] */
-  w62 = arg[3] ? arg[3][1] : 0;
-  /* #106: @62 = (@61*@62) */
-  w62  = (w61*w62);
-  /* #107: @62 = (@62-@8) */
-  w62 -= w8;
-  /* #108: @63 = 0.3249 */
-  w63 = 3.2490000000000002e-01;
-  /* #109: @62 = (@62/@63) */
-  w62 /= w63;
-  /* #110: output[0][7] = @62 */
-  if (res[0]) res[0][7] = w62;
-  /* #111: @62 = 0 */
-  w62 = 0.;
-  /* #112: output[0][8] = @62 */
-  if (res[0]) res[0][8] = w62;
-  /* #113: @64 = input[1][0] */
-  casadi_copy(arg[1], 81, w64);
-  /* #114: {@65, @66, @67, @68, @69, @70, @71, @72, @73} = horzsplit(@64) */
-  casadi_copy(w64, 9, w65);
-  casadi_copy(w64+9, 9, w66);
-  casadi_copy(w64+18, 9, w67);
-  casadi_copy(w64+27, 9, w68);
-  casadi_copy(w64+36, 9, w69);
-  casadi_copy(w64+45, 9, w70);
-  casadi_copy(w64+54, 9, w71);
-  casadi_copy(w64+63, 9, w72);
-  casadi_copy(w64+72, 9, w73);
-  /* #115: {NULL, NULL, NULL, @62, @63, @74, @75, @76, @77} = vertsplit(@65) */
-  w62 = w65[3];
-  w63 = w65[4];
-  w74 = w65[5];
-  w75 = w65[6];
-  w76 = w65[7];
-  w77 = w65[8];
-  /* #116: output[1][0] = @62 */
-  if (res[1]) res[1][0] = w62;
-  /* #117: output[1][1] = @63 */
-  if (res[1]) res[1][1] = w63;
-  /* #118: output[1][2] = @74 */
-  if (res[1]) res[1][2] = w74;
-  /* #119: @78 = sin(@5) */
-  w78 = sin( w5 );
-  /* #120: @79 = (@78*@77) */
-  w79  = (w78*w77);
-  /* #121: @79 = (@4*@79) */
-  w79  = (w4*w79);
-  /* #122: @79 = (-@79) */
-  w79 = (- w79 );
-  /* #123: @80 = sin(@3) */
-  w80 = sin( w3 );
-  /* #124: @81 = (@80*@75) */
-  w81  = (w80*w75);
-  /* #125: @81 = (@6*@81) */
-  w81  = (w6*w81);
-  /* #126: @79 = (@79-@81) */
-  w79 -= w81;
-  /* #127: @79 = (@9*@79) */
-  w79  = (w9*w79);
-  /* #128: @81 = cos(@8) */
-  w81 = cos( w8 );
-  /* #129: @82 = (@81*@76) */
-  w82  = (w81*w76);
-  /* #130: @82 = (@7*@82) */
-  w82  = (w7*w82);
-  /* #131: @79 = (@79+@82) */
-  w79 += w82;
-  /* #132: @82 = cos(@3) */
-  w82 = cos( w3 );
-  /* #133: @83 = (@82*@75) */
-  w83  = (w82*w75);
-  /* #134: @83 = (@12*@83) */
-  w83  = (w12*w83);
-  /* #135: @84 = cos(@5) */
-  w84 = cos( w5 );
-  /* #136: @85 = (@84*@77) */
-  w85  = (w84*w77);
-  /* #137: @85 = (@11*@85) */
-  w85  = (w11*w85);
-  /* #138: @83 = (@83+@85) */
-  w83 += w85;
-  /* #139: @79 = (@79+@83) */
-  w79 += w83;
-  /* #140: @79 = (@13*@79) */
-  w79  = (w13*w79);
-  /* #141: @83 = sin(@5) */
-  w83 = sin( w5 );
-  /* #142: @85 = (@83*@77) */
-  w85  = (w83*w77);
-  /* #143: @85 = (@16*@85) */
-  w85  = (w16*w85);
-  /* #144: @85 = (-@85) */
-  w85 = (- w85 );
-  /* #145: @86 = sin(@8) */
-  w86 = sin( w8 );
-  /* #146: @87 = (@86*@76) */
-  w87  = (w86*w76);
-  /* #147: @87 = (@17*@87) */
-  w87  = (w17*w87);
-  /* #148: @85 = (@85-@87) */
-  w85 -= w87;
-  /* #149: @85 = (@15*@85) */
-  w85  = (w15*w85);
-  /* #150: @85 = (@13*@85) */
-  w85  = (w13*w85);
-  /* #151: @85 = (@0*@85) */
-  w85  = (w0*w85);
-  /* #152: @87 = (@19*@62) */
-  w87  = (w19*w62);
-  /* #153: @85 = (@85+@87) */
-  w85 += w87;
-  /* #154: @87 = cos(@5) */
-  w87 = cos( w5 );
-  /* #155: @88 = (@87*@77) */
-  w88  = (w87*w77);
-  /* #156: @88 = (@22*@88) */
-  w88  = (w22*w88);
-  /* #157: @89 = sin(@8) */
-  w89 = sin( w8 );
-  /* #158: @90 = (@89*@76) */
-  w90  = (w89*w76);
-  /* #159: @90 = (@23*@90) */
-  w90  = (w23*w90);
-  /* #160: @88 = (@88-@90) */
-  w88 -= w90;
-  /* #161: @88 = (@21*@88) */
-  w88  = (w21*w88);
-  /* #162: @88 = (@13*@88) */
-  w88  = (w13*w88);
-  /* #163: @88 = (@1*@88) */
-  w88  = (w1*w88);
-  /* #164: @90 = (@25*@63) */
-  w90  = (w25*w63);
-  /* #165: @88 = (@88+@90) */
-  w88 += w90;
-  /* #166: @85 = (@85-@88) */
-  w85 -= w88;
-  /* #167: @88 = cos(@8) */
-  w88 = cos( w8 );
-  /* #168: @90 = (@88*@76) */
-  w90  = (w88*w76);
-  /* #169: @90 = (@26*@90) */
-  w90  = (w26*w90);
-  /* #170: @90 = (@13*@90) */
-  w90  = (w13*w90);
-  /* #171: @90 = (@2*@90) */
-  w90  = (w2*w90);
-  /* #172: @91 = (@28*@74) */
-  w91  = (w28*w74);
-  /* #173: @90 = (@90+@91) */
-  w90 += w91;
-  /* #174: @85 = (@85+@90) */
-  w85 += w90;
-  /* #175: @79 = (@79-@85) */
-  w79 -= w85;
-  /* #176: output[1][3] = @79 */
-  if (res[1]) res[1][3] = w79;
-  /* #177: @79 = cos(@8) */
-  w79 = cos( w8 );
-  /* #178: @85 = (@79*@76) */
-  w85  = (w79*w76);
-  /* #179: @85 = (@14*@85) */
-  w85  = (w14*w85);
-  /* #180: @90 = sin(@3) */
-  w90 = sin( w3 );
-  /* #181: @91 = (@90*@75) */
-  w91  = (w90*w75);
-  /* #182: @91 = (@20*@91) */
-  w91  = (w20*w91);
-  /* #183: @85 = (@85-@91) */
-  w85 -= w91;
-  /* #184: @85 = (@30*@85) */
-  w85  = (w30*w85);
-  /* #185: @91 = cos(@5) */
-  w91 = cos( w5 );
-  /* #186: @92 = (@91*@77) */
-  w92  = (w91*w77);
-  /* #187: @92 = (@29*@92) */
-  w92  = (w29*w92);
-  /* #188: @85 = (@85+@92) */
-  w85 += w92;
-  /* #189: @92 = cos(@3) */
-  w92 = cos( w3 );
-  /* #190: @93 = (@92*@75) */
-  w93  = (w92*w75);
-  /* #191: @93 = (@32*@93) */
-  w93  = (w32*w93);
-  /* #192: @94 = sin(@5) */
-  w94 = sin( w5 );
-  /* #193: @95 = (@94*@77) */
-  w95  = (w94*w77);
-  /* #194: @95 = (@33*@95) */
-  w95  = (w33*w95);
-  /* #195: @93 = (@93-@95) */
-  w93 -= w95;
-  /* #196: @85 = (@85-@93) */
-  w85 -= w93;
-  /* #197: @85 = (@13*@85) */
-  w85  = (w13*w85);
-  /* #198: @93 = cos(@5) */
-  w93 = cos( w5 );
-  /* #199: @95 = (@93*@77) */
-  w95  = (w93*w77);
-  /* #200: @95 = (@36*@95) */
-  w95  = (w36*w95);
-  /* #201: @96 = sin(@3) */
-  w96 = sin( w3 );
-  /* #202: @97 = (@96*@75) */
-  w97  = (w96*w75);
-  /* #203: @97 = (@37*@97) */
-  w97  = (w37*w97);
-  /* #204: @95 = (@95-@97) */
-  w95 -= w97;
-  /* #205: @97 = cos(@8) */
-  w97 = cos( w8 );
-  /* #206: @98 = (@97*@76) */
-  w98  = (w97*w76);
-  /* #207: @98 = (@39*@98) */
-  w98  = (w39*w98);
-  /* #208: @99 = sin(@5) */
-  w99 = sin( w5 );
-  /* #209: @100 = (@99*@77) */
-  w100  = (w99*w77);
-  /* #210: @100 = (@40*@100) */
-  w100  = (w40*w100);
-  /* #211: @98 = (@98-@100) */
-  w98 -= w100;
-  /* #212: @98 = (@42*@98) */
-  w98  = (w42*w98);
-  /* #213: @100 = cos(@3) */
-  w100 = cos( w3 );
-  /* #214: @101 = (@100*@75) */
-  w101  = (w100*w75);
-  /* #215: @101 = (@41*@101) */
-  w101  = (w41*w101);
-  /* #216: @98 = (@98+@101) */
-  w98 += w101;
-  /* #217: @95 = (@95-@98) */
-  w95 -= w98;
-  /* #218: @95 = (@35*@95) */
-  w95  = (w35*w95);
-  /* #219: @95 = (@13*@95) */
-  w95  = (w13*w95);
-  /* #220: @95 = (@0*@95) */
-  w95  = (w0*w95);
-  /* #221: @62 = (@43*@62) */
-  w62  = (w43*w62);
-  /* #222: @95 = (@95+@62) */
-  w95 += w62;
-  /* #223: @62 = sin(@5) */
-  w62 = sin( w5 );
-  /* #224: @98 = (@62*@77) */
-  w98  = (w62*w77);
-  /* #225: @98 = (@46*@98) */
-  w98  = (w46*w98);
-  /* #226: @98 = (-@98) */
-  w98 = (- w98 );
-  /* #227: @101 = sin(@3) */
-  w101 = sin( w3 );
-  /* #228: @102 = (@101*@75) */
-  w102  = (w101*w75);
-  /* #229: @102 = (@47*@102) */
-  w102  = (w47*w102);
-  /* #230: @98 = (@98-@102) */
-  w98 -= w102;
-  /* #231: @102 = cos(@8) */
-  w102 = cos( w8 );
-  /* #232: @103 = (@102*@76) */
-  w103  = (w102*w76);
-  /* #233: @103 = (@50*@103) */
-  w103  = (w50*w103);
-  /* #234: @104 = cos(@3) */
-  w104 = cos( w3 );
-  /* #235: @105 = (@104*@75) */
-  w105  = (w104*w75);
-  /* #236: @105 = (@49*@105) */
-  w105  = (w49*w105);
-  /* #237: @103 = (@103+@105) */
-  w103 += w105;
-  /* #238: @103 = (@52*@103) */
-  w103  = (w52*w103);
-  /* #239: @105 = cos(@5) */
-  w105 = cos( w5 );
-  /* #240: @77 = (@105*@77) */
-  w77  = (w105*w77);
-  /* #241: @77 = (@51*@77) */
-  w77  = (w51*w77);
-  /* #242: @103 = (@103+@77) */
-  w103 += w77;
-  /* #243: @98 = (@98+@103) */
-  w98 += w103;
-  /* #244: @98 = (@45*@98) */
-  w98  = (w45*w98);
-  /* #245: @98 = (@13*@98) */
-  w98  = (w13*w98);
-  /* #246: @98 = (@1*@98) */
-  w98  = (w1*w98);
-  /* #247: @63 = (@53*@63) */
-  w63  = (w53*w63);
-  /* #248: @98 = (@98+@63) */
-  w98 += w63;
-  /* #249: @95 = (@95-@98) */
-  w95 -= w98;
-  /* #250: @98 = cos(@3) */
-  w98 = cos( w3 );
-  /* #251: @63 = (@98*@75) */
-  w63  = (w98*w75);
-  /* #252: @63 = (@55*@63) */
-  w63  = (w55*w63);
-  /* #253: @103 = sin(@8) */
-  w103 = sin( w8 );
-  /* #254: @77 = (@103*@76) */
-  w77  = (w103*w76);
-  /* #255: @77 = (@56*@77) */
-  w77  = (w56*w77);
-  /* #256: @63 = (@63-@77) */
-  w63 -= w77;
-  /* #257: @63 = (@54*@63) */
-  w63  = (w54*w63);
-  /* #258: @63 = (@13*@63) */
-  w63  = (w13*w63);
-  /* #259: @63 = (@2*@63) */
-  w63  = (w2*w63);
-  /* #260: @74 = (@58*@74) */
-  w74  = (w58*w74);
-  /* #261: @63 = (@63+@74) */
-  w63 += w74;
-  /* #262: @95 = (@95-@63) */
-  w95 -= w63;
-  /* #263: @85 = (@85-@95) */
-  w85 -= w95;
-  /* #264: output[1][4] = @85 */
-  if (res[1]) res[1][4] = w85;
-  /* #265: @85 = sin(@3) */
-  w85 = sin( w3 );
-  /* #266: @95 = (@85*@75) */
-  w95  = (w85*w75);
-  /* #267: @95 = (@44*@95) */
-  w95  = (w44*w95);
-  /* #268: @95 = (-@95) */
-  w95 = (- w95 );
-  /* #269: @63 = sin(@8) */
-  w63 = sin( w8 );
-  /* #270: @74 = (@63*@76) */
-  w74  = (w63*w76);
-  /* #271: @74 = (@59*@74) */
-  w74  = (w59*w74);
-  /* #272: @95 = (@95-@74) */
-  w95 -= w74;
-  /* #273: @95 = (@13*@95) */
-  w95  = (w13*w95);
-  /* #274: output[1][5] = @95 */
-  if (res[1]) res[1][5] = w95;
-  /* #275: @95 = 3.07125 */
-  w95 = 3.0712530712530715e+00;
-  /* #276: @75 = (@95*@75) */
-  w75  = (w95*w75);
-  /* #277: @75 = (-@75) */
-  w75 = (- w75 );
-  /* #278: output[1][6] = @75 */
-  if (res[1]) res[1][6] = w75;
-  /* #279: @75 = 3.07787 */
-  w75 = 3.0778701138811941e+00;
-  /* #280: @76 = (@75*@76) */
-  w76  = (w75*w76);
-  /* #281: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #282: output[1][7] = @76 */
-  if (res[1]) res[1][7] = w76;
-  /* #283: {NULL, NULL, NULL, @76, @74, @77, @106, @107, @108} = vertsplit(@66) */
-  w76 = w66[3];
-  w74 = w66[4];
-  w77 = w66[5];
-  w106 = w66[6];
-  w107 = w66[7];
-  w108 = w66[8];
-  /* #284: output[1][8] = @76 */
-  if (res[1]) res[1][8] = w76;
-  /* #285: output[1][9] = @74 */
-  if (res[1]) res[1][9] = w74;
-  /* #286: output[1][10] = @77 */
-  if (res[1]) res[1][10] = w77;
-  /* #287: @109 = (@78*@108) */
-  w109  = (w78*w108);
-  /* #288: @109 = (@4*@109) */
-  w109  = (w4*w109);
-  /* #289: @109 = (-@109) */
-  w109 = (- w109 );
-  /* #290: @110 = (@80*@106) */
-  w110  = (w80*w106);
-  /* #291: @110 = (@6*@110) */
-  w110  = (w6*w110);
-  /* #292: @109 = (@109-@110) */
-  w109 -= w110;
-  /* #293: @109 = (@9*@109) */
-  w109  = (w9*w109);
-  /* #294: @110 = (@81*@107) */
-  w110  = (w81*w107);
-  /* #295: @110 = (@7*@110) */
-  w110  = (w7*w110);
-  /* #296: @109 = (@109+@110) */
-  w109 += w110;
-  /* #297: @110 = (@82*@106) */
-  w110  = (w82*w106);
-  /* #298: @110 = (@12*@110) */
-  w110  = (w12*w110);
-  /* #299: @111 = (@84*@108) */
-  w111  = (w84*w108);
-  /* #300: @111 = (@11*@111) */
-  w111  = (w11*w111);
-  /* #301: @110 = (@110+@111) */
-  w110 += w111;
-  /* #302: @109 = (@109+@110) */
-  w109 += w110;
-  /* #303: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #304: @110 = (@83*@108) */
-  w110  = (w83*w108);
-  /* #305: @110 = (@16*@110) */
-  w110  = (w16*w110);
-  /* #306: @110 = (-@110) */
-  w110 = (- w110 );
-  /* #307: @111 = (@86*@107) */
-  w111  = (w86*w107);
-  /* #308: @111 = (@17*@111) */
-  w111  = (w17*w111);
-  /* #309: @110 = (@110-@111) */
-  w110 -= w111;
-  /* #310: @110 = (@15*@110) */
-  w110  = (w15*w110);
-  /* #311: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #312: @110 = (@0*@110) */
-  w110  = (w0*w110);
-  /* #313: @111 = (@19*@76) */
-  w111  = (w19*w76);
-  /* #314: @110 = (@110+@111) */
-  w110 += w111;
-  /* #315: @111 = (@87*@108) */
-  w111  = (w87*w108);
-  /* #316: @111 = (@22*@111) */
-  w111  = (w22*w111);
-  /* #317: @112 = (@89*@107) */
-  w112  = (w89*w107);
-  /* #318: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #319: @111 = (@111-@112) */
-  w111 -= w112;
-  /* #320: @111 = (@21*@111) */
-  w111  = (w21*w111);
-  /* #321: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #322: @111 = (@1*@111) */
-  w111  = (w1*w111);
-  /* #323: @112 = (@25*@74) */
-  w112  = (w25*w74);
-  /* #324: @111 = (@111+@112) */
-  w111 += w112;
-  /* #325: @110 = (@110-@111) */
-  w110 -= w111;
-  /* #326: @111 = (@88*@107) */
-  w111  = (w88*w107);
-  /* #327: @111 = (@26*@111) */
-  w111  = (w26*w111);
-  /* #328: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #329: @111 = (@2*@111) */
-  w111  = (w2*w111);
-  /* #330: @112 = (@28*@77) */
-  w112  = (w28*w77);
-  /* #331: @111 = (@111+@112) */
-  w111 += w112;
-  /* #332: @110 = (@110+@111) */
-  w110 += w111;
-  /* #333: @109 = (@109-@110) */
-  w109 -= w110;
-  /* #334: output[1][11] = @109 */
-  if (res[1]) res[1][11] = w109;
-  /* #335: @109 = (@79*@107) */
-  w109  = (w79*w107);
-  /* #336: @109 = (@14*@109) */
-  w109  = (w14*w109);
-  /* #337: @110 = (@90*@106) */
-  w110  = (w90*w106);
-  /* #338: @110 = (@20*@110) */
-  w110  = (w20*w110);
-  /* #339: @109 = (@109-@110) */
-  w109 -= w110;
-  /* #340: @109 = (@30*@109) */
-  w109  = (w30*w109);
-  /* #341: @110 = (@91*@108) */
-  w110  = (w91*w108);
-  /* #342: @110 = (@29*@110) */
-  w110  = (w29*w110);
-  /* #343: @109 = (@109+@110) */
-  w109 += w110;
-  /* #344: @110 = (@92*@106) */
-  w110  = (w92*w106);
-  /* #345: @110 = (@32*@110) */
-  w110  = (w32*w110);
-  /* #346: @111 = (@94*@108) */
-  w111  = (w94*w108);
-  /* #347: @111 = (@33*@111) */
-  w111  = (w33*w111);
-  /* #348: @110 = (@110-@111) */
-  w110 -= w111;
-  /* #349: @109 = (@109-@110) */
-  w109 -= w110;
-  /* #350: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #351: @110 = (@93*@108) */
-  w110  = (w93*w108);
-  /* #352: @110 = (@36*@110) */
-  w110  = (w36*w110);
-  /* #353: @111 = (@96*@106) */
-  w111  = (w96*w106);
-  /* #354: @111 = (@37*@111) */
-  w111  = (w37*w111);
-  /* #355: @110 = (@110-@111) */
-  w110 -= w111;
-  /* #356: @111 = (@97*@107) */
-  w111  = (w97*w107);
-  /* #357: @111 = (@39*@111) */
-  w111  = (w39*w111);
-  /* #358: @112 = (@99*@108) */
-  w112  = (w99*w108);
-  /* #359: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #360: @111 = (@111-@112) */
-  w111 -= w112;
-  /* #361: @111 = (@42*@111) */
-  w111  = (w42*w111);
-  /* #362: @112 = (@100*@106) */
-  w112  = (w100*w106);
-  /* #363: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #364: @111 = (@111+@112) */
-  w111 += w112;
-  /* #365: @110 = (@110-@111) */
-  w110 -= w111;
-  /* #366: @110 = (@35*@110) */
-  w110  = (w35*w110);
-  /* #367: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #368: @110 = (@0*@110) */
-  w110  = (w0*w110);
-  /* #369: @76 = (@43*@76) */
-  w76  = (w43*w76);
-  /* #370: @110 = (@110+@76) */
-  w110 += w76;
-  /* #371: @76 = (@62*@108) */
-  w76  = (w62*w108);
-  /* #372: @76 = (@46*@76) */
-  w76  = (w46*w76);
-  /* #373: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #374: @111 = (@101*@106) */
-  w111  = (w101*w106);
-  /* #375: @111 = (@47*@111) */
-  w111  = (w47*w111);
-  /* #376: @76 = (@76-@111) */
-  w76 -= w111;
-  /* #377: @111 = (@102*@107) */
-  w111  = (w102*w107);
-  /* #378: @111 = (@50*@111) */
-  w111  = (w50*w111);
-  /* #379: @112 = (@104*@106) */
-  w112  = (w104*w106);
-  /* #380: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #381: @111 = (@111+@112) */
-  w111 += w112;
-  /* #382: @111 = (@52*@111) */
-  w111  = (w52*w111);
-  /* #383: @108 = (@105*@108) */
-  w108  = (w105*w108);
-  /* #384: @108 = (@51*@108) */
-  w108  = (w51*w108);
-  /* #385: @111 = (@111+@108) */
-  w111 += w108;
-  /* #386: @76 = (@76+@111) */
-  w76 += w111;
-  /* #387: @76 = (@45*@76) */
-  w76  = (w45*w76);
-  /* #388: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #389: @76 = (@1*@76) */
-  w76  = (w1*w76);
-  /* #390: @74 = (@53*@74) */
-  w74  = (w53*w74);
-  /* #391: @76 = (@76+@74) */
-  w76 += w74;
-  /* #392: @110 = (@110-@76) */
-  w110 -= w76;
-  /* #393: @76 = (@98*@106) */
-  w76  = (w98*w106);
-  /* #394: @76 = (@55*@76) */
-  w76  = (w55*w76);
-  /* #395: @74 = (@103*@107) */
-  w74  = (w103*w107);
-  /* #396: @74 = (@56*@74) */
-  w74  = (w56*w74);
-  /* #397: @76 = (@76-@74) */
-  w76 -= w74;
-  /* #398: @76 = (@54*@76) */
-  w76  = (w54*w76);
-  /* #399: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #400: @76 = (@2*@76) */
-  w76  = (w2*w76);
-  /* #401: @77 = (@58*@77) */
-  w77  = (w58*w77);
-  /* #402: @76 = (@76+@77) */
-  w76 += w77;
-  /* #403: @110 = (@110-@76) */
-  w110 -= w76;
-  /* #404: @109 = (@109-@110) */
-  w109 -= w110;
-  /* #405: output[1][12] = @109 */
-  if (res[1]) res[1][12] = w109;
-  /* #406: @109 = (@85*@106) */
-  w109  = (w85*w106);
-  /* #407: @109 = (@44*@109) */
-  w109  = (w44*w109);
-  /* #408: @109 = (-@109) */
-  w109 = (- w109 );
-  /* #409: @110 = (@63*@107) */
-  w110  = (w63*w107);
-  /* #410: @110 = (@59*@110) */
-  w110  = (w59*w110);
-  /* #411: @109 = (@109-@110) */
-  w109 -= w110;
-  /* #412: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #413: output[1][13] = @109 */
-  if (res[1]) res[1][13] = w109;
-  /* #414: @106 = (@95*@106) */
-  w106  = (w95*w106);
-  /* #415: @106 = (-@106) */
-  w106 = (- w106 );
-  /* #416: output[1][14] = @106 */
-  if (res[1]) res[1][14] = w106;
-  /* #417: @107 = (@75*@107) */
-  w107  = (w75*w107);
-  /* #418: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #419: output[1][15] = @107 */
-  if (res[1]) res[1][15] = w107;
-  /* #420: {NULL, NULL, NULL, @107, @106, @109, @110, @76, @77} = vertsplit(@67) */
-  w107 = w67[3];
-  w106 = w67[4];
-  w109 = w67[5];
-  w110 = w67[6];
-  w76 = w67[7];
-  w77 = w67[8];
-  /* #421: output[1][16] = @107 */
-  if (res[1]) res[1][16] = w107;
-  /* #422: output[1][17] = @106 */
-  if (res[1]) res[1][17] = w106;
-  /* #423: output[1][18] = @109 */
-  if (res[1]) res[1][18] = w109;
-  /* #424: @74 = (@78*@77) */
-  w74  = (w78*w77);
-  /* #425: @74 = (@4*@74) */
-  w74  = (w4*w74);
-  /* #426: @74 = (-@74) */
-  w74 = (- w74 );
-  /* #427: @111 = (@80*@110) */
-  w111  = (w80*w110);
-  /* #428: @111 = (@6*@111) */
-  w111  = (w6*w111);
-  /* #429: @74 = (@74-@111) */
-  w74 -= w111;
-  /* #430: @74 = (@9*@74) */
-  w74  = (w9*w74);
-  /* #431: @111 = (@81*@76) */
-  w111  = (w81*w76);
-  /* #432: @111 = (@7*@111) */
-  w111  = (w7*w111);
-  /* #433: @74 = (@74+@111) */
-  w74 += w111;
-  /* #434: @111 = (@82*@110) */
-  w111  = (w82*w110);
-  /* #435: @111 = (@12*@111) */
-  w111  = (w12*w111);
-  /* #436: @108 = (@84*@77) */
-  w108  = (w84*w77);
-  /* #437: @108 = (@11*@108) */
-  w108  = (w11*w108);
-  /* #438: @111 = (@111+@108) */
-  w111 += w108;
-  /* #439: @74 = (@74+@111) */
-  w74 += w111;
-  /* #440: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #441: @111 = (@83*@77) */
-  w111  = (w83*w77);
-  /* #442: @111 = (@16*@111) */
-  w111  = (w16*w111);
-  /* #443: @111 = (-@111) */
-  w111 = (- w111 );
-  /* #444: @108 = (@86*@76) */
-  w108  = (w86*w76);
-  /* #445: @108 = (@17*@108) */
-  w108  = (w17*w108);
-  /* #446: @111 = (@111-@108) */
-  w111 -= w108;
-  /* #447: @111 = (@15*@111) */
-  w111  = (w15*w111);
-  /* #448: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #449: @111 = (@0*@111) */
-  w111  = (w0*w111);
-  /* #450: @108 = (@19*@107) */
-  w108  = (w19*w107);
-  /* #451: @111 = (@111+@108) */
-  w111 += w108;
-  /* #452: @108 = (@87*@77) */
-  w108  = (w87*w77);
-  /* #453: @108 = (@22*@108) */
-  w108  = (w22*w108);
-  /* #454: @112 = (@89*@76) */
-  w112  = (w89*w76);
-  /* #455: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #456: @108 = (@108-@112) */
-  w108 -= w112;
-  /* #457: @108 = (@21*@108) */
-  w108  = (w21*w108);
-  /* #458: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #459: @108 = (@1*@108) */
-  w108  = (w1*w108);
-  /* #460: @112 = (@25*@106) */
-  w112  = (w25*w106);
-  /* #461: @108 = (@108+@112) */
-  w108 += w112;
-  /* #462: @111 = (@111-@108) */
-  w111 -= w108;
-  /* #463: @108 = (@88*@76) */
-  w108  = (w88*w76);
-  /* #464: @108 = (@26*@108) */
-  w108  = (w26*w108);
-  /* #465: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #466: @108 = (@2*@108) */
-  w108  = (w2*w108);
-  /* #467: @112 = (@28*@109) */
-  w112  = (w28*w109);
-  /* #468: @108 = (@108+@112) */
-  w108 += w112;
-  /* #469: @111 = (@111+@108) */
-  w111 += w108;
-  /* #470: @74 = (@74-@111) */
-  w74 -= w111;
-  /* #471: output[1][19] = @74 */
-  if (res[1]) res[1][19] = w74;
-  /* #472: @74 = (@79*@76) */
-  w74  = (w79*w76);
-  /* #473: @74 = (@14*@74) */
-  w74  = (w14*w74);
-  /* #474: @111 = (@90*@110) */
-  w111  = (w90*w110);
-  /* #475: @111 = (@20*@111) */
-  w111  = (w20*w111);
-  /* #476: @74 = (@74-@111) */
-  w74 -= w111;
-  /* #477: @74 = (@30*@74) */
-  w74  = (w30*w74);
-  /* #478: @111 = (@91*@77) */
-  w111  = (w91*w77);
-  /* #479: @111 = (@29*@111) */
-  w111  = (w29*w111);
-  /* #480: @74 = (@74+@111) */
-  w74 += w111;
-  /* #481: @111 = (@92*@110) */
-  w111  = (w92*w110);
-  /* #482: @111 = (@32*@111) */
-  w111  = (w32*w111);
-  /* #483: @108 = (@94*@77) */
-  w108  = (w94*w77);
-  /* #484: @108 = (@33*@108) */
-  w108  = (w33*w108);
-  /* #485: @111 = (@111-@108) */
-  w111 -= w108;
-  /* #486: @74 = (@74-@111) */
-  w74 -= w111;
-  /* #487: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #488: @111 = (@93*@77) */
-  w111  = (w93*w77);
-  /* #489: @111 = (@36*@111) */
-  w111  = (w36*w111);
-  /* #490: @108 = (@96*@110) */
-  w108  = (w96*w110);
-  /* #491: @108 = (@37*@108) */
-  w108  = (w37*w108);
-  /* #492: @111 = (@111-@108) */
-  w111 -= w108;
-  /* #493: @108 = (@97*@76) */
-  w108  = (w97*w76);
-  /* #494: @108 = (@39*@108) */
-  w108  = (w39*w108);
-  /* #495: @112 = (@99*@77) */
-  w112  = (w99*w77);
-  /* #496: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #497: @108 = (@108-@112) */
-  w108 -= w112;
-  /* #498: @108 = (@42*@108) */
-  w108  = (w42*w108);
-  /* #499: @112 = (@100*@110) */
-  w112  = (w100*w110);
-  /* #500: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #501: @108 = (@108+@112) */
-  w108 += w112;
-  /* #502: @111 = (@111-@108) */
-  w111 -= w108;
-  /* #503: @111 = (@35*@111) */
-  w111  = (w35*w111);
-  /* #504: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #505: @111 = (@0*@111) */
-  w111  = (w0*w111);
-  /* #506: @107 = (@43*@107) */
-  w107  = (w43*w107);
-  /* #507: @111 = (@111+@107) */
-  w111 += w107;
-  /* #508: @107 = (@62*@77) */
-  w107  = (w62*w77);
-  /* #509: @107 = (@46*@107) */
-  w107  = (w46*w107);
-  /* #510: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #511: @108 = (@101*@110) */
-  w108  = (w101*w110);
-  /* #512: @108 = (@47*@108) */
-  w108  = (w47*w108);
-  /* #513: @107 = (@107-@108) */
-  w107 -= w108;
-  /* #514: @108 = (@102*@76) */
-  w108  = (w102*w76);
-  /* #515: @108 = (@50*@108) */
-  w108  = (w50*w108);
-  /* #516: @112 = (@104*@110) */
-  w112  = (w104*w110);
-  /* #517: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #518: @108 = (@108+@112) */
-  w108 += w112;
-  /* #519: @108 = (@52*@108) */
-  w108  = (w52*w108);
-  /* #520: @77 = (@105*@77) */
-  w77  = (w105*w77);
-  /* #521: @77 = (@51*@77) */
-  w77  = (w51*w77);
-  /* #522: @108 = (@108+@77) */
-  w108 += w77;
-  /* #523: @107 = (@107+@108) */
-  w107 += w108;
-  /* #524: @107 = (@45*@107) */
-  w107  = (w45*w107);
-  /* #525: @107 = (@13*@107) */
-  w107  = (w13*w107);
-  /* #526: @107 = (@1*@107) */
-  w107  = (w1*w107);
-  /* #527: @106 = (@53*@106) */
-  w106  = (w53*w106);
-  /* #528: @107 = (@107+@106) */
-  w107 += w106;
-  /* #529: @111 = (@111-@107) */
-  w111 -= w107;
-  /* #530: @107 = (@98*@110) */
-  w107  = (w98*w110);
-  /* #531: @107 = (@55*@107) */
-  w107  = (w55*w107);
-  /* #532: @106 = (@103*@76) */
-  w106  = (w103*w76);
-  /* #533: @106 = (@56*@106) */
-  w106  = (w56*w106);
-  /* #534: @107 = (@107-@106) */
-  w107 -= w106;
-  /* #535: @107 = (@54*@107) */
-  w107  = (w54*w107);
-  /* #536: @107 = (@13*@107) */
-  w107  = (w13*w107);
-  /* #537: @107 = (@2*@107) */
-  w107  = (w2*w107);
-  /* #538: @109 = (@58*@109) */
-  w109  = (w58*w109);
-  /* #539: @107 = (@107+@109) */
-  w107 += w109;
-  /* #540: @111 = (@111-@107) */
-  w111 -= w107;
-  /* #541: @74 = (@74-@111) */
-  w74 -= w111;
-  /* #542: output[1][20] = @74 */
-  if (res[1]) res[1][20] = w74;
-  /* #543: @74 = (@85*@110) */
-  w74  = (w85*w110);
-  /* #544: @74 = (@44*@74) */
-  w74  = (w44*w74);
-  /* #545: @74 = (-@74) */
-  w74 = (- w74 );
-  /* #546: @111 = (@63*@76) */
-  w111  = (w63*w76);
-  /* #547: @111 = (@59*@111) */
-  w111  = (w59*w111);
-  /* #548: @74 = (@74-@111) */
-  w74 -= w111;
-  /* #549: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #550: output[1][21] = @74 */
-  if (res[1]) res[1][21] = w74;
-  /* #551: @110 = (@95*@110) */
-  w110  = (w95*w110);
-  /* #552: @110 = (-@110) */
-  w110 = (- w110 );
-  /* #553: output[1][22] = @110 */
-  if (res[1]) res[1][22] = w110;
-  /* #554: @76 = (@75*@76) */
-  w76  = (w75*w76);
-  /* #555: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #556: output[1][23] = @76 */
-  if (res[1]) res[1][23] = w76;
-  /* #557: {NULL, NULL, NULL, @76, @110, @74, @111, @107, @109} = vertsplit(@68) */
-  w76 = w68[3];
-  w110 = w68[4];
-  w74 = w68[5];
-  w111 = w68[6];
-  w107 = w68[7];
-  w109 = w68[8];
-  /* #558: output[1][24] = @76 */
-  if (res[1]) res[1][24] = w76;
-  /* #559: output[1][25] = @110 */
-  if (res[1]) res[1][25] = w110;
-  /* #560: output[1][26] = @74 */
-  if (res[1]) res[1][26] = w74;
-  /* #561: @106 = (@78*@109) */
-  w106  = (w78*w109);
-  /* #562: @106 = (@4*@106) */
-  w106  = (w4*w106);
-  /* #563: @106 = (-@106) */
-  w106 = (- w106 );
-  /* #564: @108 = (@80*@111) */
-  w108  = (w80*w111);
-  /* #565: @108 = (@6*@108) */
-  w108  = (w6*w108);
-  /* #566: @106 = (@106-@108) */
-  w106 -= w108;
-  /* #567: @106 = (@9*@106) */
-  w106  = (w9*w106);
-  /* #568: @108 = (@81*@107) */
-  w108  = (w81*w107);
-  /* #569: @108 = (@7*@108) */
-  w108  = (w7*w108);
-  /* #570: @106 = (@106+@108) */
-  w106 += w108;
-  /* #571: @108 = (@82*@111) */
-  w108  = (w82*w111);
-  /* #572: @108 = (@12*@108) */
-  w108  = (w12*w108);
-  /* #573: @77 = (@84*@109) */
-  w77  = (w84*w109);
-  /* #574: @77 = (@11*@77) */
-  w77  = (w11*w77);
-  /* #575: @108 = (@108+@77) */
-  w108 += w77;
-  /* #576: @106 = (@106+@108) */
-  w106 += w108;
-  /* #577: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #578: @108 = (@83*@109) */
-  w108  = (w83*w109);
-  /* #579: @108 = (@16*@108) */
-  w108  = (w16*w108);
-  /* #580: @108 = (-@108) */
-  w108 = (- w108 );
-  /* #581: @77 = (@86*@107) */
-  w77  = (w86*w107);
-  /* #582: @77 = (@17*@77) */
-  w77  = (w17*w77);
-  /* #583: @108 = (@108-@77) */
-  w108 -= w77;
-  /* #584: @108 = (@15*@108) */
-  w108  = (w15*w108);
-  /* #585: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #586: @108 = (@0*@108) */
-  w108  = (w0*w108);
-  /* #587: @77 = (@19*@76) */
-  w77  = (w19*w76);
-  /* #588: @108 = (@108+@77) */
-  w108 += w77;
-  /* #589: @77 = (@87*@109) */
-  w77  = (w87*w109);
-  /* #590: @77 = (@22*@77) */
-  w77  = (w22*w77);
-  /* #591: @112 = (@89*@107) */
-  w112  = (w89*w107);
-  /* #592: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #593: @77 = (@77-@112) */
-  w77 -= w112;
-  /* #594: @77 = (@21*@77) */
-  w77  = (w21*w77);
-  /* #595: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #596: @77 = (@1*@77) */
-  w77  = (w1*w77);
-  /* #597: @112 = (@25*@110) */
-  w112  = (w25*w110);
-  /* #598: @77 = (@77+@112) */
-  w77 += w112;
-  /* #599: @108 = (@108-@77) */
-  w108 -= w77;
-  /* #600: @77 = (@88*@107) */
-  w77  = (w88*w107);
-  /* #601: @77 = (@26*@77) */
-  w77  = (w26*w77);
-  /* #602: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #603: @77 = (@2*@77) */
-  w77  = (w2*w77);
-  /* #604: @112 = (@28*@74) */
-  w112  = (w28*w74);
-  /* #605: @77 = (@77+@112) */
-  w77 += w112;
-  /* #606: @108 = (@108+@77) */
-  w108 += w77;
-  /* #607: @106 = (@106-@108) */
-  w106 -= w108;
-  /* #608: output[1][27] = @106 */
-  if (res[1]) res[1][27] = w106;
-  /* #609: @106 = (@79*@107) */
-  w106  = (w79*w107);
-  /* #610: @106 = (@14*@106) */
-  w106  = (w14*w106);
-  /* #611: @108 = (@90*@111) */
-  w108  = (w90*w111);
-  /* #612: @108 = (@20*@108) */
-  w108  = (w20*w108);
-  /* #613: @106 = (@106-@108) */
-  w106 -= w108;
-  /* #614: @106 = (@30*@106) */
-  w106  = (w30*w106);
-  /* #615: @108 = (@91*@109) */
-  w108  = (w91*w109);
-  /* #616: @108 = (@29*@108) */
-  w108  = (w29*w108);
-  /* #617: @106 = (@106+@108) */
-  w106 += w108;
-  /* #618: @108 = (@92*@111) */
-  w108  = (w92*w111);
-  /* #619: @108 = (@32*@108) */
-  w108  = (w32*w108);
-  /* #620: @77 = (@94*@109) */
-  w77  = (w94*w109);
-  /* #621: @77 = (@33*@77) */
-  w77  = (w33*w77);
-  /* #622: @108 = (@108-@77) */
-  w108 -= w77;
-  /* #623: @106 = (@106-@108) */
-  w106 -= w108;
-  /* #624: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #625: @108 = (@93*@109) */
-  w108  = (w93*w109);
-  /* #626: @108 = (@36*@108) */
-  w108  = (w36*w108);
-  /* #627: @77 = (@96*@111) */
-  w77  = (w96*w111);
-  /* #628: @77 = (@37*@77) */
-  w77  = (w37*w77);
-  /* #629: @108 = (@108-@77) */
-  w108 -= w77;
-  /* #630: @77 = (@97*@107) */
-  w77  = (w97*w107);
-  /* #631: @77 = (@39*@77) */
-  w77  = (w39*w77);
-  /* #632: @112 = (@99*@109) */
-  w112  = (w99*w109);
-  /* #633: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #634: @77 = (@77-@112) */
-  w77 -= w112;
-  /* #635: @77 = (@42*@77) */
-  w77  = (w42*w77);
-  /* #636: @112 = (@100*@111) */
-  w112  = (w100*w111);
-  /* #637: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #638: @77 = (@77+@112) */
-  w77 += w112;
-  /* #639: @108 = (@108-@77) */
-  w108 -= w77;
-  /* #640: @108 = (@35*@108) */
-  w108  = (w35*w108);
-  /* #641: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #642: @108 = (@0*@108) */
-  w108  = (w0*w108);
-  /* #643: @76 = (@43*@76) */
-  w76  = (w43*w76);
-  /* #644: @108 = (@108+@76) */
-  w108 += w76;
-  /* #645: @76 = (@62*@109) */
-  w76  = (w62*w109);
-  /* #646: @76 = (@46*@76) */
-  w76  = (w46*w76);
-  /* #647: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #648: @77 = (@101*@111) */
-  w77  = (w101*w111);
-  /* #649: @77 = (@47*@77) */
-  w77  = (w47*w77);
-  /* #650: @76 = (@76-@77) */
-  w76 -= w77;
-  /* #651: @77 = (@102*@107) */
-  w77  = (w102*w107);
-  /* #652: @77 = (@50*@77) */
-  w77  = (w50*w77);
-  /* #653: @112 = (@104*@111) */
-  w112  = (w104*w111);
-  /* #654: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #655: @77 = (@77+@112) */
-  w77 += w112;
-  /* #656: @77 = (@52*@77) */
-  w77  = (w52*w77);
-  /* #657: @109 = (@105*@109) */
-  w109  = (w105*w109);
-  /* #658: @109 = (@51*@109) */
-  w109  = (w51*w109);
-  /* #659: @77 = (@77+@109) */
-  w77 += w109;
-  /* #660: @76 = (@76+@77) */
-  w76 += w77;
-  /* #661: @76 = (@45*@76) */
-  w76  = (w45*w76);
-  /* #662: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #663: @76 = (@1*@76) */
-  w76  = (w1*w76);
-  /* #664: @110 = (@53*@110) */
-  w110  = (w53*w110);
-  /* #665: @76 = (@76+@110) */
-  w76 += w110;
-  /* #666: @108 = (@108-@76) */
-  w108 -= w76;
-  /* #667: @76 = (@98*@111) */
-  w76  = (w98*w111);
-  /* #668: @76 = (@55*@76) */
-  w76  = (w55*w76);
-  /* #669: @110 = (@103*@107) */
-  w110  = (w103*w107);
-  /* #670: @110 = (@56*@110) */
-  w110  = (w56*w110);
-  /* #671: @76 = (@76-@110) */
-  w76 -= w110;
-  /* #672: @76 = (@54*@76) */
-  w76  = (w54*w76);
-  /* #673: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #674: @76 = (@2*@76) */
-  w76  = (w2*w76);
-  /* #675: @74 = (@58*@74) */
-  w74  = (w58*w74);
-  /* #676: @76 = (@76+@74) */
-  w76 += w74;
-  /* #677: @108 = (@108-@76) */
-  w108 -= w76;
-  /* #678: @106 = (@106-@108) */
-  w106 -= w108;
-  /* #679: output[1][28] = @106 */
-  if (res[1]) res[1][28] = w106;
-  /* #680: @106 = (@85*@111) */
-  w106  = (w85*w111);
-  /* #681: @106 = (@44*@106) */
-  w106  = (w44*w106);
-  /* #682: @106 = (-@106) */
-  w106 = (- w106 );
-  /* #683: @108 = (@63*@107) */
-  w108  = (w63*w107);
-  /* #684: @108 = (@59*@108) */
-  w108  = (w59*w108);
-  /* #685: @106 = (@106-@108) */
-  w106 -= w108;
-  /* #686: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #687: output[1][29] = @106 */
-  if (res[1]) res[1][29] = w106;
-  /* #688: @111 = (@95*@111) */
-  w111  = (w95*w111);
-  /* #689: @111 = (-@111) */
-  w111 = (- w111 );
-  /* #690: output[1][30] = @111 */
-  if (res[1]) res[1][30] = w111;
-  /* #691: @107 = (@75*@107) */
-  w107  = (w75*w107);
-  /* #692: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #693: output[1][31] = @107 */
-  if (res[1]) res[1][31] = w107;
-  /* #694: {NULL, NULL, NULL, @107, @111, @106, @108, @76, @74} = vertsplit(@69) */
-  w107 = w69[3];
-  w111 = w69[4];
-  w106 = w69[5];
-  w108 = w69[6];
-  w76 = w69[7];
-  w74 = w69[8];
-  /* #695: output[1][32] = @107 */
-  if (res[1]) res[1][32] = w107;
-  /* #696: output[1][33] = @111 */
-  if (res[1]) res[1][33] = w111;
-  /* #697: output[1][34] = @106 */
-  if (res[1]) res[1][34] = w106;
-  /* #698: @110 = (@78*@74) */
-  w110  = (w78*w74);
-  /* #699: @110 = (@4*@110) */
-  w110  = (w4*w110);
-  /* #700: @110 = (-@110) */
-  w110 = (- w110 );
-  /* #701: @77 = (@80*@108) */
-  w77  = (w80*w108);
-  /* #702: @77 = (@6*@77) */
-  w77  = (w6*w77);
-  /* #703: @110 = (@110-@77) */
-  w110 -= w77;
-  /* #704: @110 = (@9*@110) */
-  w110  = (w9*w110);
-  /* #705: @77 = (@81*@76) */
-  w77  = (w81*w76);
-  /* #706: @77 = (@7*@77) */
-  w77  = (w7*w77);
-  /* #707: @110 = (@110+@77) */
-  w110 += w77;
-  /* #708: @77 = (@82*@108) */
-  w77  = (w82*w108);
-  /* #709: @77 = (@12*@77) */
-  w77  = (w12*w77);
-  /* #710: @109 = (@84*@74) */
-  w109  = (w84*w74);
-  /* #711: @109 = (@11*@109) */
-  w109  = (w11*w109);
-  /* #712: @77 = (@77+@109) */
-  w77 += w109;
-  /* #713: @110 = (@110+@77) */
-  w110 += w77;
-  /* #714: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #715: @77 = (@83*@74) */
-  w77  = (w83*w74);
-  /* #716: @77 = (@16*@77) */
-  w77  = (w16*w77);
-  /* #717: @77 = (-@77) */
-  w77 = (- w77 );
-  /* #718: @109 = (@86*@76) */
-  w109  = (w86*w76);
-  /* #719: @109 = (@17*@109) */
-  w109  = (w17*w109);
-  /* #720: @77 = (@77-@109) */
-  w77 -= w109;
-  /* #721: @77 = (@15*@77) */
-  w77  = (w15*w77);
-  /* #722: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #723: @77 = (@0*@77) */
-  w77  = (w0*w77);
-  /* #724: @109 = (@19*@107) */
-  w109  = (w19*w107);
-  /* #725: @77 = (@77+@109) */
-  w77 += w109;
-  /* #726: @109 = (@87*@74) */
-  w109  = (w87*w74);
-  /* #727: @109 = (@22*@109) */
-  w109  = (w22*w109);
-  /* #728: @112 = (@89*@76) */
-  w112  = (w89*w76);
-  /* #729: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #730: @109 = (@109-@112) */
-  w109 -= w112;
-  /* #731: @109 = (@21*@109) */
-  w109  = (w21*w109);
-  /* #732: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #733: @109 = (@1*@109) */
-  w109  = (w1*w109);
-  /* #734: @112 = (@25*@111) */
-  w112  = (w25*w111);
-  /* #735: @109 = (@109+@112) */
-  w109 += w112;
-  /* #736: @77 = (@77-@109) */
-  w77 -= w109;
-  /* #737: @109 = (@88*@76) */
-  w109  = (w88*w76);
-  /* #738: @109 = (@26*@109) */
-  w109  = (w26*w109);
-  /* #739: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #740: @109 = (@2*@109) */
-  w109  = (w2*w109);
-  /* #741: @112 = (@28*@106) */
-  w112  = (w28*w106);
-  /* #742: @109 = (@109+@112) */
-  w109 += w112;
-  /* #743: @77 = (@77+@109) */
-  w77 += w109;
-  /* #744: @110 = (@110-@77) */
-  w110 -= w77;
-  /* #745: output[1][35] = @110 */
-  if (res[1]) res[1][35] = w110;
-  /* #746: @110 = (@79*@76) */
-  w110  = (w79*w76);
-  /* #747: @110 = (@14*@110) */
-  w110  = (w14*w110);
-  /* #748: @77 = (@90*@108) */
-  w77  = (w90*w108);
-  /* #749: @77 = (@20*@77) */
-  w77  = (w20*w77);
-  /* #750: @110 = (@110-@77) */
-  w110 -= w77;
-  /* #751: @110 = (@30*@110) */
-  w110  = (w30*w110);
-  /* #752: @77 = (@91*@74) */
-  w77  = (w91*w74);
-  /* #753: @77 = (@29*@77) */
-  w77  = (w29*w77);
-  /* #754: @110 = (@110+@77) */
-  w110 += w77;
-  /* #755: @77 = (@92*@108) */
-  w77  = (w92*w108);
-  /* #756: @77 = (@32*@77) */
-  w77  = (w32*w77);
-  /* #757: @109 = (@94*@74) */
-  w109  = (w94*w74);
-  /* #758: @109 = (@33*@109) */
-  w109  = (w33*w109);
-  /* #759: @77 = (@77-@109) */
-  w77 -= w109;
-  /* #760: @110 = (@110-@77) */
-  w110 -= w77;
-  /* #761: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #762: @77 = (@93*@74) */
-  w77  = (w93*w74);
-  /* #763: @77 = (@36*@77) */
-  w77  = (w36*w77);
-  /* #764: @109 = (@96*@108) */
-  w109  = (w96*w108);
-  /* #765: @109 = (@37*@109) */
-  w109  = (w37*w109);
-  /* #766: @77 = (@77-@109) */
-  w77 -= w109;
-  /* #767: @109 = (@97*@76) */
-  w109  = (w97*w76);
-  /* #768: @109 = (@39*@109) */
-  w109  = (w39*w109);
-  /* #769: @112 = (@99*@74) */
-  w112  = (w99*w74);
-  /* #770: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #771: @109 = (@109-@112) */
-  w109 -= w112;
-  /* #772: @109 = (@42*@109) */
-  w109  = (w42*w109);
-  /* #773: @112 = (@100*@108) */
-  w112  = (w100*w108);
-  /* #774: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #775: @109 = (@109+@112) */
-  w109 += w112;
-  /* #776: @77 = (@77-@109) */
-  w77 -= w109;
-  /* #777: @77 = (@35*@77) */
-  w77  = (w35*w77);
-  /* #778: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #779: @77 = (@0*@77) */
-  w77  = (w0*w77);
-  /* #780: @107 = (@43*@107) */
-  w107  = (w43*w107);
-  /* #781: @77 = (@77+@107) */
-  w77 += w107;
-  /* #782: @107 = (@62*@74) */
-  w107  = (w62*w74);
-  /* #783: @107 = (@46*@107) */
-  w107  = (w46*w107);
-  /* #784: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #785: @109 = (@101*@108) */
-  w109  = (w101*w108);
-  /* #786: @109 = (@47*@109) */
-  w109  = (w47*w109);
-  /* #787: @107 = (@107-@109) */
-  w107 -= w109;
-  /* #788: @109 = (@102*@76) */
-  w109  = (w102*w76);
-  /* #789: @109 = (@50*@109) */
-  w109  = (w50*w109);
-  /* #790: @112 = (@104*@108) */
-  w112  = (w104*w108);
-  /* #791: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #792: @109 = (@109+@112) */
-  w109 += w112;
-  /* #793: @109 = (@52*@109) */
-  w109  = (w52*w109);
-  /* #794: @74 = (@105*@74) */
-  w74  = (w105*w74);
-  /* #795: @74 = (@51*@74) */
-  w74  = (w51*w74);
-  /* #796: @109 = (@109+@74) */
-  w109 += w74;
-  /* #797: @107 = (@107+@109) */
-  w107 += w109;
-  /* #798: @107 = (@45*@107) */
-  w107  = (w45*w107);
-  /* #799: @107 = (@13*@107) */
-  w107  = (w13*w107);
-  /* #800: @107 = (@1*@107) */
-  w107  = (w1*w107);
-  /* #801: @111 = (@53*@111) */
-  w111  = (w53*w111);
-  /* #802: @107 = (@107+@111) */
-  w107 += w111;
-  /* #803: @77 = (@77-@107) */
-  w77 -= w107;
-  /* #804: @107 = (@98*@108) */
-  w107  = (w98*w108);
-  /* #805: @107 = (@55*@107) */
-  w107  = (w55*w107);
-  /* #806: @111 = (@103*@76) */
-  w111  = (w103*w76);
-  /* #807: @111 = (@56*@111) */
-  w111  = (w56*w111);
-  /* #808: @107 = (@107-@111) */
-  w107 -= w111;
-  /* #809: @107 = (@54*@107) */
-  w107  = (w54*w107);
-  /* #810: @107 = (@13*@107) */
-  w107  = (w13*w107);
-  /* #811: @107 = (@2*@107) */
-  w107  = (w2*w107);
-  /* #812: @106 = (@58*@106) */
-  w106  = (w58*w106);
-  /* #813: @107 = (@107+@106) */
-  w107 += w106;
-  /* #814: @77 = (@77-@107) */
-  w77 -= w107;
-  /* #815: @110 = (@110-@77) */
-  w110 -= w77;
-  /* #816: output[1][36] = @110 */
-  if (res[1]) res[1][36] = w110;
-  /* #817: @110 = (@85*@108) */
-  w110  = (w85*w108);
-  /* #818: @110 = (@44*@110) */
-  w110  = (w44*w110);
-  /* #819: @110 = (-@110) */
-  w110 = (- w110 );
-  /* #820: @77 = (@63*@76) */
-  w77  = (w63*w76);
-  /* #821: @77 = (@59*@77) */
-  w77  = (w59*w77);
-  /* #822: @110 = (@110-@77) */
-  w110 -= w77;
-  /* #823: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #824: output[1][37] = @110 */
-  if (res[1]) res[1][37] = w110;
-  /* #825: @108 = (@95*@108) */
-  w108  = (w95*w108);
-  /* #826: @108 = (-@108) */
-  w108 = (- w108 );
-  /* #827: output[1][38] = @108 */
-  if (res[1]) res[1][38] = w108;
-  /* #828: @76 = (@75*@76) */
-  w76  = (w75*w76);
-  /* #829: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #830: output[1][39] = @76 */
-  if (res[1]) res[1][39] = w76;
-  /* #831: {NULL, NULL, NULL, @76, @108, @110, @77, @107, @106} = vertsplit(@70) */
-  w76 = w70[3];
-  w108 = w70[4];
-  w110 = w70[5];
-  w77 = w70[6];
-  w107 = w70[7];
-  w106 = w70[8];
-  /* #832: output[1][40] = @76 */
-  if (res[1]) res[1][40] = w76;
-  /* #833: output[1][41] = @108 */
-  if (res[1]) res[1][41] = w108;
-  /* #834: output[1][42] = @110 */
-  if (res[1]) res[1][42] = w110;
-  /* #835: @111 = (@78*@106) */
-  w111  = (w78*w106);
-  /* #836: @111 = (@4*@111) */
-  w111  = (w4*w111);
-  /* #837: @111 = (-@111) */
-  w111 = (- w111 );
-  /* #838: @109 = (@80*@77) */
-  w109  = (w80*w77);
-  /* #839: @109 = (@6*@109) */
-  w109  = (w6*w109);
-  /* #840: @111 = (@111-@109) */
-  w111 -= w109;
-  /* #841: @111 = (@9*@111) */
-  w111  = (w9*w111);
-  /* #842: @109 = (@81*@107) */
-  w109  = (w81*w107);
-  /* #843: @109 = (@7*@109) */
-  w109  = (w7*w109);
-  /* #844: @111 = (@111+@109) */
-  w111 += w109;
-  /* #845: @109 = (@82*@77) */
-  w109  = (w82*w77);
-  /* #846: @109 = (@12*@109) */
-  w109  = (w12*w109);
-  /* #847: @74 = (@84*@106) */
-  w74  = (w84*w106);
-  /* #848: @74 = (@11*@74) */
-  w74  = (w11*w74);
-  /* #849: @109 = (@109+@74) */
-  w109 += w74;
-  /* #850: @111 = (@111+@109) */
-  w111 += w109;
-  /* #851: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #852: @109 = (@83*@106) */
-  w109  = (w83*w106);
-  /* #853: @109 = (@16*@109) */
-  w109  = (w16*w109);
-  /* #854: @109 = (-@109) */
-  w109 = (- w109 );
-  /* #855: @74 = (@86*@107) */
-  w74  = (w86*w107);
-  /* #856: @74 = (@17*@74) */
-  w74  = (w17*w74);
-  /* #857: @109 = (@109-@74) */
-  w109 -= w74;
-  /* #858: @109 = (@15*@109) */
-  w109  = (w15*w109);
-  /* #859: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #860: @109 = (@0*@109) */
-  w109  = (w0*w109);
-  /* #861: @74 = (@19*@76) */
-  w74  = (w19*w76);
-  /* #862: @109 = (@109+@74) */
-  w109 += w74;
-  /* #863: @74 = (@87*@106) */
-  w74  = (w87*w106);
-  /* #864: @74 = (@22*@74) */
-  w74  = (w22*w74);
-  /* #865: @112 = (@89*@107) */
-  w112  = (w89*w107);
-  /* #866: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #867: @74 = (@74-@112) */
-  w74 -= w112;
-  /* #868: @74 = (@21*@74) */
-  w74  = (w21*w74);
-  /* #869: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #870: @74 = (@1*@74) */
-  w74  = (w1*w74);
-  /* #871: @112 = (@25*@108) */
-  w112  = (w25*w108);
-  /* #872: @74 = (@74+@112) */
-  w74 += w112;
-  /* #873: @109 = (@109-@74) */
-  w109 -= w74;
-  /* #874: @74 = (@88*@107) */
-  w74  = (w88*w107);
-  /* #875: @74 = (@26*@74) */
-  w74  = (w26*w74);
-  /* #876: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #877: @74 = (@2*@74) */
-  w74  = (w2*w74);
-  /* #878: @112 = (@28*@110) */
-  w112  = (w28*w110);
-  /* #879: @74 = (@74+@112) */
-  w74 += w112;
-  /* #880: @109 = (@109+@74) */
-  w109 += w74;
-  /* #881: @111 = (@111-@109) */
-  w111 -= w109;
-  /* #882: output[1][43] = @111 */
-  if (res[1]) res[1][43] = w111;
-  /* #883: @111 = (@79*@107) */
-  w111  = (w79*w107);
-  /* #884: @111 = (@14*@111) */
-  w111  = (w14*w111);
-  /* #885: @109 = (@90*@77) */
-  w109  = (w90*w77);
-  /* #886: @109 = (@20*@109) */
-  w109  = (w20*w109);
-  /* #887: @111 = (@111-@109) */
-  w111 -= w109;
-  /* #888: @111 = (@30*@111) */
-  w111  = (w30*w111);
-  /* #889: @109 = (@91*@106) */
-  w109  = (w91*w106);
-  /* #890: @109 = (@29*@109) */
-  w109  = (w29*w109);
-  /* #891: @111 = (@111+@109) */
-  w111 += w109;
-  /* #892: @109 = (@92*@77) */
-  w109  = (w92*w77);
-  /* #893: @109 = (@32*@109) */
-  w109  = (w32*w109);
-  /* #894: @74 = (@94*@106) */
-  w74  = (w94*w106);
-  /* #895: @74 = (@33*@74) */
-  w74  = (w33*w74);
-  /* #896: @109 = (@109-@74) */
-  w109 -= w74;
-  /* #897: @111 = (@111-@109) */
-  w111 -= w109;
-  /* #898: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #899: @109 = (@93*@106) */
-  w109  = (w93*w106);
-  /* #900: @109 = (@36*@109) */
-  w109  = (w36*w109);
-  /* #901: @74 = (@96*@77) */
-  w74  = (w96*w77);
-  /* #902: @74 = (@37*@74) */
-  w74  = (w37*w74);
-  /* #903: @109 = (@109-@74) */
-  w109 -= w74;
-  /* #904: @74 = (@97*@107) */
-  w74  = (w97*w107);
-  /* #905: @74 = (@39*@74) */
-  w74  = (w39*w74);
-  /* #906: @112 = (@99*@106) */
-  w112  = (w99*w106);
-  /* #907: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #908: @74 = (@74-@112) */
-  w74 -= w112;
-  /* #909: @74 = (@42*@74) */
-  w74  = (w42*w74);
-  /* #910: @112 = (@100*@77) */
-  w112  = (w100*w77);
-  /* #911: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #912: @74 = (@74+@112) */
-  w74 += w112;
-  /* #913: @109 = (@109-@74) */
-  w109 -= w74;
-  /* #914: @109 = (@35*@109) */
-  w109  = (w35*w109);
-  /* #915: @109 = (@13*@109) */
-  w109  = (w13*w109);
-  /* #916: @109 = (@0*@109) */
-  w109  = (w0*w109);
-  /* #917: @76 = (@43*@76) */
-  w76  = (w43*w76);
-  /* #918: @109 = (@109+@76) */
-  w109 += w76;
-  /* #919: @76 = (@62*@106) */
-  w76  = (w62*w106);
-  /* #920: @76 = (@46*@76) */
-  w76  = (w46*w76);
-  /* #921: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #922: @74 = (@101*@77) */
-  w74  = (w101*w77);
-  /* #923: @74 = (@47*@74) */
-  w74  = (w47*w74);
-  /* #924: @76 = (@76-@74) */
-  w76 -= w74;
-  /* #925: @74 = (@102*@107) */
-  w74  = (w102*w107);
-  /* #926: @74 = (@50*@74) */
-  w74  = (w50*w74);
-  /* #927: @112 = (@104*@77) */
-  w112  = (w104*w77);
-  /* #928: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #929: @74 = (@74+@112) */
-  w74 += w112;
-  /* #930: @74 = (@52*@74) */
-  w74  = (w52*w74);
-  /* #931: @106 = (@105*@106) */
-  w106  = (w105*w106);
-  /* #932: @106 = (@51*@106) */
-  w106  = (w51*w106);
-  /* #933: @74 = (@74+@106) */
-  w74 += w106;
-  /* #934: @76 = (@76+@74) */
-  w76 += w74;
-  /* #935: @76 = (@45*@76) */
-  w76  = (w45*w76);
-  /* #936: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #937: @76 = (@1*@76) */
-  w76  = (w1*w76);
-  /* #938: @108 = (@53*@108) */
-  w108  = (w53*w108);
-  /* #939: @76 = (@76+@108) */
-  w76 += w108;
-  /* #940: @109 = (@109-@76) */
-  w109 -= w76;
-  /* #941: @76 = (@98*@77) */
-  w76  = (w98*w77);
-  /* #942: @76 = (@55*@76) */
-  w76  = (w55*w76);
-  /* #943: @108 = (@103*@107) */
-  w108  = (w103*w107);
-  /* #944: @108 = (@56*@108) */
-  w108  = (w56*w108);
-  /* #945: @76 = (@76-@108) */
-  w76 -= w108;
-  /* #946: @76 = (@54*@76) */
-  w76  = (w54*w76);
-  /* #947: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #948: @76 = (@2*@76) */
-  w76  = (w2*w76);
-  /* #949: @110 = (@58*@110) */
-  w110  = (w58*w110);
-  /* #950: @76 = (@76+@110) */
-  w76 += w110;
-  /* #951: @109 = (@109-@76) */
-  w109 -= w76;
-  /* #952: @111 = (@111-@109) */
-  w111 -= w109;
-  /* #953: output[1][44] = @111 */
-  if (res[1]) res[1][44] = w111;
-  /* #954: @111 = (@85*@77) */
-  w111  = (w85*w77);
-  /* #955: @111 = (@44*@111) */
-  w111  = (w44*w111);
-  /* #956: @111 = (-@111) */
-  w111 = (- w111 );
-  /* #957: @109 = (@63*@107) */
-  w109  = (w63*w107);
-  /* #958: @109 = (@59*@109) */
-  w109  = (w59*w109);
-  /* #959: @111 = (@111-@109) */
-  w111 -= w109;
-  /* #960: @111 = (@13*@111) */
-  w111  = (w13*w111);
-  /* #961: output[1][45] = @111 */
-  if (res[1]) res[1][45] = w111;
-  /* #962: @77 = (@95*@77) */
-  w77  = (w95*w77);
-  /* #963: @77 = (-@77) */
-  w77 = (- w77 );
-  /* #964: output[1][46] = @77 */
-  if (res[1]) res[1][46] = w77;
-  /* #965: @107 = (@75*@107) */
-  w107  = (w75*w107);
-  /* #966: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #967: output[1][47] = @107 */
-  if (res[1]) res[1][47] = w107;
-  /* #968: {NULL, NULL, NULL, @107, @77, @111, @109, @76, @110} = vertsplit(@71) */
-  w107 = w71[3];
-  w77 = w71[4];
-  w111 = w71[5];
-  w109 = w71[6];
-  w76 = w71[7];
-  w110 = w71[8];
-  /* #969: output[1][48] = @107 */
-  if (res[1]) res[1][48] = w107;
-  /* #970: output[1][49] = @77 */
-  if (res[1]) res[1][49] = w77;
-  /* #971: output[1][50] = @111 */
-  if (res[1]) res[1][50] = w111;
-  /* #972: @108 = (@78*@110) */
-  w108  = (w78*w110);
-  /* #973: @108 = (@4*@108) */
-  w108  = (w4*w108);
-  /* #974: @108 = (-@108) */
-  w108 = (- w108 );
-  /* #975: @74 = (@80*@109) */
-  w74  = (w80*w109);
-  /* #976: @74 = (@6*@74) */
-  w74  = (w6*w74);
-  /* #977: @108 = (@108-@74) */
-  w108 -= w74;
-  /* #978: @108 = (@9*@108) */
-  w108  = (w9*w108);
-  /* #979: @74 = (@81*@76) */
-  w74  = (w81*w76);
-  /* #980: @74 = (@7*@74) */
-  w74  = (w7*w74);
-  /* #981: @108 = (@108+@74) */
-  w108 += w74;
-  /* #982: @74 = (@82*@109) */
-  w74  = (w82*w109);
-  /* #983: @74 = (@12*@74) */
-  w74  = (w12*w74);
-  /* #984: @106 = (@84*@110) */
-  w106  = (w84*w110);
-  /* #985: @106 = (@11*@106) */
-  w106  = (w11*w106);
-  /* #986: @74 = (@74+@106) */
-  w74 += w106;
-  /* #987: @108 = (@108+@74) */
-  w108 += w74;
-  /* #988: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #989: @74 = (@83*@110) */
-  w74  = (w83*w110);
-  /* #990: @74 = (@16*@74) */
-  w74  = (w16*w74);
-  /* #991: @74 = (-@74) */
-  w74 = (- w74 );
-  /* #992: @106 = (@86*@76) */
-  w106  = (w86*w76);
-  /* #993: @106 = (@17*@106) */
-  w106  = (w17*w106);
-  /* #994: @74 = (@74-@106) */
-  w74 -= w106;
-  /* #995: @74 = (@15*@74) */
-  w74  = (w15*w74);
-  /* #996: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #997: @74 = (@0*@74) */
-  w74  = (w0*w74);
-  /* #998: @106 = (@19*@107) */
-  w106  = (w19*w107);
-  /* #999: @74 = (@74+@106) */
-  w74 += w106;
-  /* #1000: @106 = (@87*@110) */
-  w106  = (w87*w110);
-  /* #1001: @106 = (@22*@106) */
-  w106  = (w22*w106);
-  /* #1002: @112 = (@89*@76) */
-  w112  = (w89*w76);
-  /* #1003: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #1004: @106 = (@106-@112) */
-  w106 -= w112;
-  /* #1005: @106 = (@21*@106) */
-  w106  = (w21*w106);
-  /* #1006: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #1007: @106 = (@1*@106) */
-  w106  = (w1*w106);
-  /* #1008: @112 = (@25*@77) */
-  w112  = (w25*w77);
-  /* #1009: @106 = (@106+@112) */
-  w106 += w112;
-  /* #1010: @74 = (@74-@106) */
-  w74 -= w106;
-  /* #1011: @106 = (@88*@76) */
-  w106  = (w88*w76);
-  /* #1012: @106 = (@26*@106) */
-  w106  = (w26*w106);
-  /* #1013: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #1014: @106 = (@2*@106) */
-  w106  = (w2*w106);
-  /* #1015: @112 = (@28*@111) */
-  w112  = (w28*w111);
-  /* #1016: @106 = (@106+@112) */
-  w106 += w112;
-  /* #1017: @74 = (@74+@106) */
-  w74 += w106;
-  /* #1018: @108 = (@108-@74) */
-  w108 -= w74;
-  /* #1019: output[1][51] = @108 */
-  if (res[1]) res[1][51] = w108;
-  /* #1020: @108 = (@79*@76) */
-  w108  = (w79*w76);
-  /* #1021: @108 = (@14*@108) */
-  w108  = (w14*w108);
-  /* #1022: @74 = (@90*@109) */
-  w74  = (w90*w109);
-  /* #1023: @74 = (@20*@74) */
-  w74  = (w20*w74);
-  /* #1024: @108 = (@108-@74) */
-  w108 -= w74;
-  /* #1025: @108 = (@30*@108) */
-  w108  = (w30*w108);
-  /* #1026: @74 = (@91*@110) */
-  w74  = (w91*w110);
-  /* #1027: @74 = (@29*@74) */
-  w74  = (w29*w74);
-  /* #1028: @108 = (@108+@74) */
-  w108 += w74;
-  /* #1029: @74 = (@92*@109) */
-  w74  = (w92*w109);
-  /* #1030: @74 = (@32*@74) */
-  w74  = (w32*w74);
-  /* #1031: @106 = (@94*@110) */
-  w106  = (w94*w110);
-  /* #1032: @106 = (@33*@106) */
-  w106  = (w33*w106);
-  /* #1033: @74 = (@74-@106) */
-  w74 -= w106;
-  /* #1034: @108 = (@108-@74) */
-  w108 -= w74;
-  /* #1035: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #1036: @74 = (@93*@110) */
-  w74  = (w93*w110);
-  /* #1037: @74 = (@36*@74) */
-  w74  = (w36*w74);
-  /* #1038: @106 = (@96*@109) */
-  w106  = (w96*w109);
-  /* #1039: @106 = (@37*@106) */
-  w106  = (w37*w106);
-  /* #1040: @74 = (@74-@106) */
-  w74 -= w106;
-  /* #1041: @106 = (@97*@76) */
-  w106  = (w97*w76);
-  /* #1042: @106 = (@39*@106) */
-  w106  = (w39*w106);
-  /* #1043: @112 = (@99*@110) */
-  w112  = (w99*w110);
-  /* #1044: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #1045: @106 = (@106-@112) */
-  w106 -= w112;
-  /* #1046: @106 = (@42*@106) */
-  w106  = (w42*w106);
-  /* #1047: @112 = (@100*@109) */
-  w112  = (w100*w109);
-  /* #1048: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #1049: @106 = (@106+@112) */
-  w106 += w112;
-  /* #1050: @74 = (@74-@106) */
-  w74 -= w106;
-  /* #1051: @74 = (@35*@74) */
-  w74  = (w35*w74);
-  /* #1052: @74 = (@13*@74) */
-  w74  = (w13*w74);
-  /* #1053: @74 = (@0*@74) */
-  w74  = (w0*w74);
-  /* #1054: @107 = (@43*@107) */
-  w107  = (w43*w107);
-  /* #1055: @74 = (@74+@107) */
-  w74 += w107;
-  /* #1056: @107 = (@62*@110) */
-  w107  = (w62*w110);
-  /* #1057: @107 = (@46*@107) */
-  w107  = (w46*w107);
-  /* #1058: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #1059: @106 = (@101*@109) */
-  w106  = (w101*w109);
-  /* #1060: @106 = (@47*@106) */
-  w106  = (w47*w106);
-  /* #1061: @107 = (@107-@106) */
-  w107 -= w106;
-  /* #1062: @106 = (@102*@76) */
-  w106  = (w102*w76);
-  /* #1063: @106 = (@50*@106) */
-  w106  = (w50*w106);
-  /* #1064: @112 = (@104*@109) */
-  w112  = (w104*w109);
-  /* #1065: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #1066: @106 = (@106+@112) */
-  w106 += w112;
-  /* #1067: @106 = (@52*@106) */
-  w106  = (w52*w106);
-  /* #1068: @110 = (@105*@110) */
-  w110  = (w105*w110);
-  /* #1069: @110 = (@51*@110) */
-  w110  = (w51*w110);
-  /* #1070: @106 = (@106+@110) */
-  w106 += w110;
-  /* #1071: @107 = (@107+@106) */
-  w107 += w106;
-  /* #1072: @107 = (@45*@107) */
-  w107  = (w45*w107);
-  /* #1073: @107 = (@13*@107) */
-  w107  = (w13*w107);
-  /* #1074: @107 = (@1*@107) */
-  w107  = (w1*w107);
-  /* #1075: @77 = (@53*@77) */
-  w77  = (w53*w77);
-  /* #1076: @107 = (@107+@77) */
-  w107 += w77;
-  /* #1077: @74 = (@74-@107) */
-  w74 -= w107;
-  /* #1078: @107 = (@98*@109) */
-  w107  = (w98*w109);
-  /* #1079: @107 = (@55*@107) */
-  w107  = (w55*w107);
-  /* #1080: @77 = (@103*@76) */
-  w77  = (w103*w76);
-  /* #1081: @77 = (@56*@77) */
-  w77  = (w56*w77);
-  /* #1082: @107 = (@107-@77) */
-  w107 -= w77;
-  /* #1083: @107 = (@54*@107) */
-  w107  = (w54*w107);
-  /* #1084: @107 = (@13*@107) */
-  w107  = (w13*w107);
-  /* #1085: @107 = (@2*@107) */
-  w107  = (w2*w107);
-  /* #1086: @111 = (@58*@111) */
-  w111  = (w58*w111);
-  /* #1087: @107 = (@107+@111) */
-  w107 += w111;
-  /* #1088: @74 = (@74-@107) */
-  w74 -= w107;
-  /* #1089: @108 = (@108-@74) */
-  w108 -= w74;
-  /* #1090: output[1][52] = @108 */
-  if (res[1]) res[1][52] = w108;
-  /* #1091: @108 = (@85*@109) */
-  w108  = (w85*w109);
-  /* #1092: @108 = (@44*@108) */
-  w108  = (w44*w108);
-  /* #1093: @108 = (-@108) */
-  w108 = (- w108 );
-  /* #1094: @74 = (@63*@76) */
-  w74  = (w63*w76);
-  /* #1095: @74 = (@59*@74) */
-  w74  = (w59*w74);
-  /* #1096: @108 = (@108-@74) */
-  w108 -= w74;
-  /* #1097: @108 = (@13*@108) */
-  w108  = (w13*w108);
-  /* #1098: output[1][53] = @108 */
-  if (res[1]) res[1][53] = w108;
-  /* #1099: @109 = (@95*@109) */
-  w109  = (w95*w109);
-  /* #1100: @109 = (-@109) */
-  w109 = (- w109 );
-  /* #1101: output[1][54] = @109 */
-  if (res[1]) res[1][54] = w109;
-  /* #1102: @76 = (@75*@76) */
-  w76  = (w75*w76);
-  /* #1103: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #1104: output[1][55] = @76 */
-  if (res[1]) res[1][55] = w76;
-  /* #1105: {NULL, NULL, NULL, @76, @109, @108, @74, @107, @111} = vertsplit(@72) */
-  w76 = w72[3];
-  w109 = w72[4];
-  w108 = w72[5];
-  w74 = w72[6];
-  w107 = w72[7];
-  w111 = w72[8];
-  /* #1106: output[1][56] = @76 */
-  if (res[1]) res[1][56] = w76;
-  /* #1107: output[1][57] = @109 */
-  if (res[1]) res[1][57] = w109;
-  /* #1108: output[1][58] = @108 */
-  if (res[1]) res[1][58] = w108;
-  /* #1109: @77 = (@78*@111) */
-  w77  = (w78*w111);
-  /* #1110: @77 = (@4*@77) */
-  w77  = (w4*w77);
-  /* #1111: @77 = (-@77) */
-  w77 = (- w77 );
-  /* #1112: @106 = (@80*@74) */
-  w106  = (w80*w74);
-  /* #1113: @106 = (@6*@106) */
-  w106  = (w6*w106);
-  /* #1114: @77 = (@77-@106) */
-  w77 -= w106;
-  /* #1115: @77 = (@9*@77) */
-  w77  = (w9*w77);
-  /* #1116: @106 = (@81*@107) */
-  w106  = (w81*w107);
-  /* #1117: @106 = (@7*@106) */
-  w106  = (w7*w106);
-  /* #1118: @77 = (@77+@106) */
-  w77 += w106;
-  /* #1119: @106 = (@82*@74) */
-  w106  = (w82*w74);
-  /* #1120: @106 = (@12*@106) */
-  w106  = (w12*w106);
-  /* #1121: @110 = (@84*@111) */
-  w110  = (w84*w111);
-  /* #1122: @110 = (@11*@110) */
-  w110  = (w11*w110);
-  /* #1123: @106 = (@106+@110) */
-  w106 += w110;
-  /* #1124: @77 = (@77+@106) */
-  w77 += w106;
-  /* #1125: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #1126: @106 = (@83*@111) */
-  w106  = (w83*w111);
-  /* #1127: @106 = (@16*@106) */
-  w106  = (w16*w106);
-  /* #1128: @106 = (-@106) */
-  w106 = (- w106 );
-  /* #1129: @110 = (@86*@107) */
-  w110  = (w86*w107);
-  /* #1130: @110 = (@17*@110) */
-  w110  = (w17*w110);
-  /* #1131: @106 = (@106-@110) */
-  w106 -= w110;
-  /* #1132: @106 = (@15*@106) */
-  w106  = (w15*w106);
-  /* #1133: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #1134: @106 = (@0*@106) */
-  w106  = (w0*w106);
-  /* #1135: @110 = (@19*@76) */
-  w110  = (w19*w76);
-  /* #1136: @106 = (@106+@110) */
-  w106 += w110;
-  /* #1137: @110 = (@87*@111) */
-  w110  = (w87*w111);
-  /* #1138: @110 = (@22*@110) */
-  w110  = (w22*w110);
-  /* #1139: @112 = (@89*@107) */
-  w112  = (w89*w107);
-  /* #1140: @112 = (@23*@112) */
-  w112  = (w23*w112);
-  /* #1141: @110 = (@110-@112) */
-  w110 -= w112;
-  /* #1142: @110 = (@21*@110) */
-  w110  = (w21*w110);
-  /* #1143: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #1144: @110 = (@1*@110) */
-  w110  = (w1*w110);
-  /* #1145: @112 = (@25*@109) */
-  w112  = (w25*w109);
-  /* #1146: @110 = (@110+@112) */
-  w110 += w112;
-  /* #1147: @106 = (@106-@110) */
-  w106 -= w110;
-  /* #1148: @110 = (@88*@107) */
-  w110  = (w88*w107);
-  /* #1149: @110 = (@26*@110) */
-  w110  = (w26*w110);
-  /* #1150: @110 = (@13*@110) */
-  w110  = (w13*w110);
-  /* #1151: @110 = (@2*@110) */
-  w110  = (w2*w110);
-  /* #1152: @112 = (@28*@108) */
-  w112  = (w28*w108);
-  /* #1153: @110 = (@110+@112) */
-  w110 += w112;
-  /* #1154: @106 = (@106+@110) */
-  w106 += w110;
-  /* #1155: @77 = (@77-@106) */
-  w77 -= w106;
-  /* #1156: output[1][59] = @77 */
-  if (res[1]) res[1][59] = w77;
-  /* #1157: @77 = (@79*@107) */
-  w77  = (w79*w107);
-  /* #1158: @77 = (@14*@77) */
-  w77  = (w14*w77);
-  /* #1159: @106 = (@90*@74) */
-  w106  = (w90*w74);
-  /* #1160: @106 = (@20*@106) */
-  w106  = (w20*w106);
-  /* #1161: @77 = (@77-@106) */
-  w77 -= w106;
-  /* #1162: @77 = (@30*@77) */
-  w77  = (w30*w77);
-  /* #1163: @106 = (@91*@111) */
-  w106  = (w91*w111);
-  /* #1164: @106 = (@29*@106) */
-  w106  = (w29*w106);
-  /* #1165: @77 = (@77+@106) */
-  w77 += w106;
-  /* #1166: @106 = (@92*@74) */
-  w106  = (w92*w74);
-  /* #1167: @106 = (@32*@106) */
-  w106  = (w32*w106);
-  /* #1168: @110 = (@94*@111) */
-  w110  = (w94*w111);
-  /* #1169: @110 = (@33*@110) */
-  w110  = (w33*w110);
-  /* #1170: @106 = (@106-@110) */
-  w106 -= w110;
-  /* #1171: @77 = (@77-@106) */
-  w77 -= w106;
-  /* #1172: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #1173: @106 = (@93*@111) */
-  w106  = (w93*w111);
-  /* #1174: @106 = (@36*@106) */
-  w106  = (w36*w106);
-  /* #1175: @110 = (@96*@74) */
-  w110  = (w96*w74);
-  /* #1176: @110 = (@37*@110) */
-  w110  = (w37*w110);
-  /* #1177: @106 = (@106-@110) */
-  w106 -= w110;
-  /* #1178: @110 = (@97*@107) */
-  w110  = (w97*w107);
-  /* #1179: @110 = (@39*@110) */
-  w110  = (w39*w110);
-  /* #1180: @112 = (@99*@111) */
-  w112  = (w99*w111);
-  /* #1181: @112 = (@40*@112) */
-  w112  = (w40*w112);
-  /* #1182: @110 = (@110-@112) */
-  w110 -= w112;
-  /* #1183: @110 = (@42*@110) */
-  w110  = (w42*w110);
-  /* #1184: @112 = (@100*@74) */
-  w112  = (w100*w74);
-  /* #1185: @112 = (@41*@112) */
-  w112  = (w41*w112);
-  /* #1186: @110 = (@110+@112) */
-  w110 += w112;
-  /* #1187: @106 = (@106-@110) */
-  w106 -= w110;
-  /* #1188: @106 = (@35*@106) */
-  w106  = (w35*w106);
-  /* #1189: @106 = (@13*@106) */
-  w106  = (w13*w106);
-  /* #1190: @106 = (@0*@106) */
-  w106  = (w0*w106);
-  /* #1191: @76 = (@43*@76) */
-  w76  = (w43*w76);
-  /* #1192: @106 = (@106+@76) */
-  w106 += w76;
-  /* #1193: @76 = (@62*@111) */
-  w76  = (w62*w111);
-  /* #1194: @76 = (@46*@76) */
-  w76  = (w46*w76);
-  /* #1195: @76 = (-@76) */
-  w76 = (- w76 );
-  /* #1196: @110 = (@101*@74) */
-  w110  = (w101*w74);
-  /* #1197: @110 = (@47*@110) */
-  w110  = (w47*w110);
-  /* #1198: @76 = (@76-@110) */
-  w76 -= w110;
-  /* #1199: @110 = (@102*@107) */
-  w110  = (w102*w107);
-  /* #1200: @110 = (@50*@110) */
-  w110  = (w50*w110);
-  /* #1201: @112 = (@104*@74) */
-  w112  = (w104*w74);
-  /* #1202: @112 = (@49*@112) */
-  w112  = (w49*w112);
-  /* #1203: @110 = (@110+@112) */
-  w110 += w112;
-  /* #1204: @110 = (@52*@110) */
-  w110  = (w52*w110);
-  /* #1205: @111 = (@105*@111) */
-  w111  = (w105*w111);
-  /* #1206: @111 = (@51*@111) */
-  w111  = (w51*w111);
-  /* #1207: @110 = (@110+@111) */
-  w110 += w111;
-  /* #1208: @76 = (@76+@110) */
-  w76 += w110;
-  /* #1209: @76 = (@45*@76) */
-  w76  = (w45*w76);
-  /* #1210: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #1211: @76 = (@1*@76) */
-  w76  = (w1*w76);
-  /* #1212: @109 = (@53*@109) */
-  w109  = (w53*w109);
-  /* #1213: @76 = (@76+@109) */
-  w76 += w109;
-  /* #1214: @106 = (@106-@76) */
-  w106 -= w76;
-  /* #1215: @76 = (@98*@74) */
-  w76  = (w98*w74);
-  /* #1216: @76 = (@55*@76) */
-  w76  = (w55*w76);
-  /* #1217: @109 = (@103*@107) */
-  w109  = (w103*w107);
-  /* #1218: @109 = (@56*@109) */
-  w109  = (w56*w109);
-  /* #1219: @76 = (@76-@109) */
-  w76 -= w109;
-  /* #1220: @76 = (@54*@76) */
-  w76  = (w54*w76);
-  /* #1221: @76 = (@13*@76) */
-  w76  = (w13*w76);
-  /* #1222: @76 = (@2*@76) */
-  w76  = (w2*w76);
-  /* #1223: @108 = (@58*@108) */
-  w108  = (w58*w108);
-  /* #1224: @76 = (@76+@108) */
-  w76 += w108;
-  /* #1225: @106 = (@106-@76) */
-  w106 -= w76;
-  /* #1226: @77 = (@77-@106) */
-  w77 -= w106;
-  /* #1227: output[1][60] = @77 */
-  if (res[1]) res[1][60] = w77;
-  /* #1228: @77 = (@85*@74) */
-  w77  = (w85*w74);
-  /* #1229: @77 = (@44*@77) */
-  w77  = (w44*w77);
-  /* #1230: @77 = (-@77) */
-  w77 = (- w77 );
-  /* #1231: @106 = (@63*@107) */
-  w106  = (w63*w107);
-  /* #1232: @106 = (@59*@106) */
-  w106  = (w59*w106);
-  /* #1233: @77 = (@77-@106) */
-  w77 -= w106;
-  /* #1234: @77 = (@13*@77) */
-  w77  = (w13*w77);
-  /* #1235: output[1][61] = @77 */
-  if (res[1]) res[1][61] = w77;
-  /* #1236: @74 = (@95*@74) */
-  w74  = (w95*w74);
-  /* #1237: @74 = (-@74) */
-  w74 = (- w74 );
-  /* #1238: output[1][62] = @74 */
-  if (res[1]) res[1][62] = w74;
-  /* #1239: @107 = (@75*@107) */
-  w107  = (w75*w107);
-  /* #1240: @107 = (-@107) */
-  w107 = (- w107 );
-  /* #1241: output[1][63] = @107 */
-  if (res[1]) res[1][63] = w107;
-  /* #1242: {NULL, NULL, NULL, @107, @74, @77, @106, @76, @108} = vertsplit(@73) */
-  w107 = w73[3];
-  w74 = w73[4];
-  w77 = w73[5];
-  w106 = w73[6];
-  w76 = w73[7];
-  w108 = w73[8];
-  /* #1243: output[1][64] = @107 */
-  if (res[1]) res[1][64] = w107;
-  /* #1244: output[1][65] = @74 */
-  if (res[1]) res[1][65] = w74;
-  /* #1245: output[1][66] = @77 */
-  if (res[1]) res[1][66] = w77;
-  /* #1246: @78 = (@78*@108) */
-  w78 *= w108;
-  /* #1247: @78 = (@4*@78) */
-  w78  = (w4*w78);
-  /* #1248: @78 = (-@78) */
-  w78 = (- w78 );
-  /* #1249: @80 = (@80*@106) */
-  w80 *= w106;
-  /* #1250: @80 = (@6*@80) */
-  w80  = (w6*w80);
-  /* #1251: @78 = (@78-@80) */
-  w78 -= w80;
-  /* #1252: @78 = (@9*@78) */
-  w78  = (w9*w78);
-  /* #1253: @81 = (@81*@76) */
-  w81 *= w76;
-  /* #1254: @81 = (@7*@81) */
-  w81  = (w7*w81);
-  /* #1255: @78 = (@78+@81) */
-  w78 += w81;
-  /* #1256: @82 = (@82*@106) */
-  w82 *= w106;
-  /* #1257: @82 = (@12*@82) */
-  w82  = (w12*w82);
-  /* #1258: @84 = (@84*@108) */
-  w84 *= w108;
-  /* #1259: @84 = (@11*@84) */
-  w84  = (w11*w84);
-  /* #1260: @82 = (@82+@84) */
-  w82 += w84;
-  /* #1261: @78 = (@78+@82) */
-  w78 += w82;
-  /* #1262: @78 = (@13*@78) */
-  w78  = (w13*w78);
-  /* #1263: @83 = (@83*@108) */
-  w83 *= w108;
-  /* #1264: @83 = (@16*@83) */
-  w83  = (w16*w83);
-  /* #1265: @83 = (-@83) */
-  w83 = (- w83 );
-  /* #1266: @86 = (@86*@76) */
-  w86 *= w76;
-  /* #1267: @86 = (@17*@86) */
-  w86  = (w17*w86);
-  /* #1268: @83 = (@83-@86) */
-  w83 -= w86;
-  /* #1269: @83 = (@15*@83) */
-  w83  = (w15*w83);
-  /* #1270: @83 = (@13*@83) */
-  w83  = (w13*w83);
-  /* #1271: @83 = (@0*@83) */
-  w83  = (w0*w83);
-  /* #1272: @86 = (@19*@107) */
-  w86  = (w19*w107);
-  /* #1273: @83 = (@83+@86) */
-  w83 += w86;
-  /* #1274: @87 = (@87*@108) */
-  w87 *= w108;
-  /* #1275: @87 = (@22*@87) */
-  w87  = (w22*w87);
-  /* #1276: @89 = (@89*@76) */
-  w89 *= w76;
-  /* #1277: @89 = (@23*@89) */
-  w89  = (w23*w89);
-  /* #1278: @87 = (@87-@89) */
-  w87 -= w89;
-  /* #1279: @87 = (@21*@87) */
-  w87  = (w21*w87);
-  /* #1280: @87 = (@13*@87) */
-  w87  = (w13*w87);
-  /* #1281: @87 = (@1*@87) */
-  w87  = (w1*w87);
-  /* #1282: @89 = (@25*@74) */
-  w89  = (w25*w74);
-  /* #1283: @87 = (@87+@89) */
-  w87 += w89;
-  /* #1284: @83 = (@83-@87) */
-  w83 -= w87;
-  /* #1285: @88 = (@88*@76) */
-  w88 *= w76;
-  /* #1286: @88 = (@26*@88) */
-  w88  = (w26*w88);
-  /* #1287: @88 = (@13*@88) */
-  w88  = (w13*w88);
-  /* #1288: @88 = (@2*@88) */
-  w88  = (w2*w88);
-  /* #1289: @87 = (@28*@77) */
-  w87  = (w28*w77);
-  /* #1290: @88 = (@88+@87) */
-  w88 += w87;
-  /* #1291: @83 = (@83+@88) */
-  w83 += w88;
-  /* #1292: @78 = (@78-@83) */
-  w78 -= w83;
-  /* #1293: output[1][67] = @78 */
-  if (res[1]) res[1][67] = w78;
-  /* #1294: @79 = (@79*@76) */
-  w79 *= w76;
-  /* #1295: @79 = (@14*@79) */
-  w79  = (w14*w79);
-  /* #1296: @90 = (@90*@106) */
-  w90 *= w106;
-  /* #1297: @90 = (@20*@90) */
-  w90  = (w20*w90);
-  /* #1298: @79 = (@79-@90) */
-  w79 -= w90;
-  /* #1299: @79 = (@30*@79) */
-  w79  = (w30*w79);
-  /* #1300: @91 = (@91*@108) */
-  w91 *= w108;
-  /* #1301: @91 = (@29*@91) */
-  w91  = (w29*w91);
-  /* #1302: @79 = (@79+@91) */
-  w79 += w91;
-  /* #1303: @92 = (@92*@106) */
-  w92 *= w106;
-  /* #1304: @92 = (@32*@92) */
-  w92  = (w32*w92);
-  /* #1305: @94 = (@94*@108) */
-  w94 *= w108;
-  /* #1306: @94 = (@33*@94) */
-  w94  = (w33*w94);
-  /* #1307: @92 = (@92-@94) */
-  w92 -= w94;
-  /* #1308: @79 = (@79-@92) */
-  w79 -= w92;
-  /* #1309: @79 = (@13*@79) */
-  w79  = (w13*w79);
-  /* #1310: @93 = (@93*@108) */
-  w93 *= w108;
-  /* #1311: @93 = (@36*@93) */
-  w93  = (w36*w93);
-  /* #1312: @96 = (@96*@106) */
-  w96 *= w106;
-  /* #1313: @96 = (@37*@96) */
-  w96  = (w37*w96);
-  /* #1314: @93 = (@93-@96) */
-  w93 -= w96;
-  /* #1315: @97 = (@97*@76) */
-  w97 *= w76;
-  /* #1316: @97 = (@39*@97) */
-  w97  = (w39*w97);
-  /* #1317: @99 = (@99*@108) */
-  w99 *= w108;
-  /* #1318: @99 = (@40*@99) */
-  w99  = (w40*w99);
-  /* #1319: @97 = (@97-@99) */
-  w97 -= w99;
-  /* #1320: @97 = (@42*@97) */
-  w97  = (w42*w97);
-  /* #1321: @100 = (@100*@106) */
-  w100 *= w106;
-  /* #1322: @100 = (@41*@100) */
-  w100  = (w41*w100);
-  /* #1323: @97 = (@97+@100) */
-  w97 += w100;
-  /* #1324: @93 = (@93-@97) */
-  w93 -= w97;
-  /* #1325: @93 = (@35*@93) */
-  w93  = (w35*w93);
-  /* #1326: @93 = (@13*@93) */
-  w93  = (w13*w93);
-  /* #1327: @93 = (@0*@93) */
-  w93  = (w0*w93);
-  /* #1328: @107 = (@43*@107) */
-  w107  = (w43*w107);
-  /* #1329: @93 = (@93+@107) */
-  w93 += w107;
-  /* #1330: @62 = (@62*@108) */
-  w62 *= w108;
-  /* #1331: @62 = (@46*@62) */
-  w62  = (w46*w62);
-  /* #1332: @62 = (-@62) */
-  w62 = (- w62 );
-  /* #1333: @101 = (@101*@106) */
-  w101 *= w106;
-  /* #1334: @101 = (@47*@101) */
-  w101  = (w47*w101);
-  /* #1335: @62 = (@62-@101) */
-  w62 -= w101;
-  /* #1336: @102 = (@102*@76) */
-  w102 *= w76;
-  /* #1337: @102 = (@50*@102) */
-  w102  = (w50*w102);
-  /* #1338: @104 = (@104*@106) */
-  w104 *= w106;
-  /* #1339: @104 = (@49*@104) */
-  w104  = (w49*w104);
-  /* #1340: @102 = (@102+@104) */
-  w102 += w104;
-  /* #1341: @102 = (@52*@102) */
-  w102  = (w52*w102);
-  /* #1342: @105 = (@105*@108) */
-  w105 *= w108;
-  /* #1343: @105 = (@51*@105) */
-  w105  = (w51*w105);
-  /* #1344: @102 = (@102+@105) */
-  w102 += w105;
-  /* #1345: @62 = (@62+@102) */
-  w62 += w102;
-  /* #1346: @62 = (@45*@62) */
-  w62  = (w45*w62);
-  /* #1347: @62 = (@13*@62) */
-  w62  = (w13*w62);
-  /* #1348: @62 = (@1*@62) */
-  w62  = (w1*w62);
-  /* #1349: @74 = (@53*@74) */
-  w74  = (w53*w74);
-  /* #1350: @62 = (@62+@74) */
-  w62 += w74;
-  /* #1351: @93 = (@93-@62) */
-  w93 -= w62;
-  /* #1352: @98 = (@98*@106) */
-  w98 *= w106;
-  /* #1353: @98 = (@55*@98) */
-  w98  = (w55*w98);
-  /* #1354: @103 = (@103*@76) */
-  w103 *= w76;
-  /* #1355: @103 = (@56*@103) */
-  w103  = (w56*w103);
-  /* #1356: @98 = (@98-@103) */
-  w98 -= w103;
-  /* #1357: @98 = (@54*@98) */
-  w98  = (w54*w98);
-  /* #1358: @98 = (@13*@98) */
-  w98  = (w13*w98);
-  /* #1359: @98 = (@2*@98) */
-  w98  = (w2*w98);
-  /* #1360: @77 = (@58*@77) */
-  w77  = (w58*w77);
-  /* #1361: @98 = (@98+@77) */
-  w98 += w77;
-  /* #1362: @93 = (@93-@98) */
-  w93 -= w98;
-  /* #1363: @79 = (@79-@93) */
-  w79 -= w93;
-  /* #1364: output[1][68] = @79 */
-  if (res[1]) res[1][68] = w79;
-  /* #1365: @85 = (@85*@106) */
-  w85 *= w106;
-  /* #1366: @85 = (@44*@85) */
-  w85  = (w44*w85);
-  /* #1367: @85 = (-@85) */
-  w85 = (- w85 );
-  /* #1368: @63 = (@63*@76) */
-  w63 *= w76;
-  /* #1369: @63 = (@59*@63) */
-  w63  = (w59*w63);
-  /* #1370: @85 = (@85-@63) */
-  w85 -= w63;
-  /* #1371: @85 = (@13*@85) */
-  w85  = (w13*w85);
-  /* #1372: output[1][69] = @85 */
-  if (res[1]) res[1][69] = w85;
-  /* #1373: @95 = (@95*@106) */
-  w95 *= w106;
-  /* #1374: @95 = (-@95) */
-  w95 = (- w95 );
-  /* #1375: output[1][70] = @95 */
-  if (res[1]) res[1][70] = w95;
-  /* #1376: @75 = (@75*@76) */
-  w75 *= w76;
-  /* #1377: @75 = (-@75) */
-  w75 = (- w75 );
-  /* #1378: output[1][71] = @75 */
-  if (res[1]) res[1][71] = w75;
-  /* #1379: @113 = zeros(3x9,5nz) */
-  casadi_clear(w113, 5);
-  /* #1380: @114 = 00 */
-  /* #1381: @115 = 00 */
-  /* #1382: @116 = 00 */
-  /* #1383: @117 = ones(3x1) */
-  casadi_fill(w117, 3, 1.);
-  /* #1384: {@75, @76, @95} = vertsplit(@117) */
-  w75 = w117[0];
-  w76 = w117[1];
-  w95 = w117[2];
-  /* #1385: @10 = (@10*@95) */
-  w10 *= w95;
-  /* #1386: @18 = (@18*@95) */
-  w18 *= w95;
-  /* #1387: @18 = (@0*@18) */
-  w18  = (w0*w18);
-  /* #1388: @24 = (@24*@95) */
-  w24 *= w95;
-  /* #1389: @24 = (@1*@24) */
-  w24  = (w1*w24);
-  /* #1390: @18 = (@18-@24) */
-  w18 -= w24;
-  /* #1391: @27 = (@27*@95) */
-  w27 *= w95;
-  /* #1392: @27 = (@2*@27) */
-  w27  = (w2*w27);
-  /* #1393: @18 = (@18+@27) */
-  w18 += w27;
-  /* #1394: @10 = (@10-@18) */
-  w10 -= w18;
-  /* #1395: @31 = (@31*@95) */
-  w31 *= w95;
-  /* #1396: @38 = (@38*@95) */
-  w38 *= w95;
-  /* #1397: @38 = (@0*@38) */
-  w38  = (w0*w38);
-  /* #1398: @48 = (@48*@95) */
-  w48 *= w95;
-  /* #1399: @48 = (@1*@48) */
-  w48  = (w1*w48);
-  /* #1400: @38 = (@38-@48) */
+  /* #41: @14 = (@4*@9) */
+  w14 = (w4*w9);
+  /* #42: @19 = (@14*@5) */
+  w19 = (w14*w5);
+  /* #43: @24 = (@6*@11) */
+  w24 = (w6*w11);
+  /* #44: @19 = (@19-@24) */
+  w19 -= w24;
+  /* #45: @24 = (@19*@13) */
+  w24 = (w19*w13);
+  /* #46: @25 = (@4*@5) */
+  w25 = (w4*w5);
+  /* #47: @26 = (@6*@9) */
+  w26 = (w6*w9);
+  /* #48: @27 = (@26*@11) */
+  w27 = (w26*w11);
+  /* #49: @25 = (@25-@27) */
+  w25 -= w27;
+  /* #50: @27 = input[4][5] */
+  w27 = arg[4] ? arg[4][5] : 0;
+  /* #51: @25 = (@25*@27) */
+  w25 *= w27;
+  /* #52: @28 = (@25*@13) */
+  w28 = (w25*w13);
+  /* #53: @29 = (@28*@0) */
+  w29 = (w28*w0);
+  /* #54: @30 = (@9*@11) */
+  w30 = (w9*w11);
+  /* #55: @31 = (@30*@5) */
+  w31 = (w30*w5);
+  /* #56: @31 = (@7+@31) */
+  w31 = (w7+w31);
+  /* #57: @31 = (@31*@27) */
+  w31 *= w27;
+  /* #58: @32 = (@31*@13) */
+  w32 = (w31*w13);
+  /* #59: @33 = (@32*@1) */
+  w33 = (w32*w1);
+  /* #60: @29 = (@29-@33) */
+  w29 -= w33;
+  /* #61: @33 = (@15*@11) */
+  w33 = (w15*w11);
+  /* #62: @33 = (@33*@27) */
+  w33 *= w27;
+  /* #63: @34 = (@33*@13) */
+  w34 = (w33*w13);
+  /* #64: @35 = (@34*@2) */
+  w35 = (w34*w2);
+  /* #65: @29 = (@29-@35) */
+  w29 -= w35;
+  /* #66: @24 = (@24-@29) */
+  w24 -= w29;
+  /* #67: @29 = input[4][8] */
+  w29 = arg[4] ? arg[4][8] : 0;
+  /* #68: @24 = (@24+@29) */
+  w24 += w29;
+  /* #69: output[0][4] = @24 */
+  if (res[0]) res[0][4] = w24;
+  /* #70: @24 = -9.8066 */
+  w24 = -9.8065999999999995e+00;
+  /* #71: @29 = (@15*@4) */
+  w29 = (w15*w4);
+  /* #72: @35 = (@29*@13) */
+  w35 = (w29*w13);
+  /* #73: @24 = (@24+@35) */
+  w24 += w35;
+  /* #74: @35 = input[4][9] */
+  w35 = arg[4] ? arg[4][9] : 0;
+  /* #75: @24 = (@24+@35) */
+  w24 += w35;
+  /* #76: output[0][5] = @24 */
+  if (res[0]) res[0][5] = w24;
+  /* #77: @24 = input[4][1] */
+  w24 = arg[4] ? arg[4][1] : 0;
+  /* #78: @35 = input[3][0] */
+  w35 = arg[3] ? arg[3][0] : 0;
+  /* #79: @35 = (@24*@35) */
+  w35 = (w24*w35);
+  /* #80: @35 = (@35-@3) */
+  w35 -= w3;
+  /* #81: @3 = input[4][0] */
+  w3 = arg[4] ? arg[4][0] : 0;
+  /* #82: @35 = (@35/@3) */
+  w35 /= w3;
+  /* #83: output[0][6] = @35 */
+  if (res[0]) res[0][6] = w35;
+  /* #84: @35 = input[4][3] */
+  w35 = arg[4] ? arg[4][3] : 0;
+  /* #85: @36 = input[3][1] */
+  w36 = arg[3] ? arg[3][1] : 0;
+  /* #86: @36 = (@35*@36) */
+  w36 = (w35*w36);
+  /* #87: @36 = (@36-@8) */
+  w36 -= w8;
+  /* #88: @8 = input[4][2] */
+  w8 = arg[4] ? arg[4][2] : 0;
+  /* #89: @36 = (@36/@8) */
+  w36 /= w8;
+  /* #90: output[0][7] = @36 */
+  if (res[0]) res[0][7] = w36;
+  /* #91: @36 = 0 */
+  w36 = 0.;
+  /* #92: output[0][8] = @36 */
+  if (res[0]) res[0][8] = w36;
+  /* #93: @36 = input[1][3] */
+  w36 = arg[1] ? arg[1][3] : 0;
+  /* #94: output[1][0] = @36 */
+  if (res[1]) res[1][0] = w36;
+  /* #95: @37 = input[1][4] */
+  w37 = arg[1] ? arg[1][4] : 0;
+  /* #96: output[1][1] = @37 */
+  if (res[1]) res[1][1] = w37;
+  /* #97: @38 = input[1][5] */
+  w38 = arg[1] ? arg[1][5] : 0;
+  /* #98: output[1][2] = @38 */
+  if (res[1]) res[1][2] = w38;
+  /* #99: @39 = input[1][6] */
+  w39 = arg[1] ? arg[1][6] : 0;
+  /* #100: @40 = (@11*@39) */
+  w40 = (w11*w39);
+  /* #101: @40 = (-@40) */
+  w40 = (- w40 );
+  /* #102: @41 = (@40*@6) */
+  w41 = (w40*w6);
+  /* #103: @42 = input[1][8] */
+  w42 = arg[1] ? arg[1][8] : 0;
+  /* #104: @43 = (@5*@42) */
+  w43 = (w5*w42);
+  /* #105: @43 = (-@43) */
+  w43 = (- w43 );
+  /* #106: @44 = (@4*@43) */
+  w44 = (w4*w43);
+  /* #107: @41 = (@41+@44) */
+  w41 += w44;
+  /* #108: @44 = (@41*@9) */
+  w44 = (w41*w9);
+  /* #109: @45 = input[1][7] */
+  w45 = arg[1] ? arg[1][7] : 0;
+  /* #110: @46 = (@15*@45) */
+  w46 = (w15*w45);
+  /* #111: @47 = (@7*@46) */
+  w47 = (w7*w46);
+  /* #112: @44 = (@44+@47) */
+  w44 += w47;
+  /* #113: @47 = (@4*@39) */
+  w47 = (w4*w39);
+  /* #114: @48 = (@47*@5) */
+  w48 = (w47*w5);
+  /* #115: @42 = (@6*@42) */
+  w42 = (w6*w42);
+  /* #116: @49 = (@11*@42) */
+  w49 = (w11*w42);
+  /* #117: @48 = (@48+@49) */
+  w48 += w49;
+  /* #118: @44 = (@44+@48) */
+  w44 += w48;
+  /* #119: @44 = (@44*@13) */
+  w44 *= w13;
+  /* #120: @48 = (@9*@45) */
+  w48 = (w9*w45);
+  /* #121: @48 = (-@48) */
+  w48 = (- w48 );
+  /* #122: @49 = (@48*@6) */
+  w49 = (w48*w6);
+  /* #123: @50 = (@15*@43) */
+  w50 = (w15*w43);
+  /* #124: @49 = (@49+@50) */
+  w49 += w50;
+  /* #125: @49 = (@49*@17) */
+  w49 *= w17;
+  /* #126: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #127: @49 = (@49*@0) */
+  w49 *= w0;
+  /* #128: @50 = (@18*@36) */
+  w50 = (w18*w36);
+  /* #129: @49 = (@49+@50) */
+  w49 += w50;
+  /* #130: @50 = (@48*@5) */
+  w50 = (w48*w5);
+  /* #131: @51 = (@15*@42) */
+  w51 = (w15*w42);
+  /* #132: @50 = (@50+@51) */
+  w50 += w51;
+  /* #133: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #134: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #135: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #136: @51 = (@21*@37) */
+  w51 = (w21*w37);
+  /* #137: @50 = (@50+@51) */
+  w50 += w51;
+  /* #138: @49 = (@49-@50) */
+  w49 -= w50;
+  /* #139: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #140: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #141: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #142: @51 = (@23*@38) */
+  w51 = (w23*w38);
+  /* #143: @50 = (@50+@51) */
+  w50 += w51;
+  /* #144: @49 = (@49+@50) */
+  w49 += w50;
+  /* #145: @44 = (@44-@49) */
+  w44 -= w49;
+  /* #146: output[1][3] = @44 */
+  if (res[1]) res[1][3] = w44;
+  /* #147: @44 = (@40*@9) */
+  w44 = (w40*w9);
+  /* #148: @49 = (@4*@46) */
+  w49 = (w4*w46);
+  /* #149: @44 = (@44+@49) */
+  w44 += w49;
+  /* #150: @44 = (@44*@5) */
+  w44 *= w5;
+  /* #151: @49 = (@14*@42) */
+  w49 = (w14*w42);
+  /* #152: @44 = (@44+@49) */
+  w44 += w49;
+  /* #153: @49 = (@43*@11) */
+  w49 = (w43*w11);
+  /* #154: @50 = (@6*@47) */
+  w50 = (w6*w47);
+  /* #155: @49 = (@49+@50) */
+  w49 += w50;
+  /* #156: @44 = (@44-@49) */
+  w44 -= w49;
+  /* #157: @44 = (@44*@13) */
+  w44 *= w13;
+  /* #158: @49 = (@40*@5) */
+  w49 = (w40*w5);
+  /* #159: @50 = (@4*@42) */
+  w50 = (w4*w42);
+  /* #160: @49 = (@49+@50) */
+  w49 += w50;
+  /* #161: @43 = (@43*@9) */
+  w43 *= w9;
+  /* #162: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #163: @43 = (@43+@50) */
+  w43 += w50;
+  /* #164: @43 = (@43*@11) */
+  w43 *= w11;
+  /* #165: @50 = (@26*@47) */
+  w50 = (w26*w47);
+  /* #166: @43 = (@43+@50) */
+  w43 += w50;
+  /* #167: @49 = (@49-@43) */
+  w49 -= w43;
+  /* #168: @49 = (@49*@27) */
+  w49 *= w27;
+  /* #169: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #170: @49 = (@49*@0) */
+  w49 *= w0;
+  /* #171: @36 = (@28*@36) */
+  w36 = (w28*w36);
+  /* #172: @49 = (@49+@36) */
+  w49 += w36;
+  /* #173: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #174: @36 = (@9*@47) */
+  w36 = (w9*w47);
+  /* #175: @46 = (@46+@36) */
+  w46 += w36;
+  /* #176: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #177: @42 = (@30*@42) */
+  w42 = (w30*w42);
+  /* #178: @46 = (@46+@42) */
+  w46 += w42;
+  /* #179: @41 = (@41+@46) */
+  w41 += w46;
+  /* #180: @41 = (@41*@27) */
+  w41 *= w27;
+  /* #181: @41 = (@41*@13) */
+  w41 *= w13;
+  /* #182: @41 = (@41*@1) */
+  w41 *= w1;
+  /* #183: @37 = (@32*@37) */
+  w37 = (w32*w37);
+  /* #184: @41 = (@41+@37) */
+  w41 += w37;
+  /* #185: @49 = (@49-@41) */
+  w49 -= w41;
+  /* #186: @41 = (@48*@11) */
+  w41 = (w48*w11);
+  /* #187: @47 = (@15*@47) */
+  w47 = (w15*w47);
+  /* #188: @41 = (@41+@47) */
+  w41 += w47;
+  /* #189: @41 = (@41*@27) */
+  w41 *= w27;
+  /* #190: @41 = (@41*@13) */
+  w41 *= w13;
+  /* #191: @41 = (@41*@2) */
+  w41 *= w2;
+  /* #192: @38 = (@34*@38) */
+  w38 = (w34*w38);
+  /* #193: @41 = (@41+@38) */
+  w41 += w38;
+  /* #194: @49 = (@49-@41) */
+  w49 -= w41;
+  /* #195: @44 = (@44-@49) */
+  w44 -= w49;
+  /* #196: output[1][4] = @44 */
+  if (res[1]) res[1][4] = w44;
+  /* #197: @48 = (@48*@4) */
+  w48 *= w4;
+  /* #198: @40 = (@15*@40) */
+  w40 = (w15*w40);
+  /* #199: @48 = (@48+@40) */
+  w48 += w40;
+  /* #200: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #201: output[1][5] = @48 */
+  if (res[1]) res[1][5] = w48;
+  /* #202: @39 = (-@39) */
+  w39 = (- w39 );
+  /* #203: @39 = (@39/@3) */
+  w39 /= w3;
+  /* #204: output[1][6] = @39 */
+  if (res[1]) res[1][6] = w39;
+  /* #205: @45 = (-@45) */
+  w45 = (- w45 );
+  /* #206: @45 = (@45/@8) */
+  w45 /= w8;
+  /* #207: output[1][7] = @45 */
+  if (res[1]) res[1][7] = w45;
+  /* #208: @45 = input[1][12] */
+  w45 = arg[1] ? arg[1][12] : 0;
+  /* #209: output[1][8] = @45 */
+  if (res[1]) res[1][8] = w45;
+  /* #210: @39 = input[1][13] */
+  w39 = arg[1] ? arg[1][13] : 0;
+  /* #211: output[1][9] = @39 */
+  if (res[1]) res[1][9] = w39;
+  /* #212: @48 = input[1][14] */
+  w48 = arg[1] ? arg[1][14] : 0;
+  /* #213: output[1][10] = @48 */
+  if (res[1]) res[1][10] = w48;
+  /* #214: @40 = input[1][15] */
+  w40 = arg[1] ? arg[1][15] : 0;
+  /* #215: @44 = (@11*@40) */
+  w44 = (w11*w40);
+  /* #216: @44 = (-@44) */
+  w44 = (- w44 );
+  /* #217: @49 = (@44*@6) */
+  w49 = (w44*w6);
+  /* #218: @41 = input[1][17] */
+  w41 = arg[1] ? arg[1][17] : 0;
+  /* #219: @38 = (@5*@41) */
+  w38 = (w5*w41);
+  /* #220: @38 = (-@38) */
+  w38 = (- w38 );
+  /* #221: @47 = (@4*@38) */
+  w47 = (w4*w38);
+  /* #222: @49 = (@49+@47) */
+  w49 += w47;
+  /* #223: @47 = (@49*@9) */
+  w47 = (w49*w9);
+  /* #224: @37 = input[1][16] */
+  w37 = arg[1] ? arg[1][16] : 0;
+  /* #225: @46 = (@15*@37) */
+  w46 = (w15*w37);
+  /* #226: @42 = (@7*@46) */
+  w42 = (w7*w46);
+  /* #227: @47 = (@47+@42) */
+  w47 += w42;
+  /* #228: @42 = (@4*@40) */
+  w42 = (w4*w40);
+  /* #229: @36 = (@42*@5) */
+  w36 = (w42*w5);
+  /* #230: @41 = (@6*@41) */
+  w41 = (w6*w41);
+  /* #231: @43 = (@11*@41) */
+  w43 = (w11*w41);
+  /* #232: @36 = (@36+@43) */
+  w36 += w43;
+  /* #233: @47 = (@47+@36) */
+  w47 += w36;
+  /* #234: @47 = (@47*@13) */
+  w47 *= w13;
+  /* #235: @36 = (@9*@37) */
+  w36 = (w9*w37);
+  /* #236: @36 = (-@36) */
+  w36 = (- w36 );
+  /* #237: @43 = (@36*@6) */
+  w43 = (w36*w6);
+  /* #238: @50 = (@15*@38) */
+  w50 = (w15*w38);
+  /* #239: @43 = (@43+@50) */
+  w43 += w50;
+  /* #240: @43 = (@43*@17) */
+  w43 *= w17;
+  /* #241: @43 = (@43*@13) */
+  w43 *= w13;
+  /* #242: @43 = (@43*@0) */
+  w43 *= w0;
+  /* #243: @50 = (@18*@45) */
+  w50 = (w18*w45);
+  /* #244: @43 = (@43+@50) */
+  w43 += w50;
+  /* #245: @50 = (@36*@5) */
+  w50 = (w36*w5);
+  /* #246: @51 = (@15*@41) */
+  w51 = (w15*w41);
+  /* #247: @50 = (@50+@51) */
+  w50 += w51;
+  /* #248: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #249: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #250: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #251: @51 = (@21*@39) */
+  w51 = (w21*w39);
+  /* #252: @50 = (@50+@51) */
+  w50 += w51;
+  /* #253: @43 = (@43-@50) */
+  w43 -= w50;
+  /* #254: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #255: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #256: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #257: @51 = (@23*@48) */
+  w51 = (w23*w48);
+  /* #258: @50 = (@50+@51) */
+  w50 += w51;
+  /* #259: @43 = (@43+@50) */
+  w43 += w50;
+  /* #260: @47 = (@47-@43) */
+  w47 -= w43;
+  /* #261: output[1][11] = @47 */
+  if (res[1]) res[1][11] = w47;
+  /* #262: @47 = (@44*@9) */
+  w47 = (w44*w9);
+  /* #263: @43 = (@4*@46) */
+  w43 = (w4*w46);
+  /* #264: @47 = (@47+@43) */
+  w47 += w43;
+  /* #265: @47 = (@47*@5) */
+  w47 *= w5;
+  /* #266: @43 = (@14*@41) */
+  w43 = (w14*w41);
+  /* #267: @47 = (@47+@43) */
+  w47 += w43;
+  /* #268: @43 = (@38*@11) */
+  w43 = (w38*w11);
+  /* #269: @50 = (@6*@42) */
+  w50 = (w6*w42);
+  /* #270: @43 = (@43+@50) */
+  w43 += w50;
+  /* #271: @47 = (@47-@43) */
+  w47 -= w43;
+  /* #272: @47 = (@47*@13) */
+  w47 *= w13;
+  /* #273: @43 = (@44*@5) */
+  w43 = (w44*w5);
+  /* #274: @50 = (@4*@41) */
+  w50 = (w4*w41);
+  /* #275: @43 = (@43+@50) */
+  w43 += w50;
+  /* #276: @38 = (@38*@9) */
+  w38 *= w9;
+  /* #277: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #278: @38 = (@38+@50) */
+  w38 += w50;
+  /* #279: @38 = (@38*@11) */
+  w38 *= w11;
+  /* #280: @50 = (@26*@42) */
+  w50 = (w26*w42);
+  /* #281: @38 = (@38+@50) */
+  w38 += w50;
+  /* #282: @43 = (@43-@38) */
+  w43 -= w38;
+  /* #283: @43 = (@43*@27) */
+  w43 *= w27;
+  /* #284: @43 = (@43*@13) */
+  w43 *= w13;
+  /* #285: @43 = (@43*@0) */
+  w43 *= w0;
+  /* #286: @45 = (@28*@45) */
+  w45 = (w28*w45);
+  /* #287: @43 = (@43+@45) */
+  w43 += w45;
+  /* #288: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #289: @45 = (@9*@42) */
+  w45 = (w9*w42);
+  /* #290: @46 = (@46+@45) */
+  w46 += w45;
+  /* #291: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #292: @41 = (@30*@41) */
+  w41 = (w30*w41);
+  /* #293: @46 = (@46+@41) */
+  w46 += w41;
+  /* #294: @49 = (@49+@46) */
+  w49 += w46;
+  /* #295: @49 = (@49*@27) */
+  w49 *= w27;
+  /* #296: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #297: @49 = (@49*@1) */
+  w49 *= w1;
+  /* #298: @39 = (@32*@39) */
+  w39 = (w32*w39);
+  /* #299: @49 = (@49+@39) */
+  w49 += w39;
+  /* #300: @43 = (@43-@49) */
+  w43 -= w49;
+  /* #301: @49 = (@36*@11) */
+  w49 = (w36*w11);
+  /* #302: @42 = (@15*@42) */
+  w42 = (w15*w42);
+  /* #303: @49 = (@49+@42) */
+  w49 += w42;
+  /* #304: @49 = (@49*@27) */
+  w49 *= w27;
+  /* #305: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #306: @49 = (@49*@2) */
+  w49 *= w2;
+  /* #307: @48 = (@34*@48) */
+  w48 = (w34*w48);
+  /* #308: @49 = (@49+@48) */
+  w49 += w48;
+  /* #309: @43 = (@43-@49) */
+  w43 -= w49;
+  /* #310: @47 = (@47-@43) */
+  w47 -= w43;
+  /* #311: output[1][12] = @47 */
+  if (res[1]) res[1][12] = w47;
+  /* #312: @36 = (@36*@4) */
+  w36 *= w4;
+  /* #313: @44 = (@15*@44) */
+  w44 = (w15*w44);
+  /* #314: @36 = (@36+@44) */
+  w36 += w44;
+  /* #315: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #316: output[1][13] = @36 */
+  if (res[1]) res[1][13] = w36;
+  /* #317: @40 = (-@40) */
+  w40 = (- w40 );
+  /* #318: @40 = (@40/@3) */
+  w40 /= w3;
+  /* #319: output[1][14] = @40 */
+  if (res[1]) res[1][14] = w40;
+  /* #320: @37 = (-@37) */
+  w37 = (- w37 );
+  /* #321: @37 = (@37/@8) */
+  w37 /= w8;
+  /* #322: output[1][15] = @37 */
+  if (res[1]) res[1][15] = w37;
+  /* #323: @37 = input[1][21] */
+  w37 = arg[1] ? arg[1][21] : 0;
+  /* #324: output[1][16] = @37 */
+  if (res[1]) res[1][16] = w37;
+  /* #325: @40 = input[1][22] */
+  w40 = arg[1] ? arg[1][22] : 0;
+  /* #326: output[1][17] = @40 */
+  if (res[1]) res[1][17] = w40;
+  /* #327: @36 = input[1][23] */
+  w36 = arg[1] ? arg[1][23] : 0;
+  /* #328: output[1][18] = @36 */
+  if (res[1]) res[1][18] = w36;
+  /* #329: @44 = input[1][24] */
+  w44 = arg[1] ? arg[1][24] : 0;
+  /* #330: @47 = (@11*@44) */
+  w47 = (w11*w44);
+  /* #331: @47 = (-@47) */
+  w47 = (- w47 );
+  /* #332: @43 = (@47*@6) */
+  w43 = (w47*w6);
+  /* #333: @49 = input[1][26] */
+  w49 = arg[1] ? arg[1][26] : 0;
+  /* #334: @48 = (@5*@49) */
+  w48 = (w5*w49);
+  /* #335: @48 = (-@48) */
+  w48 = (- w48 );
+  /* #336: @42 = (@4*@48) */
+  w42 = (w4*w48);
+  /* #337: @43 = (@43+@42) */
+  w43 += w42;
+  /* #338: @42 = (@43*@9) */
+  w42 = (w43*w9);
+  /* #339: @39 = input[1][25] */
+  w39 = arg[1] ? arg[1][25] : 0;
+  /* #340: @46 = (@15*@39) */
+  w46 = (w15*w39);
+  /* #341: @41 = (@7*@46) */
+  w41 = (w7*w46);
+  /* #342: @42 = (@42+@41) */
+  w42 += w41;
+  /* #343: @41 = (@4*@44) */
+  w41 = (w4*w44);
+  /* #344: @45 = (@41*@5) */
+  w45 = (w41*w5);
+  /* #345: @49 = (@6*@49) */
+  w49 = (w6*w49);
+  /* #346: @38 = (@11*@49) */
+  w38 = (w11*w49);
+  /* #347: @45 = (@45+@38) */
+  w45 += w38;
+  /* #348: @42 = (@42+@45) */
+  w42 += w45;
+  /* #349: @42 = (@42*@13) */
+  w42 *= w13;
+  /* #350: @45 = (@9*@39) */
+  w45 = (w9*w39);
+  /* #351: @45 = (-@45) */
+  w45 = (- w45 );
+  /* #352: @38 = (@45*@6) */
+  w38 = (w45*w6);
+  /* #353: @50 = (@15*@48) */
+  w50 = (w15*w48);
+  /* #354: @38 = (@38+@50) */
+  w38 += w50;
+  /* #355: @38 = (@38*@17) */
+  w38 *= w17;
+  /* #356: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #357: @38 = (@38*@0) */
+  w38 *= w0;
+  /* #358: @50 = (@18*@37) */
+  w50 = (w18*w37);
+  /* #359: @38 = (@38+@50) */
+  w38 += w50;
+  /* #360: @50 = (@45*@5) */
+  w50 = (w45*w5);
+  /* #361: @51 = (@15*@49) */
+  w51 = (w15*w49);
+  /* #362: @50 = (@50+@51) */
+  w50 += w51;
+  /* #363: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #364: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #365: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #366: @51 = (@21*@40) */
+  w51 = (w21*w40);
+  /* #367: @50 = (@50+@51) */
+  w50 += w51;
+  /* #368: @38 = (@38-@50) */
+  w38 -= w50;
+  /* #369: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #370: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #371: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #372: @51 = (@23*@36) */
+  w51 = (w23*w36);
+  /* #373: @50 = (@50+@51) */
+  w50 += w51;
+  /* #374: @38 = (@38+@50) */
+  w38 += w50;
+  /* #375: @42 = (@42-@38) */
+  w42 -= w38;
+  /* #376: output[1][19] = @42 */
+  if (res[1]) res[1][19] = w42;
+  /* #377: @42 = (@47*@9) */
+  w42 = (w47*w9);
+  /* #378: @38 = (@4*@46) */
+  w38 = (w4*w46);
+  /* #379: @42 = (@42+@38) */
+  w42 += w38;
+  /* #380: @42 = (@42*@5) */
+  w42 *= w5;
+  /* #381: @38 = (@14*@49) */
+  w38 = (w14*w49);
+  /* #382: @42 = (@42+@38) */
+  w42 += w38;
+  /* #383: @38 = (@48*@11) */
+  w38 = (w48*w11);
+  /* #384: @50 = (@6*@41) */
+  w50 = (w6*w41);
+  /* #385: @38 = (@38+@50) */
+  w38 += w50;
+  /* #386: @42 = (@42-@38) */
+  w42 -= w38;
+  /* #387: @42 = (@42*@13) */
+  w42 *= w13;
+  /* #388: @38 = (@47*@5) */
+  w38 = (w47*w5);
+  /* #389: @50 = (@4*@49) */
+  w50 = (w4*w49);
+  /* #390: @38 = (@38+@50) */
+  w38 += w50;
+  /* #391: @48 = (@48*@9) */
+  w48 *= w9;
+  /* #392: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #393: @48 = (@48+@50) */
+  w48 += w50;
+  /* #394: @48 = (@48*@11) */
+  w48 *= w11;
+  /* #395: @50 = (@26*@41) */
+  w50 = (w26*w41);
+  /* #396: @48 = (@48+@50) */
+  w48 += w50;
+  /* #397: @38 = (@38-@48) */
   w38 -= w48;
-  /* #1401: @57 = (@57*@95) */
-  w57 *= w95;
-  /* #1402: @57 = (@2*@57) */
-  w57  = (w2*w57);
-  /* #1403: @38 = (@38-@57) */
-  w38 -= w57;
-  /* #1404: @31 = (@31-@38) */
-  w31 -= w38;
-  /* #1405: @60 = (@60*@95) */
-  w60 *= w95;
-  /* #1406: @95 = 3.07125 */
-  w95 = 3.0712530712530715e+00;
-  /* #1407: @34 = (@34*@75) */
-  w34 *= w75;
-  /* #1408: @95 = (@95*@34) */
-  w95 *= w34;
-  /* #1409: @34 = 3.07787 */
-  w34 = 3.0778701138811941e+00;
-  /* #1410: @61 = (@61*@76) */
-  w61 *= w76;
-  /* #1411: @34 = (@34*@61) */
-  w34 *= w61;
-  /* #1412: @118 = 00 */
-  /* #1413: @119 = vertcat(@114, @115, @116, @10, @31, @60, @95, @34, @118) */
-  rr=w119;
-  *rr++ = w10;
-  *rr++ = w31;
-  *rr++ = w60;
-  *rr++ = w95;
-  *rr++ = w34;
-  /* #1414: @120 = @119[:5] */
-  for (rr=w120, ss=w119+0; ss!=w119+5; ss+=1) *rr++ = *ss;
-  /* #1415: (@113[:5] = @120) */
-  for (rr=w113+0, ss=w120; rr!=w113+5; rr+=1) *rr = *ss++;
-  /* #1416: @120 = @113' */
-  casadi_trans(w113,casadi_s1, w120, casadi_s0, iw);
-  /* #1417: @121 = project(@120) */
-  casadi_project(w120, casadi_s0, w121, casadi_s2, w);
-  /* #1418: @122 = input[2][0] */
-  casadi_copy(arg[2], 27, w122);
-  /* #1419: {@73, @72, @71} = horzsplit(@122) */
-  casadi_copy(w122, 9, w73);
-  casadi_copy(w122+9, 9, w72);
-  casadi_copy(w122+18, 9, w71);
-  /* #1420: {NULL, NULL, NULL, @10, @31, @60, @95, @34, @61} = vertsplit(@73) */
-  w10 = w73[3];
-  w31 = w73[4];
-  w60 = w73[5];
-  w95 = w73[6];
-  w34 = w73[7];
-  w61 = w73[8];
-  /* #1421: @76 = sin(@5) */
-  w76 = sin( w5 );
-  /* #1422: @75 = (@76*@61) */
-  w75  = (w76*w61);
-  /* #1423: @75 = (@4*@75) */
-  w75  = (w4*w75);
-  /* #1424: @75 = (-@75) */
-  w75 = (- w75 );
-  /* #1425: @38 = sin(@3) */
-  w38 = sin( w3 );
-  /* #1426: @57 = (@38*@95) */
-  w57  = (w38*w95);
-  /* #1427: @57 = (@6*@57) */
-  w57  = (w6*w57);
-  /* #1428: @75 = (@75-@57) */
-  w75 -= w57;
-  /* #1429: @75 = (@9*@75) */
-  w75  = (w9*w75);
-  /* #1430: @57 = cos(@8) */
-  w57 = cos( w8 );
-  /* #1431: @48 = (@57*@34) */
-  w48  = (w57*w34);
-  /* #1432: @48 = (@7*@48) */
-  w48  = (w7*w48);
-  /* #1433: @75 = (@75+@48) */
-  w75 += w48;
-  /* #1434: @48 = cos(@3) */
-  w48 = cos( w3 );
-  /* #1435: @18 = (@48*@95) */
-  w18  = (w48*w95);
-  /* #1436: @18 = (@12*@18) */
-  w18  = (w12*w18);
-  /* #1437: @27 = cos(@5) */
-  w27 = cos( w5 );
-  /* #1438: @24 = (@27*@61) */
-  w24  = (w27*w61);
-  /* #1439: @24 = (@11*@24) */
-  w24  = (w11*w24);
-  /* #1440: @18 = (@18+@24) */
-  w18 += w24;
-  /* #1441: @75 = (@75+@18) */
-  w75 += w18;
-  /* #1442: @75 = (@13*@75) */
-  w75  = (w13*w75);
-  /* #1443: @18 = sin(@5) */
-  w18 = sin( w5 );
-  /* #1444: @24 = (@18*@61) */
-  w24  = (w18*w61);
-  /* #1445: @24 = (@16*@24) */
-  w24  = (w16*w24);
-  /* #1446: @24 = (-@24) */
-  w24 = (- w24 );
-  /* #1447: @106 = sin(@8) */
-  w106 = sin( w8 );
-  /* #1448: @85 = (@106*@34) */
-  w85  = (w106*w34);
-  /* #1449: @85 = (@17*@85) */
-  w85  = (w17*w85);
-  /* #1450: @24 = (@24-@85) */
-  w24 -= w85;
-  /* #1451: @24 = (@15*@24) */
-  w24  = (w15*w24);
-  /* #1452: @24 = (@13*@24) */
-  w24  = (w13*w24);
-  /* #1453: @24 = (@0*@24) */
-  w24  = (w0*w24);
-  /* #1454: @85 = (@19*@10) */
-  w85  = (w19*w10);
-  /* #1455: @24 = (@24+@85) */
-  w24 += w85;
-  /* #1456: @85 = cos(@5) */
-  w85 = cos( w5 );
-  /* #1457: @63 = (@85*@61) */
-  w63  = (w85*w61);
-  /* #1458: @63 = (@22*@63) */
-  w63  = (w22*w63);
-  /* #1459: @79 = sin(@8) */
-  w79 = sin( w8 );
-  /* #1460: @93 = (@79*@34) */
-  w93  = (w79*w34);
-  /* #1461: @93 = (@23*@93) */
-  w93  = (w23*w93);
-  /* #1462: @63 = (@63-@93) */
-  w63 -= w93;
-  /* #1463: @63 = (@21*@63) */
-  w63  = (w21*w63);
-  /* #1464: @63 = (@13*@63) */
-  w63  = (w13*w63);
-  /* #1465: @63 = (@1*@63) */
-  w63  = (w1*w63);
-  /* #1466: @93 = (@25*@31) */
-  w93  = (w25*w31);
-  /* #1467: @63 = (@63+@93) */
-  w63 += w93;
-  /* #1468: @24 = (@24-@63) */
-  w24 -= w63;
-  /* #1469: @63 = cos(@8) */
-  w63 = cos( w8 );
-  /* #1470: @93 = (@63*@34) */
-  w93  = (w63*w34);
-  /* #1471: @93 = (@26*@93) */
-  w93  = (w26*w93);
-  /* #1472: @93 = (@13*@93) */
-  w93  = (w13*w93);
-  /* #1473: @93 = (@2*@93) */
-  w93  = (w2*w93);
-  /* #1474: @98 = (@28*@60) */
-  w98  = (w28*w60);
-  /* #1475: @93 = (@93+@98) */
-  w93 += w98;
-  /* #1476: @24 = (@24+@93) */
-  w24 += w93;
-  /* #1477: @75 = (@75-@24) */
-  w75 -= w24;
-  /* #1478: @24 = cos(@8) */
-  w24 = cos( w8 );
-  /* #1479: @93 = (@24*@34) */
-  w93  = (w24*w34);
-  /* #1480: @93 = (@14*@93) */
-  w93  = (w14*w93);
-  /* #1481: @98 = sin(@3) */
-  w98 = sin( w3 );
-  /* #1482: @77 = (@98*@95) */
-  w77  = (w98*w95);
-  /* #1483: @77 = (@20*@77) */
-  w77  = (w20*w77);
-  /* #1484: @93 = (@93-@77) */
-  w93 -= w77;
-  /* #1485: @93 = (@30*@93) */
-  w93  = (w30*w93);
-  /* #1486: @77 = cos(@5) */
-  w77 = cos( w5 );
-  /* #1487: @103 = (@77*@61) */
-  w103  = (w77*w61);
-  /* #1488: @103 = (@29*@103) */
-  w103  = (w29*w103);
-  /* #1489: @93 = (@93+@103) */
-  w93 += w103;
-  /* #1490: @103 = cos(@3) */
-  w103 = cos( w3 );
-  /* #1491: @62 = (@103*@95) */
-  w62  = (w103*w95);
-  /* #1492: @62 = (@32*@62) */
-  w62  = (w32*w62);
-  /* #1493: @74 = sin(@5) */
-  w74 = sin( w5 );
-  /* #1494: @102 = (@74*@61) */
-  w102  = (w74*w61);
-  /* #1495: @102 = (@33*@102) */
-  w102  = (w33*w102);
-  /* #1496: @62 = (@62-@102) */
-  w62 -= w102;
-  /* #1497: @93 = (@93-@62) */
-  w93 -= w62;
-  /* #1498: @93 = (@13*@93) */
-  w93  = (w13*w93);
-  /* #1499: @62 = cos(@5) */
-  w62 = cos( w5 );
-  /* #1500: @102 = (@62*@61) */
-  w102  = (w62*w61);
-  /* #1501: @102 = (@36*@102) */
-  w102  = (w36*w102);
-  /* #1502: @105 = sin(@3) */
-  w105 = sin( w3 );
-  /* #1503: @108 = (@105*@95) */
-  w108  = (w105*w95);
-  /* #1504: @108 = (@37*@108) */
-  w108  = (w37*w108);
-  /* #1505: @102 = (@102-@108) */
-  w102 -= w108;
-  /* #1506: @108 = cos(@8) */
-  w108 = cos( w8 );
-  /* #1507: @104 = (@108*@34) */
-  w104  = (w108*w34);
-  /* #1508: @104 = (@39*@104) */
-  w104  = (w39*w104);
-  /* #1509: @101 = sin(@5) */
-  w101 = sin( w5 );
-  /* #1510: @107 = (@101*@61) */
-  w107  = (w101*w61);
-  /* #1511: @107 = (@40*@107) */
-  w107  = (w40*w107);
-  /* #1512: @104 = (@104-@107) */
-  w104 -= w107;
-  /* #1513: @104 = (@42*@104) */
-  w104  = (w42*w104);
-  /* #1514: @107 = cos(@3) */
-  w107 = cos( w3 );
-  /* #1515: @97 = (@107*@95) */
-  w97  = (w107*w95);
-  /* #1516: @97 = (@41*@97) */
-  w97  = (w41*w97);
-  /* #1517: @104 = (@104+@97) */
-  w104 += w97;
-  /* #1518: @102 = (@102-@104) */
-  w102 -= w104;
-  /* #1519: @102 = (@35*@102) */
-  w102  = (w35*w102);
-  /* #1520: @102 = (@13*@102) */
-  w102  = (w13*w102);
-  /* #1521: @102 = (@0*@102) */
-  w102  = (w0*w102);
-  /* #1522: @104 = (@43*@10) */
-  w104  = (w43*w10);
-  /* #1523: @102 = (@102+@104) */
-  w102 += w104;
-  /* #1524: @104 = sin(@5) */
-  w104 = sin( w5 );
-  /* #1525: @97 = (@104*@61) */
-  w97  = (w104*w61);
-  /* #1526: @97 = (@46*@97) */
-  w97  = (w46*w97);
-  /* #1527: @97 = (-@97) */
-  w97 = (- w97 );
-  /* #1528: @100 = sin(@3) */
-  w100 = sin( w3 );
-  /* #1529: @99 = (@100*@95) */
-  w99  = (w100*w95);
-  /* #1530: @99 = (@47*@99) */
-  w99  = (w47*w99);
-  /* #1531: @97 = (@97-@99) */
-  w97 -= w99;
-  /* #1532: @99 = cos(@8) */
-  w99 = cos( w8 );
-  /* #1533: @96 = (@99*@34) */
-  w96  = (w99*w34);
-  /* #1534: @96 = (@50*@96) */
-  w96  = (w50*w96);
-  /* #1535: @92 = cos(@3) */
-  w92 = cos( w3 );
-  /* #1536: @94 = (@92*@95) */
-  w94  = (w92*w95);
-  /* #1537: @94 = (@49*@94) */
-  w94  = (w49*w94);
-  /* #1538: @96 = (@96+@94) */
-  w96 += w94;
-  /* #1539: @96 = (@52*@96) */
-  w96  = (w52*w96);
-  /* #1540: @5 = cos(@5) */
-  w5 = cos( w5 );
-  /* #1541: @61 = (@5*@61) */
-  w61  = (w5*w61);
-  /* #1542: @61 = (@51*@61) */
-  w61  = (w51*w61);
-  /* #1543: @96 = (@96+@61) */
-  w96 += w61;
-  /* #1544: @97 = (@97+@96) */
-  w97 += w96;
-  /* #1545: @97 = (@45*@97) */
-  w97  = (w45*w97);
-  /* #1546: @97 = (@13*@97) */
-  w97  = (w13*w97);
-  /* #1547: @97 = (@1*@97) */
-  w97  = (w1*w97);
-  /* #1548: @96 = (@53*@31) */
-  w96  = (w53*w31);
-  /* #1549: @97 = (@97+@96) */
-  w97 += w96;
-  /* #1550: @102 = (@102-@97) */
-  w102 -= w97;
-  /* #1551: @97 = cos(@3) */
-  w97 = cos( w3 );
-  /* #1552: @96 = (@97*@95) */
-  w96  = (w97*w95);
-  /* #1553: @96 = (@55*@96) */
-  w96  = (w55*w96);
-  /* #1554: @61 = sin(@8) */
-  w61 = sin( w8 );
-  /* #1555: @94 = (@61*@34) */
-  w94  = (w61*w34);
-  /* #1556: @94 = (@56*@94) */
-  w94  = (w56*w94);
-  /* #1557: @96 = (@96-@94) */
-  w96 -= w94;
-  /* #1558: @96 = (@54*@96) */
-  w96  = (w54*w96);
-  /* #1559: @96 = (@13*@96) */
-  w96  = (w13*w96);
-  /* #1560: @96 = (@2*@96) */
-  w96  = (w2*w96);
-  /* #1561: @94 = (@58*@60) */
-  w94  = (w58*w60);
-  /* #1562: @96 = (@96+@94) */
-  w96 += w94;
-  /* #1563: @102 = (@102-@96) */
-  w102 -= w96;
-  /* #1564: @93 = (@93-@102) */
-  w93 -= w102;
-  /* #1565: @3 = sin(@3) */
-  w3 = sin( w3 );
-  /* #1566: @102 = (@3*@95) */
-  w102  = (w3*w95);
-  /* #1567: @102 = (@44*@102) */
-  w102  = (w44*w102);
-  /* #1568: @102 = (-@102) */
-  w102 = (- w102 );
-  /* #1569: @8 = sin(@8) */
-  w8 = sin( w8 );
-  /* #1570: @96 = (@8*@34) */
-  w96  = (w8*w34);
-  /* #1571: @96 = (@59*@96) */
-  w96  = (w59*w96);
-  /* #1572: @102 = (@102-@96) */
-  w102 -= w96;
-  /* #1573: @102 = (@13*@102) */
-  w102  = (w13*w102);
-  /* #1574: @96 = 3.07125 */
-  w96 = 3.0712530712530715e+00;
-  /* #1575: @95 = (@96*@95) */
-  w95  = (w96*w95);
-  /* #1576: @95 = (-@95) */
-  w95 = (- w95 );
-  /* #1577: @94 = 3.07787 */
-  w94 = 3.0778701138811941e+00;
-  /* #1578: @34 = (@94*@34) */
-  w34  = (w94*w34);
-  /* #1579: @34 = (-@34) */
-  w34 = (- w34 );
-  /* #1580: @114 = 00 */
-  /* #1581: @123 = vertcat(@10, @31, @60, @75, @93, @102, @95, @34, @114) */
-  rr=w123;
-  *rr++ = w10;
-  *rr++ = w31;
-  *rr++ = w60;
-  *rr++ = w75;
-  *rr++ = w93;
-  *rr++ = w102;
-  *rr++ = w95;
-  *rr++ = w34;
-  /* #1582: {NULL, NULL, NULL, @10, @31, @60, @75, @93, @102} = vertsplit(@72) */
-  w10 = w72[3];
-  w31 = w72[4];
-  w60 = w72[5];
-  w75 = w72[6];
-  w93 = w72[7];
-  w102 = w72[8];
-  /* #1583: @95 = (@76*@102) */
-  w95  = (w76*w102);
-  /* #1584: @95 = (@4*@95) */
-  w95  = (w4*w95);
-  /* #1585: @95 = (-@95) */
-  w95 = (- w95 );
-  /* #1586: @34 = (@38*@75) */
-  w34  = (w38*w75);
-  /* #1587: @34 = (@6*@34) */
-  w34  = (w6*w34);
-  /* #1588: @95 = (@95-@34) */
-  w95 -= w34;
-  /* #1589: @95 = (@9*@95) */
-  w95  = (w9*w95);
-  /* #1590: @34 = (@57*@93) */
-  w34  = (w57*w93);
-  /* #1591: @34 = (@7*@34) */
-  w34  = (w7*w34);
-  /* #1592: @95 = (@95+@34) */
-  w95 += w34;
-  /* #1593: @34 = (@48*@75) */
-  w34  = (w48*w75);
-  /* #1594: @34 = (@12*@34) */
-  w34  = (w12*w34);
-  /* #1595: @91 = (@27*@102) */
-  w91  = (w27*w102);
-  /* #1596: @91 = (@11*@91) */
-  w91  = (w11*w91);
-  /* #1597: @34 = (@34+@91) */
-  w34 += w91;
-  /* #1598: @95 = (@95+@34) */
-  w95 += w34;
-  /* #1599: @95 = (@13*@95) */
-  w95  = (w13*w95);
-  /* #1600: @34 = (@18*@102) */
-  w34  = (w18*w102);
-  /* #1601: @34 = (@16*@34) */
-  w34  = (w16*w34);
-  /* #1602: @34 = (-@34) */
-  w34 = (- w34 );
-  /* #1603: @91 = (@106*@93) */
-  w91  = (w106*w93);
-  /* #1604: @91 = (@17*@91) */
-  w91  = (w17*w91);
-  /* #1605: @34 = (@34-@91) */
-  w34 -= w91;
-  /* #1606: @34 = (@15*@34) */
-  w34  = (w15*w34);
-  /* #1607: @34 = (@13*@34) */
-  w34  = (w13*w34);
-  /* #1608: @34 = (@0*@34) */
-  w34  = (w0*w34);
-  /* #1609: @91 = (@19*@10) */
-  w91  = (w19*w10);
-  /* #1610: @34 = (@34+@91) */
-  w34 += w91;
-  /* #1611: @91 = (@85*@102) */
-  w91  = (w85*w102);
-  /* #1612: @91 = (@22*@91) */
-  w91  = (w22*w91);
-  /* #1613: @90 = (@79*@93) */
-  w90  = (w79*w93);
-  /* #1614: @90 = (@23*@90) */
-  w90  = (w23*w90);
-  /* #1615: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1616: @91 = (@21*@91) */
-  w91  = (w21*w91);
-  /* #1617: @91 = (@13*@91) */
-  w91  = (w13*w91);
-  /* #1618: @91 = (@1*@91) */
-  w91  = (w1*w91);
-  /* #1619: @90 = (@25*@31) */
-  w90  = (w25*w31);
-  /* #1620: @91 = (@91+@90) */
-  w91 += w90;
-  /* #1621: @34 = (@34-@91) */
-  w34 -= w91;
-  /* #1622: @91 = (@63*@93) */
-  w91  = (w63*w93);
-  /* #1623: @91 = (@26*@91) */
-  w91  = (w26*w91);
-  /* #1624: @91 = (@13*@91) */
-  w91  = (w13*w91);
-  /* #1625: @91 = (@2*@91) */
-  w91  = (w2*w91);
-  /* #1626: @90 = (@28*@60) */
-  w90  = (w28*w60);
-  /* #1627: @91 = (@91+@90) */
-  w91 += w90;
-  /* #1628: @34 = (@34+@91) */
-  w34 += w91;
-  /* #1629: @95 = (@95-@34) */
-  w95 -= w34;
-  /* #1630: @34 = (@24*@93) */
-  w34  = (w24*w93);
-  /* #1631: @34 = (@14*@34) */
-  w34  = (w14*w34);
-  /* #1632: @91 = (@98*@75) */
-  w91  = (w98*w75);
-  /* #1633: @91 = (@20*@91) */
-  w91  = (w20*w91);
-  /* #1634: @34 = (@34-@91) */
-  w34 -= w91;
-  /* #1635: @34 = (@30*@34) */
-  w34  = (w30*w34);
-  /* #1636: @91 = (@77*@102) */
-  w91  = (w77*w102);
-  /* #1637: @91 = (@29*@91) */
-  w91  = (w29*w91);
-  /* #1638: @34 = (@34+@91) */
-  w34 += w91;
-  /* #1639: @91 = (@103*@75) */
-  w91  = (w103*w75);
-  /* #1640: @91 = (@32*@91) */
-  w91  = (w32*w91);
-  /* #1641: @90 = (@74*@102) */
-  w90  = (w74*w102);
-  /* #1642: @90 = (@33*@90) */
-  w90  = (w33*w90);
-  /* #1643: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1644: @34 = (@34-@91) */
-  w34 -= w91;
-  /* #1645: @34 = (@13*@34) */
-  w34  = (w13*w34);
-  /* #1646: @91 = (@62*@102) */
-  w91  = (w62*w102);
-  /* #1647: @91 = (@36*@91) */
-  w91  = (w36*w91);
-  /* #1648: @90 = (@105*@75) */
-  w90  = (w105*w75);
-  /* #1649: @90 = (@37*@90) */
-  w90  = (w37*w90);
-  /* #1650: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1651: @90 = (@108*@93) */
-  w90  = (w108*w93);
-  /* #1652: @90 = (@39*@90) */
-  w90  = (w39*w90);
-  /* #1653: @78 = (@101*@102) */
-  w78  = (w101*w102);
-  /* #1654: @78 = (@40*@78) */
-  w78  = (w40*w78);
-  /* #1655: @90 = (@90-@78) */
-  w90 -= w78;
-  /* #1656: @90 = (@42*@90) */
-  w90  = (w42*w90);
-  /* #1657: @78 = (@107*@75) */
-  w78  = (w107*w75);
-  /* #1658: @78 = (@41*@78) */
-  w78  = (w41*w78);
-  /* #1659: @90 = (@90+@78) */
-  w90 += w78;
-  /* #1660: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1661: @91 = (@35*@91) */
-  w91  = (w35*w91);
-  /* #1662: @91 = (@13*@91) */
-  w91  = (w13*w91);
-  /* #1663: @91 = (@0*@91) */
-  w91  = (w0*w91);
-  /* #1664: @90 = (@43*@10) */
-  w90  = (w43*w10);
-  /* #1665: @91 = (@91+@90) */
-  w91 += w90;
-  /* #1666: @90 = (@104*@102) */
-  w90  = (w104*w102);
-  /* #1667: @90 = (@46*@90) */
-  w90  = (w46*w90);
-  /* #1668: @90 = (-@90) */
-  w90 = (- w90 );
-  /* #1669: @78 = (@100*@75) */
-  w78  = (w100*w75);
-  /* #1670: @78 = (@47*@78) */
-  w78  = (w47*w78);
-  /* #1671: @90 = (@90-@78) */
-  w90 -= w78;
-  /* #1672: @78 = (@99*@93) */
-  w78  = (w99*w93);
-  /* #1673: @78 = (@50*@78) */
-  w78  = (w50*w78);
-  /* #1674: @83 = (@92*@75) */
-  w83  = (w92*w75);
-  /* #1675: @83 = (@49*@83) */
-  w83  = (w49*w83);
-  /* #1676: @78 = (@78+@83) */
-  w78 += w83;
-  /* #1677: @78 = (@52*@78) */
-  w78  = (w52*w78);
-  /* #1678: @102 = (@5*@102) */
-  w102  = (w5*w102);
-  /* #1679: @102 = (@51*@102) */
-  w102  = (w51*w102);
-  /* #1680: @78 = (@78+@102) */
-  w78 += w102;
-  /* #1681: @90 = (@90+@78) */
-  w90 += w78;
-  /* #1682: @90 = (@45*@90) */
-  w90  = (w45*w90);
-  /* #1683: @90 = (@13*@90) */
-  w90  = (w13*w90);
-  /* #1684: @90 = (@1*@90) */
-  w90  = (w1*w90);
-  /* #1685: @78 = (@53*@31) */
-  w78  = (w53*w31);
-  /* #1686: @90 = (@90+@78) */
-  w90 += w78;
-  /* #1687: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1688: @90 = (@97*@75) */
-  w90  = (w97*w75);
-  /* #1689: @90 = (@55*@90) */
-  w90  = (w55*w90);
-  /* #1690: @78 = (@61*@93) */
-  w78  = (w61*w93);
-  /* #1691: @78 = (@56*@78) */
-  w78  = (w56*w78);
-  /* #1692: @90 = (@90-@78) */
-  w90 -= w78;
-  /* #1693: @90 = (@54*@90) */
-  w90  = (w54*w90);
-  /* #1694: @90 = (@13*@90) */
-  w90  = (w13*w90);
-  /* #1695: @90 = (@2*@90) */
-  w90  = (w2*w90);
-  /* #1696: @78 = (@58*@60) */
-  w78  = (w58*w60);
-  /* #1697: @90 = (@90+@78) */
-  w90 += w78;
-  /* #1698: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1699: @34 = (@34-@91) */
-  w34 -= w91;
-  /* #1700: @91 = (@3*@75) */
-  w91  = (w3*w75);
-  /* #1701: @91 = (@44*@91) */
-  w91  = (w44*w91);
-  /* #1702: @91 = (-@91) */
-  w91 = (- w91 );
-  /* #1703: @90 = (@8*@93) */
-  w90  = (w8*w93);
-  /* #1704: @90 = (@59*@90) */
-  w90  = (w59*w90);
-  /* #1705: @91 = (@91-@90) */
-  w91 -= w90;
-  /* #1706: @91 = (@13*@91) */
-  w91  = (w13*w91);
-  /* #1707: @75 = (@96*@75) */
-  w75  = (w96*w75);
-  /* #1708: @75 = (-@75) */
-  w75 = (- w75 );
-  /* #1709: @93 = (@94*@93) */
-  w93  = (w94*w93);
-  /* #1710: @93 = (-@93) */
-  w93 = (- w93 );
-  /* #1711: @114 = 00 */
-  /* #1712: @124 = vertcat(@10, @31, @60, @95, @34, @91, @75, @93, @114) */
-  rr=w124;
-  *rr++ = w10;
-  *rr++ = w31;
-  *rr++ = w60;
-  *rr++ = w95;
-  *rr++ = w34;
-  *rr++ = w91;
-  *rr++ = w75;
-  *rr++ = w93;
-  /* #1713: {NULL, NULL, NULL, @10, @31, @60, @95, @34, @91} = vertsplit(@71) */
-  w10 = w71[3];
-  w31 = w71[4];
-  w60 = w71[5];
-  w95 = w71[6];
-  w34 = w71[7];
-  w91 = w71[8];
-  /* #1714: @76 = (@76*@91) */
-  w76 *= w91;
-  /* #1715: @4 = (@4*@76) */
-  w4 *= w76;
-  /* #1716: @4 = (-@4) */
-  w4 = (- w4 );
-  /* #1717: @38 = (@38*@95) */
-  w38 *= w95;
-  /* #1718: @6 = (@6*@38) */
-  w6 *= w38;
-  /* #1719: @4 = (@4-@6) */
-  w4 -= w6;
-  /* #1720: @9 = (@9*@4) */
-  w9 *= w4;
-  /* #1721: @57 = (@57*@34) */
-  w57 *= w34;
-  /* #1722: @7 = (@7*@57) */
-  w7 *= w57;
-  /* #1723: @9 = (@9+@7) */
-  w9 += w7;
-  /* #1724: @48 = (@48*@95) */
-  w48 *= w95;
-  /* #1725: @12 = (@12*@48) */
-  w12 *= w48;
-  /* #1726: @27 = (@27*@91) */
-  w27 *= w91;
-  /* #1727: @11 = (@11*@27) */
-  w11 *= w27;
-  /* #1728: @12 = (@12+@11) */
-  w12 += w11;
-  /* #1729: @9 = (@9+@12) */
-  w9 += w12;
-  /* #1730: @9 = (@13*@9) */
-  w9  = (w13*w9);
-  /* #1731: @18 = (@18*@91) */
-  w18 *= w91;
-  /* #1732: @16 = (@16*@18) */
-  w16 *= w18;
-  /* #1733: @16 = (-@16) */
-  w16 = (- w16 );
-  /* #1734: @106 = (@106*@34) */
-  w106 *= w34;
-  /* #1735: @17 = (@17*@106) */
-  w17 *= w106;
-  /* #1736: @16 = (@16-@17) */
-  w16 -= w17;
-  /* #1737: @15 = (@15*@16) */
-  w15 *= w16;
-  /* #1738: @15 = (@13*@15) */
-  w15  = (w13*w15);
-  /* #1739: @15 = (@0*@15) */
-  w15  = (w0*w15);
-  /* #1740: @19 = (@19*@10) */
-  w19 *= w10;
-  /* #1741: @15 = (@15+@19) */
-  w15 += w19;
-  /* #1742: @85 = (@85*@91) */
-  w85 *= w91;
-  /* #1743: @22 = (@22*@85) */
-  w22 *= w85;
-  /* #1744: @79 = (@79*@34) */
-  w79 *= w34;
-  /* #1745: @23 = (@23*@79) */
-  w23 *= w79;
-  /* #1746: @22 = (@22-@23) */
-  w22 -= w23;
-  /* #1747: @21 = (@21*@22) */
-  w21 *= w22;
-  /* #1748: @21 = (@13*@21) */
-  w21  = (w13*w21);
-  /* #1749: @21 = (@1*@21) */
-  w21  = (w1*w21);
-  /* #1750: @25 = (@25*@31) */
-  w25 *= w31;
-  /* #1751: @21 = (@21+@25) */
-  w21 += w25;
-  /* #1752: @15 = (@15-@21) */
-  w15 -= w21;
-  /* #1753: @63 = (@63*@34) */
-  w63 *= w34;
-  /* #1754: @26 = (@26*@63) */
-  w26 *= w63;
-  /* #1755: @26 = (@13*@26) */
-  w26  = (w13*w26);
-  /* #1756: @26 = (@2*@26) */
-  w26  = (w2*w26);
-  /* #1757: @28 = (@28*@60) */
-  w28 *= w60;
-  /* #1758: @26 = (@26+@28) */
-  w26 += w28;
-  /* #1759: @15 = (@15+@26) */
-  w15 += w26;
-  /* #1760: @9 = (@9-@15) */
-  w9 -= w15;
-  /* #1761: @24 = (@24*@34) */
-  w24 *= w34;
-  /* #1762: @14 = (@14*@24) */
-  w14 *= w24;
-  /* #1763: @98 = (@98*@95) */
-  w98 *= w95;
-  /* #1764: @20 = (@20*@98) */
-  w20 *= w98;
-  /* #1765: @14 = (@14-@20) */
-  w14 -= w20;
-  /* #1766: @30 = (@30*@14) */
-  w30 *= w14;
-  /* #1767: @77 = (@77*@91) */
-  w77 *= w91;
-  /* #1768: @29 = (@29*@77) */
-  w29 *= w77;
-  /* #1769: @30 = (@30+@29) */
-  w30 += w29;
-  /* #1770: @103 = (@103*@95) */
-  w103 *= w95;
-  /* #1771: @32 = (@32*@103) */
-  w32 *= w103;
-  /* #1772: @74 = (@74*@91) */
-  w74 *= w91;
-  /* #1773: @33 = (@33*@74) */
-  w33 *= w74;
-  /* #1774: @32 = (@32-@33) */
-  w32 -= w33;
-  /* #1775: @30 = (@30-@32) */
-  w30 -= w32;
-  /* #1776: @30 = (@13*@30) */
-  w30  = (w13*w30);
-  /* #1777: @62 = (@62*@91) */
-  w62 *= w91;
-  /* #1778: @36 = (@36*@62) */
-  w36 *= w62;
-  /* #1779: @105 = (@105*@95) */
-  w105 *= w95;
-  /* #1780: @37 = (@37*@105) */
-  w37 *= w105;
-  /* #1781: @36 = (@36-@37) */
-  w36 -= w37;
-  /* #1782: @108 = (@108*@34) */
-  w108 *= w34;
-  /* #1783: @39 = (@39*@108) */
-  w39 *= w108;
-  /* #1784: @101 = (@101*@91) */
-  w101 *= w91;
-  /* #1785: @40 = (@40*@101) */
-  w40 *= w101;
-  /* #1786: @39 = (@39-@40) */
+  /* #398: @38 = (@38*@27) */
+  w38 *= w27;
+  /* #399: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #400: @38 = (@38*@0) */
+  w38 *= w0;
+  /* #401: @37 = (@28*@37) */
+  w37 = (w28*w37);
+  /* #402: @38 = (@38+@37) */
+  w38 += w37;
+  /* #403: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #404: @37 = (@9*@41) */
+  w37 = (w9*w41);
+  /* #405: @46 = (@46+@37) */
+  w46 += w37;
+  /* #406: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #407: @49 = (@30*@49) */
+  w49 = (w30*w49);
+  /* #408: @46 = (@46+@49) */
+  w46 += w49;
+  /* #409: @43 = (@43+@46) */
+  w43 += w46;
+  /* #410: @43 = (@43*@27) */
+  w43 *= w27;
+  /* #411: @43 = (@43*@13) */
+  w43 *= w13;
+  /* #412: @43 = (@43*@1) */
+  w43 *= w1;
+  /* #413: @40 = (@32*@40) */
+  w40 = (w32*w40);
+  /* #414: @43 = (@43+@40) */
+  w43 += w40;
+  /* #415: @38 = (@38-@43) */
+  w38 -= w43;
+  /* #416: @43 = (@45*@11) */
+  w43 = (w45*w11);
+  /* #417: @41 = (@15*@41) */
+  w41 = (w15*w41);
+  /* #418: @43 = (@43+@41) */
+  w43 += w41;
+  /* #419: @43 = (@43*@27) */
+  w43 *= w27;
+  /* #420: @43 = (@43*@13) */
+  w43 *= w13;
+  /* #421: @43 = (@43*@2) */
+  w43 *= w2;
+  /* #422: @36 = (@34*@36) */
+  w36 = (w34*w36);
+  /* #423: @43 = (@43+@36) */
+  w43 += w36;
+  /* #424: @38 = (@38-@43) */
+  w38 -= w43;
+  /* #425: @42 = (@42-@38) */
+  w42 -= w38;
+  /* #426: output[1][20] = @42 */
+  if (res[1]) res[1][20] = w42;
+  /* #427: @45 = (@45*@4) */
+  w45 *= w4;
+  /* #428: @47 = (@15*@47) */
+  w47 = (w15*w47);
+  /* #429: @45 = (@45+@47) */
+  w45 += w47;
+  /* #430: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #431: output[1][21] = @45 */
+  if (res[1]) res[1][21] = w45;
+  /* #432: @44 = (-@44) */
+  w44 = (- w44 );
+  /* #433: @44 = (@44/@3) */
+  w44 /= w3;
+  /* #434: output[1][22] = @44 */
+  if (res[1]) res[1][22] = w44;
+  /* #435: @39 = (-@39) */
+  w39 = (- w39 );
+  /* #436: @39 = (@39/@8) */
+  w39 /= w8;
+  /* #437: output[1][23] = @39 */
+  if (res[1]) res[1][23] = w39;
+  /* #438: @39 = input[1][30] */
+  w39 = arg[1] ? arg[1][30] : 0;
+  /* #439: output[1][24] = @39 */
+  if (res[1]) res[1][24] = w39;
+  /* #440: @44 = input[1][31] */
+  w44 = arg[1] ? arg[1][31] : 0;
+  /* #441: output[1][25] = @44 */
+  if (res[1]) res[1][25] = w44;
+  /* #442: @45 = input[1][32] */
+  w45 = arg[1] ? arg[1][32] : 0;
+  /* #443: output[1][26] = @45 */
+  if (res[1]) res[1][26] = w45;
+  /* #444: @47 = input[1][33] */
+  w47 = arg[1] ? arg[1][33] : 0;
+  /* #445: @42 = (@11*@47) */
+  w42 = (w11*w47);
+  /* #446: @42 = (-@42) */
+  w42 = (- w42 );
+  /* #447: @38 = (@42*@6) */
+  w38 = (w42*w6);
+  /* #448: @43 = input[1][35] */
+  w43 = arg[1] ? arg[1][35] : 0;
+  /* #449: @36 = (@5*@43) */
+  w36 = (w5*w43);
+  /* #450: @36 = (-@36) */
+  w36 = (- w36 );
+  /* #451: @41 = (@4*@36) */
+  w41 = (w4*w36);
+  /* #452: @38 = (@38+@41) */
+  w38 += w41;
+  /* #453: @41 = (@38*@9) */
+  w41 = (w38*w9);
+  /* #454: @40 = input[1][34] */
+  w40 = arg[1] ? arg[1][34] : 0;
+  /* #455: @46 = (@15*@40) */
+  w46 = (w15*w40);
+  /* #456: @49 = (@7*@46) */
+  w49 = (w7*w46);
+  /* #457: @41 = (@41+@49) */
+  w41 += w49;
+  /* #458: @49 = (@4*@47) */
+  w49 = (w4*w47);
+  /* #459: @37 = (@49*@5) */
+  w37 = (w49*w5);
+  /* #460: @43 = (@6*@43) */
+  w43 = (w6*w43);
+  /* #461: @48 = (@11*@43) */
+  w48 = (w11*w43);
+  /* #462: @37 = (@37+@48) */
+  w37 += w48;
+  /* #463: @41 = (@41+@37) */
+  w41 += w37;
+  /* #464: @41 = (@41*@13) */
+  w41 *= w13;
+  /* #465: @37 = (@9*@40) */
+  w37 = (w9*w40);
+  /* #466: @37 = (-@37) */
+  w37 = (- w37 );
+  /* #467: @48 = (@37*@6) */
+  w48 = (w37*w6);
+  /* #468: @50 = (@15*@36) */
+  w50 = (w15*w36);
+  /* #469: @48 = (@48+@50) */
+  w48 += w50;
+  /* #470: @48 = (@48*@17) */
+  w48 *= w17;
+  /* #471: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #472: @48 = (@48*@0) */
+  w48 *= w0;
+  /* #473: @50 = (@18*@39) */
+  w50 = (w18*w39);
+  /* #474: @48 = (@48+@50) */
+  w48 += w50;
+  /* #475: @50 = (@37*@5) */
+  w50 = (w37*w5);
+  /* #476: @51 = (@15*@43) */
+  w51 = (w15*w43);
+  /* #477: @50 = (@50+@51) */
+  w50 += w51;
+  /* #478: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #479: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #480: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #481: @51 = (@21*@44) */
+  w51 = (w21*w44);
+  /* #482: @50 = (@50+@51) */
+  w50 += w51;
+  /* #483: @48 = (@48-@50) */
+  w48 -= w50;
+  /* #484: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #485: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #486: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #487: @51 = (@23*@45) */
+  w51 = (w23*w45);
+  /* #488: @50 = (@50+@51) */
+  w50 += w51;
+  /* #489: @48 = (@48+@50) */
+  w48 += w50;
+  /* #490: @41 = (@41-@48) */
+  w41 -= w48;
+  /* #491: output[1][27] = @41 */
+  if (res[1]) res[1][27] = w41;
+  /* #492: @41 = (@42*@9) */
+  w41 = (w42*w9);
+  /* #493: @48 = (@4*@46) */
+  w48 = (w4*w46);
+  /* #494: @41 = (@41+@48) */
+  w41 += w48;
+  /* #495: @41 = (@41*@5) */
+  w41 *= w5;
+  /* #496: @48 = (@14*@43) */
+  w48 = (w14*w43);
+  /* #497: @41 = (@41+@48) */
+  w41 += w48;
+  /* #498: @48 = (@36*@11) */
+  w48 = (w36*w11);
+  /* #499: @50 = (@6*@49) */
+  w50 = (w6*w49);
+  /* #500: @48 = (@48+@50) */
+  w48 += w50;
+  /* #501: @41 = (@41-@48) */
+  w41 -= w48;
+  /* #502: @41 = (@41*@13) */
+  w41 *= w13;
+  /* #503: @48 = (@42*@5) */
+  w48 = (w42*w5);
+  /* #504: @50 = (@4*@43) */
+  w50 = (w4*w43);
+  /* #505: @48 = (@48+@50) */
+  w48 += w50;
+  /* #506: @36 = (@36*@9) */
+  w36 *= w9;
+  /* #507: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #508: @36 = (@36+@50) */
+  w36 += w50;
+  /* #509: @36 = (@36*@11) */
+  w36 *= w11;
+  /* #510: @50 = (@26*@49) */
+  w50 = (w26*w49);
+  /* #511: @36 = (@36+@50) */
+  w36 += w50;
+  /* #512: @48 = (@48-@36) */
+  w48 -= w36;
+  /* #513: @48 = (@48*@27) */
+  w48 *= w27;
+  /* #514: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #515: @48 = (@48*@0) */
+  w48 *= w0;
+  /* #516: @39 = (@28*@39) */
+  w39 = (w28*w39);
+  /* #517: @48 = (@48+@39) */
+  w48 += w39;
+  /* #518: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #519: @39 = (@9*@49) */
+  w39 = (w9*w49);
+  /* #520: @46 = (@46+@39) */
+  w46 += w39;
+  /* #521: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #522: @43 = (@30*@43) */
+  w43 = (w30*w43);
+  /* #523: @46 = (@46+@43) */
+  w46 += w43;
+  /* #524: @38 = (@38+@46) */
+  w38 += w46;
+  /* #525: @38 = (@38*@27) */
+  w38 *= w27;
+  /* #526: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #527: @38 = (@38*@1) */
+  w38 *= w1;
+  /* #528: @44 = (@32*@44) */
+  w44 = (w32*w44);
+  /* #529: @38 = (@38+@44) */
+  w38 += w44;
+  /* #530: @48 = (@48-@38) */
+  w48 -= w38;
+  /* #531: @38 = (@37*@11) */
+  w38 = (w37*w11);
+  /* #532: @49 = (@15*@49) */
+  w49 = (w15*w49);
+  /* #533: @38 = (@38+@49) */
+  w38 += w49;
+  /* #534: @38 = (@38*@27) */
+  w38 *= w27;
+  /* #535: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #536: @38 = (@38*@2) */
+  w38 *= w2;
+  /* #537: @45 = (@34*@45) */
+  w45 = (w34*w45);
+  /* #538: @38 = (@38+@45) */
+  w38 += w45;
+  /* #539: @48 = (@48-@38) */
+  w48 -= w38;
+  /* #540: @41 = (@41-@48) */
+  w41 -= w48;
+  /* #541: output[1][28] = @41 */
+  if (res[1]) res[1][28] = w41;
+  /* #542: @37 = (@37*@4) */
+  w37 *= w4;
+  /* #543: @42 = (@15*@42) */
+  w42 = (w15*w42);
+  /* #544: @37 = (@37+@42) */
+  w37 += w42;
+  /* #545: @37 = (@37*@13) */
+  w37 *= w13;
+  /* #546: output[1][29] = @37 */
+  if (res[1]) res[1][29] = w37;
+  /* #547: @47 = (-@47) */
+  w47 = (- w47 );
+  /* #548: @47 = (@47/@3) */
+  w47 /= w3;
+  /* #549: output[1][30] = @47 */
+  if (res[1]) res[1][30] = w47;
+  /* #550: @40 = (-@40) */
+  w40 = (- w40 );
+  /* #551: @40 = (@40/@8) */
+  w40 /= w8;
+  /* #552: output[1][31] = @40 */
+  if (res[1]) res[1][31] = w40;
+  /* #553: @40 = input[1][39] */
+  w40 = arg[1] ? arg[1][39] : 0;
+  /* #554: output[1][32] = @40 */
+  if (res[1]) res[1][32] = w40;
+  /* #555: @47 = input[1][40] */
+  w47 = arg[1] ? arg[1][40] : 0;
+  /* #556: output[1][33] = @47 */
+  if (res[1]) res[1][33] = w47;
+  /* #557: @37 = input[1][41] */
+  w37 = arg[1] ? arg[1][41] : 0;
+  /* #558: output[1][34] = @37 */
+  if (res[1]) res[1][34] = w37;
+  /* #559: @42 = input[1][42] */
+  w42 = arg[1] ? arg[1][42] : 0;
+  /* #560: @41 = (@11*@42) */
+  w41 = (w11*w42);
+  /* #561: @41 = (-@41) */
+  w41 = (- w41 );
+  /* #562: @48 = (@41*@6) */
+  w48 = (w41*w6);
+  /* #563: @38 = input[1][44] */
+  w38 = arg[1] ? arg[1][44] : 0;
+  /* #564: @45 = (@5*@38) */
+  w45 = (w5*w38);
+  /* #565: @45 = (-@45) */
+  w45 = (- w45 );
+  /* #566: @49 = (@4*@45) */
+  w49 = (w4*w45);
+  /* #567: @48 = (@48+@49) */
+  w48 += w49;
+  /* #568: @49 = (@48*@9) */
+  w49 = (w48*w9);
+  /* #569: @44 = input[1][43] */
+  w44 = arg[1] ? arg[1][43] : 0;
+  /* #570: @46 = (@15*@44) */
+  w46 = (w15*w44);
+  /* #571: @43 = (@7*@46) */
+  w43 = (w7*w46);
+  /* #572: @49 = (@49+@43) */
+  w49 += w43;
+  /* #573: @43 = (@4*@42) */
+  w43 = (w4*w42);
+  /* #574: @39 = (@43*@5) */
+  w39 = (w43*w5);
+  /* #575: @38 = (@6*@38) */
+  w38 = (w6*w38);
+  /* #576: @36 = (@11*@38) */
+  w36 = (w11*w38);
+  /* #577: @39 = (@39+@36) */
+  w39 += w36;
+  /* #578: @49 = (@49+@39) */
+  w49 += w39;
+  /* #579: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #580: @39 = (@9*@44) */
+  w39 = (w9*w44);
+  /* #581: @39 = (-@39) */
+  w39 = (- w39 );
+  /* #582: @36 = (@39*@6) */
+  w36 = (w39*w6);
+  /* #583: @50 = (@15*@45) */
+  w50 = (w15*w45);
+  /* #584: @36 = (@36+@50) */
+  w36 += w50;
+  /* #585: @36 = (@36*@17) */
+  w36 *= w17;
+  /* #586: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #587: @36 = (@36*@0) */
+  w36 *= w0;
+  /* #588: @50 = (@18*@40) */
+  w50 = (w18*w40);
+  /* #589: @36 = (@36+@50) */
+  w36 += w50;
+  /* #590: @50 = (@39*@5) */
+  w50 = (w39*w5);
+  /* #591: @51 = (@15*@38) */
+  w51 = (w15*w38);
+  /* #592: @50 = (@50+@51) */
+  w50 += w51;
+  /* #593: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #594: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #595: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #596: @51 = (@21*@47) */
+  w51 = (w21*w47);
+  /* #597: @50 = (@50+@51) */
+  w50 += w51;
+  /* #598: @36 = (@36-@50) */
+  w36 -= w50;
+  /* #599: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #600: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #601: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #602: @51 = (@23*@37) */
+  w51 = (w23*w37);
+  /* #603: @50 = (@50+@51) */
+  w50 += w51;
+  /* #604: @36 = (@36+@50) */
+  w36 += w50;
+  /* #605: @49 = (@49-@36) */
+  w49 -= w36;
+  /* #606: output[1][35] = @49 */
+  if (res[1]) res[1][35] = w49;
+  /* #607: @49 = (@41*@9) */
+  w49 = (w41*w9);
+  /* #608: @36 = (@4*@46) */
+  w36 = (w4*w46);
+  /* #609: @49 = (@49+@36) */
+  w49 += w36;
+  /* #610: @49 = (@49*@5) */
+  w49 *= w5;
+  /* #611: @36 = (@14*@38) */
+  w36 = (w14*w38);
+  /* #612: @49 = (@49+@36) */
+  w49 += w36;
+  /* #613: @36 = (@45*@11) */
+  w36 = (w45*w11);
+  /* #614: @50 = (@6*@43) */
+  w50 = (w6*w43);
+  /* #615: @36 = (@36+@50) */
+  w36 += w50;
+  /* #616: @49 = (@49-@36) */
+  w49 -= w36;
+  /* #617: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #618: @36 = (@41*@5) */
+  w36 = (w41*w5);
+  /* #619: @50 = (@4*@38) */
+  w50 = (w4*w38);
+  /* #620: @36 = (@36+@50) */
+  w36 += w50;
+  /* #621: @45 = (@45*@9) */
+  w45 *= w9;
+  /* #622: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #623: @45 = (@45+@50) */
+  w45 += w50;
+  /* #624: @45 = (@45*@11) */
+  w45 *= w11;
+  /* #625: @50 = (@26*@43) */
+  w50 = (w26*w43);
+  /* #626: @45 = (@45+@50) */
+  w45 += w50;
+  /* #627: @36 = (@36-@45) */
+  w36 -= w45;
+  /* #628: @36 = (@36*@27) */
+  w36 *= w27;
+  /* #629: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #630: @36 = (@36*@0) */
+  w36 *= w0;
+  /* #631: @40 = (@28*@40) */
+  w40 = (w28*w40);
+  /* #632: @36 = (@36+@40) */
+  w36 += w40;
+  /* #633: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #634: @40 = (@9*@43) */
+  w40 = (w9*w43);
+  /* #635: @46 = (@46+@40) */
+  w46 += w40;
+  /* #636: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #637: @38 = (@30*@38) */
+  w38 = (w30*w38);
+  /* #638: @46 = (@46+@38) */
+  w46 += w38;
+  /* #639: @48 = (@48+@46) */
+  w48 += w46;
+  /* #640: @48 = (@48*@27) */
+  w48 *= w27;
+  /* #641: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #642: @48 = (@48*@1) */
+  w48 *= w1;
+  /* #643: @47 = (@32*@47) */
+  w47 = (w32*w47);
+  /* #644: @48 = (@48+@47) */
+  w48 += w47;
+  /* #645: @36 = (@36-@48) */
+  w36 -= w48;
+  /* #646: @48 = (@39*@11) */
+  w48 = (w39*w11);
+  /* #647: @43 = (@15*@43) */
+  w43 = (w15*w43);
+  /* #648: @48 = (@48+@43) */
+  w48 += w43;
+  /* #649: @48 = (@48*@27) */
+  w48 *= w27;
+  /* #650: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #651: @48 = (@48*@2) */
+  w48 *= w2;
+  /* #652: @37 = (@34*@37) */
+  w37 = (w34*w37);
+  /* #653: @48 = (@48+@37) */
+  w48 += w37;
+  /* #654: @36 = (@36-@48) */
+  w36 -= w48;
+  /* #655: @49 = (@49-@36) */
+  w49 -= w36;
+  /* #656: output[1][36] = @49 */
+  if (res[1]) res[1][36] = w49;
+  /* #657: @39 = (@39*@4) */
+  w39 *= w4;
+  /* #658: @41 = (@15*@41) */
+  w41 = (w15*w41);
+  /* #659: @39 = (@39+@41) */
+  w39 += w41;
+  /* #660: @39 = (@39*@13) */
+  w39 *= w13;
+  /* #661: output[1][37] = @39 */
+  if (res[1]) res[1][37] = w39;
+  /* #662: @42 = (-@42) */
+  w42 = (- w42 );
+  /* #663: @42 = (@42/@3) */
+  w42 /= w3;
+  /* #664: output[1][38] = @42 */
+  if (res[1]) res[1][38] = w42;
+  /* #665: @44 = (-@44) */
+  w44 = (- w44 );
+  /* #666: @44 = (@44/@8) */
+  w44 /= w8;
+  /* #667: output[1][39] = @44 */
+  if (res[1]) res[1][39] = w44;
+  /* #668: @44 = input[1][48] */
+  w44 = arg[1] ? arg[1][48] : 0;
+  /* #669: output[1][40] = @44 */
+  if (res[1]) res[1][40] = w44;
+  /* #670: @42 = input[1][49] */
+  w42 = arg[1] ? arg[1][49] : 0;
+  /* #671: output[1][41] = @42 */
+  if (res[1]) res[1][41] = w42;
+  /* #672: @39 = input[1][50] */
+  w39 = arg[1] ? arg[1][50] : 0;
+  /* #673: output[1][42] = @39 */
+  if (res[1]) res[1][42] = w39;
+  /* #674: @41 = input[1][51] */
+  w41 = arg[1] ? arg[1][51] : 0;
+  /* #675: @49 = (@11*@41) */
+  w49 = (w11*w41);
+  /* #676: @49 = (-@49) */
+  w49 = (- w49 );
+  /* #677: @36 = (@49*@6) */
+  w36 = (w49*w6);
+  /* #678: @48 = input[1][53] */
+  w48 = arg[1] ? arg[1][53] : 0;
+  /* #679: @37 = (@5*@48) */
+  w37 = (w5*w48);
+  /* #680: @37 = (-@37) */
+  w37 = (- w37 );
+  /* #681: @43 = (@4*@37) */
+  w43 = (w4*w37);
+  /* #682: @36 = (@36+@43) */
+  w36 += w43;
+  /* #683: @43 = (@36*@9) */
+  w43 = (w36*w9);
+  /* #684: @47 = input[1][52] */
+  w47 = arg[1] ? arg[1][52] : 0;
+  /* #685: @46 = (@15*@47) */
+  w46 = (w15*w47);
+  /* #686: @38 = (@7*@46) */
+  w38 = (w7*w46);
+  /* #687: @43 = (@43+@38) */
+  w43 += w38;
+  /* #688: @38 = (@4*@41) */
+  w38 = (w4*w41);
+  /* #689: @40 = (@38*@5) */
+  w40 = (w38*w5);
+  /* #690: @48 = (@6*@48) */
+  w48 = (w6*w48);
+  /* #691: @45 = (@11*@48) */
+  w45 = (w11*w48);
+  /* #692: @40 = (@40+@45) */
+  w40 += w45;
+  /* #693: @43 = (@43+@40) */
+  w43 += w40;
+  /* #694: @43 = (@43*@13) */
+  w43 *= w13;
+  /* #695: @40 = (@9*@47) */
+  w40 = (w9*w47);
+  /* #696: @40 = (-@40) */
+  w40 = (- w40 );
+  /* #697: @45 = (@40*@6) */
+  w45 = (w40*w6);
+  /* #698: @50 = (@15*@37) */
+  w50 = (w15*w37);
+  /* #699: @45 = (@45+@50) */
+  w45 += w50;
+  /* #700: @45 = (@45*@17) */
+  w45 *= w17;
+  /* #701: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #702: @45 = (@45*@0) */
+  w45 *= w0;
+  /* #703: @50 = (@18*@44) */
+  w50 = (w18*w44);
+  /* #704: @45 = (@45+@50) */
+  w45 += w50;
+  /* #705: @50 = (@40*@5) */
+  w50 = (w40*w5);
+  /* #706: @51 = (@15*@48) */
+  w51 = (w15*w48);
+  /* #707: @50 = (@50+@51) */
+  w50 += w51;
+  /* #708: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #709: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #710: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #711: @51 = (@21*@42) */
+  w51 = (w21*w42);
+  /* #712: @50 = (@50+@51) */
+  w50 += w51;
+  /* #713: @45 = (@45-@50) */
+  w45 -= w50;
+  /* #714: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #715: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #716: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #717: @51 = (@23*@39) */
+  w51 = (w23*w39);
+  /* #718: @50 = (@50+@51) */
+  w50 += w51;
+  /* #719: @45 = (@45+@50) */
+  w45 += w50;
+  /* #720: @43 = (@43-@45) */
+  w43 -= w45;
+  /* #721: output[1][43] = @43 */
+  if (res[1]) res[1][43] = w43;
+  /* #722: @43 = (@49*@9) */
+  w43 = (w49*w9);
+  /* #723: @45 = (@4*@46) */
+  w45 = (w4*w46);
+  /* #724: @43 = (@43+@45) */
+  w43 += w45;
+  /* #725: @43 = (@43*@5) */
+  w43 *= w5;
+  /* #726: @45 = (@14*@48) */
+  w45 = (w14*w48);
+  /* #727: @43 = (@43+@45) */
+  w43 += w45;
+  /* #728: @45 = (@37*@11) */
+  w45 = (w37*w11);
+  /* #729: @50 = (@6*@38) */
+  w50 = (w6*w38);
+  /* #730: @45 = (@45+@50) */
+  w45 += w50;
+  /* #731: @43 = (@43-@45) */
+  w43 -= w45;
+  /* #732: @43 = (@43*@13) */
+  w43 *= w13;
+  /* #733: @45 = (@49*@5) */
+  w45 = (w49*w5);
+  /* #734: @50 = (@4*@48) */
+  w50 = (w4*w48);
+  /* #735: @45 = (@45+@50) */
+  w45 += w50;
+  /* #736: @37 = (@37*@9) */
+  w37 *= w9;
+  /* #737: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #738: @37 = (@37+@50) */
+  w37 += w50;
+  /* #739: @37 = (@37*@11) */
+  w37 *= w11;
+  /* #740: @50 = (@26*@38) */
+  w50 = (w26*w38);
+  /* #741: @37 = (@37+@50) */
+  w37 += w50;
+  /* #742: @45 = (@45-@37) */
+  w45 -= w37;
+  /* #743: @45 = (@45*@27) */
+  w45 *= w27;
+  /* #744: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #745: @45 = (@45*@0) */
+  w45 *= w0;
+  /* #746: @44 = (@28*@44) */
+  w44 = (w28*w44);
+  /* #747: @45 = (@45+@44) */
+  w45 += w44;
+  /* #748: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #749: @44 = (@9*@38) */
+  w44 = (w9*w38);
+  /* #750: @46 = (@46+@44) */
+  w46 += w44;
+  /* #751: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #752: @48 = (@30*@48) */
+  w48 = (w30*w48);
+  /* #753: @46 = (@46+@48) */
+  w46 += w48;
+  /* #754: @36 = (@36+@46) */
+  w36 += w46;
+  /* #755: @36 = (@36*@27) */
+  w36 *= w27;
+  /* #756: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #757: @36 = (@36*@1) */
+  w36 *= w1;
+  /* #758: @42 = (@32*@42) */
+  w42 = (w32*w42);
+  /* #759: @36 = (@36+@42) */
+  w36 += w42;
+  /* #760: @45 = (@45-@36) */
+  w45 -= w36;
+  /* #761: @36 = (@40*@11) */
+  w36 = (w40*w11);
+  /* #762: @38 = (@15*@38) */
+  w38 = (w15*w38);
+  /* #763: @36 = (@36+@38) */
+  w36 += w38;
+  /* #764: @36 = (@36*@27) */
+  w36 *= w27;
+  /* #765: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #766: @36 = (@36*@2) */
+  w36 *= w2;
+  /* #767: @39 = (@34*@39) */
+  w39 = (w34*w39);
+  /* #768: @36 = (@36+@39) */
+  w36 += w39;
+  /* #769: @45 = (@45-@36) */
+  w45 -= w36;
+  /* #770: @43 = (@43-@45) */
+  w43 -= w45;
+  /* #771: output[1][44] = @43 */
+  if (res[1]) res[1][44] = w43;
+  /* #772: @40 = (@40*@4) */
+  w40 *= w4;
+  /* #773: @49 = (@15*@49) */
+  w49 = (w15*w49);
+  /* #774: @40 = (@40+@49) */
+  w40 += w49;
+  /* #775: @40 = (@40*@13) */
+  w40 *= w13;
+  /* #776: output[1][45] = @40 */
+  if (res[1]) res[1][45] = w40;
+  /* #777: @41 = (-@41) */
+  w41 = (- w41 );
+  /* #778: @41 = (@41/@3) */
+  w41 /= w3;
+  /* #779: output[1][46] = @41 */
+  if (res[1]) res[1][46] = w41;
+  /* #780: @47 = (-@47) */
+  w47 = (- w47 );
+  /* #781: @47 = (@47/@8) */
+  w47 /= w8;
+  /* #782: output[1][47] = @47 */
+  if (res[1]) res[1][47] = w47;
+  /* #783: @47 = input[1][57] */
+  w47 = arg[1] ? arg[1][57] : 0;
+  /* #784: output[1][48] = @47 */
+  if (res[1]) res[1][48] = w47;
+  /* #785: @41 = input[1][58] */
+  w41 = arg[1] ? arg[1][58] : 0;
+  /* #786: output[1][49] = @41 */
+  if (res[1]) res[1][49] = w41;
+  /* #787: @40 = input[1][59] */
+  w40 = arg[1] ? arg[1][59] : 0;
+  /* #788: output[1][50] = @40 */
+  if (res[1]) res[1][50] = w40;
+  /* #789: @49 = input[1][60] */
+  w49 = arg[1] ? arg[1][60] : 0;
+  /* #790: @43 = (@11*@49) */
+  w43 = (w11*w49);
+  /* #791: @43 = (-@43) */
+  w43 = (- w43 );
+  /* #792: @45 = (@43*@6) */
+  w45 = (w43*w6);
+  /* #793: @36 = input[1][62] */
+  w36 = arg[1] ? arg[1][62] : 0;
+  /* #794: @39 = (@5*@36) */
+  w39 = (w5*w36);
+  /* #795: @39 = (-@39) */
+  w39 = (- w39 );
+  /* #796: @38 = (@4*@39) */
+  w38 = (w4*w39);
+  /* #797: @45 = (@45+@38) */
+  w45 += w38;
+  /* #798: @38 = (@45*@9) */
+  w38 = (w45*w9);
+  /* #799: @42 = input[1][61] */
+  w42 = arg[1] ? arg[1][61] : 0;
+  /* #800: @46 = (@15*@42) */
+  w46 = (w15*w42);
+  /* #801: @48 = (@7*@46) */
+  w48 = (w7*w46);
+  /* #802: @38 = (@38+@48) */
+  w38 += w48;
+  /* #803: @48 = (@4*@49) */
+  w48 = (w4*w49);
+  /* #804: @44 = (@48*@5) */
+  w44 = (w48*w5);
+  /* #805: @36 = (@6*@36) */
+  w36 = (w6*w36);
+  /* #806: @37 = (@11*@36) */
+  w37 = (w11*w36);
+  /* #807: @44 = (@44+@37) */
+  w44 += w37;
+  /* #808: @38 = (@38+@44) */
+  w38 += w44;
+  /* #809: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #810: @44 = (@9*@42) */
+  w44 = (w9*w42);
+  /* #811: @44 = (-@44) */
+  w44 = (- w44 );
+  /* #812: @37 = (@44*@6) */
+  w37 = (w44*w6);
+  /* #813: @50 = (@15*@39) */
+  w50 = (w15*w39);
+  /* #814: @37 = (@37+@50) */
+  w37 += w50;
+  /* #815: @37 = (@37*@17) */
+  w37 *= w17;
+  /* #816: @37 = (@37*@13) */
+  w37 *= w13;
+  /* #817: @37 = (@37*@0) */
+  w37 *= w0;
+  /* #818: @50 = (@18*@47) */
+  w50 = (w18*w47);
+  /* #819: @37 = (@37+@50) */
+  w37 += w50;
+  /* #820: @50 = (@44*@5) */
+  w50 = (w44*w5);
+  /* #821: @51 = (@15*@36) */
+  w51 = (w15*w36);
+  /* #822: @50 = (@50+@51) */
+  w50 += w51;
+  /* #823: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #824: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #825: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #826: @51 = (@21*@41) */
+  w51 = (w21*w41);
+  /* #827: @50 = (@50+@51) */
+  w50 += w51;
+  /* #828: @37 = (@37-@50) */
+  w37 -= w50;
+  /* #829: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #830: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #831: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #832: @51 = (@23*@40) */
+  w51 = (w23*w40);
+  /* #833: @50 = (@50+@51) */
+  w50 += w51;
+  /* #834: @37 = (@37+@50) */
+  w37 += w50;
+  /* #835: @38 = (@38-@37) */
+  w38 -= w37;
+  /* #836: output[1][51] = @38 */
+  if (res[1]) res[1][51] = w38;
+  /* #837: @38 = (@43*@9) */
+  w38 = (w43*w9);
+  /* #838: @37 = (@4*@46) */
+  w37 = (w4*w46);
+  /* #839: @38 = (@38+@37) */
+  w38 += w37;
+  /* #840: @38 = (@38*@5) */
+  w38 *= w5;
+  /* #841: @37 = (@14*@36) */
+  w37 = (w14*w36);
+  /* #842: @38 = (@38+@37) */
+  w38 += w37;
+  /* #843: @37 = (@39*@11) */
+  w37 = (w39*w11);
+  /* #844: @50 = (@6*@48) */
+  w50 = (w6*w48);
+  /* #845: @37 = (@37+@50) */
+  w37 += w50;
+  /* #846: @38 = (@38-@37) */
+  w38 -= w37;
+  /* #847: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #848: @37 = (@43*@5) */
+  w37 = (w43*w5);
+  /* #849: @50 = (@4*@36) */
+  w50 = (w4*w36);
+  /* #850: @37 = (@37+@50) */
+  w37 += w50;
+  /* #851: @39 = (@39*@9) */
+  w39 *= w9;
+  /* #852: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #853: @39 = (@39+@50) */
+  w39 += w50;
+  /* #854: @39 = (@39*@11) */
+  w39 *= w11;
+  /* #855: @50 = (@26*@48) */
+  w50 = (w26*w48);
+  /* #856: @39 = (@39+@50) */
+  w39 += w50;
+  /* #857: @37 = (@37-@39) */
+  w37 -= w39;
+  /* #858: @37 = (@37*@27) */
+  w37 *= w27;
+  /* #859: @37 = (@37*@13) */
+  w37 *= w13;
+  /* #860: @37 = (@37*@0) */
+  w37 *= w0;
+  /* #861: @47 = (@28*@47) */
+  w47 = (w28*w47);
+  /* #862: @37 = (@37+@47) */
+  w37 += w47;
+  /* #863: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #864: @47 = (@9*@48) */
+  w47 = (w9*w48);
+  /* #865: @46 = (@46+@47) */
+  w46 += w47;
+  /* #866: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #867: @36 = (@30*@36) */
+  w36 = (w30*w36);
+  /* #868: @46 = (@46+@36) */
+  w46 += w36;
+  /* #869: @45 = (@45+@46) */
+  w45 += w46;
+  /* #870: @45 = (@45*@27) */
+  w45 *= w27;
+  /* #871: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #872: @45 = (@45*@1) */
+  w45 *= w1;
+  /* #873: @41 = (@32*@41) */
+  w41 = (w32*w41);
+  /* #874: @45 = (@45+@41) */
+  w45 += w41;
+  /* #875: @37 = (@37-@45) */
+  w37 -= w45;
+  /* #876: @45 = (@44*@11) */
+  w45 = (w44*w11);
+  /* #877: @48 = (@15*@48) */
+  w48 = (w15*w48);
+  /* #878: @45 = (@45+@48) */
+  w45 += w48;
+  /* #879: @45 = (@45*@27) */
+  w45 *= w27;
+  /* #880: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #881: @45 = (@45*@2) */
+  w45 *= w2;
+  /* #882: @40 = (@34*@40) */
+  w40 = (w34*w40);
+  /* #883: @45 = (@45+@40) */
+  w45 += w40;
+  /* #884: @37 = (@37-@45) */
+  w37 -= w45;
+  /* #885: @38 = (@38-@37) */
+  w38 -= w37;
+  /* #886: output[1][52] = @38 */
+  if (res[1]) res[1][52] = w38;
+  /* #887: @44 = (@44*@4) */
+  w44 *= w4;
+  /* #888: @43 = (@15*@43) */
+  w43 = (w15*w43);
+  /* #889: @44 = (@44+@43) */
+  w44 += w43;
+  /* #890: @44 = (@44*@13) */
+  w44 *= w13;
+  /* #891: output[1][53] = @44 */
+  if (res[1]) res[1][53] = w44;
+  /* #892: @49 = (-@49) */
+  w49 = (- w49 );
+  /* #893: @49 = (@49/@3) */
+  w49 /= w3;
+  /* #894: output[1][54] = @49 */
+  if (res[1]) res[1][54] = w49;
+  /* #895: @42 = (-@42) */
+  w42 = (- w42 );
+  /* #896: @42 = (@42/@8) */
+  w42 /= w8;
+  /* #897: output[1][55] = @42 */
+  if (res[1]) res[1][55] = w42;
+  /* #898: @42 = input[1][66] */
+  w42 = arg[1] ? arg[1][66] : 0;
+  /* #899: output[1][56] = @42 */
+  if (res[1]) res[1][56] = w42;
+  /* #900: @49 = input[1][67] */
+  w49 = arg[1] ? arg[1][67] : 0;
+  /* #901: output[1][57] = @49 */
+  if (res[1]) res[1][57] = w49;
+  /* #902: @44 = input[1][68] */
+  w44 = arg[1] ? arg[1][68] : 0;
+  /* #903: output[1][58] = @44 */
+  if (res[1]) res[1][58] = w44;
+  /* #904: @43 = input[1][69] */
+  w43 = arg[1] ? arg[1][69] : 0;
+  /* #905: @38 = (@11*@43) */
+  w38 = (w11*w43);
+  /* #906: @38 = (-@38) */
+  w38 = (- w38 );
+  /* #907: @37 = (@38*@6) */
+  w37 = (w38*w6);
+  /* #908: @45 = input[1][71] */
+  w45 = arg[1] ? arg[1][71] : 0;
+  /* #909: @40 = (@5*@45) */
+  w40 = (w5*w45);
+  /* #910: @40 = (-@40) */
+  w40 = (- w40 );
+  /* #911: @48 = (@4*@40) */
+  w48 = (w4*w40);
+  /* #912: @37 = (@37+@48) */
+  w37 += w48;
+  /* #913: @48 = (@37*@9) */
+  w48 = (w37*w9);
+  /* #914: @41 = input[1][70] */
+  w41 = arg[1] ? arg[1][70] : 0;
+  /* #915: @46 = (@15*@41) */
+  w46 = (w15*w41);
+  /* #916: @36 = (@7*@46) */
+  w36 = (w7*w46);
+  /* #917: @48 = (@48+@36) */
+  w48 += w36;
+  /* #918: @36 = (@4*@43) */
+  w36 = (w4*w43);
+  /* #919: @47 = (@36*@5) */
+  w47 = (w36*w5);
+  /* #920: @45 = (@6*@45) */
+  w45 = (w6*w45);
+  /* #921: @39 = (@11*@45) */
+  w39 = (w11*w45);
+  /* #922: @47 = (@47+@39) */
+  w47 += w39;
+  /* #923: @48 = (@48+@47) */
+  w48 += w47;
+  /* #924: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #925: @47 = (@9*@41) */
+  w47 = (w9*w41);
+  /* #926: @47 = (-@47) */
+  w47 = (- w47 );
+  /* #927: @39 = (@47*@6) */
+  w39 = (w47*w6);
+  /* #928: @50 = (@15*@40) */
+  w50 = (w15*w40);
+  /* #929: @39 = (@39+@50) */
+  w39 += w50;
+  /* #930: @39 = (@39*@17) */
+  w39 *= w17;
+  /* #931: @39 = (@39*@13) */
+  w39 *= w13;
+  /* #932: @39 = (@39*@0) */
+  w39 *= w0;
+  /* #933: @50 = (@18*@42) */
+  w50 = (w18*w42);
+  /* #934: @39 = (@39+@50) */
+  w39 += w50;
+  /* #935: @50 = (@47*@5) */
+  w50 = (w47*w5);
+  /* #936: @51 = (@15*@45) */
+  w51 = (w15*w45);
+  /* #937: @50 = (@50+@51) */
+  w50 += w51;
+  /* #938: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #939: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #940: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #941: @51 = (@21*@49) */
+  w51 = (w21*w49);
+  /* #942: @50 = (@50+@51) */
+  w50 += w51;
+  /* #943: @39 = (@39-@50) */
+  w39 -= w50;
+  /* #944: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #945: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #946: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #947: @51 = (@23*@44) */
+  w51 = (w23*w44);
+  /* #948: @50 = (@50+@51) */
+  w50 += w51;
+  /* #949: @39 = (@39+@50) */
+  w39 += w50;
+  /* #950: @48 = (@48-@39) */
+  w48 -= w39;
+  /* #951: output[1][59] = @48 */
+  if (res[1]) res[1][59] = w48;
+  /* #952: @48 = (@38*@9) */
+  w48 = (w38*w9);
+  /* #953: @39 = (@4*@46) */
+  w39 = (w4*w46);
+  /* #954: @48 = (@48+@39) */
+  w48 += w39;
+  /* #955: @48 = (@48*@5) */
+  w48 *= w5;
+  /* #956: @39 = (@14*@45) */
+  w39 = (w14*w45);
+  /* #957: @48 = (@48+@39) */
+  w48 += w39;
+  /* #958: @39 = (@40*@11) */
+  w39 = (w40*w11);
+  /* #959: @50 = (@6*@36) */
+  w50 = (w6*w36);
+  /* #960: @39 = (@39+@50) */
+  w39 += w50;
+  /* #961: @48 = (@48-@39) */
+  w48 -= w39;
+  /* #962: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #963: @39 = (@38*@5) */
+  w39 = (w38*w5);
+  /* #964: @50 = (@4*@45) */
+  w50 = (w4*w45);
+  /* #965: @39 = (@39+@50) */
+  w39 += w50;
+  /* #966: @40 = (@40*@9) */
+  w40 *= w9;
+  /* #967: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #968: @40 = (@40+@50) */
+  w40 += w50;
+  /* #969: @40 = (@40*@11) */
+  w40 *= w11;
+  /* #970: @50 = (@26*@36) */
+  w50 = (w26*w36);
+  /* #971: @40 = (@40+@50) */
+  w40 += w50;
+  /* #972: @39 = (@39-@40) */
   w39 -= w40;
-  /* #1787: @42 = (@42*@39) */
-  w42 *= w39;
-  /* #1788: @107 = (@107*@95) */
-  w107 *= w95;
-  /* #1789: @41 = (@41*@107) */
-  w41 *= w107;
-  /* #1790: @42 = (@42+@41) */
-  w42 += w41;
-  /* #1791: @36 = (@36-@42) */
-  w36 -= w42;
-  /* #1792: @35 = (@35*@36) */
-  w35 *= w36;
-  /* #1793: @35 = (@13*@35) */
-  w35  = (w13*w35);
-  /* #1794: @0 = (@0*@35) */
-  w0 *= w35;
-  /* #1795: @43 = (@43*@10) */
-  w43 *= w10;
-  /* #1796: @0 = (@0+@43) */
-  w0 += w43;
-  /* #1797: @104 = (@104*@91) */
-  w104 *= w91;
-  /* #1798: @46 = (@46*@104) */
-  w46 *= w104;
-  /* #1799: @46 = (-@46) */
-  w46 = (- w46 );
-  /* #1800: @100 = (@100*@95) */
-  w100 *= w95;
-  /* #1801: @47 = (@47*@100) */
-  w47 *= w100;
-  /* #1802: @46 = (@46-@47) */
-  w46 -= w47;
-  /* #1803: @99 = (@99*@34) */
-  w99 *= w34;
-  /* #1804: @50 = (@50*@99) */
-  w50 *= w99;
-  /* #1805: @92 = (@92*@95) */
-  w92 *= w95;
-  /* #1806: @49 = (@49*@92) */
-  w49 *= w92;
-  /* #1807: @50 = (@50+@49) */
-  w50 += w49;
-  /* #1808: @52 = (@52*@50) */
-  w52 *= w50;
-  /* #1809: @5 = (@5*@91) */
-  w5 *= w91;
-  /* #1810: @51 = (@51*@5) */
-  w51 *= w5;
-  /* #1811: @52 = (@52+@51) */
-  w52 += w51;
-  /* #1812: @46 = (@46+@52) */
-  w46 += w52;
-  /* #1813: @45 = (@45*@46) */
-  w45 *= w46;
-  /* #1814: @45 = (@13*@45) */
-  w45  = (w13*w45);
-  /* #1815: @1 = (@1*@45) */
-  w1 *= w45;
-  /* #1816: @53 = (@53*@31) */
-  w53 *= w31;
-  /* #1817: @1 = (@1+@53) */
-  w1 += w53;
-  /* #1818: @0 = (@0-@1) */
-  w0 -= w1;
-  /* #1819: @97 = (@97*@95) */
-  w97 *= w95;
-  /* #1820: @55 = (@55*@97) */
-  w55 *= w97;
-  /* #1821: @61 = (@61*@34) */
-  w61 *= w34;
-  /* #1822: @56 = (@56*@61) */
-  w56 *= w61;
-  /* #1823: @55 = (@55-@56) */
-  w55 -= w56;
-  /* #1824: @54 = (@54*@55) */
-  w54 *= w55;
-  /* #1825: @54 = (@13*@54) */
-  w54  = (w13*w54);
-  /* #1826: @2 = (@2*@54) */
-  w2 *= w54;
-  /* #1827: @58 = (@58*@60) */
-  w58 *= w60;
-  /* #1828: @2 = (@2+@58) */
-  w2 += w58;
-  /* #1829: @0 = (@0-@2) */
-  w0 -= w2;
-  /* #1830: @30 = (@30-@0) */
-  w30 -= w0;
-  /* #1831: @3 = (@3*@95) */
-  w3 *= w95;
-  /* #1832: @44 = (@44*@3) */
-  w44 *= w3;
-  /* #1833: @44 = (-@44) */
+  /* #973: @39 = (@39*@27) */
+  w39 *= w27;
+  /* #974: @39 = (@39*@13) */
+  w39 *= w13;
+  /* #975: @39 = (@39*@0) */
+  w39 *= w0;
+  /* #976: @42 = (@28*@42) */
+  w42 = (w28*w42);
+  /* #977: @39 = (@39+@42) */
+  w39 += w42;
+  /* #978: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #979: @42 = (@9*@36) */
+  w42 = (w9*w36);
+  /* #980: @46 = (@46+@42) */
+  w46 += w42;
+  /* #981: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #982: @45 = (@30*@45) */
+  w45 = (w30*w45);
+  /* #983: @46 = (@46+@45) */
+  w46 += w45;
+  /* #984: @37 = (@37+@46) */
+  w37 += w46;
+  /* #985: @37 = (@37*@27) */
+  w37 *= w27;
+  /* #986: @37 = (@37*@13) */
+  w37 *= w13;
+  /* #987: @37 = (@37*@1) */
+  w37 *= w1;
+  /* #988: @49 = (@32*@49) */
+  w49 = (w32*w49);
+  /* #989: @37 = (@37+@49) */
+  w37 += w49;
+  /* #990: @39 = (@39-@37) */
+  w39 -= w37;
+  /* #991: @37 = (@47*@11) */
+  w37 = (w47*w11);
+  /* #992: @36 = (@15*@36) */
+  w36 = (w15*w36);
+  /* #993: @37 = (@37+@36) */
+  w37 += w36;
+  /* #994: @37 = (@37*@27) */
+  w37 *= w27;
+  /* #995: @37 = (@37*@13) */
+  w37 *= w13;
+  /* #996: @37 = (@37*@2) */
+  w37 *= w2;
+  /* #997: @44 = (@34*@44) */
+  w44 = (w34*w44);
+  /* #998: @37 = (@37+@44) */
+  w37 += w44;
+  /* #999: @39 = (@39-@37) */
+  w39 -= w37;
+  /* #1000: @48 = (@48-@39) */
+  w48 -= w39;
+  /* #1001: output[1][60] = @48 */
+  if (res[1]) res[1][60] = w48;
+  /* #1002: @47 = (@47*@4) */
+  w47 *= w4;
+  /* #1003: @38 = (@15*@38) */
+  w38 = (w15*w38);
+  /* #1004: @47 = (@47+@38) */
+  w47 += w38;
+  /* #1005: @47 = (@47*@13) */
+  w47 *= w13;
+  /* #1006: output[1][61] = @47 */
+  if (res[1]) res[1][61] = w47;
+  /* #1007: @43 = (-@43) */
+  w43 = (- w43 );
+  /* #1008: @43 = (@43/@3) */
+  w43 /= w3;
+  /* #1009: output[1][62] = @43 */
+  if (res[1]) res[1][62] = w43;
+  /* #1010: @41 = (-@41) */
+  w41 = (- w41 );
+  /* #1011: @41 = (@41/@8) */
+  w41 /= w8;
+  /* #1012: output[1][63] = @41 */
+  if (res[1]) res[1][63] = w41;
+  /* #1013: @41 = input[1][75] */
+  w41 = arg[1] ? arg[1][75] : 0;
+  /* #1014: output[1][64] = @41 */
+  if (res[1]) res[1][64] = w41;
+  /* #1015: @43 = input[1][76] */
+  w43 = arg[1] ? arg[1][76] : 0;
+  /* #1016: output[1][65] = @43 */
+  if (res[1]) res[1][65] = w43;
+  /* #1017: @47 = input[1][77] */
+  w47 = arg[1] ? arg[1][77] : 0;
+  /* #1018: output[1][66] = @47 */
+  if (res[1]) res[1][66] = w47;
+  /* #1019: @38 = input[1][78] */
+  w38 = arg[1] ? arg[1][78] : 0;
+  /* #1020: @48 = (@11*@38) */
+  w48 = (w11*w38);
+  /* #1021: @48 = (-@48) */
+  w48 = (- w48 );
+  /* #1022: @39 = (@48*@6) */
+  w39 = (w48*w6);
+  /* #1023: @37 = input[1][80] */
+  w37 = arg[1] ? arg[1][80] : 0;
+  /* #1024: @44 = (@5*@37) */
+  w44 = (w5*w37);
+  /* #1025: @44 = (-@44) */
   w44 = (- w44 );
-  /* #1834: @8 = (@8*@34) */
-  w8 *= w34;
-  /* #1835: @59 = (@59*@8) */
-  w59 *= w8;
-  /* #1836: @44 = (@44-@59) */
-  w44 -= w59;
-  /* #1837: @13 = (@13*@44) */
-  w13 *= w44;
-  /* #1838: @96 = (@96*@95) */
-  w96 *= w95;
-  /* #1839: @96 = (-@96) */
-  w96 = (- w96 );
-  /* #1840: @94 = (@94*@34) */
-  w94 *= w34;
-  /* #1841: @94 = (-@94) */
-  w94 = (- w94 );
-  /* #1842: @114 = 00 */
-  /* #1843: @125 = vertcat(@10, @31, @60, @9, @30, @13, @96, @94, @114) */
-  rr=w125;
-  *rr++ = w10;
-  *rr++ = w31;
-  *rr++ = w60;
-  *rr++ = w9;
-  *rr++ = w30;
-  *rr++ = w13;
-  *rr++ = w96;
-  *rr++ = w94;
-  /* #1844: @126 = horzcat(@123, @124, @125) */
-  rr=w126;
-  for (i=0, cs=w123; i<8; ++i) *rr++ = *cs++;
-  for (i=0, cs=w124; i<8; ++i) *rr++ = *cs++;
-  for (i=0, cs=w125; i<8; ++i) *rr++ = *cs++;
-  /* #1845: @121 = (@121+@126) */
-  for (i=0, rr=w121, cs=w126; i<24; ++i) (*rr++) += (*cs++);
-  /* #1846: output[2][0] = @121 */
-  casadi_copy(w121, 24, res[2]);
+  /* #1026: @36 = (@4*@44) */
+  w36 = (w4*w44);
+  /* #1027: @39 = (@39+@36) */
+  w39 += w36;
+  /* #1028: @36 = (@39*@9) */
+  w36 = (w39*w9);
+  /* #1029: @49 = input[1][79] */
+  w49 = arg[1] ? arg[1][79] : 0;
+  /* #1030: @46 = (@15*@49) */
+  w46 = (w15*w49);
+  /* #1031: @45 = (@7*@46) */
+  w45 = (w7*w46);
+  /* #1032: @36 = (@36+@45) */
+  w36 += w45;
+  /* #1033: @45 = (@4*@38) */
+  w45 = (w4*w38);
+  /* #1034: @42 = (@45*@5) */
+  w42 = (w45*w5);
+  /* #1035: @37 = (@6*@37) */
+  w37 = (w6*w37);
+  /* #1036: @40 = (@11*@37) */
+  w40 = (w11*w37);
+  /* #1037: @42 = (@42+@40) */
+  w42 += w40;
+  /* #1038: @36 = (@36+@42) */
+  w36 += w42;
+  /* #1039: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #1040: @42 = (@9*@49) */
+  w42 = (w9*w49);
+  /* #1041: @42 = (-@42) */
+  w42 = (- w42 );
+  /* #1042: @40 = (@42*@6) */
+  w40 = (w42*w6);
+  /* #1043: @50 = (@15*@44) */
+  w50 = (w15*w44);
+  /* #1044: @40 = (@40+@50) */
+  w40 += w50;
+  /* #1045: @40 = (@40*@17) */
+  w40 *= w17;
+  /* #1046: @40 = (@40*@13) */
+  w40 *= w13;
+  /* #1047: @40 = (@40*@0) */
+  w40 *= w0;
+  /* #1048: @50 = (@18*@41) */
+  w50 = (w18*w41);
+  /* #1049: @40 = (@40+@50) */
+  w40 += w50;
+  /* #1050: @50 = (@42*@5) */
+  w50 = (w42*w5);
+  /* #1051: @51 = (@15*@37) */
+  w51 = (w15*w37);
+  /* #1052: @50 = (@50+@51) */
+  w50 += w51;
+  /* #1053: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #1054: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #1055: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #1056: @51 = (@21*@43) */
+  w51 = (w21*w43);
+  /* #1057: @50 = (@50+@51) */
+  w50 += w51;
+  /* #1058: @40 = (@40-@50) */
+  w40 -= w50;
+  /* #1059: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #1060: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #1061: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #1062: @51 = (@23*@47) */
+  w51 = (w23*w47);
+  /* #1063: @50 = (@50+@51) */
+  w50 += w51;
+  /* #1064: @40 = (@40+@50) */
+  w40 += w50;
+  /* #1065: @36 = (@36-@40) */
+  w36 -= w40;
+  /* #1066: output[1][67] = @36 */
+  if (res[1]) res[1][67] = w36;
+  /* #1067: @36 = (@48*@9) */
+  w36 = (w48*w9);
+  /* #1068: @40 = (@4*@46) */
+  w40 = (w4*w46);
+  /* #1069: @36 = (@36+@40) */
+  w36 += w40;
+  /* #1070: @36 = (@36*@5) */
+  w36 *= w5;
+  /* #1071: @40 = (@14*@37) */
+  w40 = (w14*w37);
+  /* #1072: @36 = (@36+@40) */
+  w36 += w40;
+  /* #1073: @40 = (@44*@11) */
+  w40 = (w44*w11);
+  /* #1074: @50 = (@6*@45) */
+  w50 = (w6*w45);
+  /* #1075: @40 = (@40+@50) */
+  w40 += w50;
+  /* #1076: @36 = (@36-@40) */
+  w36 -= w40;
+  /* #1077: @36 = (@36*@13) */
+  w36 *= w13;
+  /* #1078: @40 = (@48*@5) */
+  w40 = (w48*w5);
+  /* #1079: @50 = (@4*@37) */
+  w50 = (w4*w37);
+  /* #1080: @40 = (@40+@50) */
+  w40 += w50;
+  /* #1081: @44 = (@44*@9) */
+  w44 *= w9;
+  /* #1082: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #1083: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1084: @44 = (@44*@11) */
+  w44 *= w11;
+  /* #1085: @50 = (@26*@45) */
+  w50 = (w26*w45);
+  /* #1086: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1087: @40 = (@40-@44) */
+  w40 -= w44;
+  /* #1088: @40 = (@40*@27) */
+  w40 *= w27;
+  /* #1089: @40 = (@40*@13) */
+  w40 *= w13;
+  /* #1090: @40 = (@40*@0) */
+  w40 *= w0;
+  /* #1091: @41 = (@28*@41) */
+  w41 = (w28*w41);
+  /* #1092: @40 = (@40+@41) */
+  w40 += w41;
+  /* #1093: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #1094: @41 = (@9*@45) */
+  w41 = (w9*w45);
+  /* #1095: @46 = (@46+@41) */
+  w46 += w41;
+  /* #1096: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #1097: @37 = (@30*@37) */
+  w37 = (w30*w37);
+  /* #1098: @46 = (@46+@37) */
+  w46 += w37;
+  /* #1099: @39 = (@39+@46) */
+  w39 += w46;
+  /* #1100: @39 = (@39*@27) */
+  w39 *= w27;
+  /* #1101: @39 = (@39*@13) */
+  w39 *= w13;
+  /* #1102: @39 = (@39*@1) */
+  w39 *= w1;
+  /* #1103: @43 = (@32*@43) */
+  w43 = (w32*w43);
+  /* #1104: @39 = (@39+@43) */
+  w39 += w43;
+  /* #1105: @40 = (@40-@39) */
+  w40 -= w39;
+  /* #1106: @39 = (@42*@11) */
+  w39 = (w42*w11);
+  /* #1107: @45 = (@15*@45) */
+  w45 = (w15*w45);
+  /* #1108: @39 = (@39+@45) */
+  w39 += w45;
+  /* #1109: @39 = (@39*@27) */
+  w39 *= w27;
+  /* #1110: @39 = (@39*@13) */
+  w39 *= w13;
+  /* #1111: @39 = (@39*@2) */
+  w39 *= w2;
+  /* #1112: @47 = (@34*@47) */
+  w47 = (w34*w47);
+  /* #1113: @39 = (@39+@47) */
+  w39 += w47;
+  /* #1114: @40 = (@40-@39) */
+  w40 -= w39;
+  /* #1115: @36 = (@36-@40) */
+  w36 -= w40;
+  /* #1116: output[1][68] = @36 */
+  if (res[1]) res[1][68] = w36;
+  /* #1117: @42 = (@42*@4) */
+  w42 *= w4;
+  /* #1118: @48 = (@15*@48) */
+  w48 = (w15*w48);
+  /* #1119: @42 = (@42+@48) */
+  w42 += w48;
+  /* #1120: @42 = (@42*@13) */
+  w42 *= w13;
+  /* #1121: output[1][69] = @42 */
+  if (res[1]) res[1][69] = w42;
+  /* #1122: @38 = (-@38) */
+  w38 = (- w38 );
+  /* #1123: @38 = (@38/@3) */
+  w38 /= w3;
+  /* #1124: output[1][70] = @38 */
+  if (res[1]) res[1][70] = w38;
+  /* #1125: @49 = (-@49) */
+  w49 = (- w49 );
+  /* #1126: @49 = (@49/@8) */
+  w49 /= w8;
+  /* #1127: output[1][71] = @49 */
+  if (res[1]) res[1][71] = w49;
+  /* #1128: @49 = input[2][3] */
+  w49 = arg[2] ? arg[2][3] : 0;
+  /* #1129: output[2][0] = @49 */
+  if (res[2]) res[2][0] = w49;
+  /* #1130: @38 = input[2][4] */
+  w38 = arg[2] ? arg[2][4] : 0;
+  /* #1131: output[2][1] = @38 */
+  if (res[2]) res[2][1] = w38;
+  /* #1132: @42 = input[2][5] */
+  w42 = arg[2] ? arg[2][5] : 0;
+  /* #1133: output[2][2] = @42 */
+  if (res[2]) res[2][2] = w42;
+  /* #1134: @48 = input[2][6] */
+  w48 = arg[2] ? arg[2][6] : 0;
+  /* #1135: @36 = (@11*@48) */
+  w36 = (w11*w48);
+  /* #1136: @36 = (-@36) */
+  w36 = (- w36 );
+  /* #1137: @40 = (@36*@6) */
+  w40 = (w36*w6);
+  /* #1138: @39 = input[2][8] */
+  w39 = arg[2] ? arg[2][8] : 0;
+  /* #1139: @47 = (@5*@39) */
+  w47 = (w5*w39);
+  /* #1140: @47 = (-@47) */
+  w47 = (- w47 );
+  /* #1141: @45 = (@4*@47) */
+  w45 = (w4*w47);
+  /* #1142: @40 = (@40+@45) */
+  w40 += w45;
+  /* #1143: @45 = (@40*@9) */
+  w45 = (w40*w9);
+  /* #1144: @43 = input[2][7] */
+  w43 = arg[2] ? arg[2][7] : 0;
+  /* #1145: @46 = (@15*@43) */
+  w46 = (w15*w43);
+  /* #1146: @37 = (@7*@46) */
+  w37 = (w7*w46);
+  /* #1147: @45 = (@45+@37) */
+  w45 += w37;
+  /* #1148: @37 = (@4*@48) */
+  w37 = (w4*w48);
+  /* #1149: @41 = (@37*@5) */
+  w41 = (w37*w5);
+  /* #1150: @39 = (@6*@39) */
+  w39 = (w6*w39);
+  /* #1151: @44 = (@11*@39) */
+  w44 = (w11*w39);
+  /* #1152: @41 = (@41+@44) */
+  w41 += w44;
+  /* #1153: @45 = (@45+@41) */
+  w45 += w41;
+  /* #1154: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #1155: @41 = (@9*@43) */
+  w41 = (w9*w43);
+  /* #1156: @41 = (-@41) */
+  w41 = (- w41 );
+  /* #1157: @44 = (@41*@6) */
+  w44 = (w41*w6);
+  /* #1158: @50 = (@15*@47) */
+  w50 = (w15*w47);
+  /* #1159: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1160: @44 = (@44*@17) */
+  w44 *= w17;
+  /* #1161: @44 = (@44*@13) */
+  w44 *= w13;
+  /* #1162: @44 = (@44*@0) */
+  w44 *= w0;
+  /* #1163: @50 = (@18*@49) */
+  w50 = (w18*w49);
+  /* #1164: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1165: @50 = (@41*@5) */
+  w50 = (w41*w5);
+  /* #1166: @51 = (@15*@39) */
+  w51 = (w15*w39);
+  /* #1167: @50 = (@50+@51) */
+  w50 += w51;
+  /* #1168: @50 = (@50*@17) */
+  w50 *= w17;
+  /* #1169: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #1170: @50 = (@50*@1) */
+  w50 *= w1;
+  /* #1171: @51 = (@21*@38) */
+  w51 = (w21*w38);
+  /* #1172: @50 = (@50+@51) */
+  w50 += w51;
+  /* #1173: @44 = (@44-@50) */
+  w44 -= w50;
+  /* #1174: @50 = (@46*@17) */
+  w50 = (w46*w17);
+  /* #1175: @50 = (@50*@13) */
+  w50 *= w13;
+  /* #1176: @50 = (@50*@2) */
+  w50 *= w2;
+  /* #1177: @51 = (@23*@42) */
+  w51 = (w23*w42);
+  /* #1178: @50 = (@50+@51) */
+  w50 += w51;
+  /* #1179: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1180: @45 = (@45-@44) */
+  w45 -= w44;
+  /* #1181: output[2][3] = @45 */
+  if (res[2]) res[2][3] = w45;
+  /* #1182: @45 = (@36*@9) */
+  w45 = (w36*w9);
+  /* #1183: @44 = (@4*@46) */
+  w44 = (w4*w46);
+  /* #1184: @45 = (@45+@44) */
+  w45 += w44;
+  /* #1185: @45 = (@45*@5) */
+  w45 *= w5;
+  /* #1186: @44 = (@14*@39) */
+  w44 = (w14*w39);
+  /* #1187: @45 = (@45+@44) */
+  w45 += w44;
+  /* #1188: @44 = (@47*@11) */
+  w44 = (w47*w11);
+  /* #1189: @50 = (@6*@37) */
+  w50 = (w6*w37);
+  /* #1190: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1191: @45 = (@45-@44) */
+  w45 -= w44;
+  /* #1192: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #1193: @44 = (@36*@5) */
+  w44 = (w36*w5);
+  /* #1194: @50 = (@4*@39) */
+  w50 = (w4*w39);
+  /* #1195: @44 = (@44+@50) */
+  w44 += w50;
+  /* #1196: @47 = (@47*@9) */
+  w47 *= w9;
+  /* #1197: @50 = (@6*@46) */
+  w50 = (w6*w46);
+  /* #1198: @47 = (@47+@50) */
+  w47 += w50;
+  /* #1199: @47 = (@47*@11) */
+  w47 *= w11;
+  /* #1200: @50 = (@26*@37) */
+  w50 = (w26*w37);
+  /* #1201: @47 = (@47+@50) */
+  w47 += w50;
+  /* #1202: @44 = (@44-@47) */
+  w44 -= w47;
+  /* #1203: @44 = (@44*@27) */
+  w44 *= w27;
+  /* #1204: @44 = (@44*@13) */
+  w44 *= w13;
+  /* #1205: @44 = (@44*@0) */
+  w44 *= w0;
+  /* #1206: @49 = (@28*@49) */
+  w49 = (w28*w49);
+  /* #1207: @44 = (@44+@49) */
+  w44 += w49;
+  /* #1208: @46 = (@46*@11) */
+  w46 *= w11;
+  /* #1209: @49 = (@9*@37) */
+  w49 = (w9*w37);
+  /* #1210: @46 = (@46+@49) */
+  w46 += w49;
+  /* #1211: @46 = (@46*@5) */
+  w46 *= w5;
+  /* #1212: @39 = (@30*@39) */
+  w39 = (w30*w39);
+  /* #1213: @46 = (@46+@39) */
+  w46 += w39;
+  /* #1214: @40 = (@40+@46) */
+  w40 += w46;
+  /* #1215: @40 = (@40*@27) */
+  w40 *= w27;
+  /* #1216: @40 = (@40*@13) */
+  w40 *= w13;
+  /* #1217: @40 = (@40*@1) */
+  w40 *= w1;
+  /* #1218: @38 = (@32*@38) */
+  w38 = (w32*w38);
+  /* #1219: @40 = (@40+@38) */
+  w40 += w38;
+  /* #1220: @44 = (@44-@40) */
+  w44 -= w40;
+  /* #1221: @40 = (@41*@11) */
+  w40 = (w41*w11);
+  /* #1222: @37 = (@15*@37) */
+  w37 = (w15*w37);
+  /* #1223: @40 = (@40+@37) */
+  w40 += w37;
+  /* #1224: @40 = (@40*@27) */
+  w40 *= w27;
+  /* #1225: @40 = (@40*@13) */
+  w40 *= w13;
+  /* #1226: @40 = (@40*@2) */
+  w40 *= w2;
+  /* #1227: @42 = (@34*@42) */
+  w42 = (w34*w42);
+  /* #1228: @40 = (@40+@42) */
+  w40 += w42;
+  /* #1229: @44 = (@44-@40) */
+  w44 -= w40;
+  /* #1230: @45 = (@45-@44) */
+  w45 -= w44;
+  /* #1231: output[2][4] = @45 */
+  if (res[2]) res[2][4] = w45;
+  /* #1232: @41 = (@41*@4) */
+  w41 *= w4;
+  /* #1233: @36 = (@15*@36) */
+  w36 = (w15*w36);
+  /* #1234: @41 = (@41+@36) */
+  w41 += w36;
+  /* #1235: @41 = (@41*@13) */
+  w41 *= w13;
+  /* #1236: output[2][5] = @41 */
+  if (res[2]) res[2][5] = w41;
+  /* #1237: @24 = (@24-@48) */
+  w24 -= w48;
+  /* #1238: @24 = (@24/@3) */
+  w24 /= w3;
+  /* #1239: output[2][6] = @24 */
+  if (res[2]) res[2][6] = w24;
+  /* #1240: @43 = (-@43) */
+  w43 = (- w43 );
+  /* #1241: @43 = (@43/@8) */
+  w43 /= w8;
+  /* #1242: output[2][7] = @43 */
+  if (res[2]) res[2][7] = w43;
+  /* #1243: @43 = input[2][12] */
+  w43 = arg[2] ? arg[2][12] : 0;
+  /* #1244: output[2][8] = @43 */
+  if (res[2]) res[2][8] = w43;
+  /* #1245: @24 = input[2][13] */
+  w24 = arg[2] ? arg[2][13] : 0;
+  /* #1246: output[2][9] = @24 */
+  if (res[2]) res[2][9] = w24;
+  /* #1247: @48 = input[2][14] */
+  w48 = arg[2] ? arg[2][14] : 0;
+  /* #1248: output[2][10] = @48 */
+  if (res[2]) res[2][10] = w48;
+  /* #1249: @41 = input[2][15] */
+  w41 = arg[2] ? arg[2][15] : 0;
+  /* #1250: @36 = (@11*@41) */
+  w36 = (w11*w41);
+  /* #1251: @36 = (-@36) */
+  w36 = (- w36 );
+  /* #1252: @45 = (@36*@6) */
+  w45 = (w36*w6);
+  /* #1253: @44 = input[2][17] */
+  w44 = arg[2] ? arg[2][17] : 0;
+  /* #1254: @40 = (@5*@44) */
+  w40 = (w5*w44);
+  /* #1255: @40 = (-@40) */
+  w40 = (- w40 );
+  /* #1256: @42 = (@4*@40) */
+  w42 = (w4*w40);
+  /* #1257: @45 = (@45+@42) */
+  w45 += w42;
+  /* #1258: @42 = (@45*@9) */
+  w42 = (w45*w9);
+  /* #1259: @37 = input[2][16] */
+  w37 = arg[2] ? arg[2][16] : 0;
+  /* #1260: @38 = (@15*@37) */
+  w38 = (w15*w37);
+  /* #1261: @46 = (@7*@38) */
+  w46 = (w7*w38);
+  /* #1262: @42 = (@42+@46) */
+  w42 += w46;
+  /* #1263: @46 = (@4*@41) */
+  w46 = (w4*w41);
+  /* #1264: @39 = (@46*@5) */
+  w39 = (w46*w5);
+  /* #1265: @44 = (@6*@44) */
+  w44 = (w6*w44);
+  /* #1266: @49 = (@11*@44) */
+  w49 = (w11*w44);
+  /* #1267: @39 = (@39+@49) */
+  w39 += w49;
+  /* #1268: @42 = (@42+@39) */
+  w42 += w39;
+  /* #1269: @42 = (@42*@13) */
+  w42 *= w13;
+  /* #1270: @39 = (@9*@37) */
+  w39 = (w9*w37);
+  /* #1271: @39 = (-@39) */
+  w39 = (- w39 );
+  /* #1272: @49 = (@39*@6) */
+  w49 = (w39*w6);
+  /* #1273: @47 = (@15*@40) */
+  w47 = (w15*w40);
+  /* #1274: @49 = (@49+@47) */
+  w49 += w47;
+  /* #1275: @49 = (@49*@17) */
+  w49 *= w17;
+  /* #1276: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #1277: @49 = (@49*@0) */
+  w49 *= w0;
+  /* #1278: @47 = (@18*@43) */
+  w47 = (w18*w43);
+  /* #1279: @49 = (@49+@47) */
+  w49 += w47;
+  /* #1280: @47 = (@39*@5) */
+  w47 = (w39*w5);
+  /* #1281: @50 = (@15*@44) */
+  w50 = (w15*w44);
+  /* #1282: @47 = (@47+@50) */
+  w47 += w50;
+  /* #1283: @47 = (@47*@17) */
+  w47 *= w17;
+  /* #1284: @47 = (@47*@13) */
+  w47 *= w13;
+  /* #1285: @47 = (@47*@1) */
+  w47 *= w1;
+  /* #1286: @50 = (@21*@24) */
+  w50 = (w21*w24);
+  /* #1287: @47 = (@47+@50) */
+  w47 += w50;
+  /* #1288: @49 = (@49-@47) */
+  w49 -= w47;
+  /* #1289: @47 = (@38*@17) */
+  w47 = (w38*w17);
+  /* #1290: @47 = (@47*@13) */
+  w47 *= w13;
+  /* #1291: @47 = (@47*@2) */
+  w47 *= w2;
+  /* #1292: @50 = (@23*@48) */
+  w50 = (w23*w48);
+  /* #1293: @47 = (@47+@50) */
+  w47 += w50;
+  /* #1294: @49 = (@49+@47) */
+  w49 += w47;
+  /* #1295: @42 = (@42-@49) */
+  w42 -= w49;
+  /* #1296: output[2][11] = @42 */
+  if (res[2]) res[2][11] = w42;
+  /* #1297: @42 = (@36*@9) */
+  w42 = (w36*w9);
+  /* #1298: @49 = (@4*@38) */
+  w49 = (w4*w38);
+  /* #1299: @42 = (@42+@49) */
+  w42 += w49;
+  /* #1300: @42 = (@42*@5) */
+  w42 *= w5;
+  /* #1301: @49 = (@14*@44) */
+  w49 = (w14*w44);
+  /* #1302: @42 = (@42+@49) */
+  w42 += w49;
+  /* #1303: @49 = (@40*@11) */
+  w49 = (w40*w11);
+  /* #1304: @47 = (@6*@46) */
+  w47 = (w6*w46);
+  /* #1305: @49 = (@49+@47) */
+  w49 += w47;
+  /* #1306: @42 = (@42-@49) */
+  w42 -= w49;
+  /* #1307: @42 = (@42*@13) */
+  w42 *= w13;
+  /* #1308: @49 = (@36*@5) */
+  w49 = (w36*w5);
+  /* #1309: @47 = (@4*@44) */
+  w47 = (w4*w44);
+  /* #1310: @49 = (@49+@47) */
+  w49 += w47;
+  /* #1311: @40 = (@40*@9) */
+  w40 *= w9;
+  /* #1312: @47 = (@6*@38) */
+  w47 = (w6*w38);
+  /* #1313: @40 = (@40+@47) */
+  w40 += w47;
+  /* #1314: @40 = (@40*@11) */
+  w40 *= w11;
+  /* #1315: @47 = (@26*@46) */
+  w47 = (w26*w46);
+  /* #1316: @40 = (@40+@47) */
+  w40 += w47;
+  /* #1317: @49 = (@49-@40) */
+  w49 -= w40;
+  /* #1318: @49 = (@49*@27) */
+  w49 *= w27;
+  /* #1319: @49 = (@49*@13) */
+  w49 *= w13;
+  /* #1320: @49 = (@49*@0) */
+  w49 *= w0;
+  /* #1321: @43 = (@28*@43) */
+  w43 = (w28*w43);
+  /* #1322: @49 = (@49+@43) */
+  w49 += w43;
+  /* #1323: @38 = (@38*@11) */
+  w38 *= w11;
+  /* #1324: @43 = (@9*@46) */
+  w43 = (w9*w46);
+  /* #1325: @38 = (@38+@43) */
+  w38 += w43;
+  /* #1326: @38 = (@38*@5) */
+  w38 *= w5;
+  /* #1327: @44 = (@30*@44) */
+  w44 = (w30*w44);
+  /* #1328: @38 = (@38+@44) */
+  w38 += w44;
+  /* #1329: @45 = (@45+@38) */
+  w45 += w38;
+  /* #1330: @45 = (@45*@27) */
+  w45 *= w27;
+  /* #1331: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #1332: @45 = (@45*@1) */
+  w45 *= w1;
+  /* #1333: @24 = (@32*@24) */
+  w24 = (w32*w24);
+  /* #1334: @45 = (@45+@24) */
+  w45 += w24;
+  /* #1335: @49 = (@49-@45) */
+  w49 -= w45;
+  /* #1336: @45 = (@39*@11) */
+  w45 = (w39*w11);
+  /* #1337: @46 = (@15*@46) */
+  w46 = (w15*w46);
+  /* #1338: @45 = (@45+@46) */
+  w45 += w46;
+  /* #1339: @45 = (@45*@27) */
+  w45 *= w27;
+  /* #1340: @45 = (@45*@13) */
+  w45 *= w13;
+  /* #1341: @45 = (@45*@2) */
+  w45 *= w2;
+  /* #1342: @48 = (@34*@48) */
+  w48 = (w34*w48);
+  /* #1343: @45 = (@45+@48) */
+  w45 += w48;
+  /* #1344: @49 = (@49-@45) */
+  w49 -= w45;
+  /* #1345: @42 = (@42-@49) */
+  w42 -= w49;
+  /* #1346: output[2][12] = @42 */
+  if (res[2]) res[2][12] = w42;
+  /* #1347: @39 = (@39*@4) */
+  w39 *= w4;
+  /* #1348: @36 = (@15*@36) */
+  w36 = (w15*w36);
+  /* #1349: @39 = (@39+@36) */
+  w39 += w36;
+  /* #1350: @39 = (@39*@13) */
+  w39 *= w13;
+  /* #1351: output[2][13] = @39 */
+  if (res[2]) res[2][13] = w39;
+  /* #1352: @41 = (-@41) */
+  w41 = (- w41 );
+  /* #1353: @41 = (@41/@3) */
+  w41 /= w3;
+  /* #1354: output[2][14] = @41 */
+  if (res[2]) res[2][14] = w41;
+  /* #1355: @35 = (@35-@37) */
+  w35 -= w37;
+  /* #1356: @35 = (@35/@8) */
+  w35 /= w8;
+  /* #1357: output[2][15] = @35 */
+  if (res[2]) res[2][15] = w35;
+  /* #1358: @35 = input[2][21] */
+  w35 = arg[2] ? arg[2][21] : 0;
+  /* #1359: output[2][16] = @35 */
+  if (res[2]) res[2][16] = w35;
+  /* #1360: @37 = input[2][22] */
+  w37 = arg[2] ? arg[2][22] : 0;
+  /* #1361: output[2][17] = @37 */
+  if (res[2]) res[2][17] = w37;
+  /* #1362: @41 = input[2][23] */
+  w41 = arg[2] ? arg[2][23] : 0;
+  /* #1363: output[2][18] = @41 */
+  if (res[2]) res[2][18] = w41;
+  /* #1364: @39 = input[2][24] */
+  w39 = arg[2] ? arg[2][24] : 0;
+  /* #1365: @36 = (@11*@39) */
+  w36 = (w11*w39);
+  /* #1366: @36 = (-@36) */
+  w36 = (- w36 );
+  /* #1367: @42 = (@36*@6) */
+  w42 = (w36*w6);
+  /* #1368: @49 = input[2][26] */
+  w49 = arg[2] ? arg[2][26] : 0;
+  /* #1369: @45 = (@5*@49) */
+  w45 = (w5*w49);
+  /* #1370: @45 = (-@45) */
+  w45 = (- w45 );
+  /* #1371: @48 = (@4*@45) */
+  w48 = (w4*w45);
+  /* #1372: @42 = (@42+@48) */
+  w42 += w48;
+  /* #1373: @48 = (@42*@9) */
+  w48 = (w42*w9);
+  /* #1374: @46 = input[2][25] */
+  w46 = arg[2] ? arg[2][25] : 0;
+  /* #1375: @24 = (@15*@46) */
+  w24 = (w15*w46);
+  /* #1376: @7 = (@7*@24) */
+  w7 *= w24;
+  /* #1377: @48 = (@48+@7) */
+  w48 += w7;
+  /* #1378: @7 = (@4*@39) */
+  w7 = (w4*w39);
+  /* #1379: @38 = (@7*@5) */
+  w38 = (w7*w5);
+  /* #1380: @49 = (@6*@49) */
+  w49 = (w6*w49);
+  /* #1381: @44 = (@11*@49) */
+  w44 = (w11*w49);
+  /* #1382: @38 = (@38+@44) */
+  w38 += w44;
+  /* #1383: @48 = (@48+@38) */
+  w48 += w38;
+  /* #1384: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #1385: @10 = (@10*@12) */
+  w10 *= w12;
+  /* #1386: @48 = (@48+@10) */
+  w48 += w10;
+  /* #1387: @10 = (@9*@46) */
+  w10 = (w9*w46);
+  /* #1388: @10 = (-@10) */
+  w10 = (- w10 );
+  /* #1389: @38 = (@10*@6) */
+  w38 = (w10*w6);
+  /* #1390: @44 = (@15*@45) */
+  w44 = (w15*w45);
+  /* #1391: @38 = (@38+@44) */
+  w38 += w44;
+  /* #1392: @38 = (@38*@17) */
+  w38 *= w17;
+  /* #1393: @38 = (@38*@13) */
+  w38 *= w13;
+  /* #1394: @16 = (@16*@12) */
+  w16 *= w12;
+  /* #1395: @38 = (@38+@16) */
+  w38 += w16;
+  /* #1396: @38 = (@38*@0) */
+  w38 *= w0;
+  /* #1397: @18 = (@18*@35) */
+  w18 *= w35;
+  /* #1398: @38 = (@38+@18) */
+  w38 += w18;
+  /* #1399: @18 = (@10*@5) */
+  w18 = (w10*w5);
+  /* #1400: @16 = (@15*@49) */
+  w16 = (w15*w49);
+  /* #1401: @18 = (@18+@16) */
+  w18 += w16;
+  /* #1402: @18 = (@18*@17) */
+  w18 *= w17;
+  /* #1403: @18 = (@18*@13) */
+  w18 *= w13;
+  /* #1404: @20 = (@20*@12) */
+  w20 *= w12;
+  /* #1405: @18 = (@18+@20) */
+  w18 += w20;
+  /* #1406: @18 = (@18*@1) */
+  w18 *= w1;
+  /* #1407: @21 = (@21*@37) */
+  w21 *= w37;
+  /* #1408: @18 = (@18+@21) */
+  w18 += w21;
+  /* #1409: @38 = (@38-@18) */
+  w38 -= w18;
+  /* #1410: @17 = (@24*@17) */
+  w17 = (w24*w17);
+  /* #1411: @17 = (@17*@13) */
+  w17 *= w13;
+  /* #1412: @22 = (@22*@12) */
+  w22 *= w12;
+  /* #1413: @17 = (@17+@22) */
+  w17 += w22;
+  /* #1414: @17 = (@17*@2) */
+  w17 *= w2;
+  /* #1415: @23 = (@23*@41) */
+  w23 *= w41;
+  /* #1416: @17 = (@17+@23) */
+  w17 += w23;
+  /* #1417: @38 = (@38+@17) */
+  w38 += w17;
+  /* #1418: @48 = (@48-@38) */
+  w48 -= w38;
+  /* #1419: output[2][19] = @48 */
+  if (res[2]) res[2][19] = w48;
+  /* #1420: @48 = (@36*@9) */
+  w48 = (w36*w9);
+  /* #1421: @38 = (@4*@24) */
+  w38 = (w4*w24);
+  /* #1422: @48 = (@48+@38) */
+  w48 += w38;
+  /* #1423: @48 = (@48*@5) */
+  w48 *= w5;
+  /* #1424: @14 = (@14*@49) */
+  w14 *= w49;
+  /* #1425: @48 = (@48+@14) */
+  w48 += w14;
+  /* #1426: @14 = (@45*@11) */
+  w14 = (w45*w11);
+  /* #1427: @38 = (@6*@7) */
+  w38 = (w6*w7);
+  /* #1428: @14 = (@14+@38) */
+  w14 += w38;
+  /* #1429: @48 = (@48-@14) */
+  w48 -= w14;
+  /* #1430: @48 = (@48*@13) */
+  w48 *= w13;
+  /* #1431: @19 = (@19*@12) */
+  w19 *= w12;
+  /* #1432: @48 = (@48+@19) */
+  w48 += w19;
+  /* #1433: @19 = (@36*@5) */
+  w19 = (w36*w5);
+  /* #1434: @14 = (@4*@49) */
+  w14 = (w4*w49);
+  /* #1435: @19 = (@19+@14) */
+  w19 += w14;
+  /* #1436: @45 = (@45*@9) */
+  w45 *= w9;
+  /* #1437: @6 = (@6*@24) */
+  w6 *= w24;
+  /* #1438: @45 = (@45+@6) */
+  w45 += w6;
+  /* #1439: @45 = (@45*@11) */
+  w45 *= w11;
+  /* #1440: @26 = (@26*@7) */
+  w26 *= w7;
+  /* #1441: @45 = (@45+@26) */
+  w45 += w26;
+  /* #1442: @19 = (@19-@45) */
+  w19 -= w45;
+  /* #1443: @19 = (@19*@27) */
+  w19 *= w27;
+  /* #1444: @19 = (@19*@13) */
+  w19 *= w13;
+  /* #1445: @25 = (@25*@12) */
+  w25 *= w12;
+  /* #1446: @19 = (@19+@25) */
+  w19 += w25;
+  /* #1447: @19 = (@19*@0) */
+  w19 *= w0;
+  /* #1448: @28 = (@28*@35) */
+  w28 *= w35;
+  /* #1449: @19 = (@19+@28) */
+  w19 += w28;
+  /* #1450: @24 = (@24*@11) */
+  w24 *= w11;
+  /* #1451: @9 = (@9*@7) */
+  w9 *= w7;
+  /* #1452: @24 = (@24+@9) */
+  w24 += w9;
+  /* #1453: @24 = (@24*@5) */
+  w24 *= w5;
+  /* #1454: @30 = (@30*@49) */
+  w30 *= w49;
+  /* #1455: @24 = (@24+@30) */
+  w24 += w30;
+  /* #1456: @42 = (@42+@24) */
+  w42 += w24;
+  /* #1457: @42 = (@42*@27) */
+  w42 *= w27;
+  /* #1458: @42 = (@42*@13) */
+  w42 *= w13;
+  /* #1459: @31 = (@31*@12) */
+  w31 *= w12;
+  /* #1460: @42 = (@42+@31) */
+  w42 += w31;
+  /* #1461: @42 = (@42*@1) */
+  w42 *= w1;
+  /* #1462: @32 = (@32*@37) */
+  w32 *= w37;
+  /* #1463: @42 = (@42+@32) */
+  w42 += w32;
+  /* #1464: @19 = (@19-@42) */
+  w19 -= w42;
+  /* #1465: @11 = (@10*@11) */
+  w11 = (w10*w11);
+  /* #1466: @7 = (@15*@7) */
+  w7 = (w15*w7);
+  /* #1467: @11 = (@11+@7) */
+  w11 += w7;
+  /* #1468: @11 = (@11*@27) */
+  w11 *= w27;
+  /* #1469: @11 = (@11*@13) */
+  w11 *= w13;
+  /* #1470: @33 = (@33*@12) */
+  w33 *= w12;
+  /* #1471: @11 = (@11+@33) */
+  w11 += w33;
+  /* #1472: @11 = (@11*@2) */
+  w11 *= w2;
+  /* #1473: @34 = (@34*@41) */
+  w34 *= w41;
+  /* #1474: @11 = (@11+@34) */
+  w11 += w34;
+  /* #1475: @19 = (@19-@11) */
+  w19 -= w11;
+  /* #1476: @48 = (@48-@19) */
+  w48 -= w19;
+  /* #1477: output[2][20] = @48 */
+  if (res[2]) res[2][20] = w48;
+  /* #1478: @10 = (@10*@4) */
+  w10 *= w4;
+  /* #1479: @15 = (@15*@36) */
+  w15 *= w36;
+  /* #1480: @10 = (@10+@15) */
+  w10 += w15;
+  /* #1481: @10 = (@10*@13) */
+  w10 *= w13;
+  /* #1482: @29 = (@29*@12) */
+  w29 *= w12;
+  /* #1483: @10 = (@10+@29) */
+  w10 += w29;
+  /* #1484: output[2][21] = @10 */
+  if (res[2]) res[2][21] = w10;
+  /* #1485: @39 = (-@39) */
+  w39 = (- w39 );
+  /* #1486: @39 = (@39/@3) */
+  w39 /= w3;
+  /* #1487: output[2][22] = @39 */
+  if (res[2]) res[2][22] = w39;
+  /* #1488: @46 = (-@46) */
+  w46 = (- w46 );
+  /* #1489: @46 = (@46/@8) */
+  w46 /= w8;
+  /* #1490: output[2][23] = @46 */
+  if (res[2]) res[2][23] = w46;
   return 0;
 }
 
@@ -3979,29 +3104,29 @@ CASADI_SYMBOL_EXPORT const char* mav_nmpc_tracker_model_expl_vde_forw_name_out(c
 
 CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_expl_vde_forw_sparsity_in(casadi_int i) {
   switch (i) {
-    case 0: return casadi_s3;
-    case 1: return casadi_s4;
-    case 2: return casadi_s5;
-    case 3: return casadi_s6;
-    case 4: return casadi_s7;
+    case 0: return casadi_s0;
+    case 1: return casadi_s1;
+    case 2: return casadi_s2;
+    case 3: return casadi_s3;
+    case 4: return casadi_s4;
     default: return 0;
   }
 }
 
 CASADI_SYMBOL_EXPORT const casadi_int* mav_nmpc_tracker_model_expl_vde_forw_sparsity_out(casadi_int i) {
   switch (i) {
-    case 0: return casadi_s3;
-    case 1: return casadi_s8;
-    case 2: return casadi_s2;
+    case 0: return casadi_s0;
+    case 1: return casadi_s5;
+    case 2: return casadi_s6;
     default: return 0;
   }
 }
 
 CASADI_SYMBOL_EXPORT int mav_nmpc_tracker_model_expl_vde_forw_work(casadi_int *sz_arg, casadi_int* sz_res, casadi_int *sz_iw, casadi_int *sz_w) {
-  if (sz_arg) *sz_arg = 14;
-  if (sz_res) *sz_res = 12;
-  if (sz_iw) *sz_iw = 4;
-  if (sz_w) *sz_w = 391;
+  if (sz_arg) *sz_arg = 5;
+  if (sz_res) *sz_res = 3;
+  if (sz_iw) *sz_iw = 0;
+  if (sz_w) *sz_w = 52;
   return 0;
 }
 
@@ -0,0 +1,75 @@
+#include "mav_nmpc_tracker/command_interpolator.h"
+
+#include <algorithm>
+
+#include "mav_nmpc_tracker/warm_start.h"
+
+namespace mav_nmpc_tracker {
+
+void CommandInterpolator::locate(const std::vector<double> &stage_times, double time, int &iStage, double &ratio)
+{
+    const int N = static_cast<int>(stage_times.size()) - 1;
+    if (time <= stage_times.front()) {
+        iStage = 0;
+        ratio = 0.0;
+        return;
+    }
+    if (time >= stage_times.back()) {
+        iStage = N - 1;
+        ratio = 1.0;
+        return;
+    }
+    iStage = static_cast<int>(std::upper_bound(stage_times.begin(), stage_times.end(), time) - stage_times.begin()) - 1;
+    ratio = (time - stage_times[iStage]) / (stage_times[iStage + 1] - stage_times[iStage]);
+}
+
+StateVector CommandInterpolator::plan_state(const CommandPlan &plan, double time)
+{
+    int iStage;
+    double ratio;
+    locate(plan.stage_times, time - plan.start_time, iStage, ratio);
+    return (1.0 - ratio) * plan.x.col(iStage) + ratio * plan.x.col(iStage + 1);
+}
+
+bool CommandInterpolator::command(const CommandPlan &plan, double time, const StateSample *measured,
+                                  InputVector &u) const
+{
+    const double t = time - plan.start_time;
+    if (!plan.valid || plan.u.cols() == 0 || t > plan.stage_times.back()) {
+        u = plan.fallback;
+        return false;
+    }
+    int iStage;
+    double ratio;
+    locate(plan.stage_times, t, iStage, ratio);
+    const int N = static_cast<int>(plan.u.cols());
+    // the controls of the plan are held over their stage, a first order hold instead smooths the steps
+    u = plan.u.col(iStage);
+    if (param_.linear && iStage + 1 < N)
+        u += ratio * (plan.u.col(iStage + 1) - plan.u.col(iStage));
+
+    if (measured != nullptr && (param_.kp > 0.0 || param_.kd > 0.0)) {
+        // the acceleration correcting the error at the time of the measurement, as the change of the
+        // attitude and thrust from the one of the planned acceleration
+        const StateVector x_ref = plan_state(plan, measured->time);
+        const Eigen::Vector3d acc_feedback =
+            param_.kp * (x_ref.head<3>() - measured->state.head<3>()) +
+            param_.kd * (x_ref.segment<3>(3) - measured->state.segment<3>(3));
+        const MpcFormulationParam &model = plan.model;
+        const Eigen::Vector3d disturbance(model.disturbance_x, model.disturbance_y, model.disturbance_z);
+        const Eigen::Vector3d acc_plan =
+            mav_dynamics(model, (1.0 - ratio) * plan.x.col(iStage) + ratio * plan.x.col(iStage + 1), u)
+                .segment<3>(3) -
+            disturbance;
+        const double yaw = measured->state(8);
+        const Eigen::Vector3d delta =
+            acceleration_attitude(acc_plan + acc_feedback, yaw) - acceleration_attitude(acc_plan, yaw);
+        u += Eigen::Vector3d(delta(0) / model.roll_gain, delta(1) / model.pitch_gain, delta(2) / model.thrust_gain);
+    }
+    u(0) = std::min(std::max(u(0), -plan.model.roll_max), plan.model.roll_max);
+    u(1) = std::min(std::max(u(1), -plan.model.pitch_max), plan.model.pitch_max);
+    u(2) = std::min(std::max(u(2), plan.model.thrust_min), plan.model.thrust_max);
+    return true;
+}
+
+}  // namespace mav_nmpc_tracker
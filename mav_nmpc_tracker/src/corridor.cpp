@@ -0,0 +1,85 @@
+#include "mav_nmpc_tracker/corridor.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// corridors a stage may move ahead of the one before it, bounds the search of a position outside
+constexpr int kLookAhead = 4;
+
+}  // namespace
+
+double Corridor::violation(const Eigen::Vector3d &p) const
+{
+    if (faces == 0)
+        return -std::numeric_limits<double>::infinity();
+    return (A.topRows(faces) * p - b.head(faces)).maxCoeff();
+}
+
+bool Corridor::operator==(const Corridor &other) const
+{
+    return faces == other.faces && A.topRows(faces) == other.A.topRows(faces) &&
+           b.head(faces) == other.b.head(faces);
+}
+
+Corridor box_corridor(const Eigen::Vector3d &center, const Eigen::Quaterniond &orientation,
+                      const Eigen::Vector3d &size)
+{
+    // +- each axis of the box
+    const Eigen::Matrix3d R = orientation.normalized().toRotationMatrix();
+    Corridor corridor;
+    corridor.faces = 6;
+    for (int iAxis = 0; iAxis < 3; iAxis++) {
+        const Eigen::Vector3d axis = R.col(iAxis);
+        const double half = 0.5 * size(iAxis);
+        corridor.A.row(2 * iAxis) = axis.transpose();
+        corridor.b(2 * iAxis) = axis.dot(center) + half;
+        corridor.A.row(2 * iAxis + 1) = -axis.transpose();
+        corridor.b(2 * iAxis + 1) = -axis.dot(center) + half;
+    }
+    return corridor;
+}
+
+void CorridorAssigner::set_corridors(const std::vector<Corridor> &corridors)
+{
+    corridors_ = corridors;
+    first_corridor_ = 0;
+}
+
+const std::vector<int> &CorridorAssigner::assign(const Eigen::Matrix3Xd &positions)
+{
+    const int n_stages = static_cast<int>(positions.cols());
+    const int n_corridors = static_cast<int>(corridors_.size());
+    stage_corridors_.assign(n_stages, -1);
+    tests_ = 0;
+    if (n_corridors == 0)
+        return stage_corridors_;
+
+    // the first stage may have fallen back by one since the last cycle, e.g. on a new trajectory
+    int current = std::min(first_corridor_, n_corridors - 1);
+    if (current > 0 && !corridors_[current].contains(positions.col(0)) &&
+        corridors_[current - 1].contains(positions.col(0)))
+        current--;
+    for (int iStage = 0; iStage < n_stages; iStage++) {
+        const Eigen::Vector3d p = positions.col(iStage);
+        // the next corridor the position is in, searching forward from the current one
+        int iCorridor = current;
+        tests_++;
+        const int last = std::min(current + kLookAhead, n_corridors - 1);
+        while (!corridors_[iCorridor].contains(p) && iCorridor < last) {
+            iCorridor++;
+            tests_++;
+        }
+        if (corridors_[iCorridor].contains(p))
+            current = iCorridor;
+        stage_corridors_[iStage] = current;
+        if (iStage == 0)
+            first_corridor_ = current;
+    }
+    return stage_corridors_;
+}
+
+}  // namespace mav_nmpc_tracker
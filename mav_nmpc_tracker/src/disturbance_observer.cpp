@@ -0,0 +1,53 @@
+#include "mav_nmpc_tracker/disturbance_observer.h"
+
+#include <algorithm>
+
+#include "mav_nmpc_tracker/warm_start.h"
+
+namespace mav_nmpc_tracker {
+
+DisturbanceObserver::DisturbanceObserver(const MpcFormulationParam &param,
+                                         const DisturbanceObserverParam &observer_param)
+    : param_(param),
+      observer_param_(observer_param)
+{
+    reset();
+}
+
+void DisturbanceObserver::reset()
+{
+    disturbance_.setZero();
+    has_last_ = false;
+    last_time_ = 0.0;
+    last_x_.setZero();
+}
+
+void DisturbanceObserver::set_model(const MpcFormulationParam &param)
+{
+    param_ = param;
+}
+
+void DisturbanceObserver::update(double t, const StateVector &x, const InputVector &u)
+{
+    const double dt = t - last_time_;
+    const bool usable = has_last_ && dt > 0.0 && dt <= observer_param_.max_sample_dt;
+    const StateVector x_last = last_x_;
+    if (has_last_ && dt <= 0.0)
+        return;
+    has_last_ = true;
+    last_time_ = t;
+    last_x_ = x;
+    if (!usable)
+        return;
+
+    // the velocity over the sample with the current estimate, its error is the change of the offset
+    param_.disturbance_x = disturbance_(0);
+    param_.disturbance_y = disturbance_(1);
+    param_.disturbance_z = disturbance_(2);
+    const StateVector x_pred = integrate_mav_dynamics(param_, x_last, u, dt);
+    disturbance_ += observer_param_.gain * (x.segment<3>(3) - x_pred.segment<3>(3)) / dt;
+    const double limit = observer_param_.disturbance_max;
+    disturbance_ = disturbance_.cwiseMax(-limit).cwiseMin(limit);
+}
+
+}  // namespace mav_nmpc_tracker
@@ -0,0 +1,187 @@
+#include "mav_nmpc_tracker/esdf_map.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+const char kEsdfMagic[8] = {'E', 'S', 'D', 'F', '0', '0', '0', '1'};
+
+}  // namespace
+
+constexpr int EsdfMap::kBlockBits;
+constexpr int EsdfMap::kBlock;
+constexpr int EsdfMap::kBlockVoxels;
+
+EsdfMap::EsdfMap(const std::string &path, int cache_blocks)
+    : mapping_(nullptr), mapping_size_(0), voxels_(nullptr), cache_hits_(0), cache_misses_(0)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open the distance field " + path);
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(EsdfHeader)) {
+        close(fd);
+        throw std::runtime_error(path + " is not a distance field");
+    }
+    mapping_size_ = static_cast<size_t>(file_stat.st_size);
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error("Cannot map the distance field " + path);
+    }
+
+    EsdfHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+    size_ << header.size[0], header.size[1], header.size[2];
+    const size_t n_voxels = static_cast<size_t>(std::max(size_(0), 0)) * std::max(size_(1), 0) *
+                            std::max(size_(2), 0);
+    if (std::memcmp(header.magic, kEsdfMagic, sizeof(kEsdfMagic)) != 0 || size_.minCoeff() < 2 ||
+        !(header.resolution > 0.0) || mapping_size_ < sizeof(EsdfHeader) + n_voxels * sizeof(float)) {
+        munmap(mapping_, mapping_size_);
+        throw std::runtime_error(path + " is not a distance field");
+    }
+    origin_ << header.origin[0], header.origin[1], header.origin[2];
+    resolution_ = header.resolution;
+    voxels_ = reinterpret_cast<const float *>(static_cast<const char *>(mapping_) + sizeof(EsdfHeader));
+    blocks_ = (size_.array() - 2) / kBlock + 1;
+    size_t entries = 1;
+    while (entries < static_cast<size_t>(cache_blocks))
+        entries *= 2;
+    cache_.resize(entries);
+    cache_mask_ = static_cast<long long>(entries) - 1;
+}
+
+EsdfMap::~EsdfMap()
+{
+    if (mapping_ != nullptr)
+        munmap(mapping_, mapping_size_);
+}
+
+void EsdfMap::write(const std::string &path, const Eigen::Vector3i &size, const Eigen::Vector3d &origin,
+                    double resolution, const std::vector<float> &distances)
+{
+    if (static_cast<size_t>(size.prod()) != distances.size())
+        throw std::runtime_error("The distances do not fill the grid");
+    EsdfHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kEsdfMagic, sizeof(kEsdfMagic));
+    for (int i = 0; i < 3; i++) {
+        header.size[i] = size(i);
+        header.origin[i] = origin(i);
+    }
+    header.resolution = resolution;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(distances.data()), distances.size() * sizeof(float));
+    if (!file)
+        throw std::runtime_error("Cannot write the distance field " + path);
+}
+
+double EsdfMap::distance(const Eigen::Vector3d &p, Eigen::Vector3d *gradient)
+{
+    Eigen::Vector3i cell;
+    Eigen::Vector3d fraction;
+    locate(p, cell, fraction);
+    const Eigen::Vector3i block_index(cell(0) >> kBlockBits, cell(1) >> kBlockBits, cell(2) >> kBlockBits);
+    const Eigen::Vector3i local = cell - kBlock * block_index;
+    const float *values = block(block_index).values;
+    float corners[8];
+    for (int c = 0; c < 8; c++) {
+        const int i = local(0) + (c & 1), j = local(1) + ((c >> 1) & 1), k = local(2) + ((c >> 2) & 1);
+        corners[c] = values[i + kBlockVoxels * (j + kBlockVoxels * k)];
+    }
+    return interpolate(corners, fraction, gradient);
+}
+
+EsdfConstraint EsdfMap::linearize(const Eigen::Vector3d &p, double safe_distance)
+{
+    // d(p0) + g . (p - p0) >= safe_distance
+    EsdfConstraint constraint;
+    const double d0 = distance(p, &constraint.gradient);
+    constraint.bound = safe_distance - d0 + constraint.gradient.dot(p);
+    constraint.active = true;
+    return constraint;
+}
+
+double EsdfMap::distance_uncached(const Eigen::Vector3d &p, Eigen::Vector3d *gradient) const
+{
+    Eigen::Vector3i cell;
+    Eigen::Vector3d fraction;
+    locate(p, cell, fraction);
+    float corners[8];
+    for (int c = 0; c < 8; c++)
+        corners[c] = voxel(cell(0) + (c & 1), cell(1) + ((c >> 1) & 1), cell(2) + ((c >> 2) & 1));
+    return interpolate(corners, fraction, gradient);
+}
+
+void EsdfMap::locate(const Eigen::Vector3d &p, Eigen::Vector3i &cell, Eigen::Vector3d &fraction) const
+{
+    const Eigen::Vector3d grid = (p - origin_) / resolution_;
+    for (int i = 0; i < 3; i++) {
+        const double clamped = std::max(0.0, std::min(grid(i), static_cast<double>(size_(i) - 1)));
+        cell(i) = std::min(static_cast<int>(clamped), size_(i) - 2);
+        fraction(i) = clamped - cell(i);
+    }
+}
+
+const EsdfMap::CachedBlock &EsdfMap::block(const Eigen::Vector3i &block_index)
+{
+    // direct mapped, a block always goes to the same entry
+    const long long tag =
+        block_index(0) + static_cast<long long>(blocks_(0)) * (block_index(1) + static_cast<long long>(blocks_(1)) *
+                                                                                    block_index(2));
+    CachedBlock &entry = cache_[static_cast<size_t>(tag & cache_mask_)];
+    if (entry.tag == tag) {
+        cache_hits_++;
+        return entry;
+    }
+    cache_misses_++;
+    // the voxels of the block, held at the last one of the map past its end
+    const Eigen::Vector3i first = kBlock * block_index;
+    for (int k = 0; k < kBlockVoxels; k++) {
+        const int z = std::min(first(2) + k, size_(2) - 1);
+        for (int j = 0; j < kBlockVoxels; j++) {
+            const int y = std::min(first(1) + j, size_(1) - 1);
+            float *row = entry.values + kBlockVoxels * (j + kBlockVoxels * k);
+            for (int i = 0; i < kBlockVoxels; i++)
+                row[i] = voxel(std::min(first(0) + i, size_(0) - 1), y, z);
+        }
+    }
+    entry.tag = tag;
+    return entry;
+}
+
+double EsdfMap::interpolate(const float corners[8], const Eigen::Vector3d &fraction,
+                            Eigen::Vector3d *gradient) const
+{
+    const double fx = fraction(0), fy = fraction(1), fz = fraction(2);
+    // along x, then y, then z
+    const double c00 = corners[0] + fx * (corners[1] - corners[0]);
+    const double c10 = corners[2] + fx * (corners[3] - corners[2]);
+    const double c01 = corners[4] + fx * (corners[5] - corners[4]);
+    const double c11 = corners[6] + fx * (corners[7] - corners[6]);
+    const double c0 = c00 + fy * (c10 - c00);
+    const double c1 = c01 + fy * (c11 - c01);
+    if (gradient != nullptr) {
+        const double dx0 = (1.0 - fy) * (corners[1] - corners[0]) + fy * (corners[3] - corners[2]);
+        const double dx1 = (1.0 - fy) * (corners[5] - corners[4]) + fy * (corners[7] - corners[6]);
+        (*gradient)(0) = ((1.0 - fz) * dx0 + fz * dx1) / resolution_;
+        (*gradient)(1) = ((1.0 - fz) * (c10 - c00) + fz * (c11 - c01)) / resolution_;
+        (*gradient)(2) = (c1 - c0) / resolution_;
+    }
+    return c0 + fz * (c1 - c0);
+}
+
+}  // namespace mav_nmpc_tracker
@@ -0,0 +1,80 @@
+// acados
+#include "acados_c/ocp_nlp_interface.h"
+#include "acados/ocp_nlp/ocp_nlp_cost_ls.h"
+// blasfeo
+#include "blasfeo_d_aux.h"
+
+#include "mav_nmpc_tracker/horizon_io.h"
+
+#define NX     MAV_NMPC_TRACKER_MODEL_NX
+#define NU     MAV_NMPC_TRACKER_MODEL_NU
+#define NY     MAV_NMPC_TRACKER_MODEL_NY
+#define NYN    MAV_NMPC_TRACKER_MODEL_NYN
+
+
+int mav_nmpc_tracker_horizon_set_x0(mav_nmpc_tracker_model_solver_capsule *capsule, const double *x0)
+{
+    ocp_nlp_constraints_model_set(capsule->nlp_config, capsule->nlp_dims, capsule->nlp_in, 0, "lbx", (double *) x0);
+    ocp_nlp_constraints_model_set(capsule->nlp_config, capsule->nlp_dims, capsule->nlp_in, 0, "ubx", (double *) x0);
+    return 0;
+}
+
+
+int mav_nmpc_tracker_horizon_set_x_traj(mav_nmpc_tracker_model_solver_capsule *capsule, const double *x_traj)
+{
+    // ux is stored as [u; x; s] per stage
+    const int N = capsule->nlp_dims->N;
+    const int *nu = capsule->nlp_dims->nu;
+    struct blasfeo_dvec *ux = capsule->nlp_out->ux;
+    for (int i = 0; i <= N; i++)
+        blasfeo_pack_dvec(NX, (double *) x_traj + i*NX, 1, &ux[i], nu[i]);
+    return 0;
+}
+
+
+int mav_nmpc_tracker_horizon_set_u_traj(mav_nmpc_tracker_model_solver_capsule *capsule, const double *u_traj)
+{
+    const int N = capsule->nlp_dims->N;
+    struct blasfeo_dvec *ux = capsule->nlp_out->ux;
+    for (int i = 0; i < N; i++)
+        blasfeo_pack_dvec(NU, (double *) u_traj + i*NU, 1, &ux[i], 0);
+    return 0;
+}
+
+
+int mav_nmpc_tracker_horizon_set_yref_traj(mav_nmpc_tracker_model_solver_capsule *capsule,
+                                                const double *yref_traj, const double *yref_e)
+{
+    // all stages are LINEAR_LS, see nlp_solver_plan->nlp_cost
+    const int N = capsule->nlp_dims->N;
+    void **cost = capsule->nlp_in->cost;
+    for (int i = 0; i < N; i++)
+    {
+        ocp_nlp_cost_ls_model *model = (ocp_nlp_cost_ls_model *) cost[i];
+        blasfeo_pack_dvec(NY, (double *) yref_traj + i*NY, 1, &model->y_ref, 0);
+    }
+    ocp_nlp_cost_ls_model *model_e = (ocp_nlp_cost_ls_model *) cost[N];
+    blasfeo_pack_dvec(NYN, (double *) yref_e, 1, &model_e->y_ref, 0);
+    return 0;
+}
+
+
+int mav_nmpc_tracker_horizon_get_x_traj(mav_nmpc_tracker_model_solver_capsule *capsule, double *x_traj)
+{
+    const int N = capsule->nlp_dims->N;
+    const int *nu = capsule->nlp_dims->nu;
+    struct blasfeo_dvec *ux = capsule->nlp_out->ux;
+    for (int i = 0; i <= N; i++)
+        blasfeo_unpack_dvec(NX, &ux[i], nu[i], x_traj + i*NX, 1);
+    return 0;
+}
+
+
+int mav_nmpc_tracker_horizon_get_u_traj(mav_nmpc_tracker_model_solver_capsule *capsule, double *u_traj)
+{
+    const int N = capsule->nlp_dims->N;
+    struct blasfeo_dvec *ux = capsule->nlp_out->ux;
+    for (int i = 0; i < N; i++)
+        blasfeo_unpack_dvec(NU, &ux[i], 0, u_traj + i*NU, 1);
+    return 0;
+}
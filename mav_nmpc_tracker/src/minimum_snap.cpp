@@ -0,0 +1,168 @@
+#include "mav_nmpc_tracker/minimum_snap.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+typedef Eigen::Matrix<double, 3, 8> Coefficients;
+
+// inverse of the end conditions of the powers 4 to 7 of the normalized time: position, velocity,
+// acceleration and jerk at 1, rows of [1 1 1 1; 4 5 6 7; 12 20 30 42; 24 60 120 210]
+const double kEndInverse[4][4] = {
+    {35.0, -15.0, 5.0 / 2.0, -1.0 / 6.0},
+    {-84.0, 39.0, -7.0, 1.0 / 2.0},
+    {70.0, -34.0, 13.0 / 2.0, -1.0 / 2.0},
+    {-20.0, 10.0, -2.0, 1.0 / 6.0},
+};
+
+// peak speed and acceleration of the rest to rest transition over the distance D in T: D / T and D / T^2 times
+const double kRestPeakVelocity = 2.1875;
+const double kRestPeakAcceleration = 7.5132;
+
+// the duration grows by a factor in between these while the limits are exceeded, at most kDurationIterations
+// times; with an acceleration at the start the peaks grow again past some duration
+const double kMinGrowth = 1.02;
+const double kMaxGrowth = 2.0;
+const int kDurationIterations = 8;
+// samples of the normalized time the peaks are taken at
+const int kPeakSamples = 32;
+
+// the value at tau of ascending powers, Horner's scheme
+template <typename Derived>
+Eigen::Vector3d horner(const Eigen::MatrixBase<Derived> &coefficients, double tau)
+{
+    Eigen::Vector3d value = coefficients.col(coefficients.cols() - 1);
+    for (int k = static_cast<int>(coefficients.cols()) - 2; k >= 0; k--)
+        value = value * tau + coefficients.col(k);
+    return value;
+}
+
+// peak speed and acceleration of normalized coefficients over a duration
+void sampled_peaks(const Coefficients &c, double duration, double &velocity, double &acceleration)
+{
+    Eigen::Matrix<double, 3, 7> dc;
+    Eigen::Matrix<double, 3, 6> ddc;
+    for (int k = 1; k < 8; k++)
+        dc.col(k - 1) = k * c.col(k);
+    for (int k = 1; k < 7; k++)
+        ddc.col(k - 1) = k * dc.col(k);
+    velocity = 0.0;
+    acceleration = 0.0;
+    for (int i = 0; i <= kPeakSamples; i++) {
+        const double tau = static_cast<double>(i) / kPeakSamples;
+        velocity = std::max(velocity, horner(dc, tau).norm());
+        acceleration = std::max(acceleration, horner(ddc, tau).norm());
+    }
+    velocity /= duration;
+    acceleration /= duration * duration;
+}
+
+}  // namespace
+
+Coefficients MinimumSnapTrajectory::normalized_coefficients(const Eigen::Vector3d &p0, const Eigen::Vector3d &v0,
+                                                            const Eigen::Vector3d &a0,
+                                                            const Eigen::Vector3d &target, double duration)
+{
+    // the start fixes the powers 0 to 3, its jerk is 0
+    Coefficients c;
+    c.col(0) = p0;
+    c.col(1) = duration * v0;
+    c.col(2) = 0.5 * duration * duration * a0;
+    c.col(3).setZero();
+    // what the powers 4 to 7 have to add at the end for the target at rest
+    Eigen::Matrix<double, 3, 4> residual;
+    residual.col(0) = target - c.col(0) - c.col(1) - c.col(2);
+    residual.col(1) = -c.col(1) - 2.0 * c.col(2);
+    residual.col(2) = -2.0 * c.col(2);
+    residual.col(3).setZero();
+    for (int k = 0; k < 4; k++) {
+        c.col(4 + k) = kEndInverse[k][0] * residual.col(0) + kEndInverse[k][1] * residual.col(1) +
+                       kEndInverse[k][2] * residual.col(2) + kEndInverse[k][3] * residual.col(3);
+    }
+    return c;
+}
+
+void MinimumSnapTrajectory::plan(double start_time, const Eigen::Vector3d &p0, const Eigen::Vector3d &v0,
+                                 const Eigen::Vector3d &a0, const Eigen::Vector3d &target,
+                                 const MinimumSnapLimits &limits)
+{
+    // the limits cannot hold below the start itself
+    const double velocity_limit = std::max(limits.velocity, v0.norm());
+    const double acceleration_limit = std::max(limits.acceleration, a0.norm());
+
+    // from the bounds of the rest to rest transition, longer while the sampled peaks exceed the limits
+    const double distance = (target - p0).norm();
+    double duration = std::max({limits.min_duration, kRestPeakVelocity * distance / velocity_limit,
+                                std::sqrt(kRestPeakAcceleration * distance / acceleration_limit)});
+    Coefficients c = normalized_coefficients(p0, v0, a0, target, duration);
+    // the duration exceeding the limits least, once they hold or a longer one exceeds them more
+    double best_duration = duration, best_ratio = std::numeric_limits<double>::infinity();
+    for (int iIteration = 0; iIteration < kDurationIterations; iIteration++) {
+        double velocity, acceleration;
+        sampled_peaks(c, duration, velocity, acceleration);
+        const double ratio = std::max(velocity / velocity_limit, std::sqrt(acceleration / acceleration_limit));
+        if (ratio >= best_ratio)
+            break;
+        best_duration = duration;
+        best_ratio = ratio;
+        if (ratio <= 1.0)
+            break;
+        duration *= std::min(std::max(ratio, kMinGrowth), kMaxGrowth);
+        c = normalized_coefficients(p0, v0, a0, target, duration);
+    }
+    if (duration != best_duration) {
+        duration = best_duration;
+        c = normalized_coefficients(p0, v0, a0, target, duration);
+    }
+
+    // in powers of the time from the start
+    coefficients_.resize(3, 8);
+    double scale = 1.0;
+    for (int k = 0; k < 8; k++) {
+        coefficients_.col(k) = c.col(k) * scale;
+        scale /= duration;
+    }
+    velocity_coefficients_.resize(3, 7);
+    for (int k = 1; k < 8; k++)
+        velocity_coefficients_.col(k - 1) = k * coefficients_.col(k);
+    acceleration_coefficients_.resize(3, 6);
+    for (int k = 1; k < 7; k++)
+        acceleration_coefficients_.col(k - 1) = k * velocity_coefficients_.col(k);
+    start_time_ = start_time;
+    duration_ = duration;
+    start_ = p0;
+    target_ = target;
+    empty_ = false;
+}
+
+void MinimumSnapTrajectory::evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                                     Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations) const
+{
+    assert(!empty_);
+    const int n = static_cast<int>(offsets.size());
+    positions.resize(3, n);
+    velocities.resize(3, n);
+    if (accelerations != nullptr)
+        accelerations->resize(3, n);
+    for (int i = 0; i < n; i++) {
+        const double t = t0 + offsets[i] - start_time_;
+        if (t < 0.0 || t >= duration_) {
+            positions.col(i) = t < 0.0 ? start_ : target_;
+            velocities.col(i).setZero();
+            if (accelerations != nullptr)
+                accelerations->col(i).setZero();
+            continue;
+        }
+        positions.col(i) = horner(coefficients_, t);
+        velocities.col(i) = horner(velocity_coefficients_, t);
+        if (accelerations != nullptr)
+            accelerations->col(i) = horner(acceleration_coefficients_, t);
+    }
+}
+
+}  // namespace mav_nmpc_tracker
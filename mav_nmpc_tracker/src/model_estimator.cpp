@@ -0,0 +1,139 @@
+#include "mav_nmpc_tracker/model_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+double clamp(double value, double low, double high)
+{
+    return std::min(std::max(value, low), high);
+}
+
+// the first order model theta = [gain / tau, 1 / tau] of a time constant and a gain
+Eigen::Vector2d first_order_theta(double time_constant, double gain)
+{
+    return Eigen::Vector2d(gain / time_constant, 1.0 / time_constant);
+}
+
+}  // namespace
+
+void ModelEstimate::apply(MpcFormulationParam &param) const
+{
+    param.thrust_scale = thrust_scale;
+    param.drag_coefficient_x = drag_coefficient_x;
+    param.drag_coefficient_y = drag_coefficient_y;
+    param.roll_time_constant = roll_time_constant;
+    param.roll_gain = roll_gain;
+    param.pitch_time_constant = pitch_time_constant;
+    param.pitch_gain = pitch_gain;
+}
+
+ModelEstimator::ModelEstimator(const MpcFormulationParam &param, const ModelEstimatorParam &estimator_param)
+    : nominal_(param),
+      estimator_param_(estimator_param),
+      // initial covariances about the square of the parameters, the trace never above it
+      roll_(first_order_theta(param.roll_time_constant, param.roll_gain), 10.0, estimator_param.forgetting, 20.0),
+      pitch_(first_order_theta(param.pitch_time_constant, param.pitch_gain), 10.0, estimator_param.forgetting,
+             20.0),
+      thrust_(RecursiveLeastSquares<1>::Vector(param.thrust_scale), param.thrust_scale * param.thrust_scale,
+              estimator_param.forgetting, param.thrust_scale * param.thrust_scale),
+      drag_x_(RecursiveLeastSquares<1>::Vector(param.drag_coefficient_x), 1e-3, estimator_param.forgetting, 1e-3),
+      drag_y_(RecursiveLeastSquares<1>::Vector(param.drag_coefficient_y), 1e-3, estimator_param.forgetting, 1e-3),
+      command_count_(0),
+      has_last_(false),
+      last_time_(0.0)
+{
+    command_time_[0] = command_time_[1] = 0.0;
+    command_[0].setZero();
+    command_[1].setZero();
+    last_x_.setZero();
+}
+
+void ModelEstimator::add_command(double t, double roll_cmd, double pitch_cmd, double thrust_cmd)
+{
+    command_time_[0] = command_time_[1];
+    command_[0] = command_[1];
+    command_time_[1] = t;
+    command_[1] = Eigen::Vector3d(roll_cmd, pitch_cmd, thrust_cmd);
+    command_count_ = std::min(command_count_ + 1, 2);
+}
+
+void ModelEstimator::add_odometry(double t, const StateVector &x)
+{
+    const double dt = t - last_time_;
+    if (has_last_ && dt < estimator_param_.min_sample_dt && dt >= 0.0)
+        return;
+    const bool usable = has_last_ && dt <= estimator_param_.max_sample_dt && dt > 0.0;
+    const StateVector x_last = last_x_;
+    has_last_ = true;
+    last_time_ = t;
+    last_x_ = x;
+    if (!usable || command_count_ == 0)
+        return;
+
+    // the command held since the last measurement, an interval with a command change is skipped
+    int iCommand = 1;
+    if (command_time_[1] > t - dt) {
+        if (command_time_[1] < t || command_count_ < 2 || command_time_[0] > t - dt)
+            return;
+        iCommand = 0;
+    }
+    const Eigen::Vector3d &u = command_[iCommand];
+    if (u(2) <= 0.0)
+        return;
+
+    // forward differences, the regressors at the last measurement
+    const double roll = x_last(6), pitch = x_last(7), yaw = x_last(8);
+    const double cr = std::cos(roll), sr = std::sin(roll);
+    const double cp = std::cos(pitch), sp = std::sin(pitch);
+    const double cy = std::cos(yaw), sy = std::sin(yaw);
+    const double vx = x_last(3), vy = x_last(4), vz = x_last(5);
+    const Eigen::Vector3d acc = (x.segment<3>(3) - x_last.segment<3>(3)) / dt;
+
+    // roll_dot = gain / tau * roll_cmd - 1 / tau * roll, with the attitude at the middle of the interval
+    roll_.update(Eigen::Vector2d(u(0), -0.5 * (roll + x(6))), (x(6) - roll) / dt);
+    pitch_.update(Eigen::Vector2d(u(1), -0.5 * (pitch + x(7))), (x(7) - pitch) / dt);
+
+    // az + g = cos(pitch) cos(roll) thrust_scale / mass * thrust_cmd
+    thrust_.update(RecursiveLeastSquares<1>::Vector(cp * cr * u(2)), (acc(2) + g) * nominal_.mass);
+
+    // ax = thrust x_body(x) - drag_x thrust (x_body . v), the same for y, with the thrust of the estimate
+    const double thrust =
+        clamp(thrust_.theta()(0), nominal_.thrust_scale / estimator_param_.bound_ratio,
+              nominal_.thrust_scale * estimator_param_.bound_ratio) * u(2) / nominal_.mass;
+    const double x_body_x = cr * cy * sp + sr * sy;
+    const double y_body_y = cr * sp * sy - cy * sr;
+    drag_x_.update(RecursiveLeastSquares<1>::Vector(thrust * (cp * cy * vx - cp * sy * vy + sp * vz)),
+                   x_body_x * thrust - acc(0));
+    drag_y_.update(RecursiveLeastSquares<1>::Vector(
+                       thrust * ((cr * sy - cy * sp * sr) * vx - (cr * cy + sp * sr * sy) * vy - cp * sr * vz)),
+                   y_body_y * thrust - acc(1));
+}
+
+ModelEstimate ModelEstimator::estimate() const
+{
+    const double ratio = estimator_param_.bound_ratio;
+    ModelEstimate estimate;
+    estimate.thrust_scale = clamp(thrust_.theta()(0), nominal_.thrust_scale / ratio, nominal_.thrust_scale * ratio);
+    estimate.drag_coefficient_x = clamp(drag_x_.theta()(0), 0.0, estimator_param_.drag_max);
+    estimate.drag_coefficient_y = clamp(drag_y_.theta()(0), 0.0, estimator_param_.drag_max);
+
+    // tau = 1 / theta(1), gain = theta(0) / theta(1)
+    const Eigen::Vector2d &roll = roll_.theta();
+    const Eigen::Vector2d &pitch = pitch_.theta();
+    estimate.roll_time_constant = clamp(1.0 / std::max(roll(1), 1e-6), nominal_.roll_time_constant / ratio,
+                                        nominal_.roll_time_constant * ratio);
+    estimate.roll_gain = clamp(roll(0) / std::max(roll(1), 1e-6), nominal_.roll_gain / ratio,
+                               nominal_.roll_gain * ratio);
+    estimate.pitch_time_constant = clamp(1.0 / std::max(pitch(1), 1e-6), nominal_.pitch_time_constant / ratio,
+                                         nominal_.pitch_time_constant * ratio);
+    estimate.pitch_gain = clamp(pitch(0) / std::max(pitch(1), 1e-6), nominal_.pitch_gain / ratio,
+                                nominal_.pitch_gain * ratio);
+    estimate.converged = samples() >= estimator_param_.min_samples;
+    return estimate;
+}
+
+}  // namespace mav_nmpc_tracker
@@ -0,0 +1,207 @@
+#include "mav_nmpc_tracker/moving_horizon_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+double wrap_angle(double angle)
+{
+    return std::atan2(std::sin(angle), std::cos(angle));
+}
+
+}  // namespace
+
+MovingHorizonEstimator::MovingHorizonEstimator(const std::string &json_file, const MpcFormulationParam &param,
+                                               const MheParam &mhe_param)
+    : mhe_param_(mhe_param)
+{
+    const SolverDescriptor descriptor = read_solver_descriptor(json_file);
+    if (descriptor.nx != kMheNx || descriptor.nu != kMheNw || descriptor.ny != kMheNy || descriptor.ny_e != kNx ||
+        descriptor.np != kMheNp)
+        throw std::runtime_error(json_file + " is not an MHE of the model, generate it with "
+                                             "scripts/nmpc_tracker_solver.py --mhe");
+    library_ = SolverLibrary::open(descriptor);
+    N_ = descriptor.N;
+
+    capsule_ = library_->create_capsule();
+    if (capsule_ == nullptr) {
+        throw std::runtime_error("Failed to allocate the acados MHE capsule");
+    }
+    std::vector<double> time_steps = descriptor.time_steps;
+    int status = library_->create_with_discretization(capsule_, N_, time_steps.data());
+    if (status != 0) {
+        library_->free_capsule(capsule_);
+        throw std::runtime_error(descriptor.model_name + "_acados_create() returned status " +
+                                 std::to_string(status));
+    }
+
+    nlp_config_ = library_->get_nlp_config(capsule_);
+    nlp_dims_ = library_->get_nlp_dims(capsule_);
+    nlp_in_ = library_->get_nlp_in(capsule_);
+    nlp_out_ = library_->get_nlp_out(capsule_);
+    nlp_solver_ = library_->get_nlp_solver(capsule_);
+    nlp_opts_ = library_->get_nlp_opts(capsule_);
+
+    set_weights(mhe_param_);
+    set_model_params(model_params(param));
+    t_window_.setZero(N_ + 1);
+    y_window_.setZero(kNx, N_ + 1);
+    u_window_.setZero(kNu, N_);
+    x_init_.setZero(kMheNx, N_ + 1);
+    w_init_.setZero(kMheNw, N_);
+    reset();
+}
+
+MovingHorizonEstimator::~MovingHorizonEstimator()
+{
+    library_->free_solver(capsule_);
+    library_->free_capsule(capsule_);
+}
+
+void MovingHorizonEstimator::set_weights(const MheParam &mhe_param)
+{
+    // column major, diagonal only: measurement, process noise, then the arrival cost on stage 0
+    double w_diag[kMheNy0];
+    for (int i = 0; i < 3; i++) {
+        w_diag[i] = mhe_param.r_pos;
+        w_diag[3 + i] = mhe_param.r_vel;
+        w_diag[6 + i] = mhe_param.r_att;
+        w_diag[kNx + i] = mhe_param.q_pos;
+        w_diag[kNx + 3 + i] = mhe_param.q_vel;
+        w_diag[kNx + 6 + i] = mhe_param.q_att;
+        w_diag[kNx + 9 + i] = mhe_param.q_dist;
+    }
+    for (int i = 0; i < kNx; i++)
+        w_diag[kMheNy + i] = mhe_param.p0_state;
+    for (int i = kNx; i < kMheNx; i++)
+        w_diag[kMheNy + i] = mhe_param.p0_dist;
+
+    double W_0[kMheNy0 * kMheNy0] = {0.0};
+    for (int i = 0; i < kMheNy0; i++)
+        W_0[i + kMheNy0 * i] = w_diag[i];
+    ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, 0, "W", W_0);
+
+    double W[kMheNy * kMheNy] = {0.0};
+    for (int i = 0; i < kMheNy; i++)
+        W[i + kMheNy * i] = w_diag[i];
+    for (int iStage = 1; iStage < N_; iStage++)
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "W", W);
+
+    double W_e[kNx * kNx] = {0.0};
+    for (int i = 0; i < kNx; i++)
+        W_e[i + kNx * i] = w_diag[i];
+    ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, N_, "W", W_e);
+}
+
+void MovingHorizonEstimator::reset()
+{
+    samples_ = 0;
+    x_prior_.setZero();
+    state_.setZero();
+    disturbance_.setZero();
+}
+
+void MovingHorizonEstimator::add_measurement(double t, const StateVector &y, const InputVector &u)
+{
+    if (samples_ > 0) {
+        const double dt = t - t_window_(N_);
+        if (dt <= 0.0)
+            return;
+        if (dt > mhe_param_.max_sample_dt)
+            reset();
+    }
+    // yaw continuous over the window
+    StateVector y_sample = y;
+    if (samples_ > 0)
+        y_sample(8) = y_window_(8, N_) + wrap_angle(y(8) - y_window_(8, N_));
+    const Eigen::Vector3d disturbance_last =
+        samples_ > 0 ? Eigen::Vector3d(x_init_.col(N_).tail<3>()) : Eigen::Vector3d::Zero();
+
+    // the oldest sample leaves the window
+    t_window_.head(N_) = t_window_.tail(N_).eval();
+    y_window_.leftCols(N_) = y_window_.rightCols(N_).eval();
+    u_window_.leftCols(N_ - 1) = u_window_.rightCols(N_ - 1).eval();
+    x_init_.leftCols(N_) = x_init_.rightCols(N_).eval();
+    w_init_.leftCols(N_ - 1) = w_init_.rightCols(N_ - 1).eval();
+    t_window_(N_) = t;
+    y_window_.col(N_) = y_sample;
+    u_window_.col(N_ - 1) = u;
+    x_init_.col(N_) << y_sample, disturbance_last;
+    w_init_.col(N_ - 1).setZero();
+    // the estimate of the new first stage, before the sample left, is its prior
+    x_prior_ = x_init_.col(0);
+    samples_ = std::min(samples_ + 1, N_ + 1);
+
+    state_ = y;
+}
+
+int MovingHorizonEstimator::update()
+{
+    if (!ready())
+        return -1;
+
+    // the steps between the samples, and the commands held over them
+    Eigen::Matrix<double, kMheNp, 1> p;
+    for (int iStage = 0; iStage < N_; iStage++) {
+        double Ts = std::max(t_window_(iStage + 1) - t_window_(iStage), 1e-3);
+        ocp_nlp_in_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "Ts", &Ts);
+        ocp_nlp_dynamics_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "T", &Ts);
+        p << u_window_.col(iStage), model_params_;
+        library_->update_params(capsule_, iStage, p.data(), kMheNp);
+    }
+    library_->update_params(capsule_, N_, p.data(), kMheNp);
+
+    // measurements, zero process noise, and the prior on the first stage
+    Eigen::Matrix<double, kMheNy0, 1> yref_0;
+    yref_0 << y_window_.col(0), Eigen::Matrix<double, kMheNw, 1>::Zero(), x_prior_;
+    ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, 0, "yref", yref_0.data());
+    Eigen::Matrix<double, kMheNy, 1> yref = Eigen::Matrix<double, kMheNy, 1>::Zero();
+    for (int iStage = 1; iStage < N_; iStage++) {
+        yref.head<kNx>() = y_window_.col(iStage);
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "yref", yref.data());
+    }
+    StateVector yref_e = y_window_.col(N_);
+    ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, N_, "yref", yref_e.data());
+
+    // warm start with the shifted last solution
+    for (int iStage = 0; iStage <= N_; iStage++)
+        ocp_nlp_out_set(nlp_config_, nlp_dims_, nlp_out_, iStage, "x", x_init_.col(iStage).data());
+    for (int iStage = 0; iStage < N_; iStage++)
+        ocp_nlp_out_set(nlp_config_, nlp_dims_, nlp_out_, iStage, "u", w_init_.col(iStage).data());
+
+    int rti_phase = 0;
+    ocp_nlp_solver_opts_set(nlp_config_, nlp_opts_, "rti_phase", &rti_phase);
+    const int status = library_->solve(capsule_);
+    if (status != 0)
+        return status;
+
+    for (int iStage = 0; iStage <= N_; iStage++)
+        ocp_nlp_out_get(nlp_config_, nlp_dims_, nlp_out_, iStage, "x", x_init_.col(iStage).data());
+    for (int iStage = 0; iStage < N_; iStage++)
+        ocp_nlp_out_get(nlp_config_, nlp_dims_, nlp_out_, iStage, "u", w_init_.col(iStage).data());
+    state_ = x_init_.col(N_).head<kNx>();
+    state_(8) = wrap_angle(state_(8));
+    disturbance_ = x_init_.col(N_).tail<3>();
+    return status;
+}
+
+void MovingHorizonEstimator::set_model_params(const ModelParamVector &p)
+{
+    model_params_ = p;
+    // the disturbance is a state here
+    model_params_.tail<3>().setZero();
+}
+
+double MovingHorizonEstimator::get_time_tot() const
+{
+    double time_tot = 0.0;
+    ocp_nlp_get(nlp_config_, nlp_solver_, "time_tot", &time_tot);
+    return time_tot;
+}
+
+}  // namespace mav_nmpc_tracker
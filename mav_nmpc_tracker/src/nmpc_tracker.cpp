@@ -0,0 +1,1381 @@
+#include "mav_nmpc_tracker/nmpc_tracker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <geometry_msgs/Point.h>
+#include <tf/transform_datatypes.h>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// header stamps that are unset or from an unsynchronized clock are not used
+bool stamp_usable(const ros::Time &stamp, const ros::Time &received)
+{
+    if (stamp.isZero())
+        return false;
+    const double delay = (received - stamp).toSec();
+    return delay > -0.005 && delay < 1.0;
+}
+
+// m and m/s, below which the points of a trajectory are the same
+constexpr double kStationaryTolerance = 1e-3;
+
+// s between two updates of the model of the solvers by the estimate
+constexpr double kModelEstimatePeriod = 1.0;
+
+}  // namespace
+
+MavNmpcTracker::MavNmpcTracker(ros::NodeHandle &nh, const MpcFormulationParam &mpc_form_param,
+                               const std::string &tracking_mode, const std::string &yaw_command_mode,
+                               const NmpcTrackerOptions &options)
+    : mpc_form_param_(mpc_form_param),
+      tracking_mode_(tracking_mode),
+      yaw_command_mode_(yaw_command_mode),
+      options_(options)
+{
+    // mav mass, and settings
+    mass_ = mpc_form_param_.mass;
+    thrust_scale_ = mpc_form_param_.thrust_scale;
+    odom_time_out_ = 0.2;
+    traj_time_out_ = 1.0;
+    traj_buffer_ = TrajectoryBuffer(options_.traj_buffer_size);
+
+    // state
+    mav_state_current_.setZero();
+
+    // MPC variables
+    mpc_x_next_.setZero();
+    mpc_u_now_.setZero();
+    mpc_feasible_ = false;
+    mpc_success_ = false;
+    mpc_prepared_ = false;
+    mpc_start_time_ = 0.0;
+
+    // MPC solver, on the model of the configuration until it is identified
+    model_param_ = mpc_form_param_;
+    mpc_solver_ = nullptr;
+    mpc_solver_index_ = -1;
+    mpc_track_solver_index_ = -1;
+    mpc_stationary_solver_index_ = -1;
+    if (options_.speculative_solve) {
+        mpc_speculative_solver_.reset(new SpeculativeSolver(mpc_form_param_, options_.speculative_cpu_warm,
+                                                            options_.speculative_cpu_cold,
+                                                            options_.speculative_deadline));
+        if (options_.rti_split)
+            ROS_WARN("The RTI split is not used with speculative solves.");
+        if (!options_.solver_variants.empty())
+            ROS_WARN("Solver variants are not used with speculative solves.");
+        const std::vector<double> time_steps = horizon_time_steps(mpc_form_param_);
+        mpc_stage_times_ = stage_times(time_steps);
+        mpc_dt_ = time_steps.front();
+        mpc_N_ = static_cast<int>(time_steps.size());
+        mpc_Tf_ = mpc_stage_times_.back();
+        mpc_stage_times_.pop_back();
+        resize_mpc_variables();
+        mpc_warm_start_.reset(new WarmStart(mpc_form_param_, options_.warm_start));
+    } else {
+        load_solver_variants();
+    }
+    if (options_.predict_delay) {
+        state_predictor_.reset(new StatePredictor(options_.predict_max_horizon));
+        state_predictor_->set_model_params(model_params(mpc_form_param_));
+    }
+    if (kNp < kNumModelParams)
+        ROS_WARN("The linked solver was generated without model parameters, its dynamics are the ones it was "
+                 "generated with. Regenerate it with scripts/nmpc_tracker_solver.py.");
+    last_command_ << 0.0, 0.0, g;
+    mhe_status_ = -1;
+    mhe_time_ = 0.0;
+    if (!options_.mhe_solver.empty()) {
+        mhe_.reset(new MovingHorizonEstimator(options_.mhe_solver, mpc_form_param_, options_.mhe));
+        ROS_INFO("MHE over %d odometry samples.", mhe_->N() + 1);
+    }
+    disturbance_.setZero();
+    if (options_.offset_free && !mhe_)
+        disturbance_observer_.reset(new DisturbanceObserver(mpc_form_param_, options_.disturbance_observer));
+    if (options_.offset_free && mpc_speculative_solver_)
+        ROS_WARN("The disturbance only shifts the input reference with speculative solves.");
+    model_estimate_samples_ = 0;
+    model_estimate_applied_time_ = ros::Time::now();
+    if (options_.estimate_model) {
+        model_estimator_.reset(new ModelEstimator(mpc_form_param_, options_.model_estimator));
+        model_estimate_ = model_estimator_->estimate();
+        if (mpc_speculative_solver_)
+            ROS_WARN("The model estimate only corrects the thrust scale with speculative solves.");
+    }
+
+    // ROS subscriber
+    odom_sub_ = nh.subscribe("/mavros/local_position/odom_local", 1, &MavNmpcTracker::set_odom, this,
+                             ros::TransportHints().tcpNoDelay());
+    received_first_odom_ = false;
+    odom_received_time_ = ros::Time::now();
+    odom_stamp_time_ = odom_received_time_;
+    // queued, a long trajectory sent at once must not be dropped for the next message
+    traj_sub_ = nh.subscribe("/command/trajectory", 10, &MavNmpcTracker::set_traj_ref, this);
+    polynomial_sub_ = nh.subscribe("/command/polynomial_trajectory", 1, &MavNmpcTracker::set_polynomial_ref, this);
+    goto_sub_ = nh.subscribe("/command/goto", 1, &MavNmpcTracker::set_goto, this);
+    traj_source_ = ReferenceSource::kPoints;
+    traj_source_msg_ = traj_source_;
+    polynomial_updated_ = false;
+    polynomial_msg_start_ = 0.0;
+    goto_msg_.setZero();
+    goto_updated_ = false;
+    traj_horizon_ = mpc_form_param_.Tf;
+    for (const std::unique_ptr<NmpcTrackerSolver> &solver : mpc_solvers_)
+        traj_horizon_ = std::max(traj_horizon_, stage_times(solver->time_steps()).back());
+    traj_stationary_ = true;
+    traj_yaw_ref_ = 0.0;
+    if (!options_.trajectory_library.empty()) {
+        try {
+            traj_library_.reset(new TrajectoryLibrary(options_.trajectory_library));
+            library_playback_msg_.seek(traj_library_->start_time(), ros::Time::now().toSec());
+            traj_playback_ = library_playback_msg_;
+            library_service_ =
+                nh.advertiseService("/mpc/trajectory_library", &MavNmpcTracker::set_library_playback, this);
+            ROS_INFO("Trajectory library %s: %lld samples in %d segments, %.1f s.",
+                     options_.trajectory_library.c_str(), traj_library_->sample_count(),
+                     traj_library_->segment_count(), traj_library_->end_time() - traj_library_->start_time());
+        } catch (const std::exception &e) {
+            ROS_ERROR("Trajectory library not used: %s", e.what());
+        }
+    }
+    solver_variant_sub_ = nh.subscribe("/mpc/solver_variant", 1, &MavNmpcTracker::set_solver_variant, this);
+    corridors_updated_ = false;
+    if (options_.corridors) {
+        corridor_sub_ = nh.subscribe("/traj_opt/corridors", 1, &MavNmpcTracker::set_corridors, this);
+        if (mpc_speculative_solver_)
+            ROS_WARN("Corridors are not used with speculative solves.");
+        for (size_t iSolver = 0; iSolver < mpc_solvers_.size(); iSolver++)
+            if (!mpc_solvers_[iSolver]->has_corridor_constraints())
+                ROS_WARN("Solver variant %s has no corridor constraints, generate it with --corridor_faces %d.",
+                         mpc_solver_names_[iSolver].c_str(), kCorridorFaces);
+    }
+    obstacles_updated_ = false;
+    obstacle_index_ = ObstacleIndex(options_.obstacle_index);
+    if (options_.obstacles) {
+        obstacle_sub_ = nh.subscribe("/traj_opt/obstacles", 1, &MavNmpcTracker::set_obstacles, this);
+        if (mpc_speculative_solver_)
+            ROS_WARN("Obstacles are not used with speculative solves.");
+        for (size_t iSolver = 0; iSolver < mpc_solvers_.size(); iSolver++)
+            if (!mpc_solvers_[iSolver]->has_obstacle_constraints())
+                ROS_WARN("Solver variant %s has no obstacle constraints, generate it with --obstacle_slots %d.",
+                         mpc_solver_names_[iSolver].c_str(), kObstacleSlots);
+    }
+    if (!options_.esdf_map.empty() && mpc_speculative_solver_) {
+        ROS_WARN("The distance field is not used with speculative solves.");
+    } else if (!options_.esdf_map.empty()) {
+        try {
+            esdf_map_.reset(new EsdfMap(options_.esdf_map, options_.esdf_cache_blocks));
+            ROS_INFO("Distance field %s: %d x %d x %d voxels of %.2f m.", options_.esdf_map.c_str(),
+                     esdf_map_->size()(0), esdf_map_->size()(1), esdf_map_->size()(2), esdf_map_->resolution());
+        } catch (const std::exception &e) {
+            ROS_ERROR("Distance field not used: %s", e.what());
+        }
+    }
+    if (esdf_map_) {
+        for (size_t iSolver = 0; iSolver < mpc_solvers_.size(); iSolver++)
+            if (!mpc_solvers_[iSolver]->has_esdf_constraints())
+                ROS_WARN("Solver variant %s has no distance field constraints, generate it with --esdf_rows %d.",
+                         mpc_solver_names_[iSolver].c_str(), kEsdfRows);
+    }
+
+    odom_state_.setZero();
+    odom_stamp_ = odom_received_time_;
+    odom_count_ = 0;
+
+    // ROS publisher
+    roll_pitch_yawrate_thrust_cmd_.setZero();
+    roll_pitch_yawrate_thrust_cmd_pub_ = nh.advertise<mav_msgs::RollPitchYawrateThrust>(
+        "/mav_roll_pitch_yawrate_thrust_cmd", 1);
+    roll_pitch_yaw_thrust_cmd_.setZero();
+    roll_pitch_yaw_thrust_cmd_pub_ = nh.advertise<mavros_msgs::AttitudeTarget>(
+        "/mav_roll_pitch_yaw_thrust_cmd", 1);
+
+    mpc_traj_plan_vis_pub_ = nh.advertise<visualization_msgs::Marker>("/mpc/trajectory_plan_vis", 1);
+    mpc_timing_pub_ = nh.advertise<std_msgs::Float64MultiArray>("/mpc/solver_timing", 1);
+    if (mhe_)
+        mhe_estimate_pub_ = nh.advertise<std_msgs::Float64MultiArray>("/mpc/mhe_estimate", 1);
+    if (options_.offset_free)
+        disturbance_pub_ = nh.advertise<std_msgs::Float64MultiArray>("/mpc/disturbance", 1);
+    if (model_estimator_)
+        model_estimate_pub_ = nh.advertise<std_msgs::Float64MultiArray>("/mpc/model_estimate", 1);
+
+    // odometry-triggered control
+    control_running_ = true;
+    control_triggered_ = false;
+    control_busy_ = false;
+    if (options_.control_trigger == "odometry")
+        control_thread_ = std::thread(&MavNmpcTracker::control_thread_loop, this);
+
+    // high-rate commands
+    command_interpolator_ = CommandInterpolator(options_.command_interpolator);
+    command_running_ = options_.command_rate > 0.0;
+    if (command_running_)
+        command_thread_ = std::thread(&MavNmpcTracker::command_thread_loop, this);
+}
+
+MavNmpcTracker::~MavNmpcTracker()
+{
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        control_running_ = false;
+    }
+    control_cv_.notify_one();
+    if (control_thread_.joinable())
+        control_thread_.join();
+    command_running_ = false;
+    if (command_thread_.joinable())
+        command_thread_.join();
+}
+
+void MavNmpcTracker::set_odom(const nav_msgs::Odometry::ConstPtr &odom_msg)
+{
+    // read data
+    const ros::Time time_now = ros::Time::now();
+    const tf::Quaternion q(odom_msg->pose.pose.orientation.x, odom_msg->pose.pose.orientation.y,
+                           odom_msg->pose.pose.orientation.z, odom_msg->pose.pose.orientation.w);
+    double roll, pitch, yaw;
+    tf::Matrix3x3(q).getRPY(roll, pitch, yaw);
+    bool trigger;
+    {
+        std::lock_guard<std::mutex> lock(data_mutex_);
+        odom_time_ = time_now;
+        if (stamp_usable(odom_msg->header.stamp, time_now)) {
+            odom_stamp_ = odom_msg->header.stamp;
+            odom_delay_.add((time_now - odom_stamp_).toSec());
+        } else {
+            odom_stamp_ = time_now - ros::Duration(odom_delay_.estimate());
+        }
+        odom_state_ << odom_msg->pose.pose.position.x, odom_msg->pose.pose.position.y,
+            odom_msg->pose.pose.position.z, odom_msg->twist.twist.linear.x, odom_msg->twist.twist.linear.y,
+            odom_msg->twist.twist.linear.z, roll, pitch, yaw;
+        odom_count_++;
+        if (model_estimator_)
+            model_estimator_->add_odometry(odom_stamp_.toSec(), odom_state_);
+        trigger = (odom_count_ % options_.odom_decimation == 0);
+    }
+    // the latest odometry for the feedback of the output thread, the only writer
+    if (command_thread_.joinable()) {
+        StateSample &sample = odom_handoff_.back();
+        sample.time = odom_stamp_.toSec();
+        sample.state = odom_state_;
+        odom_handoff_.publish();
+    }
+
+    if (!trigger || !control_thread_.joinable())
+        return;
+    // start a cycle right away, a cycle still running means this one is skipped, not queued
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (control_busy_) {
+            mpc_timing_.missed_deadlines++;
+            ROS_WARN_THROTTLE(1.0, "MPC cycle overrun, %lu odometry triggers skipped so far.",
+                              mpc_timing_.missed_deadlines);
+            return;
+        }
+        control_triggered_ = true;
+    }
+    control_cv_.notify_one();
+}
+
+void MavNmpcTracker::set_traj_ref(const trajectory_msgs::MultiDOFJointTrajectory::ConstPtr &traj_msg)
+{
+    // the points at the header stamp plus their time_from_start, from the reception without a stamp;
+    // without any time_from_start they are dt apart
+    const ros::Time time_now = ros::Time::now();
+    const ros::Time start = traj_msg->header.stamp.isZero() ? time_now : traj_msg->header.stamp;
+    const bool untimed = traj_msg->points.size() > 1 && traj_msg->points.back().time_from_start.isZero();
+    std::vector<TrajectorySample> samples(traj_msg->points.size());
+    bool has_velocities = true;
+    for (size_t iPoint = 0; iPoint < traj_msg->points.size(); iPoint++) {
+        const trajectory_msgs::MultiDOFJointTrajectoryPoint &point = traj_msg->points[iPoint];
+        TrajectorySample &sample = samples[iPoint];
+        sample.time = untimed ? start.toSec() + iPoint * mpc_form_param_.dt
+                              : (start + point.time_from_start).toSec();
+        if (point.transforms.empty() || (iPoint > 0 && sample.time <= samples[iPoint - 1].time)) {
+            ROS_WARN("Received commanded trajectory incorrect, ignored.");
+            return;
+        }
+        sample.position << point.transforms[0].translation.x, point.transforms[0].translation.y,
+            point.transforms[0].translation.z;
+        if (point.velocities.empty())
+            has_velocities = false;
+        else
+            sample.velocity << point.velocities[0].linear.x, point.velocities[0].linear.y,
+                point.velocities[0].linear.z;
+    }
+    if (samples.empty())
+        return;
+    if (!has_velocities)
+        estimate_velocities(samples);
+
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    if (stamp_usable(traj_msg->header.stamp, time_now))
+        traj_delay_.add((time_now - traj_msg->header.stamp).toSec());
+    traj_msgs_.push_back(std::move(samples));
+    traj_source_msg_ = ReferenceSource::kPoints;
+}
+
+void MavNmpcTracker::set_polynomial_ref(const mav_planning_msgs::PolynomialTrajectory4D::ConstPtr &polynomial_msg)
+{
+    // the segments one after the other from the header stamp, from the reception without one; the yaw
+    // is not used
+    const ros::Time time_now = ros::Time::now();
+    const ros::Time start = polynomial_msg->header.stamp.isZero() ? time_now : polynomial_msg->header.stamp;
+    std::vector<PolynomialSegment> segments(polynomial_msg->segments.size());
+    for (size_t iSegment = 0; iSegment < segments.size(); iSegment++) {
+        const mav_planning_msgs::PolynomialSegment4D &segment_msg = polynomial_msg->segments[iSegment];
+        const int n = segment_msg.num_coeffs;
+        if (n <= 0 || static_cast<int>(segment_msg.x.size()) != n || static_cast<int>(segment_msg.y.size()) != n ||
+            static_cast<int>(segment_msg.z.size()) != n || !(segment_msg.segment_time.toSec() > 0.0)) {
+            ROS_WARN("Received polynomial trajectory incorrect, ignored.");
+            return;
+        }
+        PolynomialSegment &segment = segments[iSegment];
+        segment.duration = segment_msg.segment_time.toSec();
+        segment.coefficients.resize(3, n);
+        for (int k = 0; k < n; k++)
+            segment.coefficients.col(k) << segment_msg.x[k], segment_msg.y[k], segment_msg.z[k];
+    }
+    if (segments.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    if (stamp_usable(polynomial_msg->header.stamp, time_now))
+        traj_delay_.add((time_now - polynomial_msg->header.stamp).toSec());
+    polynomial_msg_ = std::move(segments);
+    polynomial_msg_start_ = start.toSec();
+    polynomial_updated_ = true;
+    traj_source_msg_ = ReferenceSource::kPolynomial;
+}
+
+void MavNmpcTracker::set_goto(const geometry_msgs::PointStamped::ConstPtr &goto_msg)
+{
+    // planned by the control cycle from the state it starts at
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    goto_msg_ << goto_msg->point.x, goto_msg->point.y, goto_msg->point.z;
+    goto_updated_ = true;
+    traj_source_msg_ = ReferenceSource::kGoto;
+}
+
+bool MavNmpcTracker::set_library_playback(TrajectoryLibraryPlayback::Request &request,
+                                          TrajectoryLibraryPlayback::Response &response)
+{
+    // only the clock of the playback, the library itself is read by the control cycle
+    const double time_now = ros::Time::now().toSec();
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    const double start = traj_library_->start_time(), end = traj_library_->end_time();
+    if (request.command == "start") {
+        if (library_playback_msg_.mission_time(time_now) >= end)
+            library_playback_msg_.seek(start, time_now);
+        library_playback_msg_.start(time_now);
+        traj_source_msg_ = ReferenceSource::kLibrary;
+    } else if (request.command == "pause") {
+        library_playback_msg_.pause(time_now);
+    } else if (request.command == "seek") {
+        library_playback_msg_.seek(std::max(start, std::min(request.time, end)), time_now);
+    } else {
+        response.success = false;
+        response.message = "Unknown command " + request.command + ", start, pause or seek.";
+        response.mission_time = library_playback_msg_.mission_time(time_now);
+        return true;
+    }
+    response.success = true;
+    response.message = library_playback_msg_.playing() ? "playing" : "paused";
+    response.mission_time = library_playback_msg_.mission_time(time_now);
+    ROS_INFO("Trajectory library %s at %.2f s.", response.message.c_str(), response.mission_time);
+    return true;
+}
+
+void MavNmpcTracker::request_solver_variant(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    solver_variant_request_ = name;
+}
+
+void MavNmpcTracker::set_solver_variant(const std_msgs::String::ConstPtr &variant_msg)
+{
+    request_solver_variant(variant_msg->data);
+}
+
+void MavNmpcTracker::set_corridors(const visualization_msgs::MarkerArray::ConstPtr &corridors_msg)
+{
+    // the boxes in the order of the path
+    std::vector<Corridor> corridors;
+    for (const visualization_msgs::Marker &marker : corridors_msg->markers) {
+        if (marker.action == visualization_msgs::Marker::DELETEALL)
+            corridors.clear();
+        if (marker.type != visualization_msgs::Marker::CUBE || marker.action != visualization_msgs::Marker::ADD)
+            continue;
+        const Eigen::Vector3d center(marker.pose.position.x, marker.pose.position.y, marker.pose.position.z);
+        Eigen::Quaterniond orientation(marker.pose.orientation.w, marker.pose.orientation.x,
+                                       marker.pose.orientation.y, marker.pose.orientation.z);
+        // an unset orientation is the identity
+        if (orientation.norm() < 1e-6)
+            orientation = Eigen::Quaterniond::Identity();
+        const Eigen::Vector3d size(marker.scale.x, marker.scale.y, marker.scale.z);
+        corridors.push_back(box_corridor(center, orientation.normalized(), size));
+    }
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    corridors_msg_ = std::move(corridors);
+    corridors_updated_ = true;
+}
+
+void MavNmpcTracker::set_obstacles(const visualization_msgs::MarkerArray::ConstPtr &obstacles_msg)
+{
+    // every message is the whole set, the markers of the last one give the velocities
+    const ros::Time time_now = ros::Time::now();
+    std::map<std::pair<std::string, int>, Obstacle> tracks;
+    for (const visualization_msgs::Marker &marker : obstacles_msg->markers) {
+        if (marker.type != visualization_msgs::Marker::SPHERE || marker.action != visualization_msgs::Marker::ADD)
+            continue;
+        const std::pair<std::string, int> key(marker.ns, marker.id);
+        Obstacle obstacle;
+        obstacle.position << marker.pose.position.x, marker.pose.position.y, marker.pose.position.z;
+        obstacle.radii << 0.5 * marker.scale.x, 0.5 * marker.scale.y, 0.5 * marker.scale.z;
+        const ros::Time stamp = stamp_usable(marker.header.stamp, time_now) ? marker.header.stamp : time_now;
+        obstacle.stamp = stamp.toSec();
+        const auto track = obstacle_tracks_.find(key);
+        if (track != obstacle_tracks_.end()) {
+            const double dt = obstacle.stamp - track->second.stamp;
+            obstacle.velocity = dt > 1e-3 ? Eigen::Vector3d((obstacle.position - track->second.position) / dt)
+                                          : track->second.velocity;
+        }
+        tracks[key] = obstacle;
+    }
+    obstacle_tracks_.swap(tracks);
+
+    std::vector<Obstacle> obstacles;
+    obstacles.reserve(obstacle_tracks_.size());
+    for (const auto &track : obstacle_tracks_)
+        obstacles.push_back(track.second);
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    obstacles_msg_ = std::move(obstacles);
+    obstacles_updated_ = true;
+}
+
+bool MavNmpcTracker::fetch_latest_data()
+{
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    if (odom_count_ == 0)
+        return false;
+    if (!received_first_odom_) {
+        received_first_odom_ = true;
+        ROS_INFO("First odometry received!");
+    }
+    mav_state_current_ = odom_state_;
+    odom_received_time_ = odom_time_;
+    odom_stamp_time_ = odom_stamp_;
+    mpc_timing_.odom_delay = odom_delay_.estimate() * 1000.0;
+    mpc_timing_.traj_delay = traj_delay_.estimate() * 1000.0;
+    for (const std::vector<TrajectorySample> &samples : traj_msgs_) {
+        if (traj_buffer_.insert(samples) < static_cast<int>(samples.size()))
+            ROS_WARN("The trajectory is longer than traj_buffer_size, its end is cut.");
+    }
+    traj_msgs_.clear();
+    if (polynomial_updated_) {
+        traj_polynomial_.set(polynomial_msg_start_, polynomial_msg_);
+        polynomial_updated_ = false;
+    }
+    // the other sources are dropped on a switch, not to come back to a stale trajectory; the library is paused
+    const double time_now = ros::Time::now().toSec();
+    if (traj_source_msg_ != traj_source_) {
+        traj_source_ = traj_source_msg_;
+        if (traj_source_ != ReferenceSource::kPoints)
+            traj_buffer_.clear();
+        if (traj_source_ != ReferenceSource::kPolynomial)
+            traj_polynomial_.clear();
+        if (traj_source_ != ReferenceSource::kLibrary)
+            library_playback_msg_.pause(time_now);
+        if (traj_source_ != ReferenceSource::kGoto)
+            traj_goto_.clear();
+    }
+    traj_playback_ = library_playback_msg_;
+    // from the odometry and the acceleration of the last reference, a new point replans from where the MAV is
+    if (goto_updated_) {
+        traj_goto_.plan(time_now, mav_state_current_.head<3>(), mav_state_current_.segment<3>(3),
+                        mpc_acc_ref_.col(0), goto_msg_, options_.transition_limits);
+        goto_updated_ = false;
+        ROS_INFO("Go to [%.2f, %.2f, %.2f] in %.2f s.", goto_msg_(0), goto_msg_(1), goto_msg_(2),
+                 traj_goto_.end_time() - time_now);
+    }
+    if (corridors_updated_) {
+        corridor_assigner_.set_corridors(corridors_msg_);
+        corridors_updated_ = false;
+    }
+    if (obstacles_updated_) {
+        obstacle_index_.set_obstacles(obstacles_msg_);
+        obstacles_updated_ = false;
+    }
+    if (model_estimator_) {
+        model_estimate_ = model_estimator_->estimate();
+        model_estimate_samples_ = model_estimator_->samples();
+    }
+
+    // the samples already flown are dropped; trajectories standing still are held with the stationary horizon
+    traj_buffer_.drop_before(time_now);
+    if (traj_source_ == ReferenceSource::kPolynomial) {
+        traj_stationary_ = traj_polynomial_.stationary(time_now, time_now + traj_horizon_, kStationaryTolerance);
+    } else if (traj_source_ == ReferenceSource::kLibrary) {
+        const double mission_time = traj_playback_.mission_time(time_now);
+        traj_stationary_ = !traj_playback_.playing() ||
+                           traj_library_->stationary(mission_time, mission_time + traj_horizon_, kStationaryTolerance);
+    } else if (traj_source_ == ReferenceSource::kGoto) {
+        traj_stationary_ = traj_goto_.empty() || traj_goto_.stationary(time_now);
+    } else {
+        traj_stationary_ = traj_buffer_.stationary(time_now, time_now + traj_horizon_, kStationaryTolerance);
+    }
+
+    // a requested solver variant is switched to in select_horizon(), between two cycles
+    if (!solver_variant_request_.empty()) {
+        const std::string name = solver_variant_request_;
+        solver_variant_request_.clear();
+        const auto found = std::find(mpc_solver_names_.begin(), mpc_solver_names_.end(), name);
+        if (found == mpc_solver_names_.end())
+            ROS_WARN("Unknown solver variant %s, keeping %s.", name.c_str(),
+                     mpc_track_solver_index_ >= 0 ? mpc_solver_names_[mpc_track_solver_index_].c_str()
+                                                  : "the current one");
+        else
+            mpc_track_solver_index_ = static_cast<int>(found - mpc_solver_names_.begin());
+    }
+    return true;
+}
+
+void MavNmpcTracker::select_horizon(const std::string &mode, double time)
+{
+    if (mpc_solvers_.empty())
+        return;
+    // hover and home during their transition are tracked like a trajectory
+    const bool stationary = mode == "track" ? traj_stationary_
+                                            : (transition_mode_.empty() || transition_.stationary(time));
+    const int index = (stationary && mpc_stationary_solver_index_ >= 0) ? mpc_stationary_solver_index_
+                                                                        : mpc_track_solver_index_;
+    if (index != mpc_solver_index_)
+        activate_solver_variant(index);
+}
+
+void MavNmpcTracker::load_solver_variants()
+{
+    mpc_solver_names_.push_back("default");
+    mpc_solvers_.emplace_back(new NmpcTrackerSolver(mpc_form_param_));
+    for (const auto &variant : options_.solver_variants) {
+        if (variant.first == "default")
+            continue;
+        try {
+            const SolverDescriptor descriptor = read_solver_descriptor(variant.second);
+            std::unique_ptr<NmpcTrackerSolver> solver(new NmpcTrackerSolver(
+                mpc_form_param_, SolverLibrary::load(descriptor), descriptor.time_steps));
+            ROS_INFO("Solver variant %s: N = %d, tf = %.3f s, %s, %s.", variant.first.c_str(), descriptor.N,
+                     descriptor.tf, descriptor.integrator_type.c_str(), descriptor.qp_solver.c_str());
+            mpc_solver_names_.push_back(variant.first);
+            mpc_solvers_.push_back(std::move(solver));
+        } catch (const std::exception &e) {
+            ROS_ERROR("Solver variant %s not loaded: %s", variant.first.c_str(), e.what());
+        }
+    }
+
+    // the short horizon for a constant reference, on the linked solver
+    if (options_.stationary_N > 0) {
+        try {
+            mpc_solvers_.emplace_back(new NmpcTrackerSolver(
+                mpc_form_param_, SolverLibrary::linked(),
+                std::vector<double>(options_.stationary_N, options_.stationary_dt)));
+            mpc_solver_names_.push_back("stationary");
+            mpc_stationary_solver_index_ = static_cast<int>(mpc_solvers_.size()) - 1;
+        } catch (const std::exception &e) {
+            ROS_ERROR("Stationary horizon not created: %s", e.what());
+        }
+    }
+
+    const auto found = std::find(mpc_solver_names_.begin(), mpc_solver_names_.end(), options_.solver_variant);
+    if (found == mpc_solver_names_.end()) {
+        ROS_WARN("Unknown solver variant %s, using the default one.", options_.solver_variant.c_str());
+        mpc_track_solver_index_ = 0;
+    } else {
+        mpc_track_solver_index_ = static_cast<int>(found - mpc_solver_names_.begin());
+    }
+    activate_solver_variant(mpc_track_solver_index_);
+}
+
+void MavNmpcTracker::activate_solver_variant(int index)
+{
+    NmpcTrackerSolver *solver = mpc_solvers_[index].get();
+    const std::vector<double> &time_steps = solver->time_steps();
+
+    // the last plan on the stages of the new solver, for its warm start
+    StateTrajectory x_plan;
+    InputTrajectory u_plan;
+    const bool carry_plan = (mpc_solver_ != nullptr && mpc_feasible_);
+    std::vector<double> last_time_steps;
+    RefTrajectory last_yref;
+    if (carry_plan) {
+        last_time_steps = mpc_solver_->time_steps();
+        resample_plan(last_time_steps, mpc_x_plan_, mpc_u_plan_, time_steps, x_plan, u_plan);
+        last_yref = mpc_yref_;
+    }
+
+    mpc_solver_ = solver;
+    mpc_solver_index_ = index;
+    mpc_N_ = solver->N();
+    mpc_dt_ = time_steps.front();
+    mpc_stage_times_ = stage_times(time_steps);
+    mpc_Tf_ = mpc_stage_times_.back();
+    mpc_stage_times_.pop_back();
+    resize_mpc_variables();
+    if (carry_plan) {
+        mpc_x_plan_ = x_plan;
+        mpc_u_plan_ = u_plan;
+    }
+    // the preparation was done on the other solver
+    mpc_prepared_ = false;
+
+    MpcFormulationParam param = mpc_form_param_;
+    param.N = mpc_N_;
+    param.Tf = mpc_Tf_;
+    param.time_steps = time_steps;
+    mpc_warm_start_.reset(new WarmStart(param, options_.warm_start));
+    mpc_warm_start_->set_model(model_param_);
+    if (carry_plan) {
+        // the next jump of the reference is against the last one on the new stages
+        RefTrajectory yref;
+        resample_reference(last_time_steps, last_yref, time_steps, yref);
+        mpc_warm_start_->set_last_reference(yref);
+    }
+    ROS_INFO("Using the solver variant %s, N = %d, horizon %.3f s.", mpc_solver_names_[index].c_str(), mpc_N_,
+             mpc_Tf_);
+}
+
+void MavNmpcTracker::resize_mpc_variables()
+{
+    mpc_pos_ref_.setZero(3, mpc_N_);
+    mpc_vel_ref_.setZero(3, mpc_N_);
+    mpc_acc_ref_.setZero(3, mpc_N_);
+    mpc_u_ref_ = InputVector(0.0, 0.0, 1.0 * g).replicate(1, mpc_N_);
+    mpc_x_plan_.setZero(kNx, mpc_N_ + 1);
+    mpc_u_plan_.setZero(kNu, mpc_N_);
+    mpc_yref_.setZero(kNy, mpc_N_);
+    mpc_yref_e_.setZero();
+    mpc_x_init_.setZero(kNx, mpc_N_ + 1);
+    mpc_u_init_.setZero(kNu, mpc_N_);
+    mpc_x_cold_.setZero(kNx, mpc_N_ + 1);
+    mpc_u_cold_.setZero(kNu, mpc_N_);
+}
+
+void MavNmpcTracker::control_thread_loop()
+{
+    std::unique_lock<std::mutex> lock(control_mutex_);
+    while (true) {
+        control_cv_.wait(lock, [this] { return control_triggered_ || !control_running_; });
+        if (!control_running_)
+            break;
+        control_triggered_ = false;
+        control_busy_ = true;
+        lock.unlock();
+        control_cycle();
+        lock.lock();
+        control_busy_ = false;
+    }
+}
+
+void MavNmpcTracker::control_cycle()
+{
+    const ros::Time cycle_start_time = ros::Time::now();
+    if (!last_cycle_start_time_.isZero())
+        cycle_period_.add((cycle_start_time - last_cycle_start_time_).toSec());
+    last_cycle_start_time_ = cycle_start_time;
+    if (!fetch_latest_data()) {
+        ROS_WARN_THROTTLE(1.0, "Waiting for first Odometry!");
+        return;
+    }
+    // phase between the odometry and the control cycle, about zero when triggered by odometry
+    mpc_timing_.odom_age = (cycle_start_time - odom_received_time_).toSec() * 1000.0;
+
+    run_mhe();
+    run_disturbance_observer();
+    update_model();
+    calculate_roll_pitch_yawrate_thrust_cmd();
+    if (command_thread_.joinable())
+        hand_off_command_plan();  // sent by the output thread
+    else if (yaw_command_mode_ == "yawrate")
+        pub_roll_pitch_yawrate_thrust_cmd();
+    else if (yaw_command_mode_ == "yaw")
+        pub_roll_pitch_yaw_thrust_cmd();
+    else
+        ROS_WARN("yaw control mode is not set!");
+    prepare_acados_solver();
+    pub_mpc_traj_plan_vis();
+    pub_solver_timing();
+    pub_model_estimate();
+    pub_mhe_estimate();
+    pub_disturbance();
+}
+
+void MavNmpcTracker::run_mhe()
+{
+    if (!mhe_)
+        return;
+    if (odom_stamp_time_ != mhe_stamp_) {
+        mhe_stamp_ = odom_stamp_time_;
+        const ros::WallTime time_before_mhe = ros::WallTime::now();
+        mhe_->add_measurement(odom_stamp_time_.toSec(), mav_state_current_, last_command_);
+        mhe_status_ = mhe_->update();
+        mhe_time_ = (ros::WallTime::now() - time_before_mhe).toSec() * 1000.0;
+        if (mhe_status_ > 0)
+            ROS_WARN_THROTTLE(1.0, "MHE failure, status %d, the odometry is used as is.", mhe_status_);
+    }
+    // the odometry itself while the window fills or after a failure
+    mav_state_current_ = mhe_->state();
+}
+
+void MavNmpcTracker::run_disturbance_observer()
+{
+    if (!options_.offset_free)
+        return;
+    if (mhe_) {
+        if (mhe_->ready())
+            disturbance_ = mhe_->disturbance();
+        return;
+    }
+    if (odom_stamp_time_ == disturbance_stamp_)
+        return;
+    disturbance_stamp_ = odom_stamp_time_;
+    disturbance_observer_->update(odom_stamp_time_.toSec(), mav_state_current_, last_command_);
+    disturbance_ = disturbance_observer_->disturbance();
+}
+
+void MavNmpcTracker::update_model()
+{
+    bool changed = false;
+    if (model_estimator_ && model_estimate_.converged) {
+        const ros::Time time_now = ros::Time::now();
+        if ((time_now - model_estimate_applied_time_).toSec() >= kModelEstimatePeriod) {
+            model_estimate_applied_time_ = time_now;
+            // the thrust scale only enters the conversion of the commands, the rest the model parameters
+            thrust_scale_ = model_estimate_.thrust_scale;
+            model_estimate_.apply(model_param_);
+            if (disturbance_observer_)
+                disturbance_observer_->set_model(model_param_);
+            changed = true;
+        }
+    }
+    if (options_.offset_free) {
+        model_param_.disturbance_x = disturbance_(0);
+        model_param_.disturbance_y = disturbance_(1);
+        model_param_.disturbance_z = disturbance_(2);
+        changed = true;
+    }
+    if (!changed)
+        return;
+
+    const ModelParamVector p = model_params(model_param_);
+    for (const std::unique_ptr<NmpcTrackerSolver> &solver : mpc_solvers_)
+        solver->set_model_params(p);
+    if (state_predictor_)
+        state_predictor_->set_model_params(p);
+    if (mhe_)
+        mhe_->set_model_params(p);
+    mpc_warm_start_->set_model(model_param_);
+}
+
+void MavNmpcTracker::predict_current_state(const ros::Time &time_now)
+{
+    mpc_timing_.prediction = 0.0;
+    if (!state_predictor_)
+        return;
+    // the command of this cycle takes effect once the solve is done
+    const ros::Time time_target = time_now + ros::Duration(solve_delay_.estimate());
+    mav_state_current_ = state_predictor_->predict(mav_state_current_, odom_stamp_time_.toSec(),
+                                                   time_target.toSec());
+    mpc_timing_.prediction = std::min((time_target - odom_stamp_time_).toSec(),
+                                      options_.predict_max_horizon) * 1000.0;
+}
+
+const std::string &MavNmpcTracker::select_tracking_mode(const ros::Time &time_now) const
+{
+    static const std::string hover_mode = "hover";
+    // the end of the trajectory is held until the time out
+    if (tracking_mode_ == "track" && time_now.toSec() - traj_end_time() > traj_time_out_) {
+        ROS_WARN_THROTTLE(1.0, "Trajectory command time out! Will try to make the MAV hover.");
+        return hover_mode;
+    }
+    return tracking_mode_;
+}
+
+double MavNmpcTracker::traj_end_time() const
+{
+    if (traj_source_ == ReferenceSource::kPolynomial)
+        return traj_polynomial_.empty() ? -std::numeric_limits<double>::infinity() : traj_polynomial_.end_time();
+    // +inf while paused
+    if (traj_source_ == ReferenceSource::kLibrary)
+        return traj_playback_.clock_time(traj_library_->end_time());
+    if (traj_source_ == ReferenceSource::kGoto)
+        return traj_goto_.empty() ? -std::numeric_limits<double>::infinity() : traj_goto_.end_time();
+    return traj_buffer_.empty() ? -std::numeric_limits<double>::infinity() : traj_buffer_.end_time();
+}
+
+void MavNmpcTracker::plan_transition(const std::string &mode, double time)
+{
+    if (mode == "track") {
+        transition_mode_.clear();
+        return;
+    }
+    if (!options_.transitions || mode == transition_mode_ || (mode != "hover" && mode != "home"))
+        return;
+    // from the odometry and the acceleration of the last reference
+    transition_mode_ = mode;
+    const Eigen::Vector3d position = mav_state_current_.head<3>();
+    const Eigen::Vector3d velocity = mav_state_current_.segment<3>(3);
+    Eigen::Vector3d target(0.0, 0.0, 1.0);
+    // hover where a stop at the acceleration limit would end
+    if (mode == "hover")
+        target = position + velocity * velocity.norm() / (2.0 * options_.transition_limits.acceleration);
+    transition_.plan(time, position, velocity, mpc_acc_ref_.col(0), target, options_.transition_limits);
+    ROS_INFO("Transition to %s at [%.2f, %.2f, %.2f] in %.2f s.", mode.c_str(), target(0), target(1), target(2),
+             transition_.end_time() - time);
+}
+
+void MavNmpcTracker::set_mpc_ref(const std::string &mode, const ros::Time &time)
+{
+    // the horizon may change with the mode, before its stages are filled
+    plan_transition(mode, time.toSec());
+    select_horizon(mode, time.toSec());
+    if (mode == "track") {  // trajectory tracking
+        // the trajectory at the stage times, held past its end
+        traj_yaw_ref_ = 0.0;
+        if (traj_source_ == ReferenceSource::kPolynomial) {
+            traj_polynomial_.evaluate(time.toSec(), mpc_stage_times_, mpc_pos_ref_, mpc_vel_ref_, &mpc_acc_ref_);
+        } else if (traj_source_ == ReferenceSource::kGoto) {
+            traj_goto_.evaluate(time.toSec(), mpc_stage_times_, mpc_pos_ref_, mpc_vel_ref_, &mpc_acc_ref_);
+        } else if (traj_source_ == ReferenceSource::kLibrary) {
+            // at the mission time, held where it is paused
+            Eigen::VectorXd yaws;
+            traj_library_->evaluate(traj_playback_.mission_time(time.toSec()), mpc_stage_times_, mpc_pos_ref_,
+                                    mpc_vel_ref_, &mpc_acc_ref_, &yaws);
+            if (!traj_playback_.playing()) {
+                const Eigen::Vector3d held = mpc_pos_ref_.col(0);
+                mpc_pos_ref_ = held.replicate(1, mpc_N_);
+                mpc_vel_ref_.setZero();
+                mpc_acc_ref_.setZero();
+            }
+            traj_yaw_ref_ = yaws(0);
+        } else {
+            traj_buffer_.evaluate(time.toSec(), mpc_stage_times_, mpc_pos_ref_, mpc_vel_ref_, &mpc_acc_ref_);
+        }
+    } else if (!transition_mode_.empty()) {  // hovering or flying to origin, along the transition
+        transition_.evaluate(time.toSec(), mpc_stage_times_, mpc_pos_ref_, mpc_vel_ref_, &mpc_acc_ref_);
+    } else if (mode == "hover") {  // hovering
+        mpc_pos_ref_ = mav_state_current_.head<3>().replicate(1, mpc_N_);
+        mpc_vel_ref_.setZero();
+        mpc_acc_ref_.setZero();
+    } else if (mode == "home") {  // flying to origin
+        mpc_pos_ref_ = Eigen::Vector3d(0.0, 0.0, 1.0).replicate(1, mpc_N_);
+        mpc_vel_ref_.setZero();
+        mpc_acc_ref_.setZero();
+    } else {
+        ROS_WARN("Tracking mode is not correctly set!");
+    }
+    // the inputs flying the reference acceleration at the yaw of the model, or hovering without
+    // input_feedforward; offset-free, against the disturbance in model_param_
+    const double yaw = mav_state_current_(8);
+    for (int iStage = 0; iStage < mpc_N_; iStage++) {
+        if (options_.input_feedforward)
+            mpc_u_ref_.col(iStage) =
+                feedforward_input(model_param_, mpc_acc_ref_.col(iStage), mpc_vel_ref_.col(iStage), yaw);
+        else
+            mpc_u_ref_.col(iStage) = feedforward_input(model_param_, Eigen::Vector3d::Zero(),
+                                                       Eigen::Vector3d::Zero(), yaw);
+    }
+    build_solver_ref();
+    set_corridor_constraints();
+    set_obstacle_constraints(time);
+}
+
+void MavNmpcTracker::set_corridor_constraints()
+{
+    if (!options_.corridors || !mpc_solver_ || !mpc_solver_->has_corridor_constraints())
+        return;
+    const std::vector<int> &stage_corridors = corridor_assigner_.assign(mpc_pos_ref_);
+    // none on stage 0, its state is fixed; the terminal stage in the corridor of the last reference
+    mpc_solver_->set_stage_corridor(0, Corridor());
+    for (int iStage = 1; iStage <= mpc_N_; iStage++) {
+        const int iCorridor = stage_corridors[std::min(iStage, mpc_N_ - 1)];
+        Corridor corridor;
+        if (iCorridor >= 0) {
+            corridor = corridor_assigner_.corridors()[iCorridor];
+            corridor.b.array() -= options_.corridor_margin;
+        }
+        mpc_solver_->set_stage_corridor(iStage, corridor);
+    }
+}
+
+void MavNmpcTracker::set_obstacle_constraints(const ros::Time &start_time)
+{
+    if (!options_.obstacles || !mpc_solver_ || !mpc_solver_->has_obstacle_constraints())
+        return;
+    // none on stage 0, its state is fixed; the terminal stage at the last reference at the end of the horizon
+    const double time_start = start_time.toSec();
+    mpc_solver_->set_stage_obstacles(0, empty_obstacle_slots());
+    for (int iStage = 1; iStage <= mpc_N_; iStage++) {
+        const double time = time_start + (iStage < mpc_N_ ? mpc_stage_times_[iStage] : mpc_Tf_);
+        const std::vector<int> &nearest =
+            obstacle_index_.nearest(mpc_pos_ref_.col(std::min(iStage, mpc_N_ - 1)), time, kObstacleSlots);
+        ObstacleSlots slots = empty_obstacle_slots();
+        for (size_t iSlot = 0; iSlot < nearest.size(); iSlot++)
+            set_obstacle_slot(slots, static_cast<int>(iSlot), obstacle_index_.obstacles()[nearest[iSlot]], time,
+                              options_.obstacle_margin);
+        mpc_solver_->set_stage_obstacles(iStage, slots);
+    }
+}
+
+void MavNmpcTracker::set_esdf_constraints()
+{
+    if (!esdf_map_ || !mpc_solver_ || !mpc_solver_->has_esdf_constraints())
+        return;
+    // none on stage 0, its state is fixed. The initial guess is where RTI linearizes the model, so the
+    // rows are linearized there as well, whichever warm start strategy built it.
+    mpc_solver_->set_stage_esdf(0, EsdfConstraint());
+    for (int iStage = 1; iStage <= mpc_N_; iStage++)
+        mpc_solver_->set_stage_esdf(iStage, esdf_map_->linearize(mpc_x_init_.col(iStage).head<3>(),
+                                                                 options_.esdf_distance));
+}
+
+void MavNmpcTracker::build_cold_start(StateTrajectory &x_init, InputTrajectory &u_init) const
+{
+    x_init.colwise() = mav_state_current_;
+    u_init = mpc_u_ref_;
+}
+
+void MavNmpcTracker::reset_acados_solver()
+{
+    // initial condition
+    mpc_solver_->set_x0(mav_state_current_);
+    // initialize plan
+    build_cold_start(mpc_x_init_, mpc_u_init_);
+    mpc_solver_->set_x_init(mpc_x_init_);
+    mpc_solver_->set_u_init(mpc_u_init_);
+}
+
+void MavNmpcTracker::initialize_acados_solver()
+{
+    // initial condition
+    mpc_solver_->set_x0(mav_state_current_);
+    // initialize plan, the strategy depends on the last solve and the reference jump
+    mpc_timing_.warm_start = mpc_warm_start_->build(mpc_feasible_, mav_state_current_, mpc_x_plan_, mpc_u_plan_,
+                                                   mpc_yref_, mpc_x_init_, mpc_u_init_);
+    mpc_solver_->set_x_init(mpc_x_init_);
+    mpc_solver_->set_u_init(mpc_u_init_);
+    set_esdf_constraints();
+}
+
+void MavNmpcTracker::build_solver_ref()
+{
+    mpc_yref_.topRows<3>() = mpc_pos_ref_;
+    mpc_yref_.middleRows<3>(3) = mpc_vel_ref_;
+    mpc_yref_.bottomRows<kNu>() = mpc_u_ref_;
+    mpc_yref_e_ << mpc_pos_ref_.col(mpc_N_ - 1), mpc_vel_ref_.col(mpc_N_ - 1);
+}
+
+void MavNmpcTracker::set_acados_solver_ref()
+{
+    mpc_solver_->set_yref(mpc_yref_, mpc_yref_e_);
+}
+
+void MavNmpcTracker::run_acados_solver()
+{
+    if (mpc_speculative_solver_) {
+        run_speculative_acados_solver();
+        return;
+    }
+
+    const ros::WallTime time_before_solver = ros::WallTime::now();
+    int solver_status;
+    if (mpc_prepared_) {
+        // linearized and condensed already, embed the new initial condition only
+        mpc_solver_->set_x0(mav_state_current_);
+        solver_status = mpc_solver_->feedback();
+    } else {
+        // initialize solver
+        initialize_acados_solver();
+
+        // set solver ref
+        set_acados_solver_ref();
+
+        // call the solver
+        solver_status = mpc_solver_->solve();
+        mpc_timing_.preparation = 0.0;
+    }
+    mpc_prepared_ = false;
+    mpc_timing_.qp_iter = mpc_solver_->get_qp_iter();
+
+    // deal with infeasibility
+    if (solver_status != 0) {  // if infeasible
+        mpc_feasible_ = false;
+        mpc_success_ = false;
+        ROS_WARN("MPC infeasible, will try again.");
+        // solve again
+        reset_acados_solver();
+        const int solver_status_alt = mpc_solver_->solve();
+        mpc_timing_.qp_iter += mpc_solver_->get_qp_iter();
+        mpc_timing_.feedback = (ros::WallTime::now() - time_before_solver).toSec() * 1000.0;
+        if (solver_status_alt != 0) {  // if infeasible again
+            mpc_feasible_ = false;
+            mpc_success_ = false;
+            ROS_WARN("MPC infeasible again.");
+            return;
+        }
+    } else {
+        mpc_timing_.feedback = (ros::WallTime::now() - time_before_solver).toSec() * 1000.0;
+    }
+    mpc_feasible_ = true;
+    mpc_success_ = true;
+
+    // ROS_INFO("MPC computation time is: %f ms.", mpc_timing_.feedback);
+
+    // obtain solution
+    mpc_solver_->get_x_traj(mpc_x_plan_);
+    mpc_solver_->get_u_traj(mpc_u_plan_);
+    mpc_x_next_ = mpc_x_plan_.col(1);
+    mpc_u_now_ = mpc_u_plan_.col(0);
+}
+
+void MavNmpcTracker::run_speculative_acados_solver()
+{
+    // initial guesses, the warm start strategy against the hover reset
+    build_cold_start(mpc_x_cold_, mpc_u_cold_);
+    mpc_timing_.warm_start = mpc_warm_start_->build(mpc_feasible_, mav_state_current_, mpc_x_plan_, mpc_u_plan_,
+                                                   mpc_yref_, mpc_x_init_, mpc_u_init_);
+
+    // call both solvers
+    const ros::WallTime time_before_solver = ros::WallTime::now();
+    const NmpcTrackerSolver *solver = mpc_speculative_solver_->solve(
+        mav_state_current_, mpc_yref_, mpc_yref_e_, mpc_x_init_, mpc_u_init_, mpc_x_cold_, mpc_u_cold_);
+    mpc_timing_.preparation = 0.0;
+    mpc_timing_.feedback = (ros::WallTime::now() - time_before_solver).toSec() * 1000.0;
+
+    // deal with infeasibility
+    if (solver == nullptr) {
+        mpc_feasible_ = false;
+        mpc_success_ = false;
+        ROS_WARN("MPC infeasible from both the warm start and the reset.");
+        return;
+    }
+    if (mpc_feasible_ && mpc_speculative_solver_->last_used_cold())
+        ROS_WARN("MPC warm start infeasible, the reset solution is used.");
+    mpc_feasible_ = true;
+    mpc_success_ = true;
+    mpc_timing_.qp_iter = solver->get_qp_iter();
+
+    // obtain solution
+    solver->get_x_traj(mpc_x_plan_);
+    solver->get_u_traj(mpc_u_plan_);
+    mpc_x_next_ = mpc_x_plan_.col(1);
+    mpc_u_now_ = mpc_u_plan_.col(0);
+}
+
+void MavNmpcTracker::calculate_roll_pitch_yawrate_thrust_cmd()
+{
+    // if odom and traj command received
+    const ros::Time time_now = ros::Time::now();
+    if ((time_now - odom_received_time_).toSec() > odom_time_out_) {
+        ROS_WARN("Odometry time out! Will try to make the MAV hover.");
+        mpc_feasible_ = false;  // will not run mpc if odometry not received
+        mpc_success_ = false;
+        mpc_prepared_ = false;
+    } else {
+        predict_current_state(time_now);
+        // the first stage at the time the state was predicted to; with a prepared solver the reference
+        // was set in the preparation phase for the expected time of this cycle
+        const ros::Time time_start = time_now + ros::Duration(state_predictor_ ? solve_delay_.estimate() : 0.0);
+        if (!mpc_prepared_)
+            set_mpc_ref(select_tracking_mode(time_now), time_start);
+        mpc_start_time_ = (mpc_prepared_ ? mpc_prepared_time_ : time_start).toSec();
+        run_acados_solver();
+    }
+
+    // control commands
+    double roll_cmd, pitch_cmd, thrust_cmd;
+    if (mpc_success_) {
+        roll_cmd = mpc_u_now_(0);
+        pitch_cmd = mpc_u_now_(1);
+        thrust_cmd = mpc_u_now_(2) * mass_ / thrust_scale_;
+    } else {
+        ROS_WARN("MPC failure! Default commands sent.");
+        roll_cmd = 0.0;
+        pitch_cmd = 0.0;
+        thrust_cmd = 1.0 * g * mass_ / thrust_scale_;
+    }
+
+    // yaw controller
+    const double current_yaw = mav_state_current_(8);
+    const double yaw_ref = traj_yaw_ref_;
+    double yaw_error = yaw_ref - current_yaw;
+
+    if (std::abs(yaw_error) > M_PI) {
+        if (yaw_error > 0.0)
+            yaw_error = yaw_error - 2.0 * M_PI;
+        else
+            yaw_error = yaw_error + 2.0 * M_PI;
+    }
+
+    double yawrate_cmd = mpc_form_param_.K_yaw * yaw_error;
+
+    // clip
+    if (std::abs(roll_cmd) > 1.05 * mpc_form_param_.roll_max) {
+        ROS_WARN("roll command is beyond limit!");
+        roll_cmd = std::max(-mpc_form_param_.roll_max, std::min(roll_cmd, mpc_form_param_.roll_max));
+    }
+    if (std::abs(pitch_cmd) > 1.05 * mpc_form_param_.pitch_max) {
+        ROS_WARN("pitch command is beyond limit!");
+        pitch_cmd = std::max(-mpc_form_param_.pitch_max, std::min(pitch_cmd, mpc_form_param_.pitch_max));
+    }
+    if (std::abs(yawrate_cmd) > 1.05 * mpc_form_param_.yawrate_max) {
+        ROS_WARN("yawrate command is beyond limit!");
+        yawrate_cmd = std::max(-mpc_form_param_.yawrate_max, std::min(yawrate_cmd, mpc_form_param_.yawrate_max));
+    }
+    const double thrust_cmd_min = mpc_form_param_.thrust_min * mass_ / thrust_scale_;
+    const double thrust_cmd_max = mpc_form_param_.thrust_max * mass_ / thrust_scale_;
+    if (thrust_cmd > 1.05 * thrust_cmd_max || thrust_cmd < 0.95 * thrust_cmd_min) {
+        ROS_WARN("thrust command is beyond limit!");
+        thrust_cmd = std::max(thrust_cmd_min, std::min(thrust_cmd, thrust_cmd_max));
+    }
+
+    // obtained command
+    roll_pitch_yawrate_thrust_cmd_ << roll_cmd, pitch_cmd, yawrate_cmd, thrust_cmd;
+    roll_pitch_yaw_thrust_cmd_ << roll_cmd, pitch_cmd, yaw_ref, thrust_cmd;
+    const ros::Time time_cmd = ros::Time::now();
+    mpc_timing_.odom_to_cmd = (time_cmd - odom_received_time_).toSec() * 1000.0;
+
+    // the command as the model sees it, for the prediction of the next cycles
+    if (state_predictor_) {
+        solve_delay_.add((time_cmd - time_now).toSec());
+        state_predictor_->add_command(time_cmd.toSec(),
+                                      InputVector(roll_cmd, pitch_cmd, thrust_cmd * thrust_scale_ / mass_));
+    }
+    last_command_ << roll_cmd, pitch_cmd, thrust_cmd * thrust_scale_ / mass_;
+    if (model_estimator_) {
+        std::lock_guard<std::mutex> lock(data_mutex_);
+        model_estimator_->add_command(time_cmd.toSec(), roll_cmd, pitch_cmd, thrust_cmd);
+    }
+}
+
+void MavNmpcTracker::prepare_acados_solver()
+{
+    if (!options_.rti_split || mpc_speculative_solver_ || !received_first_odom_)
+        return;
+    const ros::Time time_now = ros::Time::now();
+    if ((time_now - odom_received_time_).toSec() > odom_time_out_)
+        return;
+
+    // reference and initial guess for the feedback of the next cycle, a cycle period from now, with its
+    // first stage where the state will be predicted to
+    const ros::Time time_feedback = time_now + ros::Duration(cycle_period_.estimate());
+    mpc_prepared_time_ = time_feedback + ros::Duration(state_predictor_ ? solve_delay_.estimate() : 0.0);
+    set_mpc_ref(select_tracking_mode(time_feedback), mpc_prepared_time_);
+    initialize_acados_solver();
+    set_acados_solver_ref();
+
+    const ros::WallTime time_before_preparation = ros::WallTime::now();
+    const int solver_status = mpc_solver_->prepare();
+    mpc_timing_.preparation = (ros::WallTime::now() - time_before_preparation).toSec() * 1000.0;
+    mpc_prepared_ = (solver_status == 0);
+}
+
+void MavNmpcTracker::pub_roll_pitch_yawrate_thrust_cmd()
+{
+    publish_roll_pitch_yawrate_thrust(roll_pitch_yawrate_thrust_cmd_);
+}
+
+void MavNmpcTracker::pub_roll_pitch_yaw_thrust_cmd()
+{
+    publish_roll_pitch_yaw_thrust(roll_pitch_yaw_thrust_cmd_);
+}
+
+void MavNmpcTracker::publish_roll_pitch_yawrate_thrust(const Eigen::Vector4d &cmd)
+{
+    mav_msgs::RollPitchYawrateThrust cmd_msg;
+    cmd_msg.header.stamp = ros::Time::now();
+    cmd_msg.roll = cmd(0);
+    cmd_msg.pitch = cmd(1);
+    cmd_msg.yaw_rate = cmd(2);
+    cmd_msg.thrust.x = 0.0;
+    cmd_msg.thrust.y = 0.0;
+    cmd_msg.thrust.z = cmd(3);
+    roll_pitch_yawrate_thrust_cmd_pub_.publish(cmd_msg);
+}
+
+void MavNmpcTracker::publish_roll_pitch_yaw_thrust(const Eigen::Vector4d &cmd)
+{
+    mavros_msgs::AttitudeTarget cmd_msg;
+    cmd_msg.header.stamp = ros::Time::now();
+    const tf::Quaternion quat = tf::createQuaternionFromRPY(cmd(0), cmd(1), cmd(2));
+    cmd_msg.orientation.x = quat.x();
+    cmd_msg.orientation.y = quat.y();
+    cmd_msg.orientation.z = quat.z();
+    cmd_msg.orientation.w = quat.w();
+    cmd_msg.thrust = cmd(3);
+    roll_pitch_yaw_thrust_cmd_pub_.publish(cmd_msg);
+}
+
+void MavNmpcTracker::hand_off_command_plan()
+{
+    // the buffer of the control cycle, its matrices keep their size from one cycle to the next
+    CommandPlan &plan = plan_handoff_.back();
+    plan.valid = mpc_success_;
+    plan.start_time = mpc_start_time_;
+    plan.stage_times = mpc_stage_times_;
+    plan.stage_times.push_back(mpc_Tf_);
+    plan.x = mpc_x_plan_;
+    plan.u = mpc_u_plan_;
+    plan.fallback = last_command_;
+    plan.yaw_ref = traj_yaw_ref_;
+    plan.yawrate_cmd = roll_pitch_yawrate_thrust_cmd_(2);
+    plan.thrust_cmd_scale = mass_ / thrust_scale_;
+    plan.model = model_param_;
+    plan_handoff_.publish();
+}
+
+void MavNmpcTracker::command_thread_loop()
+{
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration period =
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options_.command_rate));
+    Clock::time_point next = Clock::now();
+    bool has_plan = false;
+    while (command_running_) {
+        // on the grid of the period, a late wake up does not send a burst to catch up
+        next += period;
+        const Clock::time_point now = Clock::now();
+        if (next < now)
+            next = now;
+        std::this_thread::sleep_until(next);
+        has_plan = plan_handoff_.update() || has_plan;
+        odom_handoff_.update();
+        if (!has_plan)
+            continue;
+
+        // read off the plan only on fresh odometry, else the command of the cycle is held as the control
+        // cycle would send it
+        const CommandPlan &plan = plan_handoff_.front();
+        const StateSample &odom = odom_handoff_.front();
+        const double time_now = ros::Time::now().toSec();
+        InputVector u = plan.fallback;
+        double yawrate_cmd = plan.yawrate_cmd;
+        if (time_now - odom.time <= odom_time_out_) {
+            command_interpolator_.command(plan, time_now, &odom, u);
+
+            // yaw controller of the cycle on the latest odometry
+            const double yaw_delta = plan.yaw_ref - odom.state(8);
+            const double yaw_error = std::atan2(std::sin(yaw_delta), std::cos(yaw_delta));
+            yawrate_cmd = std::max(-mpc_form_param_.yawrate_max,
+                                   std::min(mpc_form_param_.K_yaw * yaw_error, mpc_form_param_.yawrate_max));
+        }
+        const double thrust_cmd = u(2) * plan.thrust_cmd_scale;
+        if (yaw_command_mode_ == "yawrate")
+            publish_roll_pitch_yawrate_thrust(Eigen::Vector4d(u(0), u(1), yawrate_cmd, thrust_cmd));
+        else if (yaw_command_mode_ == "yaw")
+            publish_roll_pitch_yaw_thrust(Eigen::Vector4d(u(0), u(1), plan.yaw_ref, thrust_cmd));
+    }
+}
+
+void MavNmpcTracker::pub_mpc_traj_plan_vis()
+{
+    visualization_msgs::Marker marker_msg;
+    marker_msg.header.frame_id = "map";
+    marker_msg.header.stamp = ros::Time::now();
+    marker_msg.type = visualization_msgs::Marker::POINTS;
+    marker_msg.action = visualization_msgs::Marker::ADD;
+    // set the scale of the marker
+    marker_msg.scale.x = 0.2;
+    marker_msg.scale.y = 0.2;
+    marker_msg.scale.z = 0.2;
+    // set the color
+    marker_msg.color.r = 1.0;
+    marker_msg.color.g = 0.0;
+    marker_msg.color.b = 0.0;
+    marker_msg.color.a = 1.0;
+    // Set the pose of the marker
+    marker_msg.pose.position.x = 0.0;
+    marker_msg.pose.position.y = 0.0;
+    marker_msg.pose.position.z = 0.0;
+    marker_msg.pose.orientation.x = 0.0;
+    marker_msg.pose.orientation.y = 0.0;
+    marker_msg.pose.orientation.z = 0.0;
+    marker_msg.pose.orientation.w = 1.0;
+    // points
+    marker_msg.points.resize(mpc_N_);
+    for (int iStage = 0; iStage < mpc_N_; iStage++) {
+        marker_msg.points[iStage].x = mpc_x_plan_(0, iStage);
+        marker_msg.points[iStage].y = mpc_x_plan_(1, iStage);
+        marker_msg.points[iStage].z = mpc_x_plan_(2, iStage);
+    }
+    mpc_traj_plan_vis_pub_.publish(marker_msg);
+}
+
+void MavNmpcTracker::pub_solver_timing()
+{
+    std_msgs::Float64MultiArray timing_msg;
+    timing_msg.data.resize(10);
+    timing_msg.data[0] = mpc_timing_.preparation;
+    timing_msg.data[1] = mpc_timing_.feedback;
+    timing_msg.data[2] = mpc_timing_.odom_to_cmd;
+    timing_msg.data[3] = mpc_timing_.odom_age;
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        timing_msg.data[4] = static_cast<double>(mpc_timing_.missed_deadlines);
+    }
+    timing_msg.data[5] = static_cast<double>(mpc_timing_.qp_iter);
+    timing_msg.data[6] = static_cast<double>(mpc_timing_.warm_start);
+    timing_msg.data[7] = mpc_timing_.odom_delay;
+    timing_msg.data[8] = mpc_timing_.traj_delay;
+    timing_msg.data[9] = mpc_timing_.prediction;
+    mpc_timing_pub_.publish(timing_msg);
+}
+
+void MavNmpcTracker::pub_model_estimate()
+{
+    if (!model_estimator_)
+        return;
+    std_msgs::Float64MultiArray estimate_msg;
+    estimate_msg.data.resize(8);
+    estimate_msg.data[0] = model_estimate_.thrust_scale;
+    estimate_msg.data[1] = model_estimate_.drag_coefficient_x;
+    estimate_msg.data[2] = model_estimate_.drag_coefficient_y;
+    estimate_msg.data[3] = model_estimate_.roll_time_constant;
+    estimate_msg.data[4] = model_estimate_.roll_gain;
+    estimate_msg.data[5] = model_estimate_.pitch_time_constant;
+    estimate_msg.data[6] = model_estimate_.pitch_gain;
+    estimate_msg.data[7] = static_cast<double>(model_estimate_samples_);
+    model_estimate_pub_.publish(estimate_msg);
+}
+
+void MavNmpcTracker::pub_mhe_estimate()
+{
+    if (!mhe_)
+        return;
+    std_msgs::Float64MultiArray estimate_msg;
+    estimate_msg.data.resize(kNx + 5);
+    for (int i = 0; i < kNx; i++)
+        estimate_msg.data[i] = mhe_->state()(i);
+    for (int i = 0; i < 3; i++)
+        estimate_msg.data[kNx + i] = mass_ * mhe_->disturbance()(i);
+    estimate_msg.data[kNx + 3] = static_cast<double>(mhe_status_);
+    estimate_msg.data[kNx + 4] = mhe_time_;
+    mhe_estimate_pub_.publish(estimate_msg);
+}
+
+void MavNmpcTracker::pub_disturbance()
+{
+    if (!options_.offset_free)
+        return;
+    std_msgs::Float64MultiArray disturbance_msg;
+    disturbance_msg.data.resize(3);
+    for (int i = 0; i < 3; i++)
+        disturbance_msg.data[i] = mass_ * disturbance_(i);
+    disturbance_pub_.publish(disturbance_msg);
+}
+
+}  // namespace mav_nmpc_tracker
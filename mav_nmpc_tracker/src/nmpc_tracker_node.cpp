@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ros/ros.h>
+
+#include "mav_nmpc_tracker/nmpc_tracker.h"
+
+using mav_nmpc_tracker::g;
+using mav_nmpc_tracker::MavNmpcTracker;
+using mav_nmpc_tracker::MpcFormulationParam;
+using mav_nmpc_tracker::NmpcTrackerOptions;
+using mav_nmpc_tracker::geometric_time_steps;
+using mav_nmpc_tracker::horizon_time_steps;
+using mav_nmpc_tracker::piecewise_time_steps;
+using mav_nmpc_tracker::stage_times;
+
+namespace {
+
+double deg2rad(double deg) { return deg * M_PI / 180.0; }
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    // create a node
+    ROS_INFO("Starting NMPC tracking...");
+    ros::init(argc, argv, "mav_nmpc_tracker_node");
+    ros::NodeHandle nh;
+    ros::NodeHandle pnh("~");
+    double hz = 40.0;
+    pnh.param("control_rate", hz, hz);
+    ros::Rate rate(hz);
+    ros::Duration(1.0).sleep();
+
+    // fetch param
+    // tracking mode
+    std::string tracking_mode, yaw_command_mode;
+    pnh.getParam("tracking_mode", tracking_mode);
+    ROS_INFO("The running mode is: %s.", tracking_mode.c_str());
+    pnh.getParam("yaw_command_mode", yaw_command_mode);
+    ROS_INFO("The yaw control mode is: %s.", yaw_command_mode.c_str());
+    // horizon
+    MpcFormulationParam mpc_form_param;
+    pnh.getParam("dt", mpc_form_param.dt);
+    pnh.getParam("N", mpc_form_param.N);
+    mpc_form_param.Tf = mpc_form_param.N * mpc_form_param.dt;
+    // non-uniform time grid of the native tracker
+    std::string time_grid = "uniform";
+    pnh.param("time_grid", time_grid, time_grid);
+    if (time_grid == "geometric") {
+        int grid_N = mpc_form_param.N;
+        double grid_horizon = mpc_form_param.Tf, grid_ratio = 1.0;
+        pnh.param("time_grid_N", grid_N, grid_N);
+        pnh.param("time_grid_horizon", grid_horizon, grid_horizon);
+        pnh.param("time_grid_ratio", grid_ratio, grid_ratio);
+        mpc_form_param.time_steps = geometric_time_steps(grid_N, grid_horizon, grid_ratio);
+    } else if (time_grid == "piecewise") {
+        std::vector<int> grid_counts;
+        std::vector<double> grid_steps;
+        pnh.getParam("time_grid_counts", grid_counts);
+        pnh.getParam("time_grid_steps", grid_steps);
+        try {
+            mpc_form_param.time_steps = piecewise_time_steps(grid_counts, grid_steps);
+        } catch (const std::exception &e) {
+            ROS_FATAL("%s", e.what());
+            return 1;
+        }
+    } else if (time_grid != "uniform") {
+        ROS_WARN("Unknown time_grid %s, using the uniform one.", time_grid.c_str());
+    }
+    if (!mpc_form_param.time_steps.empty()) {
+        mpc_form_param.N = static_cast<int>(mpc_form_param.time_steps.size());
+        mpc_form_param.Tf = stage_times(mpc_form_param.time_steps).back();
+    }
+    ROS_INFO("Horizon: %s grid, N = %d, %.3f s, first step %.3f s, last step %.3f s.", time_grid.c_str(),
+             mpc_form_param.N, mpc_form_param.Tf, horizon_time_steps(mpc_form_param).front(),
+             horizon_time_steps(mpc_form_param).back());
+    // mav dynamics
+    pnh.getParam("mass", mpc_form_param.mass);
+    pnh.getParam("thrust_scale", mpc_form_param.thrust_scale);
+    pnh.getParam("roll_time_constant", mpc_form_param.roll_time_constant);
+    pnh.getParam("roll_gain", mpc_form_param.roll_gain);
+    pnh.getParam("pitch_time_constant", mpc_form_param.pitch_time_constant);
+    pnh.getParam("pitch_gain", mpc_form_param.pitch_gain);
+    pnh.getParam("drag_coefficient_x", mpc_form_param.drag_coefficient_x);
+    pnh.getParam("drag_coefficient_y", mpc_form_param.drag_coefficient_y);
+    pnh.param("thrust_gain", mpc_form_param.thrust_gain, mpc_form_param.thrust_gain);
+    // control bound
+    double roll_max, pitch_max, thrust_min, thrust_max, yawrate_max;
+    pnh.getParam("roll_max", roll_max);
+    pnh.getParam("pitch_max", pitch_max);
+    pnh.getParam("thrust_min", thrust_min);
+    pnh.getParam("thrust_max", thrust_max);
+    pnh.getParam("yawrate_max", yawrate_max);
+    mpc_form_param.roll_max = deg2rad(roll_max);
+    mpc_form_param.pitch_max = deg2rad(pitch_max);
+    mpc_form_param.thrust_min = thrust_min * g;
+    mpc_form_param.thrust_max = thrust_max * g;
+    pnh.getParam("K_yaw", mpc_form_param.K_yaw);
+    mpc_form_param.yawrate_max = deg2rad(yawrate_max);
+    // cost weights
+    pnh.getParam("q_x", mpc_form_param.q_x);
+    pnh.getParam("q_y", mpc_form_param.q_y);
+    pnh.getParam("q_z", mpc_form_param.q_z);
+    pnh.getParam("q_vx", mpc_form_param.q_vx);
+    pnh.getParam("q_vy", mpc_form_param.q_vy);
+    pnh.getParam("q_vz", mpc_form_param.q_vz);
+    pnh.getParam("r_roll", mpc_form_param.r_roll);
+    pnh.getParam("r_pitch", mpc_form_param.r_pitch);
+    pnh.getParam("r_thrust", mpc_form_param.r_thrust);
+    pnh.param("corridor_slack_l1", mpc_form_param.corridor_slack_l1, mpc_form_param.corridor_slack_l1);
+    pnh.param("corridor_slack_l2", mpc_form_param.corridor_slack_l2, mpc_form_param.corridor_slack_l2);
+    pnh.param("obstacle_slack_l1", mpc_form_param.obstacle_slack_l1, mpc_form_param.obstacle_slack_l1);
+    pnh.param("obstacle_slack_l2", mpc_form_param.obstacle_slack_l2, mpc_form_param.obstacle_slack_l2);
+    pnh.param("esdf_slack_l1", mpc_form_param.esdf_slack_l1, mpc_form_param.esdf_slack_l1);
+    pnh.param("esdf_slack_l2", mpc_form_param.esdf_slack_l2, mpc_form_param.esdf_slack_l2);
+
+    // native tracker settings
+    NmpcTrackerOptions options;
+    pnh.param("rti_split", options.rti_split, options.rti_split);
+    ROS_INFO("RTI preparation/feedback split: %s.", options.rti_split ? "on" : "off");
+    pnh.param("control_trigger", options.control_trigger, options.control_trigger);
+    pnh.param("odom_decimation", options.odom_decimation, options.odom_decimation);
+    options.odom_decimation = std::max(options.odom_decimation, 1);
+    pnh.param("speculative_solve", options.speculative_solve, options.speculative_solve);
+    pnh.param("speculative_cpu_warm", options.speculative_cpu_warm, options.speculative_cpu_warm);
+    pnh.param("speculative_cpu_cold", options.speculative_cpu_cold, options.speculative_cpu_cold);
+    pnh.param("speculative_deadline", options.speculative_deadline, options.speculative_deadline);
+    ROS_INFO("Speculative warm/reset solves: %s.", options.speculative_solve ? "on" : "off");
+    pnh.param("warm_start_jump_small", options.warm_start.jump_small, options.warm_start.jump_small);
+    pnh.param("warm_start_jump_large", options.warm_start.jump_large, options.warm_start.jump_large);
+    pnh.param("predict_delay", options.predict_delay, options.predict_delay);
+    pnh.param("predict_max_horizon", options.predict_max_horizon, options.predict_max_horizon);
+    ROS_INFO("Odometry delay prediction: %s.", options.predict_delay ? "on" : "off");
+    pnh.param("traj_buffer_size", options.traj_buffer_size, options.traj_buffer_size);
+    pnh.param("input_feedforward", options.input_feedforward, options.input_feedforward);
+    pnh.getParam("solver_variants", options.solver_variants);
+    pnh.param("solver_variant", options.solver_variant, options.solver_variant);
+    pnh.param("stationary_N", options.stationary_N, options.stationary_N);
+    pnh.param("stationary_dt", options.stationary_dt, options.stationary_dt);
+    if (options.stationary_N > 0)
+        ROS_INFO("Stationary references use N = %d steps of %.3f s.", options.stationary_N, options.stationary_dt);
+    pnh.param("estimate_model", options.estimate_model, options.estimate_model);
+    pnh.param("estimate_forgetting", options.model_estimator.forgetting, options.model_estimator.forgetting);
+    int estimate_min_samples = static_cast<int>(options.model_estimator.min_samples);
+    pnh.param("estimate_min_samples", estimate_min_samples, estimate_min_samples);
+    options.model_estimator.min_samples = static_cast<unsigned long>(std::max(estimate_min_samples, 0));
+    pnh.param("estimate_bound_ratio", options.model_estimator.bound_ratio, options.model_estimator.bound_ratio);
+    ROS_INFO("Online model estimation: %s.", options.estimate_model ? "on" : "off");
+    pnh.param("mhe_solver", options.mhe_solver, options.mhe_solver);
+    pnh.param("mhe_r_pos", options.mhe.r_pos, options.mhe.r_pos);
+    pnh.param("mhe_r_vel", options.mhe.r_vel, options.mhe.r_vel);
+    pnh.param("mhe_r_att", options.mhe.r_att, options.mhe.r_att);
+    pnh.param("mhe_q_pos", options.mhe.q_pos, options.mhe.q_pos);
+    pnh.param("mhe_q_vel", options.mhe.q_vel, options.mhe.q_vel);
+    pnh.param("mhe_q_att", options.mhe.q_att, options.mhe.q_att);
+    pnh.param("mhe_q_dist", options.mhe.q_dist, options.mhe.q_dist);
+    pnh.param("mhe_p0_state", options.mhe.p0_state, options.mhe.p0_state);
+    pnh.param("mhe_p0_dist", options.mhe.p0_dist, options.mhe.p0_dist);
+    pnh.param("offset_free", options.offset_free, options.offset_free);
+    pnh.param("disturbance_gain", options.disturbance_observer.gain, options.disturbance_observer.gain);
+    pnh.param("disturbance_max", options.disturbance_observer.disturbance_max,
+              options.disturbance_observer.disturbance_max);
+    ROS_INFO("Offset-free tracking: %s.", options.offset_free ? "on" : "off");
+    pnh.param("corridors", options.corridors, options.corridors);
+    pnh.param("corridor_margin", options.corridor_margin, options.corridor_margin);
+    ROS_INFO("Corridor constraints: %s.", options.corridors ? "on" : "off");
+    pnh.param("obstacles", options.obstacles, options.obstacles);
+    pnh.param("obstacle_margin", options.obstacle_margin, options.obstacle_margin);
+    pnh.param("obstacle_cell_size", options.obstacle_index.cell_size, options.obstacle_index.cell_size);
+    pnh.param("obstacle_range", options.obstacle_index.range, options.obstacle_index.range);
+    ROS_INFO("Obstacle constraints: %s.", options.obstacles ? "on" : "off");
+    pnh.param("esdf_map", options.esdf_map, options.esdf_map);
+    pnh.param("esdf_distance", options.esdf_distance, options.esdf_distance);
+    pnh.param("esdf_cache_blocks", options.esdf_cache_blocks, options.esdf_cache_blocks);
+    ROS_INFO("Distance field: %s.", options.esdf_map.empty() ? "off" : options.esdf_map.c_str());
+    pnh.param("trajectory_library", options.trajectory_library, options.trajectory_library);
+    ROS_INFO("Trajectory library: %s.",
+             options.trajectory_library.empty() ? "off" : options.trajectory_library.c_str());
+    pnh.param("transitions", options.transitions, options.transitions);
+    pnh.param("transition_velocity", options.transition_limits.velocity, options.transition_limits.velocity);
+    pnh.param("transition_acceleration", options.transition_limits.acceleration,
+              options.transition_limits.acceleration);
+    ROS_INFO("Minimum snap transitions of hover and home: %s.", options.transitions ? "on" : "off");
+    pnh.param("command_rate", options.command_rate, options.command_rate);
+    std::string command_interpolation = "linear";
+    pnh.param("command_interpolation", command_interpolation, command_interpolation);
+    options.command_interpolator.linear = (command_interpolation != "hold");
+    pnh.param("command_feedback_kp", options.command_interpolator.kp, options.command_interpolator.kp);
+    pnh.param("command_feedback_kd", options.command_interpolator.kd, options.command_interpolator.kd);
+    if (options.command_rate > 0.0)
+        ROS_INFO("Commands at %.1f Hz from the plan, %s, feedback kp %.2f kd %.2f.", options.command_rate,
+                 command_interpolation.c_str(), options.command_interpolator.kp, options.command_interpolator.kd);
+    ROS_INFO("Moving horizon estimation: %s.", options.mhe_solver.empty() ? "off" : options.mhe_solver.c_str());
+    if (options.control_trigger == "odometry")
+        ROS_INFO("The control is triggered by every %d odometry message(s).", options.odom_decimation);
+    else
+        ROS_INFO("The control runs at %.1f Hz.", hz);
+
+    // create a nmpc tracker
+    std::unique_ptr<MavNmpcTracker> nmpc_tracker;
+    try {
+        nmpc_tracker.reset(new MavNmpcTracker(nh, mpc_form_param, tracking_mode, yaw_command_mode, options));
+    } catch (const std::exception &e) {
+        ROS_FATAL("Failed to create the NMPC tracker: %s", e.what());
+        return 1;
+    }
+
+    if (options.control_trigger == "odometry") {
+        // the cycles run in the tracker's control thread
+        ros::spin();
+    } else {
+        while (ros::ok()) {
+            ros::spinOnce();
+            nmpc_tracker->control_cycle();
+            rate.sleep();
+        }
+    }
+
+    return 0;
+}
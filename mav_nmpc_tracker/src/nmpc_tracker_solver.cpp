@@ -0,0 +1,378 @@
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// bound of the corridor rows not in use
+constexpr double kInactiveBound = 1e9;
+
+}  // namespace
+
+std::vector<double> horizon_time_steps(const MpcFormulationParam &param)
+{
+    if (!param.time_steps.empty())
+        return param.time_steps;
+    return std::vector<double>(param.N, param.dt);
+}
+
+std::vector<double> geometric_time_steps(int N, double horizon, double ratio)
+{
+    // horizon = dt0 * (ratio^N - 1) / (ratio - 1)
+    const double dt0 = std::abs(ratio - 1.0) < 1e-9 ? horizon / N
+                                                    : horizon * (ratio - 1.0) / (std::pow(ratio, N) - 1.0);
+    std::vector<double> time_steps(N);
+    for (int iStage = 0; iStage < N; iStage++)
+        time_steps[iStage] = dt0 * std::pow(ratio, iStage);
+    return time_steps;
+}
+
+std::vector<double> piecewise_time_steps(const std::vector<int> &counts, const std::vector<double> &steps)
+{
+    if (counts.size() != steps.size())
+        throw std::runtime_error("piecewise time grid: " + std::to_string(counts.size()) + " counts for " +
+                                 std::to_string(steps.size()) + " steps");
+    std::vector<double> time_steps;
+    for (size_t i = 0; i < counts.size(); i++)
+        time_steps.insert(time_steps.end(), std::max(counts[i], 0), steps[i]);
+    return time_steps;
+}
+
+std::vector<double> stage_times(const std::vector<double> &time_steps)
+{
+    std::vector<double> times(time_steps.size() + 1, 0.0);
+    for (size_t iStage = 0; iStage < time_steps.size(); iStage++)
+        times[iStage + 1] = times[iStage] + time_steps[iStage];
+    return times;
+}
+
+ModelParamVector model_params(const MpcFormulationParam &param)
+{
+    ModelParamVector p;
+    p << param.roll_time_constant, param.roll_gain, param.pitch_time_constant, param.pitch_gain,
+        param.drag_coefficient_x, param.drag_coefficient_y, param.thrust_gain, param.disturbance_x,
+        param.disturbance_y, param.disturbance_z;
+    return p;
+}
+
+NmpcTrackerSolver::NmpcTrackerSolver(const MpcFormulationParam &param)
+    // the horizon may differ from the one used for code generation
+    : NmpcTrackerSolver(param, SolverLibrary::linked(), horizon_time_steps(param))
+{
+}
+
+NmpcTrackerSolver::NmpcTrackerSolver(const MpcFormulationParam &param, std::shared_ptr<const SolverLibrary> library,
+                                     const std::vector<double> &time_steps)
+    : N_(static_cast<int>(time_steps.size())),
+      time_steps_(time_steps),
+      library_(std::move(library))
+{
+    if (N_ < 1 || *std::min_element(time_steps_.begin(), time_steps_.end()) <= 0.0)
+        throw std::runtime_error("The time steps of the horizon have to be positive");
+
+    capsule_ = library_->create_capsule();
+    if (capsule_ == nullptr) {
+        throw std::runtime_error("Failed to allocate the acados solver capsule");
+    }
+
+    int status = library_->create_with_discretization(capsule_, N_, time_steps_.data());
+    if (status != 0) {
+        library_->free_capsule(capsule_);
+        throw std::runtime_error(library_->descriptor().model_name + "_acados_create() returned status " +
+                                 std::to_string(status));
+    }
+
+    nlp_config_ = library_->get_nlp_config(capsule_);
+    nlp_dims_ = library_->get_nlp_dims(capsule_);
+    nlp_in_ = library_->get_nlp_in(capsule_);
+    nlp_out_ = library_->get_nlp_out(capsule_);
+    nlp_solver_ = library_->get_nlp_solver(capsule_);
+    nlp_opts_ = library_->get_nlp_opts(capsule_);
+
+    set_weights(param);
+    set_control_bounds(param);
+    stage_param_values_.assign(library_->descriptor().np, 0.0);
+    stage_obstacles_.assign(N_ + 1, empty_obstacle_slots());
+    // NaN, the first call sets every stage
+    stage_params_.assign(N_ + 1, ModelParamVector::Constant(std::nan("")));
+    set_model_params(model_params(param));
+    // no faces yet, the first call sets every stage
+    stage_corridors_.assign(N_ + 1, Corridor());
+    stage_esdf_.assign(N_ + 1, EsdfConstraint());
+    stage_C_values_.resize(library_->descriptor().ng * kNx);
+    stage_lg_values_.resize(library_->descriptor().ng);
+    stage_ug_values_.resize(library_->descriptor().ng);
+    if (library_->descriptor().ng > 0) {
+        for (int iStage = 0; iStage <= N_; iStage++)
+            update_stage_constraints(iStage);
+    }
+    set_slack_penalties(param);
+}
+
+NmpcTrackerSolver::~NmpcTrackerSolver()
+{
+    library_->free_solver(capsule_);
+    library_->free_capsule(capsule_);
+}
+
+void NmpcTrackerSolver::set_weights(const MpcFormulationParam &param)
+{
+    // column major, diagonal only
+    double W[kNy * kNy] = {0.0};
+    const double w_diag[kNy] = {param.q_x, param.q_y, param.q_z,
+                                param.q_vx, param.q_vy, param.q_vz,
+                                param.r_roll, param.r_pitch, param.r_thrust};
+    for (int i = 0; i < kNy; i++)
+        W[i + kNy * i] = w_diag[i];
+    for (int iStage = 0; iStage < N_; iStage++)
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "W", W);
+
+    double W_e[kNyE * kNyE] = {0.0};
+    for (int i = 0; i < kNyE; i++)
+        W_e[i + kNyE * i] = w_diag[i];
+    ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, N_, "W", W_e);
+}
+
+void NmpcTrackerSolver::set_control_bounds(const MpcFormulationParam &param)
+{
+    double lbu[kNu] = {-param.roll_max, -param.pitch_max, param.thrust_min};
+    double ubu[kNu] = {param.roll_max, param.pitch_max, param.thrust_max};
+    for (int iStage = 0; iStage < N_; iStage++) {
+        ocp_nlp_constraints_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "lbu", lbu);
+        ocp_nlp_constraints_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "ubu", ubu);
+    }
+}
+
+bool NmpcTrackerSolver::has_model_params() const
+{
+    return library_->descriptor().np >= kNumModelParams;
+}
+
+bool NmpcTrackerSolver::set_model_params(const ModelParamVector &p)
+{
+    for (int iStage = 0; iStage <= N_; iStage++) {
+        if (!set_stage_model_params(iStage, p))
+            return false;
+    }
+    return true;
+}
+
+bool NmpcTrackerSolver::set_stage_model_params(int stage, const ModelParamVector &p)
+{
+    assert(stage >= 0 && stage <= N_);
+    if (!has_model_params())
+        return false;
+    if (stage_params_[stage] == p)
+        return true;
+    stage_params_[stage] = p;
+    return update_stage_params(stage);
+}
+
+bool NmpcTrackerSolver::update_stage_params(int stage)
+{
+    // only the stage's functions take the parameters, nothing is recomputed until the next solve
+    Eigen::Map<ModelParamVector>(stage_param_values_.data()) = stage_params_[stage];
+    if (has_obstacle_constraints())
+        Eigen::Map<ObstacleSlots>(stage_param_values_.data() + kNumModelParams) = stage_obstacles_[stage];
+    return library_->update_params(capsule_, stage, stage_param_values_.data(),
+                                   static_cast<int>(stage_param_values_.size())) == 0;
+}
+
+bool NmpcTrackerSolver::has_corridor_constraints() const
+{
+    const int ng = library_->descriptor().ng;
+    return ng == kCorridorFaces || ng == kCorridorFaces + kEsdfRows;
+}
+
+bool NmpcTrackerSolver::set_stage_corridor(int stage, const Corridor &corridor)
+{
+    assert(stage >= 0 && stage <= N_);
+    if (!has_corridor_constraints())
+        return false;
+    if (stage_corridors_[stage] == corridor)
+        return true;
+    stage_corridors_[stage] = corridor;
+    update_stage_constraints(stage);
+    return true;
+}
+
+bool NmpcTrackerSolver::has_esdf_constraints() const
+{
+    const int ng = library_->descriptor().ng;
+    return ng == kEsdfRows || ng == kCorridorFaces + kEsdfRows;
+}
+
+bool NmpcTrackerSolver::set_stage_esdf(int stage, const EsdfConstraint &constraint)
+{
+    assert(stage >= 0 && stage <= N_);
+    if (!has_esdf_constraints())
+        return false;
+    if (stage_esdf_[stage] == constraint)
+        return true;
+    stage_esdf_[stage] = constraint;
+    update_stage_constraints(stage);
+    return true;
+}
+
+void NmpcTrackerSolver::update_stage_constraints(int stage)
+{
+    // column major, only the position columns of the rows in use: the corridor faces, then the
+    // distance field row
+    const int ng = library_->descriptor().ng;
+    std::vector<double> &C = stage_C_values_, &lg = stage_lg_values_, &ug = stage_ug_values_;
+    std::fill(C.begin(), C.end(), 0.0);
+    std::fill(lg.begin(), lg.end(), -kInactiveBound);
+    std::fill(ug.begin(), ug.end(), kInactiveBound);
+    int row = 0;
+    if (has_corridor_constraints()) {
+        const Corridor &corridor = stage_corridors_[stage];
+        for (int i = 0; i < corridor.faces; i++) {
+            for (int j = 0; j < 3; j++)
+                C[row + i + ng * j] = corridor.A(i, j);
+            ug[row + i] = corridor.b(i);
+        }
+        row += kCorridorFaces;
+    }
+    if (has_esdf_constraints() && stage_esdf_[stage].active) {
+        for (int j = 0; j < 3; j++)
+            C[row + ng * j] = stage_esdf_[stage].gradient(j);
+        lg[row] = stage_esdf_[stage].bound;
+    }
+    ocp_nlp_constraints_model_set(nlp_config_, nlp_dims_, nlp_in_, stage, "C", C.data());
+    ocp_nlp_constraints_model_set(nlp_config_, nlp_dims_, nlp_in_, stage, "lg", lg.data());
+    ocp_nlp_constraints_model_set(nlp_config_, nlp_dims_, nlp_in_, stage, "ug", ug.data());
+}
+
+bool NmpcTrackerSolver::has_obstacle_constraints() const
+{
+    const SolverDescriptor &descriptor = library_->descriptor();
+    return descriptor.nh == kObstacleSlots && descriptor.np == kNumModelParams + kNumObstacleParams;
+}
+
+bool NmpcTrackerSolver::set_stage_obstacles(int stage, const ObstacleSlots &slots)
+{
+    assert(stage >= 0 && stage <= N_);
+    if (!has_obstacle_constraints())
+        return false;
+    if (stage_obstacles_[stage] == slots)
+        return true;
+    stage_obstacles_[stage] = slots;
+    return update_stage_params(stage);
+}
+
+void NmpcTrackerSolver::set_slack_penalties(const MpcFormulationParam &param)
+{
+    // the slacks in the order of acados, of the general then of the nonlinear constraints
+    std::vector<double> z, Z;
+    if (has_corridor_constraints()) {
+        z.insert(z.end(), kCorridorFaces, param.corridor_slack_l1);
+        Z.insert(Z.end(), kCorridorFaces, param.corridor_slack_l2);
+    }
+    if (has_esdf_constraints()) {
+        z.insert(z.end(), kEsdfRows, param.esdf_slack_l1);
+        Z.insert(Z.end(), kEsdfRows, param.esdf_slack_l2);
+    }
+    if (has_obstacle_constraints()) {
+        z.insert(z.end(), kObstacleSlots, param.obstacle_slack_l1);
+        Z.insert(Z.end(), kObstacleSlots, param.obstacle_slack_l2);
+    }
+    if (z.empty())
+        return;
+    for (int iStage = 0; iStage <= N_; iStage++) {
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "zl", z.data());
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "zu", z.data());
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "Zl", Z.data());
+        ocp_nlp_cost_model_set(nlp_config_, nlp_dims_, nlp_in_, iStage, "Zu", Z.data());
+    }
+}
+
+void NmpcTrackerSolver::set_x0(const StateVector &x0)
+{
+    mav_nmpc_tracker_horizon_set_x0(capsule_, x0.data());
+}
+
+void NmpcTrackerSolver::set_x_init(const StateTrajectory &x_traj)
+{
+    assert(x_traj.cols() == N_ + 1);
+    mav_nmpc_tracker_horizon_set_x_traj(capsule_, x_traj.data());
+}
+
+void NmpcTrackerSolver::set_u_init(const InputTrajectory &u_traj)
+{
+    assert(u_traj.cols() == N_);
+    mav_nmpc_tracker_horizon_set_u_traj(capsule_, u_traj.data());
+}
+
+void NmpcTrackerSolver::set_yref(const RefTrajectory &yref_traj, const TerminalRefVector &yref_e)
+{
+    assert(yref_traj.cols() == N_);
+    mav_nmpc_tracker_horizon_set_yref_traj(capsule_, yref_traj.data(), yref_e.data());
+}
+
+int NmpcTrackerSolver::solve()
+{
+    return solve_rti_phase(0);
+}
+
+int NmpcTrackerSolver::prepare()
+{
+    return solve_rti_phase(1);
+}
+
+int NmpcTrackerSolver::feedback()
+{
+    return solve_rti_phase(2);
+}
+
+int NmpcTrackerSolver::solve_rti_phase(int rti_phase)
+{
+    ocp_nlp_solver_opts_set(nlp_config_, nlp_opts_, "rti_phase", &rti_phase);
+    return library_->solve(capsule_);
+}
+
+void NmpcTrackerSolver::get_x_traj(StateTrajectory &x_traj) const
+{
+    x_traj.resize(kNx, N_ + 1);
+    mav_nmpc_tracker_horizon_get_x_traj(capsule_, x_traj.data());
+}
+
+void NmpcTrackerSolver::get_u_traj(InputTrajectory &u_traj) const
+{
+    u_traj.resize(kNu, N_);
+    mav_nmpc_tracker_horizon_get_u_traj(capsule_, u_traj.data());
+}
+
+StateView NmpcTrackerSolver::x_view(int stage) const
+{
+    // ux is stored as [u; x; s] per stage
+    assert(stage >= 0 && stage <= N_);
+    return StateView(nlp_out_->ux[stage].pa + nlp_dims_->nu[stage]);
+}
+
+InputView NmpcTrackerSolver::u_view(int stage) const
+{
+    assert(stage >= 0 && stage < N_);
+    return InputView(nlp_out_->ux[stage].pa);
+}
+
+double NmpcTrackerSolver::get_time_tot() const
+{
+    double time_tot = 0.0;
+    ocp_nlp_get(nlp_config_, nlp_solver_, "time_tot", &time_tot);
+    return time_tot;
+}
+
+int NmpcTrackerSolver::get_qp_iter() const
+{
+    int qp_iter = 0;
+    ocp_nlp_get(nlp_config_, nlp_solver_, "qp_iter", &qp_iter);
+    return qp_iter;
+}
+
+}  // namespace mav_nmpc_tracker
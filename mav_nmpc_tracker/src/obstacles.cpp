@@ -0,0 +1,120 @@
+#include "mav_nmpc_tracker/obstacles.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// center and semi-axes of an empty slot, the constraint value is about 300 within 100 m of the origin
+constexpr double kEmptySlotCenter = 1e4;
+constexpr double kEmptySlotRadius = 1e3;
+
+// bits of each cell coordinate in a key, the grid repeats every 2^21 cells
+constexpr int kCellKeyBits = 21;
+
+}  // namespace
+
+ObstacleSlots empty_obstacle_slots()
+{
+    ObstacleSlots slots;
+    slots.topRows<3>().setConstant(kEmptySlotCenter);
+    slots.bottomRows<3>().setConstant(kEmptySlotRadius);
+    return slots;
+}
+
+void set_obstacle_slot(ObstacleSlots &slots, int slot, const Obstacle &obstacle, double time, double margin)
+{
+    slots.col(slot).head<3>() = obstacle.position_at(time);
+    slots.col(slot).tail<3>() = obstacle.radii.array() + margin;
+}
+
+ObstacleIndex::ObstacleIndex(const ObstacleIndexParam &param)
+    : param_(param), stamp_(0.0), max_speed_(0.0), max_radius_(0.0), tests_(0)
+{
+}
+
+void ObstacleIndex::set_obstacles(const std::vector<Obstacle> &obstacles)
+{
+    obstacles_ = obstacles;
+    stamp_ = 0.0;
+    max_speed_ = 0.0;
+    max_radius_ = 0.0;
+    for (const Obstacle &obstacle : obstacles_) {
+        stamp_ = std::max(stamp_, obstacle.stamp);
+        max_speed_ = std::max(max_speed_, obstacle.velocity.norm());
+        max_radius_ = std::max(max_radius_, obstacle.radii.maxCoeff());
+    }
+    // the grid of the positions at the newest stamp, sorted by cell for the lookups
+    cells_.resize(obstacles_.size());
+    for (size_t i = 0; i < obstacles_.size(); i++)
+        cells_[i] = std::make_pair(cell_key(cell_of(obstacles_[i].position_at(stamp_))), static_cast<int>(i));
+    std::sort(cells_.begin(), cells_.end());
+}
+
+const std::vector<int> &ObstacleIndex::nearest(const Eigen::Vector3d &p, double time, int max_count)
+{
+    candidates_.clear();
+    tests_ = 0;
+    // the cells an obstacle within the range at time can be in
+    const double reach = param_.range + max_radius_ + max_speed_ * std::abs(time - stamp_);
+    const Eigen::Vector3i low = cell_of(p.array() - reach);
+    const Eigen::Vector3i high = cell_of(p.array() + reach);
+    const Eigen::Vector3i extent = high - low + Eigen::Vector3i::Ones();
+    // more cells than obstacles, e.g. fast ones far in the horizon: testing them all is cheaper
+    if (static_cast<double>(extent.cast<double>().prod()) > static_cast<double>(obstacles_.size()))
+        return nearest_brute_force(p, time, max_count);
+
+    for (int x = low(0); x <= high(0); x++) {
+        for (int y = low(1); y <= high(1); y++) {
+            for (int z = low(2); z <= high(2); z++) {
+                const long long key = cell_key(Eigen::Vector3i(x, y, z));
+                auto cell = std::lower_bound(cells_.begin(), cells_.end(), std::make_pair(key, -1));
+                for (; cell != cells_.end() && cell->first == key; ++cell)
+                    test(cell->second, p, time);
+            }
+        }
+    }
+    return select(max_count);
+}
+
+const std::vector<int> &ObstacleIndex::nearest_brute_force(const Eigen::Vector3d &p, double time, int max_count)
+{
+    candidates_.clear();
+    tests_ = 0;
+    for (size_t i = 0; i < obstacles_.size(); i++)
+        test(static_cast<int>(i), p, time);
+    return select(max_count);
+}
+
+Eigen::Vector3i ObstacleIndex::cell_of(const Eigen::Vector3d &p) const
+{
+    return (p / param_.cell_size).array().floor().cast<int>();
+}
+
+long long ObstacleIndex::cell_key(const Eigen::Vector3i &cell)
+{
+    const long long mask = (1LL << kCellKeyBits) - 1;
+    return ((cell(0) & mask) << (2 * kCellKeyBits)) | ((cell(1) & mask) << kCellKeyBits) | (cell(2) & mask);
+}
+
+void ObstacleIndex::test(int index, const Eigen::Vector3d &p, double time)
+{
+    tests_++;
+    const double distance = obstacles_[index].distance(p, time);
+    if (distance <= param_.range)
+        candidates_.push_back(std::make_pair(distance, index));
+}
+
+const std::vector<int> &ObstacleIndex::select(int max_count)
+{
+    const int count = std::min(max_count, static_cast<int>(candidates_.size()));
+    std::partial_sort(candidates_.begin(), candidates_.begin() + count, candidates_.end());
+    nearest_.resize(count);
+    for (int i = 0; i < count; i++)
+        nearest_[i] = candidates_[i].second;
+    return nearest_;
+}
+
+}  // namespace mav_nmpc_tracker
@@ -0,0 +1,127 @@
+#include "mav_nmpc_tracker/polynomial_trajectory.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+typedef Eigen::Matrix<double, 3, Eigen::Dynamic> Coefficients;
+
+Coefficients derivative(const Coefficients &coefficients)
+{
+    const int n = static_cast<int>(coefficients.cols());
+    if (n <= 1)
+        return Coefficients::Zero(3, 1);
+    Coefficients result(3, n - 1);
+    for (int k = 1; k < n; k++)
+        result.col(k - 1) = k * coefficients.col(k);
+    return result;
+}
+
+}  // namespace
+
+bool PolynomialTrajectory::set(double start_time, const std::vector<PolynomialSegment> &segments)
+{
+    if (segments.empty())
+        return false;
+    for (const PolynomialSegment &segment : segments) {
+        if (segment.coefficients.cols() == 0 || !(segment.duration > 0.0))
+            return false;
+    }
+    segments_ = segments;
+    velocity_coefficients_.resize(segments_.size());
+    acceleration_coefficients_.resize(segments_.size());
+    start_times_.resize(segments_.size() + 1);
+    start_times_[0] = start_time;
+    for (size_t i = 0; i < segments_.size(); i++) {
+        velocity_coefficients_[i] = derivative(segments_[i].coefficients);
+        acceleration_coefficients_[i] = derivative(velocity_coefficients_[i]);
+        start_times_[i + 1] = start_times_[i] + segments_[i].duration;
+    }
+    return true;
+}
+
+void PolynomialTrajectory::clear()
+{
+    segments_.clear();
+    velocity_coefficients_.clear();
+    acceleration_coefficients_.clear();
+    start_times_.clear();
+}
+
+void PolynomialTrajectory::horner(const Coefficients &coefficients, const Eigen::ArrayXd &times,
+                                  Eigen::Ref<Eigen::Matrix3Xd> values)
+{
+    const int n = static_cast<int>(coefficients.cols());
+    values = coefficients.col(n - 1).replicate(1, times.size());
+    for (int k = n - 2; k >= 0; k--)
+        values = (values.array().rowwise() * times.transpose()).colwise() + coefficients.col(k).array();
+}
+
+void PolynomialTrajectory::evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                                    Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations) const
+{
+    assert(!segments_.empty());
+    const int n = static_cast<int>(offsets.size());
+    const int n_segments = static_cast<int>(segments_.size());
+    positions.resize(3, n);
+    velocities.resize(3, n);
+    if (accelerations != nullptr)
+        accelerations->resize(3, n);
+
+    int i = 0;
+    // before the start, the first position
+    for (; i < n && t0 + offsets[i] < start_times_.front(); i++) {
+        positions.col(i) = segments_.front().coefficients.col(0);
+        velocities.col(i).setZero();
+        if (accelerations != nullptr)
+            accelerations->col(i).setZero();
+    }
+    // the stages of each segment at once
+    int iSegment = 0;
+    while (i < n && t0 + offsets[i] <= start_times_.back()) {
+        while (iSegment + 1 < n_segments && t0 + offsets[i] >= start_times_[iSegment + 1])
+            iSegment++;
+        int end = i;
+        while (end < n && t0 + offsets[end] <= start_times_.back() &&
+               (iSegment + 1 == n_segments || t0 + offsets[end] < start_times_[iSegment + 1]))
+            end++;
+        Eigen::ArrayXd times(end - i);
+        for (int j = i; j < end; j++)
+            times(j - i) = std::min(t0 + offsets[j] - start_times_[iSegment], segments_[iSegment].duration);
+        horner(segments_[iSegment].coefficients, times, positions.middleCols(i, end - i));
+        horner(velocity_coefficients_[iSegment], times, velocities.middleCols(i, end - i));
+        if (accelerations != nullptr)
+            horner(acceleration_coefficients_[iSegment], times, accelerations->middleCols(i, end - i));
+        i = end;
+    }
+    // after the end, the last position
+    if (i < n) {
+        Eigen::Matrix3Xd last(3, 1);
+        horner(segments_.back().coefficients, Eigen::ArrayXd::Constant(1, segments_.back().duration), last);
+        for (; i < n; i++) {
+            positions.col(i) = last.col(0);
+            velocities.col(i).setZero();
+            if (accelerations != nullptr)
+                accelerations->col(i).setZero();
+        }
+    }
+}
+
+bool PolynomialTrajectory::stationary(double from, double to, double tolerance, double step) const
+{
+    if (segments_.empty())
+        return true;
+    std::vector<double> offsets;
+    for (double offset = 0.0; offset < to - from; offset += step)
+        offsets.push_back(offset);
+    offsets.push_back(to - from);
+    Eigen::Matrix3Xd positions, velocities;
+    evaluate(from, offsets, positions, velocities);
+    return (positions.colwise() - positions.col(0)).colwise().norm().maxCoeff() < tolerance &&
+           velocities.colwise().norm().maxCoeff() < tolerance;
+}
+
+}  // namespace mav_nmpc_tracker
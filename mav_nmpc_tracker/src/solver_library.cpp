@@ -0,0 +1,314 @@
+#include "mav_nmpc_tracker/solver_library.h"
+
+#include <dlfcn.h>
+#include <sys/stat.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "mav_nmpc_tracker/nmpc_tracker_solver.h"
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// Just enough json for the acados descriptors
+struct JsonValue {
+    enum Type { kNull, kBool, kNumber, kString, kArray, kObject };
+    Type type = kNull;
+    double number = 0.0;
+    std::string str;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue>> object;
+
+    const JsonValue *find(const std::string &key) const
+    {
+        for (const auto &member : object)
+            if (member.first == key)
+                return &member.second;
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string &text) : text_(text), pos_(0) {}
+
+    JsonValue parse()
+    {
+        JsonValue value = parse_value();
+        skip_space();
+        if (pos_ != text_.size())
+            fail("trailing characters");
+        return value;
+    }
+
+private:
+    void fail(const std::string &what) const
+    {
+        throw std::runtime_error("json: " + what + " at offset " + std::to_string(pos_));
+    }
+
+    void skip_space()
+    {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\n' || text_[pos_] == '\t' ||
+                                       text_[pos_] == '\r'))
+            pos_++;
+    }
+
+    bool consume(const char *literal)
+    {
+        const std::string token(literal);
+        if (text_.compare(pos_, token.size(), token) != 0)
+            return false;
+        pos_ += token.size();
+        return true;
+    }
+
+    JsonValue parse_value()
+    {
+        skip_space();
+        if (pos_ >= text_.size())
+            fail("unexpected end");
+        JsonValue value;
+        const char c = text_[pos_];
+        if (c == '{') {
+            value.type = JsonValue::kObject;
+            pos_++;
+            skip_space();
+            if (consume("}"))
+                return value;
+            do {
+                skip_space();
+                std::string key = parse_string();
+                skip_space();
+                if (!consume(":"))
+                    fail("expected ':'");
+                value.object.emplace_back(std::move(key), parse_value());
+                skip_space();
+            } while (consume(","));
+            if (!consume("}"))
+                fail("expected '}'");
+        } else if (c == '[') {
+            value.type = JsonValue::kArray;
+            pos_++;
+            skip_space();
+            if (consume("]"))
+                return value;
+            do {
+                value.array.push_back(parse_value());
+                skip_space();
+            } while (consume(","));
+            if (!consume("]"))
+                fail("expected ']'");
+        } else if (c == '"') {
+            value.type = JsonValue::kString;
+            value.str = parse_string();
+        } else if (consume("true")) {
+            value.type = JsonValue::kBool;
+            value.number = 1.0;
+        } else if (consume("false")) {
+            value.type = JsonValue::kBool;
+        } else if (consume("null")) {
+            value.type = JsonValue::kNull;
+        } else {
+            value.type = JsonValue::kNumber;
+            char *end = nullptr;
+            value.number = std::strtod(text_.c_str() + pos_, &end);
+            if (end == text_.c_str() + pos_)
+                fail("unexpected character");
+            pos_ = end - text_.c_str();
+        }
+        return value;
+    }
+
+    std::string parse_string()
+    {
+        if (!consume("\""))
+            fail("expected '\"'");
+        std::string str;
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            if (text_[pos_] == '\\') {
+                // escapes are kept verbatim but for the quote and the backslash, paths do not need more
+                pos_++;
+                if (pos_ >= text_.size())
+                    break;
+            }
+            str += text_[pos_++];
+        }
+        if (!consume("\""))
+            fail("unterminated string");
+        return str;
+    }
+
+    const std::string &text_;
+    size_t pos_;
+};
+
+const JsonValue &member(const JsonValue &object, const std::string &key, const std::string &json_file)
+{
+    const JsonValue *value = object.find(key);
+    if (value == nullptr)
+        throw std::runtime_error(json_file + ": no '" + key + "'");
+    return *value;
+}
+
+bool file_exists(const std::string &path)
+{
+    struct stat buffer;
+    return stat(path.c_str(), &buffer) == 0;
+}
+
+template <typename Function>
+void load_symbol(void *handle, const std::string &name, Function &function)
+{
+    void *symbol = dlsym(handle, name.c_str());
+    if (symbol == nullptr)
+        throw std::runtime_error("Symbol " + name + " not found in the solver library");
+    function = reinterpret_cast<Function>(symbol);
+}
+
+}  // namespace
+
+SolverDescriptor read_solver_descriptor(const std::string &json_file)
+{
+    std::ifstream file(json_file);
+    if (!file)
+        throw std::runtime_error("Cannot open the solver descriptor " + json_file);
+    std::stringstream text;
+    text << file.rdbuf();
+    const JsonValue root = JsonParser(text.str()).parse();
+
+    SolverDescriptor descriptor;
+    descriptor.json_file = json_file;
+    descriptor.model_name = member(member(root, "model", json_file), "name", json_file).str;
+    const JsonValue &dims = member(root, "dims", json_file);
+    descriptor.N = static_cast<int>(member(dims, "N", json_file).number);
+    descriptor.nx = static_cast<int>(member(dims, "nx", json_file).number);
+    descriptor.nu = static_cast<int>(member(dims, "nu", json_file).number);
+    descriptor.ny = static_cast<int>(member(dims, "ny", json_file).number);
+    descriptor.ny_e = static_cast<int>(member(dims, "ny_e", json_file).number);
+    const JsonValue *np = dims.find("np");
+    descriptor.np = np == nullptr ? 0 : static_cast<int>(np->number);
+    const JsonValue *ng = dims.find("ng");
+    descriptor.ng = ng == nullptr ? 0 : static_cast<int>(ng->number);
+    const JsonValue *nh = dims.find("nh");
+    descriptor.nh = nh == nullptr ? 0 : static_cast<int>(nh->number);
+    const JsonValue &options = member(root, "solver_options", json_file);
+    descriptor.tf = member(options, "tf", json_file).number;
+    descriptor.qp_solver = member(options, "qp_solver", json_file).str;
+    descriptor.integrator_type = member(options, "integrator_type", json_file).str;
+    descriptor.nlp_solver_type = member(options, "nlp_solver_type", json_file).str;
+    const JsonValue *time_steps = options.find("time_steps");
+    if (time_steps != nullptr && static_cast<int>(time_steps->array.size()) == descriptor.N) {
+        for (const JsonValue &time_step : time_steps->array)
+            descriptor.time_steps.push_back(time_step.number);
+    } else {
+        descriptor.time_steps.assign(descriptor.N, descriptor.tf / descriptor.N);
+    }
+
+    // the library where it was generated, or next to a json that was moved with it
+    const std::string library_name = "libacados_ocp_solver_" + descriptor.model_name + ".so";
+    std::string code_dir = member(root, "code_export_directory", json_file).str;
+    if (!code_dir.empty() && code_dir.back() != '/')
+        code_dir += '/';
+    const size_t slash = json_file.find_last_of('/');
+    const std::string json_dir = slash == std::string::npos ? "./" : json_file.substr(0, slash + 1);
+    if (file_exists(code_dir + library_name))
+        descriptor.library_path = code_dir + library_name;
+    else if (file_exists(json_dir + "solver/" + library_name))
+        descriptor.library_path = json_dir + "solver/" + library_name;
+    else
+        throw std::runtime_error("No " + library_name + " for " + json_file);
+    return descriptor;
+}
+
+SolverLibrary::SolverLibrary()
+    : handle_(nullptr)
+{
+}
+
+SolverLibrary::~SolverLibrary()
+{
+    if (handle_ != nullptr)
+        dlclose(handle_);
+}
+
+std::shared_ptr<const SolverLibrary> SolverLibrary::linked()
+{
+    static const std::shared_ptr<const SolverLibrary> library = [] {
+        std::shared_ptr<SolverLibrary> linked_library(new SolverLibrary());
+        linked_library->create_capsule = &mav_nmpc_tracker_model_acados_create_capsule;
+        linked_library->free_capsule = &mav_nmpc_tracker_model_acados_free_capsule;
+        linked_library->create_with_discretization = &mav_nmpc_tracker_model_acados_create_with_discretization;
+        linked_library->solve = &mav_nmpc_tracker_model_acados_solve;
+        linked_library->free_solver = &mav_nmpc_tracker_model_acados_free;
+        linked_library->update_params = &mav_nmpc_tracker_model_acados_update_params;
+        linked_library->get_nlp_in = &mav_nmpc_tracker_model_acados_get_nlp_in;
+        linked_library->get_nlp_out = &mav_nmpc_tracker_model_acados_get_nlp_out;
+        linked_library->get_nlp_solver = &mav_nmpc_tracker_model_acados_get_nlp_solver;
+        linked_library->get_nlp_config = &mav_nmpc_tracker_model_acados_get_nlp_config;
+        linked_library->get_nlp_opts = &mav_nmpc_tracker_model_acados_get_nlp_opts;
+        linked_library->get_nlp_dims = &mav_nmpc_tracker_model_acados_get_nlp_dims;
+        SolverDescriptor &descriptor = linked_library->descriptor_;
+        descriptor.model_name = "mav_nmpc_tracker_model";
+        descriptor.N = MAV_NMPC_TRACKER_MODEL_N;
+        descriptor.nx = kNx;
+        descriptor.nu = kNu;
+        descriptor.ny = kNy;
+        descriptor.ny_e = kNyE;
+        descriptor.np = kNp;
+        descriptor.ng = MAV_NMPC_TRACKER_MODEL_NG;
+        descriptor.nh = MAV_NMPC_TRACKER_MODEL_NH;
+        // as generated by scripts/nmpc_tracker_solver.py into solver/
+        descriptor.qp_solver = "FULL_CONDENSING_QPOASES";
+        descriptor.integrator_type = "ERK";
+        descriptor.nlp_solver_type = "SQP_RTI";
+        return std::shared_ptr<const SolverLibrary>(linked_library);
+    }();
+    return library;
+}
+
+std::shared_ptr<const SolverLibrary> SolverLibrary::load(const SolverDescriptor &descriptor)
+{
+    if (descriptor.nx != kNx || descriptor.nu != kNu || descriptor.ny != kNy || descriptor.ny_e != kNyE ||
+        (descriptor.np != 0 && descriptor.np != kNumModelParams &&
+         descriptor.np != kNumModelParams + kNumObstacleParams) ||
+        (descriptor.ng != 0 && descriptor.ng != kCorridorFaces && descriptor.ng != kEsdfRows &&
+         descriptor.ng != kCorridorFaces + kEsdfRows) ||
+        (descriptor.nh != 0 && descriptor.nh != kObstacleSlots))
+        throw std::runtime_error(descriptor.json_file + ": dimensions differ from the linked model");
+    return open(descriptor);
+}
+
+std::shared_ptr<const SolverLibrary> SolverLibrary::open(const SolverDescriptor &descriptor)
+{
+    // RTLD_DEEPBIND, the library's calls into its own generated functions must not resolve to the
+    // same named ones of the linked solver
+    void *handle = dlopen(descriptor.library_path.c_str(), RTLD_NOW | RTLD_LOCAL | RTLD_DEEPBIND);
+    if (handle == nullptr)
+        throw std::runtime_error(std::string("dlopen failed: ") + dlerror());
+
+    std::shared_ptr<SolverLibrary> library(new SolverLibrary());
+    library->handle_ = handle;
+    library->descriptor_ = descriptor;
+    const std::string prefix = descriptor.model_name + "_acados_";
+    load_symbol(handle, prefix + "create_capsule", library->create_capsule);
+    load_symbol(handle, prefix + "free_capsule", library->free_capsule);
+    load_symbol(handle, prefix + "create_with_discretization", library->create_with_discretization);
+    load_symbol(handle, prefix + "solve", library->solve);
+    load_symbol(handle, prefix + "free", library->free_solver);
+    load_symbol(handle, prefix + "update_params", library->update_params);
+    load_symbol(handle, prefix + "get_nlp_in", library->get_nlp_in);
+    load_symbol(handle, prefix + "get_nlp_out", library->get_nlp_out);
+    load_symbol(handle, prefix + "get_nlp_solver", library->get_nlp_solver);
+    load_symbol(handle, prefix + "get_nlp_config", library->get_nlp_config);
+    load_symbol(handle, prefix + "get_nlp_opts", library->get_nlp_opts);
+    load_symbol(handle, prefix + "get_nlp_dims", library->get_nlp_dims);
+    return library;
+}
+
+}  // namespace mav_nmpc_tracker
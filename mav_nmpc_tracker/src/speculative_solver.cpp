@@ -0,0 +1,104 @@
+#include "mav_nmpc_tracker/speculative_solver.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdio>
+
+namespace mav_nmpc_tracker {
+
+SpeculativeSolver::SpeculativeSolver(const MpcFormulationParam &param, int cpu_warm, int cpu_cold, double deadline)
+    : deadline_(deadline), running_(true), last_used_cold_(false)
+{
+    warm_.solver.reset(new NmpcTrackerSolver(param));
+    cold_.solver.reset(new NmpcTrackerSolver(param));
+    warm_.thread = std::thread(&SpeculativeSolver::worker_loop, this, &warm_, cpu_warm);
+    cold_.thread = std::thread(&SpeculativeSolver::worker_loop, this, &cold_, cpu_cold);
+}
+
+SpeculativeSolver::~SpeculativeSolver()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    job_cv_.notify_all();
+    warm_.thread.join();
+    cold_.thread.join();
+}
+
+const NmpcTrackerSolver *SpeculativeSolver::solve(const StateVector &x0, const RefTrajectory &yref_traj,
+                                                  const TerminalRefVector &yref_e,
+                                                  const StateTrajectory &x_warm, const InputTrajectory &u_warm,
+                                                  const StateTrajectory &x_cold, const InputTrajectory &u_cold)
+{
+    const std::chrono::steady_clock::time_point time_deadline =
+        std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(deadline_));
+    std::unique_lock<std::mutex> lock(mutex_);
+    // the solve not used in the last call may still be running
+    wait_idle(lock);
+
+    warm_.solver->set_x0(x0);
+    warm_.solver->set_yref(yref_traj, yref_e);
+    warm_.solver->set_x_init(x_warm);
+    warm_.solver->set_u_init(u_warm);
+    cold_.solver->set_x0(x0);
+    cold_.solver->set_yref(yref_traj, yref_e);
+    cold_.solver->set_x_init(x_cold);
+    cold_.solver->set_u_init(u_cold);
+
+    warm_.job = cold_.job = true;
+    warm_.done = cold_.done = false;
+    job_cv_.notify_all();
+
+    // the warm answer, closer to the last plan; past the deadline a feasible reset answer will do
+    if (deadline_ > 0.0 && !done_cv_.wait_until(lock, time_deadline, [this] { return warm_.done; }))
+        done_cv_.wait(lock, [this] { return warm_.done || (cold_.done && cold_.status == 0); });
+    else
+        done_cv_.wait(lock, [this] { return warm_.done; });
+    if (warm_.done && warm_.status == 0) {
+        last_used_cold_ = false;
+        return warm_.solver.get();
+    }
+    // the warm solve failed or is late
+    done_cv_.wait(lock, [this] { return cold_.done; });
+    if (cold_.status == 0) {
+        last_used_cold_ = true;
+        return cold_.solver.get();
+    }
+    return nullptr;
+}
+
+void SpeculativeSolver::wait_idle(std::unique_lock<std::mutex> &lock)
+{
+    done_cv_.wait(lock, [this] { return warm_.done && cold_.done; });
+}
+
+void SpeculativeSolver::worker_loop(Worker *worker, int cpu)
+{
+    if (cpu >= 0) {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0)
+            fprintf(stderr, "SpeculativeSolver: failed to pin the solver thread to cpu %d.\n", cpu);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        job_cv_.wait(lock, [this, worker] { return worker->job || !running_; });
+        if (!running_)
+            break;
+        worker->job = false;
+        lock.unlock();
+        const int status = worker->solver->solve();
+        lock.lock();
+        worker->status = status;
+        worker->done = true;
+        done_cv_.notify_all();
+    }
+}
+
+}  // namespace mav_nmpc_tracker
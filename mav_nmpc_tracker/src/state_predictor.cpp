@@ -0,0 +1,113 @@
+#include "mav_nmpc_tracker/state_predictor.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace mav_nmpc_tracker {
+
+StatePredictor::StatePredictor(double max_horizon)
+    : max_horizon_(max_horizon), head_(0), size_(0), last_steps_(0)
+{
+    capsule_ = mav_nmpc_tracker_model_acados_sim_solver_create_capsule();
+    if (capsule_ == nullptr) {
+        throw std::runtime_error("Failed to allocate the acados sim solver capsule");
+    }
+    int status = mav_nmpc_tracker_model_acados_sim_create(capsule_);
+    if (status != 0) {
+        mav_nmpc_tracker_model_acados_sim_solver_free_capsule(capsule_);
+        throw std::runtime_error("mav_nmpc_tracker_model_acados_sim_create() returned status " +
+                                 std::to_string(status));
+    }
+
+    sim_config_ = mav_nmpc_tracker_model_acados_get_sim_config(capsule_);
+    sim_dims_ = mav_nmpc_tracker_model_acados_get_sim_dims(capsule_);
+    sim_in_ = mav_nmpc_tracker_model_acados_get_sim_in(capsule_);
+    sim_out_ = mav_nmpc_tracker_model_acados_get_sim_out(capsule_);
+
+    // only the state is needed, not the sensitivities
+    bool sens_forw = false;
+    sim_opts_set(sim_config_, mav_nmpc_tracker_model_acados_get_sim_opts(capsule_), "sens_forw", &sens_forw);
+}
+
+StatePredictor::~StatePredictor()
+{
+    mav_nmpc_tracker_model_acados_sim_free(capsule_);
+    mav_nmpc_tracker_model_acados_sim_solver_free_capsule(capsule_);
+}
+
+bool StatePredictor::set_model_params(const ModelParamVector &p)
+{
+    if (kNp < kNumModelParams)
+        return false;
+    // the obstacle slots after them do not enter the dynamics
+    Eigen::Matrix<double, kNumModelParams + kNumObstacleParams, 1> value;
+    value.setZero();
+    value.head<kNumModelParams>() = p;
+    return mav_nmpc_tracker_model_acados_sim_update_params(capsule_, value.data(), kNp) == 0;
+}
+
+void StatePredictor::add_command(double t, const InputVector &u)
+{
+    // the clock jumped back, e.g. a restarted simulation
+    if (size_ > 0 && t < commands_[(head_ + size_ - 1) % kHistory].t)
+        size_ = 0;
+    const int idx = (head_ + size_) % kHistory;
+    commands_[idx].t = t;
+    commands_[idx].u = u;
+    if (size_ < kHistory)
+        size_++;
+    else
+        head_ = (head_ + 1) % kHistory;
+}
+
+int StatePredictor::command_index(double t) const
+{
+    // newest first, the history is short
+    for (int i = size_ - 1; i >= 0; i--) {
+        const int idx = (head_ + i) % kHistory;
+        if (commands_[idx].t <= t)
+            return i;
+    }
+    return -1;
+}
+
+StateVector StatePredictor::predict(const StateVector &x_meas, double t_meas, double t_target)
+{
+    last_steps_ = 0;
+    StateVector x = x_meas;
+    t_target = std::min(t_target, t_meas + max_horizon_);
+    if (t_target <= t_meas)
+        return x;
+
+    const InputVector u_hover(0.0, 0.0, 1.0 * g);
+    double t = t_meas;
+    int i = command_index(t_meas);
+    while (t < t_target) {
+        // the command in effect from t until the next one is sent
+        const InputVector &u = i >= 0 ? commands_[(head_ + i) % kHistory].u : u_hover;
+        double t_next = t_target;
+        if (i + 1 < size_)
+            t_next = std::min(t_next, commands_[(head_ + i + 1) % kHistory].t);
+        // commands closer than this are merged into the previous one
+        if (t_next - t > 1e-4) {
+            integrate(x, u, t_next - t);
+            last_steps_++;
+        }
+        t = t_next;
+        i++;
+    }
+    return x;
+}
+
+void StatePredictor::integrate(StateVector &x, const InputVector &u, double T)
+{
+    sim_in_set(sim_config_, sim_dims_, sim_in_, "T", &T);
+    sim_in_set(sim_config_, sim_dims_, sim_in_, "x", x.data());
+    sim_in_set(sim_config_, sim_dims_, sim_in_, "u", const_cast<double *>(u.data()));
+    if (mav_nmpc_tracker_model_acados_sim_solve(capsule_) != 0)
+        return;  // keep the state of the last step
+    sim_out_get(sim_config_, sim_dims_, sim_out_, "x", x.data());
+}
+
+}  // namespace mav_nmpc_tracker
@@ -0,0 +1,167 @@
+#include "mav_nmpc_tracker/trajectory_buffer.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// s, samples closer than this are one
+constexpr double kMinSpacing = 1e-6;
+
+}  // namespace
+
+void estimate_velocities(std::vector<TrajectorySample> &samples)
+{
+    const int n = static_cast<int>(samples.size());
+    if (n < 2) {
+        for (TrajectorySample &sample : samples)
+            sample.velocity.setZero();
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        const TrajectorySample &before = samples[std::max(i - 1, 0)];
+        const TrajectorySample &after = samples[std::min(i + 1, n - 1)];
+        const double dt = after.time - before.time;
+        samples[i].velocity = dt > kMinSpacing ? Eigen::Vector3d((after.position - before.position) / dt)
+                                               : Eigen::Vector3d::Zero();
+    }
+}
+
+TrajectoryBuffer::TrajectoryBuffer(int capacity, double keep_past)
+    : samples_(std::max(capacity, 2)), head_(0), size_(0), keep_past_(keep_past)
+{
+}
+
+int TrajectoryBuffer::insert(const std::vector<TrajectorySample> &samples)
+{
+    if (samples.empty())
+        return 0;
+    // the part from the first new sample on is replaced
+    while (size_ > 0 && at(size_ - 1).time >= samples.front().time - kMinSpacing)
+        size_--;
+    const int capacity = static_cast<int>(samples_.size());
+    int inserted = 0;
+    for (const TrajectorySample &sample : samples) {
+        if (size_ == capacity)
+            break;
+        if (size_ > 0 && sample.time <= at(size_ - 1).time + kMinSpacing)
+            continue;
+        at(size_++) = sample;
+        inserted++;
+    }
+    return inserted;
+}
+
+void TrajectoryBuffer::clear()
+{
+    head_ = 0;
+    size_ = 0;
+}
+
+void TrajectoryBuffer::drop_before(double time)
+{
+    // the sample before the cut stays, the segment to the next one is still interpolated
+    const int iSegment = segment(time - keep_past_);
+    if (iSegment <= 0)
+        return;
+    head_ = (head_ + iSegment) % static_cast<int>(samples_.size());
+    size_ -= iSegment;
+}
+
+int TrajectoryBuffer::segment(double time) const
+{
+    // binary search over the ring
+    int low = 0, high = size_;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (at(mid).time <= time)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low - 1;
+}
+
+void TrajectoryBuffer::evaluate(double time, Eigen::Vector3d *position, Eigen::Vector3d *velocity,
+                                Eigen::Vector3d *acceleration) const
+{
+    assert(size_ > 0);
+    interpolate(segment(time), time, position, velocity, acceleration);
+}
+
+void TrajectoryBuffer::evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                                Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations) const
+{
+    assert(size_ > 0);
+    const int n = static_cast<int>(offsets.size());
+    positions.resize(3, n);
+    velocities.resize(3, n);
+    if (accelerations != nullptr)
+        accelerations->resize(3, n);
+    int iSegment = n > 0 ? segment(t0 + offsets[0]) : 0;
+    for (int i = 0; i < n; i++) {
+        const double time = t0 + offsets[i];
+        while (iSegment + 1 < size_ && at(iSegment + 1).time <= time)
+            iSegment++;
+        Eigen::Vector3d position, velocity, acceleration;
+        interpolate(iSegment, time, &position, &velocity, accelerations != nullptr ? &acceleration : nullptr);
+        positions.col(i) = position;
+        velocities.col(i) = velocity;
+        if (accelerations != nullptr)
+            accelerations->col(i) = acceleration;
+    }
+}
+
+void TrajectoryBuffer::interpolate(int iSegment, double time, Eigen::Vector3d *position, Eigen::Vector3d *velocity,
+                                   Eigen::Vector3d *acceleration) const
+{
+    // held still outside of the samples
+    if (iSegment < 0 || iSegment >= size_ - 1) {
+        if (position != nullptr)
+            *position = at(iSegment < 0 ? 0 : size_ - 1).position;
+        if (velocity != nullptr)
+            velocity->setZero();
+        if (acceleration != nullptr)
+            acceleration->setZero();
+        return;
+    }
+    const TrajectorySample &s0 = at(iSegment);
+    const TrajectorySample &s1 = at(iSegment + 1);
+    const double h = s1.time - s0.time;
+    const double s = std::min(std::max((time - s0.time) / h, 0.0), 1.0);
+    // cubic Hermite basis and its derivatives in s
+    const double s2 = s * s, s3 = s2 * s;
+    const Eigen::Vector3d m0 = h * s0.velocity, m1 = h * s1.velocity;
+    if (position != nullptr)
+        *position = (2.0 * s3 - 3.0 * s2 + 1.0) * s0.position + (s3 - 2.0 * s2 + s) * m0 +
+                    (-2.0 * s3 + 3.0 * s2) * s1.position + (s3 - s2) * m1;
+    if (velocity != nullptr)
+        *velocity = ((6.0 * s2 - 6.0 * s) * (s0.position - s1.position) + (3.0 * s2 - 4.0 * s + 1.0) * m0 +
+                     (3.0 * s2 - 2.0 * s) * m1) / h;
+    if (acceleration != nullptr)
+        *acceleration = ((12.0 * s - 6.0) * (s0.position - s1.position) + (6.0 * s - 4.0) * m0 +
+                         (6.0 * s - 2.0) * m1) / (h * h);
+}
+
+bool TrajectoryBuffer::stationary(double from, double to, double tolerance) const
+{
+    if (size_ == 0)
+        return true;
+    Eigen::Vector3d start, position, velocity;
+    evaluate(from, &start, &velocity);
+    if (velocity.norm() >= tolerance)
+        return false;
+    evaluate(to, &position, &velocity);
+    if ((position - start).norm() >= tolerance || velocity.norm() >= tolerance)
+        return false;
+    // the samples in between
+    for (int i = std::max(segment(from) + 1, 0); i < size_ && at(i).time < to; i++) {
+        if ((at(i).position - start).norm() >= tolerance || at(i).velocity.norm() >= tolerance)
+            return false;
+    }
+    return true;
+}
+
+}  // namespace mav_nmpc_tracker
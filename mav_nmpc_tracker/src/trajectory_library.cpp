@@ -0,0 +1,227 @@
+#include "mav_nmpc_tracker/trajectory_library.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+const char kLibraryMagic[8] = {'T', 'R', 'A', 'J', 'L', 'I', 'B', '1'};
+
+// samples walked on from the cursor before searching instead
+const int kMaxWalk = 16;
+
+double wrap_angle(double angle)
+{
+    return std::atan2(std::sin(angle), std::cos(angle));
+}
+
+}  // namespace
+
+TrajectoryLibrary::TrajectoryLibrary(const std::string &path)
+    : mapping_(nullptr), mapping_size_(0), segments_(nullptr), samples_(nullptr), sample_count_(0),
+      segment_count_(0), cursor_(-1), searches_(0)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open the trajectory library " + path);
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(TrajectoryLibraryHeader)) {
+        close(fd);
+        throw std::runtime_error(path + " is not a trajectory library");
+    }
+    mapping_size_ = static_cast<size_t>(file_stat.st_size);
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error("Cannot map the trajectory library " + path);
+    }
+
+    TrajectoryLibraryHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+    sample_count_ = header.sample_count;
+    segment_count_ = header.segment_count;
+    const size_t payload = mapping_size_ - sizeof(TrajectoryLibraryHeader);
+    bool valid = std::memcmp(header.magic, kLibraryMagic, sizeof(kLibraryMagic)) == 0 && sample_count_ > 0 &&
+                 segment_count_ > 0 && static_cast<size_t>(segment_count_) <= payload / sizeof(LibrarySegment) &&
+                 static_cast<size_t>(sample_count_) <=
+                     (payload - segment_count_ * sizeof(LibrarySegment)) / sizeof(LibrarySample);
+    if (valid) {
+        const char *data = static_cast<const char *>(mapping_) + sizeof(TrajectoryLibraryHeader);
+        segments_ = reinterpret_cast<const LibrarySegment *>(data);
+        samples_ = reinterpret_cast<const LibrarySample *>(data + segment_count_ * sizeof(LibrarySegment));
+        // the index only, the samples are not read before they are needed
+        valid = segments_[0].first_sample == 0;
+        for (long long i = 1; valid && i < segment_count_; i++)
+            valid = segments_[i].first_sample > segments_[i - 1].first_sample &&
+                    segments_[i].first_sample < sample_count_ && segments_[i].start_time >= segments_[i - 1].start_time;
+    }
+    if (!valid) {
+        munmap(mapping_, mapping_size_);
+        throw std::runtime_error(path + " is not a trajectory library");
+    }
+}
+
+TrajectoryLibrary::~TrajectoryLibrary()
+{
+    if (mapping_ != nullptr)
+        munmap(mapping_, mapping_size_);
+}
+
+void TrajectoryLibrary::write(const std::string &path, const std::vector<LibrarySample> &samples,
+                              const std::vector<int64_t> &segment_starts)
+{
+    if (samples.empty() || segment_starts.empty() || segment_starts.front() != 0)
+        throw std::runtime_error("The segments do not start at the first sample");
+    for (size_t i = 1; i < samples.size(); i++)
+        if (!(samples[i].time > samples[i - 1].time))
+            throw std::runtime_error("The sample times are not increasing");
+    std::vector<LibrarySegment> segments(segment_starts.size());
+    for (size_t i = 0; i < segments.size(); i++) {
+        if (segment_starts[i] >= static_cast<int64_t>(samples.size()) ||
+            (i > 0 && segment_starts[i] <= segment_starts[i - 1]))
+            throw std::runtime_error("The segments are not increasing samples");
+        segments[i].start_time = samples[segment_starts[i]].time;
+        segments[i].first_sample = segment_starts[i];
+    }
+    TrajectoryLibraryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kLibraryMagic, sizeof(kLibraryMagic));
+    header.sample_count = static_cast<int64_t>(samples.size());
+    header.segment_count = static_cast<int64_t>(segments.size());
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(segments.data()), segments.size() * sizeof(LibrarySegment));
+    file.write(reinterpret_cast<const char *>(samples.data()), samples.size() * sizeof(LibrarySample));
+    if (!file)
+        throw std::runtime_error("Cannot write the trajectory library " + path);
+}
+
+int TrajectoryLibrary::segment(double time) const
+{
+    const LibrarySegment *end = segments_ + segment_count_;
+    const LibrarySegment *found = std::upper_bound(
+        segments_, end, time, [](double t, const LibrarySegment &segment) { return t < segment.start_time; });
+    return static_cast<int>(found - segments_) - 1;
+}
+
+long long TrajectoryLibrary::search(double time) const
+{
+    // the segment in the index, then the samples of the segment
+    const int iSegment = segment(time);
+    if (iSegment < 0)
+        return -1;
+    const LibrarySample *first = samples_ + segments_[iSegment].first_sample;
+    const LibrarySample *last = iSegment + 1 < segment_count_ ? samples_ + segments_[iSegment + 1].first_sample
+                                                              : samples_ + sample_count_;
+    const LibrarySample *found = std::upper_bound(
+        first, last, time, [](double t, const LibrarySample &sample) { return t < sample.time; });
+    return static_cast<long long>(found - samples_) - 1;
+}
+
+long long TrajectoryLibrary::find(double time)
+{
+    if (cursor_ >= 0 && samples_[cursor_].time <= time) {
+        for (int walked = 0; walked < kMaxWalk; walked++) {
+            if (cursor_ + 1 >= sample_count_ || samples_[cursor_ + 1].time > time)
+                return cursor_;
+            cursor_++;
+        }
+    }
+    searches_++;
+    cursor_ = search(time);
+    return cursor_;
+}
+
+void TrajectoryLibrary::evaluate(double t0, const std::vector<double> &offsets, Eigen::Matrix3Xd &positions,
+                                 Eigen::Matrix3Xd &velocities, Eigen::Matrix3Xd *accelerations,
+                                 Eigen::VectorXd *yaws)
+{
+    const int n = static_cast<int>(offsets.size());
+    positions.resize(3, n);
+    velocities.resize(3, n);
+    if (accelerations != nullptr)
+        accelerations->resize(3, n);
+    if (yaws != nullptr)
+        yaws->resize(n);
+    long long first = -1;
+    for (int i = 0; i < n; i++) {
+        // the stages after the first one walk on from the one before
+        const double time = t0 + offsets[i];
+        const long long iSample = find(time);
+        if (i == 0)
+            first = iSample;
+        Eigen::Vector3d position, velocity, acceleration;
+        double yaw;
+        interpolate(iSample, time, &position, &velocity, &acceleration, &yaw);
+        positions.col(i) = position;
+        velocities.col(i) = velocity;
+        if (accelerations != nullptr)
+            accelerations->col(i) = acceleration;
+        if (yaws != nullptr)
+            (*yaws)(i) = yaw;
+    }
+    // the next cycle walks on from the first stage
+    if (n > 0)
+        cursor_ = first;
+}
+
+void TrajectoryLibrary::interpolate(long long iSample, double time, Eigen::Vector3d *position,
+                                    Eigen::Vector3d *velocity, Eigen::Vector3d *acceleration, double *yaw) const
+{
+    // held still outside of the samples
+    if (iSample < 0 || iSample >= sample_count_ - 1) {
+        const LibrarySample &held = samples_[iSample < 0 ? 0 : sample_count_ - 1];
+        *position = Eigen::Vector3d(held.position[0], held.position[1], held.position[2]);
+        velocity->setZero();
+        acceleration->setZero();
+        *yaw = wrap_angle(held.yaw);
+        return;
+    }
+    const LibrarySample &s0 = samples_[iSample];
+    const LibrarySample &s1 = samples_[iSample + 1];
+    const double h = s1.time - s0.time;
+    const double s = std::min(std::max((time - s0.time) / h, 0.0), 1.0);
+    // quintic in s matching position, velocity and acceleration at both samples
+    const Eigen::Map<const Eigen::Vector3d> p0(s0.position), v0(s0.velocity), a0(s0.acceleration);
+    const Eigen::Map<const Eigen::Vector3d> p1(s1.position), v1(s1.velocity), a1(s1.acceleration);
+    const Eigen::Vector3d c1 = h * v0, c2 = 0.5 * h * h * a0;
+    const Eigen::Vector3d d = p1 - p0 - c1 - c2, e = h * v1 - c1 - 2.0 * c2, f = h * h * a1 - 2.0 * c2;
+    const Eigen::Vector3d c3 = 10.0 * d - 4.0 * e + 0.5 * f;
+    const Eigen::Vector3d c4 = -15.0 * d + 7.0 * e - f;
+    const Eigen::Vector3d c5 = 6.0 * d - 3.0 * e + 0.5 * f;
+    *position = p0 + s * (c1 + s * (c2 + s * (c3 + s * (c4 + s * c5))));
+    *velocity = (c1 + s * (2.0 * c2 + s * (3.0 * c3 + s * (4.0 * c4 + s * 5.0 * c5)))) / h;
+    *acceleration = (2.0 * c2 + s * (6.0 * c3 + s * (12.0 * c4 + s * 20.0 * c5))) / (h * h);
+    *yaw = wrap_angle(s0.yaw + s * wrap_angle(s1.yaw - s0.yaw));
+}
+
+bool TrajectoryLibrary::stationary(double from, double to, double tolerance)
+{
+    Eigen::Matrix3Xd positions, velocities;
+    evaluate(from, std::vector<double>{0.0, to - from}, positions, velocities);
+    if ((positions.col(1) - positions.col(0)).norm() >= tolerance ||
+        velocities.colwise().norm().maxCoeff() >= tolerance)
+        return false;
+    // the samples in between
+    const Eigen::Vector3d start = positions.col(0);
+    for (long long i = std::max(find(from) + 1, 0LL); i < sample_count_ && samples_[i].time < to; i++) {
+        const LibrarySample &sample = samples_[i];
+        if ((Eigen::Map<const Eigen::Vector3d>(sample.position) - start).norm() >= tolerance ||
+            Eigen::Map<const Eigen::Vector3d>(sample.velocity).norm() >= tolerance)
+            return false;
+    }
+    return true;
+}
+
+}  // namespace mav_nmpc_tracker
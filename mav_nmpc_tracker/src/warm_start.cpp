@@ -0,0 +1,330 @@
+#include "mav_nmpc_tracker/warm_start.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mav_nmpc_tracker {
+
+namespace {
+
+// fixed point steps of the drag in feedforward_input(), it is small against the thrust
+const int kDragIterations = 2;
+
+}  // namespace
+
+const char *warm_start_strategy_name(WarmStartStrategy strategy)
+{
+    switch (strategy) {
+    case WarmStartStrategy::kShift:
+        return "shift";
+    case WarmStartStrategy::kBlend:
+        return "blend";
+    case WarmStartStrategy::kReference:
+        return "reference";
+    case WarmStartStrategy::kHover:
+        return "hover";
+    }
+    return "unknown";
+}
+
+StateVector mav_dynamics(const MpcFormulationParam &param, const StateVector &x, const InputVector &u)
+{
+    const double vx = x(3), vy = x(4), vz = x(5);
+    const double cr = std::cos(x(6)), sr = std::sin(x(6));
+    const double cp = std::cos(x(7)), sp = std::sin(x(7));
+    const double cy = std::cos(x(8)), sy = std::sin(x(8));
+    const double thrust = param.thrust_gain * u(2);
+
+    // drag
+    const double drag_acc_x = param.drag_coefficient_x * thrust * (cp * cy * vx - cp * sy * vy + sp * vz);
+    const double drag_acc_y = param.drag_coefficient_y * thrust *
+                              ((cr * sy - cy * sp * sr) * vx - (cr * cy + sp * sr * sy) * vy - cp * sr * vz);
+
+    StateVector x_dot;
+    x_dot << vx, vy, vz,
+        (cr * cy * sp + sr * sy) * thrust - drag_acc_x + param.disturbance_x,
+        (cr * sp * sy - cy * sr) * thrust - drag_acc_y + param.disturbance_y,
+        -g + cp * cr * thrust + param.disturbance_z,
+        (param.roll_gain * u(0) - x(6)) / param.roll_time_constant,
+        (param.pitch_gain * u(1) - x(7)) / param.pitch_time_constant,
+        0.0;
+    return x_dot;
+}
+
+StateVector integrate_mav_dynamics(const MpcFormulationParam &param, const StateVector &x,
+                                   const InputVector &u, double dt)
+{
+    const StateVector k1 = mav_dynamics(param, x, u);
+    const StateVector k2 = mav_dynamics(param, x + 0.5 * dt * k1, u);
+    const StateVector k3 = mav_dynamics(param, x + 0.5 * dt * k2, u);
+    const StateVector k4 = mav_dynamics(param, x + dt * k3, u);
+    return x + dt / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+}
+
+Eigen::Vector3d acceleration_attitude(const Eigen::Vector3d &acc, double yaw)
+{
+    const Eigen::Vector3d thrust_acc = acc + Eigen::Vector3d(0.0, 0.0, g);
+    const double cy = std::cos(yaw), sy = std::sin(yaw);
+    const double acc_forward = cy * thrust_acc(0) + sy * thrust_acc(1);
+    const double acc_left = sy * thrust_acc(0) - cy * thrust_acc(1);
+    const double thrust = thrust_acc.norm();
+    const double roll = std::asin(std::min(std::max(acc_left / std::max(thrust, 1e-6), -1.0), 1.0));
+    const double pitch = std::atan2(acc_forward, thrust_acc(2));
+    return Eigen::Vector3d(roll, pitch, thrust);
+}
+
+InputVector feedforward_input(const MpcFormulationParam &param, const Eigen::Vector3d &acc,
+                              const Eigen::Vector3d &vel, double yaw)
+{
+    // the thrust makes up for the drag and the disturbance; the drag depends on the attitude and the
+    // thrust, found from the attitude without it
+    const Eigen::Vector3d disturbance(param.disturbance_x, param.disturbance_y, param.disturbance_z);
+    Eigen::Vector3d attitude = acceleration_attitude(acc - disturbance, yaw);
+    const double cy = std::cos(yaw), sy = std::sin(yaw);
+    for (int i = 0; i < kDragIterations; i++) {
+        const double cr = std::cos(attitude(0)), sr = std::sin(attitude(0));
+        const double cp = std::cos(attitude(1)), sp = std::sin(attitude(1));
+        const double thrust = attitude(2);
+        const Eigen::Vector3d drag_acc(
+            param.drag_coefficient_x * thrust * (cp * cy * vel(0) - cp * sy * vel(1) + sp * vel(2)),
+            param.drag_coefficient_y * thrust *
+                ((cr * sy - cy * sp * sr) * vel(0) - (cr * cy + sp * sr * sy) * vel(1) - cp * sr * vel(2)),
+            0.0);
+        attitude = acceleration_attitude(acc - disturbance + drag_acc, yaw);
+    }
+    return InputVector(std::min(std::max(attitude(0) / param.roll_gain, -param.roll_max), param.roll_max),
+                       std::min(std::max(attitude(1) / param.pitch_gain, -param.pitch_max), param.pitch_max),
+                       std::min(std::max(attitude(2) / param.thrust_gain, param.thrust_min), param.thrust_max));
+}
+
+void resample_plan(const std::vector<double> &time_steps_from, const StateTrajectory &x_from,
+                   const InputTrajectory &u_from, const std::vector<double> &time_steps_to,
+                   StateTrajectory &x_to, InputTrajectory &u_to)
+{
+    const int N_from = static_cast<int>(time_steps_from.size());
+    const int N_to = static_cast<int>(time_steps_to.size());
+    x_to.resize(kNx, N_to + 1);
+    u_to.resize(kNu, N_to);
+
+    int iFrom = 0;          // stage of the old horizon at or before t
+    double t_from = 0.0;    // its time
+    double t = 0.0;
+    for (int iStage = 0; iStage <= N_to; iStage++) {
+        while (iFrom < N_from && t_from + time_steps_from[iFrom] <= t) {
+            t_from += time_steps_from[iFrom];
+            iFrom++;
+        }
+        if (iFrom < N_from) {
+            const double ratio = (t - t_from) / time_steps_from[iFrom];
+            x_to.col(iStage) = (1.0 - ratio) * x_from.col(iFrom) + ratio * x_from.col(iFrom + 1);
+        } else {
+            x_to.col(iStage) = x_from.col(N_from);
+        }
+        if (iStage < N_to) {
+            u_to.col(iStage) = u_from.col(std::min(iFrom, N_from - 1));
+            t += time_steps_to[iStage];
+        }
+    }
+}
+
+void resample_reference(const std::vector<double> &time_steps_from, const RefTrajectory &yref_from,
+                        const std::vector<double> &time_steps_to, RefTrajectory &yref_to)
+{
+    const int N_from = static_cast<int>(time_steps_from.size());
+    const int N_to = static_cast<int>(time_steps_to.size());
+    yref_to.resize(kNy, N_to);
+
+    int iFrom = 0;
+    double t_from = 0.0;
+    double t = 0.0;
+    for (int iStage = 0; iStage < N_to; iStage++) {
+        while (iFrom < N_from - 1 && t_from + time_steps_from[iFrom] <= t) {
+            t_from += time_steps_from[iFrom];
+            iFrom++;
+        }
+        if (iFrom < N_from - 1) {
+            const double ratio = (t - t_from) / time_steps_from[iFrom];
+            yref_to.col(iStage) = (1.0 - ratio) * yref_from.col(iFrom) + ratio * yref_from.col(iFrom + 1);
+        } else {
+            yref_to.col(iStage) = yref_from.col(N_from - 1);
+        }
+        t += time_steps_to[iStage];
+    }
+}
+
+WarmStart::WarmStart(const MpcFormulationParam &param, const WarmStartParam &warm_param)
+    : param_(param),
+      warm_param_(warm_param),
+      time_steps_(horizon_time_steps(param)),
+      stage_times_(stage_times(time_steps_)),
+      has_last_yref_(false),
+      last_jump_(0.0),
+      blend_weight_(0.0),
+      last_strategy_(WarmStartStrategy::kHover)
+{
+    N_ = static_cast<int>(time_steps_.size());
+    last_yref_.setZero(kNy, N_);
+    x_ref_.setZero(kNx, N_ + 1);
+    u_ref_.setZero(kNu, N_);
+}
+
+WarmStartStrategy WarmStart::build(bool last_feasible, const StateVector &x0, const StateTrajectory &x_plan,
+                                   const InputTrajectory &u_plan, const RefTrajectory &yref_traj,
+                                   StateTrajectory &x_init, InputTrajectory &u_init)
+{
+    last_jump_ = reference_jump(yref_traj);
+
+    WarmStartStrategy strategy;
+    if (!last_feasible) {
+        // the reference first, the hover reset if that did not work either
+        strategy = (last_strategy_ == WarmStartStrategy::kReference) ? WarmStartStrategy::kHover
+                                                                     : WarmStartStrategy::kReference;
+    } else if (last_jump_ <= warm_param_.jump_small) {
+        strategy = WarmStartStrategy::kShift;
+    } else if (last_jump_ >= warm_param_.jump_large) {
+        strategy = WarmStartStrategy::kReference;
+    } else {
+        strategy = WarmStartStrategy::kBlend;
+    }
+
+    build_strategy(strategy, x0, x_plan, u_plan, yref_traj, x_init, u_init);
+    return strategy;
+}
+
+void WarmStart::build_strategy(WarmStartStrategy strategy, const StateVector &x0, const StateTrajectory &x_plan,
+                               const InputTrajectory &u_plan, const RefTrajectory &yref_traj,
+                               StateTrajectory &x_init, InputTrajectory &u_init)
+{
+    blend_weight_ = 0.0;
+    switch (strategy) {
+    case WarmStartStrategy::kShift:
+        build_shift(x_plan, u_plan, yref_traj, x_init, u_init);
+        break;
+    case WarmStartStrategy::kBlend: {
+        const double jump_range = std::max(warm_param_.jump_large - warm_param_.jump_small, 1e-6);
+        blend_weight_ = std::min(std::max((last_jump_ - warm_param_.jump_small) / jump_range, 0.0), 1.0);
+        build_shift(x_plan, u_plan, yref_traj, x_init, u_init);
+        build_reference(x0, yref_traj, x_ref_, u_ref_);
+        x_init = (1.0 - blend_weight_) * x_init + blend_weight_ * x_ref_;
+        u_init = (1.0 - blend_weight_) * u_init + blend_weight_ * u_ref_;
+        break;
+    }
+    case WarmStartStrategy::kReference:
+        blend_weight_ = 1.0;
+        build_reference(x0, yref_traj, x_init, u_init);
+        break;
+    case WarmStartStrategy::kHover:
+        build_hover(x0, x_init, u_init);
+        break;
+    }
+
+    last_strategy_ = strategy;
+    last_yref_ = yref_traj;
+    has_last_yref_ = true;
+}
+
+void WarmStart::shifted_stage(int iStage, int &iFrom, double &ratio) const
+{
+    // on a uniform grid the next stage with ratio 0, the tolerance keeps it from rounding down
+    const double t = stage_times_[iStage] + time_steps_[0] + 1e-9;
+    iFrom = static_cast<int>(std::upper_bound(stage_times_.begin(), stage_times_.end(), t) - stage_times_.begin()) - 1;
+    if (iFrom >= N_) {
+        // past the horizon, ratio is the time after its end
+        iFrom = N_;
+        ratio = std::max(t - 1e-9 - stage_times_[N_], 0.0);
+    } else {
+        ratio = std::max(t - 1e-9 - stage_times_[iFrom], 0.0) / time_steps_[iFrom];
+    }
+}
+
+void WarmStart::set_last_reference(const RefTrajectory &yref_traj)
+{
+    last_yref_ = yref_traj;
+    has_last_yref_ = true;
+}
+
+void WarmStart::set_model(const MpcFormulationParam &param)
+{
+    const double dt = param_.dt;
+    const int N = param_.N;
+    const double Tf = param_.Tf;
+    const std::vector<double> time_steps = param_.time_steps;
+    param_ = param;
+    param_.dt = dt;
+    param_.N = N;
+    param_.Tf = Tf;
+    param_.time_steps = time_steps;
+}
+
+double WarmStart::reference_jump(const RefTrajectory &yref_traj) const
+{
+    if (!has_last_yref_)
+        return 0.0;
+    // the reference of the last cycle shifted by one first step against the new one,
+    // over the stages still inside the last one
+    double jump = 0.0;
+    for (int iStage = 0; iStage < N_ - 1; iStage++) {
+        int iFrom;
+        double ratio;
+        shifted_stage(iStage, iFrom, ratio);
+        if (iFrom > N_ - 1 || (iFrom == N_ - 1 && ratio > 1e-9))
+            break;
+        RefVector last_yref = last_yref_.col(iFrom);
+        if (iFrom < N_ - 1)
+            last_yref = (1.0 - ratio) * last_yref + ratio * last_yref_.col(iFrom + 1);
+        jump = std::max(jump, (yref_traj.col(iStage).head<6>() - last_yref.head<6>()).norm());
+    }
+    return jump;
+}
+
+void WarmStart::build_shift(const StateTrajectory &x_plan, const InputTrajectory &u_plan,
+                            const RefTrajectory &yref_traj, StateTrajectory &x_init, InputTrajectory &u_init) const
+{
+    // shifted by the first step, states interpolated and controls held in between the stages,
+    // the input reference of the last stage integrated past the end of the last plan
+    for (int iStage = 0; iStage <= N_; iStage++) {
+        int iFrom;
+        double ratio;
+        shifted_stage(iStage, iFrom, ratio);
+        if (iFrom < N_) {
+            x_init.col(iStage) = (1.0 - ratio) * x_plan.col(iFrom) + ratio * x_plan.col(iFrom + 1);
+            if (iStage < N_)
+                u_init.col(iStage) = u_plan.col(iFrom);
+        } else {
+            const InputVector u_ref = yref_traj.col(N_ - 1).tail<kNu>();
+            x_init.col(iStage) = ratio > 1e-9 ? integrate_mav_dynamics(param_, x_plan.col(N_), u_ref, ratio)
+                                              : StateVector(x_plan.col(N_));
+            if (iStage < N_)
+                u_init.col(iStage) = u_ref;
+        }
+    }
+}
+
+void WarmStart::build_reference(const StateVector &x0, const RefTrajectory &yref_traj,
+                                StateTrajectory &x_init, InputTrajectory &u_init) const
+{
+    const double yaw = x0(8);
+    for (int iStage = 0; iStage <= N_; iStage++) {
+        const int iRef = std::min(iStage, N_ - 1);
+        // the offset of the current state to the reference fades out over the horizon
+        const double fade = 1.0 - stage_times_[iStage] / stage_times_[N_];
+        x_init.col(iStage).head<6>() = yref_traj.col(iRef).head<6>() +
+                                       fade * (x0.head<6>() - yref_traj.col(0).head<6>());
+
+        // the input reference, the feedforward of the reference accelerations, and its settled attitude
+        const InputVector u_ref = yref_traj.col(iRef).tail<kNu>();
+        x_init(6, iStage) = fade * x0(6) + (1.0 - fade) * param_.roll_gain * u_ref(0);
+        x_init(7, iStage) = fade * x0(7) + (1.0 - fade) * param_.pitch_gain * u_ref(1);
+        x_init(8, iStage) = yaw;
+        if (iStage < N_)
+            u_init.col(iStage) = u_ref;
+    }
+}
+
+void WarmStart::build_hover(const StateVector &x0, StateTrajectory &x_init, InputTrajectory &u_init) const
+{
+    x_init.colwise() = x0;
+    u_init.colwise() = feedforward_input(param_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), x0(8));
+}
+
+}  // namespace mav_nmpc_tracker
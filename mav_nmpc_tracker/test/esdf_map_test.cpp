@@ -0,0 +1,131 @@
+// The memory-mapped distance field: the lookups through the block cache against the mapped file, the
+// interpolation and its gradient, and the files rejected.
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mav_nmpc_tracker/esdf_map.h"
+#include "temp_file.h"
+
+using namespace mav_nmpc_tracker;
+using mav_nmpc_tracker::test::TempFile;
+
+namespace {
+
+const Eigen::Vector3i kSize(37, 29, 21);  // not a multiple of the block edge
+const Eigen::Vector3d kOrigin(-2.0, -1.0, -0.5);
+const double kResolution = 0.1;
+
+// a sphere of 0.5 m radius
+double sphere_distance(const Eigen::Vector3d &p)
+{
+    return (p - Eigen::Vector3d(0.0, 0.3, 0.4)).norm() - 0.5;
+}
+
+void write_sphere(const std::string &path)
+{
+    std::vector<float> distances(kSize.prod());
+    for (int k = 0; k < kSize(2); k++)
+        for (int j = 0; j < kSize(1); j++)
+            for (int i = 0; i < kSize(0); i++)
+                distances[i + kSize(0) * (j + kSize(1) * k)] =
+                    sphere_distance(kOrigin + kResolution * Eigen::Vector3d(i, j, k));
+    EsdfMap::write(path, kSize, kOrigin, kResolution, distances);
+}
+
+}  // namespace
+
+TEST(EsdfMap, CachedSameAsUncached)
+{
+    TempFile file;
+    write_sphere(file.path());
+    // few entries, so that blocks are evicted
+    EsdfMap map(file.path(), 4);
+    EXPECT_EQ(map.size(), kSize);
+    EXPECT_EQ(map.origin(), kOrigin);
+    EXPECT_DOUBLE_EQ(map.resolution(), kResolution);
+
+    // points also outside of the map, which are clamped to it
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> coordinate(-3.0, 3.0);
+    for (int query = 0; query < 20000; query++) {
+        const Eigen::Vector3d p(coordinate(rng), coordinate(rng), coordinate(rng));
+        Eigen::Vector3d cached_gradient, uncached_gradient;
+        const double cached = map.distance(p, &cached_gradient);
+        EXPECT_EQ(cached, map.distance_uncached(p, &uncached_gradient)) << p.transpose();
+        EXPECT_EQ(cached_gradient, uncached_gradient) << p.transpose();
+    }
+    EXPECT_GT(map.cache_misses(), 4u);
+    EXPECT_EQ(map.cache_hits() + map.cache_misses(), 20000u);
+
+    // the same block again is a hit
+    const unsigned long misses = map.cache_misses();
+    map.distance(Eigen::Vector3d(0.01, 0.01, 0.01));
+    map.distance(Eigen::Vector3d(0.02, 0.03, 0.04));
+    EXPECT_LE(map.cache_misses(), misses + 1);
+}
+
+TEST(EsdfMap, TrilinearInterpolation)
+{
+    TempFile file;
+    write_sphere(file.path());
+    EsdfMap map(file.path());
+
+    // the voxel values on the grid
+    for (int i = 1; i < kSize(0); i += 5) {
+        const Eigen::Vector3d voxel = kOrigin + kResolution * Eigen::Vector3d(i, i % kSize(1), i % kSize(2));
+        EXPECT_NEAR(map.distance(voxel), static_cast<float>(sphere_distance(voxel)), 1e-6) << i;
+    }
+
+    // the gradient of the interpolation inside the cells, close to the unit normal of the sphere
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> coordinate(-0.9, 0.9);
+    const double h = 1e-6;
+    for (int query = 0; query < 200; query++) {
+        // within the map, away from the cell faces where the gradient is discontinuous
+        Eigen::Vector3d p(coordinate(rng), 0.3 + coordinate(rng), 0.4 + coordinate(rng));
+        p = kOrigin + kResolution * (((p - kOrigin) / kResolution).array().floor() + 0.37).matrix();
+        Eigen::Vector3d gradient;
+        map.distance(p, &gradient);
+        for (int axis = 0; axis < 3; axis++) {
+            const Eigen::Vector3d step = h * Eigen::Vector3d::Unit(axis);
+            const double difference = (map.distance(p + step) - map.distance(p - step)) / (2.0 * h);
+            EXPECT_NEAR(gradient(axis), difference, 1e-6) << p.transpose();
+        }
+        EXPECT_NEAR(gradient.norm(), 1.0, 0.1) << p.transpose();
+    }
+
+    // the linearized constraint holds at the point with the margin it has
+    const Eigen::Vector3d p(0.8, 0.2, 0.3);
+    const EsdfConstraint constraint = map.linearize(p, 0.2);
+    EXPECT_TRUE(constraint.active);
+    EXPECT_NEAR(constraint.gradient.dot(p) - constraint.bound, map.distance(p) - 0.2, 1e-12);
+}
+
+TEST(EsdfMap, RejectsInvalidFiles)
+{
+    EXPECT_THROW(EsdfMap("/nonexistent/mav_nmpc_tracker.esdf"), std::runtime_error);
+    TempFile file;
+    EXPECT_THROW(EsdfMap::write(file.path(), kSize, kOrigin, kResolution, std::vector<float>(10)),
+                 std::runtime_error);
+
+    write_sphere(file.path());
+    const std::string valid = file.read();
+    // shorter than a header, not the magic, fewer distances than the grid
+    file.write(valid.substr(0, sizeof(EsdfHeader) - 1));
+    EXPECT_THROW(EsdfMap map(file.path()), std::runtime_error);
+    std::string content = valid;
+    content[0] = 'X';
+    file.write(content);
+    EXPECT_THROW(EsdfMap map(file.path()), std::runtime_error);
+    file.write(valid.substr(0, valid.size() - sizeof(float)));
+    EXPECT_THROW(EsdfMap map(file.path()), std::runtime_error);
+    // too small to interpolate in
+    EsdfMap::write(file.path(), Eigen::Vector3i(1, 4, 4), kOrigin, kResolution, std::vector<float>(16));
+    EXPECT_THROW(EsdfMap map(file.path()), std::runtime_error);
+}
@@ -0,0 +1,187 @@
+// The closed form minimum snap transition: its boundary conditions, which only hold with the right end
+// inverse, and the durations from the peaks of the rest to rest transition.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mav_nmpc_tracker/minimum_snap.h"
+
+using namespace mav_nmpc_tracker;
+
+namespace {
+
+// the rest to rest transition over a unit distance and duration, 35 t^4 - 84 t^5 + 70 t^6 - 20 t^7,
+// is the first column of the end inverse
+double rest_velocity(double tau)
+{
+    return tau * tau * tau * (140.0 - 420.0 * tau + 420.0 * tau * tau - 140.0 * tau * tau * tau);
+}
+
+double rest_acceleration(double tau)
+{
+    return tau * tau * (420.0 - 1680.0 * tau + 2100.0 * tau * tau - 840.0 * tau * tau * tau);
+}
+
+// peaks of the normalized rest to rest transition, densely sampled
+void rest_peaks(double &velocity, double &acceleration)
+{
+    const int samples = 200000;
+    velocity = 0.0;
+    acceleration = 0.0;
+    for (int i = 0; i <= samples; i++) {
+        const double tau = static_cast<double>(i) / samples;
+        velocity = std::max(velocity, std::abs(rest_velocity(tau)));
+        acceleration = std::max(acceleration, std::abs(rest_acceleration(tau)));
+    }
+}
+
+// peak speed and acceleration of a plan, densely sampled
+void plan_peaks(const MinimumSnapTrajectory &plan, double &velocity, double &acceleration)
+{
+    const int samples = 20000;
+    std::vector<double> offsets(samples);
+    for (int i = 0; i < samples; i++)
+        offsets[i] = (plan.end_time() - plan.start_time()) * i / samples;
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    plan.evaluate(plan.start_time(), offsets, positions, velocities, &accelerations);
+    velocity = velocities.colwise().norm().maxCoeff();
+    acceleration = accelerations.colwise().norm().maxCoeff();
+}
+
+}  // namespace
+
+TEST(MinimumSnap, BoundaryConditions)
+{
+    const Eigen::Vector3d p0(1.0, -2.0, 0.5), v0(0.8, 0.3, -0.4), a0(-0.5, 1.2, 0.3), target(4.0, 1.0, 2.0);
+    MinimumSnapTrajectory plan;
+    plan.plan(10.0, p0, v0, a0, target);
+    ASSERT_FALSE(plan.empty());
+    const double duration = plan.end_time() - plan.start_time();
+    ASSERT_GT(duration, 0.0);
+
+    // the start, and zero jerk there from the accelerations just after it
+    const double h = 1e-3;
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    plan.evaluate(plan.start_time(), {0.0, h, 2.0 * h}, positions, velocities, &accelerations);
+    EXPECT_LT((positions.col(0) - p0).norm(), 1e-12);
+    EXPECT_LT((velocities.col(0) - v0).norm(), 1e-12);
+    EXPECT_LT((accelerations.col(0) - a0).norm(), 1e-12);
+    const Eigen::Vector3d start_jerk =
+        (-3.0 * accelerations.col(0) + 4.0 * accelerations.col(1) - accelerations.col(2)) / (2.0 * h);
+    EXPECT_LT(start_jerk.norm(), 1e-3);
+
+    // the target at rest, with zero jerk, just before the end
+    const double eps = 1e-9;
+    plan.evaluate(plan.end_time(), {-eps, -h - eps, -2.0 * h - eps}, positions, velocities, &accelerations);
+    EXPECT_LT((positions.col(0) - target).norm(), 1e-8);
+    EXPECT_LT(velocities.col(0).norm(), 1e-6);
+    EXPECT_LT(accelerations.col(0).norm(), 1e-6);
+    const Eigen::Vector3d end_jerk =
+        (3.0 * accelerations.col(0) - 4.0 * accelerations.col(1) + accelerations.col(2)) / (2.0 * h);
+    EXPECT_LT(end_jerk.norm(), 1e-3);
+
+    // held at the start before it and at the target after the end
+    plan.evaluate(plan.start_time(), {-1.0}, positions, velocities);
+    EXPECT_EQ(positions.col(0), p0);
+    EXPECT_EQ(velocities.col(0), Eigen::Vector3d::Zero());
+    plan.evaluate(plan.end_time(), {0.0, 1.0}, positions, velocities, &accelerations);
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(positions.col(i), target);
+        EXPECT_EQ(velocities.col(i), Eigen::Vector3d::Zero());
+        EXPECT_EQ(accelerations.col(i), Eigen::Vector3d::Zero());
+    }
+    EXPECT_TRUE(plan.stationary(plan.end_time()));
+    EXPECT_FALSE(plan.stationary(plan.end_time() - h));
+    EXPECT_LT(duration, 30.0);
+}
+
+TEST(MinimumSnap, RestDurationFromPeakVelocity)
+{
+    double rest_velocity_peak, rest_acceleration_peak;
+    rest_peaks(rest_velocity_peak, rest_acceleration_peak);
+
+    // the speed limit binds: D / T times the peak of the normalized transition
+    MinimumSnapLimits limits;
+    limits.velocity = 1.5;
+    limits.acceleration = 100.0;
+    limits.min_duration = 0.1;
+    const Eigen::Vector3d target(3.0, 4.0, 0.0);
+    MinimumSnapTrajectory plan;
+    plan.plan(0.0, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), target, limits);
+    const double duration = plan.end_time() - plan.start_time();
+    EXPECT_NEAR(duration, rest_velocity_peak * target.norm() / limits.velocity, 1e-6 * duration);
+
+    double velocity, acceleration;
+    plan_peaks(plan, velocity, acceleration);
+    EXPECT_NEAR(velocity, limits.velocity, 1e-6);
+    EXPECT_LT(acceleration, limits.acceleration);
+}
+
+TEST(MinimumSnap, RestDurationFromPeakAcceleration)
+{
+    double rest_velocity_peak, rest_acceleration_peak;
+    rest_peaks(rest_velocity_peak, rest_acceleration_peak);
+
+    // the acceleration limit binds: D / T^2 times the peak of the normalized transition
+    MinimumSnapLimits limits;
+    limits.velocity = 100.0;
+    limits.acceleration = 1.0;
+    limits.min_duration = 0.1;
+    const Eigen::Vector3d target(0.0, -2.0, 1.5);
+    MinimumSnapTrajectory plan;
+    plan.plan(0.0, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), target, limits);
+    const double duration = plan.end_time() - plan.start_time();
+    EXPECT_NEAR(duration, std::sqrt(rest_acceleration_peak * target.norm() / limits.acceleration), 1e-5 * duration);
+
+    double velocity, acceleration;
+    plan_peaks(plan, velocity, acceleration);
+    EXPECT_NEAR(acceleration, limits.acceleration, 1e-4);
+    EXPECT_LT(velocity, limits.velocity);
+}
+
+TEST(MinimumSnap, MovingStartWithinLimits)
+{
+    // a start moving away from the target needs longer than from rest, the peaks keep to the limits
+    MinimumSnapLimits limits;
+    const Eigen::Vector3d v0(-0.6, 0.3, 0.0), target(5.0, 0.0, 0.0);
+    MinimumSnapTrajectory plan;
+    plan.plan(0.0, Eigen::Vector3d::Zero(), v0, Eigen::Vector3d::Zero(), target, limits);
+    double velocity, acceleration;
+    plan_peaks(plan, velocity, acceleration);
+    EXPECT_LT(velocity, 1.02 * limits.velocity);
+    EXPECT_LT(acceleration, 1.02 * limits.acceleration);
+}
+
+TEST(MinimumSnap, AcceleratingStartBounded)
+{
+    // with an acceleration at the start the peaks grow again on long durations, the duration must not run
+    // away while the limits cannot be met
+    MinimumSnapLimits limits;
+    const Eigen::Vector3d v0(-0.9, 0.0, 0.0), a0(0.0, 1.5, 0.0), target(5.0, 0.0, 0.0);
+    MinimumSnapTrajectory plan;
+    plan.plan(0.0, Eigen::Vector3d::Zero(), v0, a0, target, limits);
+    EXPECT_LT(plan.end_time(), 30.0);
+    double velocity, acceleration;
+    plan_peaks(plan, velocity, acceleration);
+    EXPECT_LT(velocity, 3.0 * limits.velocity);
+    EXPECT_LT(acceleration, 3.0 * limits.acceleration);
+}
+
+TEST(MinimumSnap, MinimumDuration)
+{
+    MinimumSnapLimits limits;
+    limits.min_duration = 0.75;
+    const Eigen::Vector3d p0(1.0, 2.0, 3.0);
+    MinimumSnapTrajectory plan;
+    plan.plan(2.0, p0, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), p0, limits);
+    EXPECT_DOUBLE_EQ(plan.end_time(), 2.75);
+    Eigen::Matrix3Xd positions, velocities;
+    plan.evaluate(2.0, {0.0, 0.3, 0.6}, positions, velocities);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_LT((positions.col(i) - p0).norm(), 1e-12);
+        EXPECT_LT(velocities.col(i).norm(), 1e-12);
+    }
+}
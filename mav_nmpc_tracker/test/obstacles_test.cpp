@@ -0,0 +1,73 @@
+// The grid index of the moving obstacles against testing every one of them.
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mav_nmpc_tracker/obstacles.h"
+
+using namespace mav_nmpc_tracker;
+
+namespace {
+
+// count obstacles moving in a flat box of +-50 m, stamped around 0
+std::vector<Obstacle> random_obstacles(int count, std::mt19937 &rng)
+{
+    std::uniform_real_distribution<double> position(-50.0, 50.0), unit(-1.0, 1.0), radius(0.2, 1.5);
+    std::vector<Obstacle> obstacles(count);
+    for (Obstacle &obstacle : obstacles) {
+        obstacle.position << position(rng), position(rng), 0.1 * position(rng);
+        obstacle.velocity << unit(rng), unit(rng), 0.1 * unit(rng);
+        obstacle.radii << radius(rng), radius(rng), radius(rng);
+        obstacle.stamp = 0.1 * unit(rng);
+    }
+    return obstacles;
+}
+
+}  // namespace
+
+TEST(ObstacleIndex, NearestFirstWithinTheRange)
+{
+    Obstacle a, b, c;
+    a.position << 1.0, 0.0, 0.0;
+    b.position << 0.0, 2.5, 0.0;
+    c.position << 20.0, 0.0, 0.0;
+    c.velocity << -10.0, 0.0, 0.0;  // within the range after 1.5 s
+    ObstacleIndex index;
+    index.set_obstacles({c, b, a});
+
+    std::vector<int> nearest = index.nearest(Eigen::Vector3d::Zero(), 0.0, 4);
+    EXPECT_EQ(nearest, std::vector<int>({2, 1}));
+    nearest = index.nearest(Eigen::Vector3d::Zero(), 0.0, 1);
+    EXPECT_EQ(nearest, std::vector<int>({2}));
+    nearest = index.nearest(Eigen::Vector3d::Zero(), 2.0, 4);
+    EXPECT_EQ(nearest, std::vector<int>({0, 2, 1}));
+
+    index.set_obstacles(std::vector<Obstacle>());
+    EXPECT_TRUE(index.nearest(Eigen::Vector3d::Zero(), 0.0, 4).empty());
+}
+
+TEST(ObstacleIndex, SameAsBruteForce)
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> position(-50.0, 50.0);
+    for (int count : {10, 200, 2000}) {
+        ObstacleIndex index;
+        index.set_obstacles(random_obstacles(count, rng));
+        long tests = 0;
+        for (int query = 0; query < 1000; query++) {
+            const Eigen::Vector3d p(position(rng), position(rng), 0.1 * position(rng));
+            // the stages over a 1 s horizon
+            const double time = 0.05 * (query % 20);
+            // copied, both return the same scratch
+            const std::vector<int> nearest = index.nearest(p, time, kObstacleSlots);
+            tests += index.tests();
+            EXPECT_EQ(nearest, index.nearest_brute_force(p, time, kObstacleSlots)) << count << " " << query;
+        }
+        // the grid only tests the obstacles nearby once there are many
+        if (count == 2000) {
+            EXPECT_LT(tests, 1000L * count / 20);
+        }
+    }
+}
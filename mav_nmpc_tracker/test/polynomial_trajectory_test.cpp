@@ -0,0 +1,115 @@
+// The piecewise polynomial trajectory at and around the boundaries of its segments.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mav_nmpc_tracker/polynomial_trajectory.h"
+
+using namespace mav_nmpc_tracker;
+
+namespace {
+
+PolynomialSegment constant_segment(double duration, const Eigen::Vector3d &position)
+{
+    PolynomialSegment segment;
+    segment.duration = duration;
+    segment.coefficients = position;
+    return segment;
+}
+
+}  // namespace
+
+TEST(PolynomialTrajectory, SegmentsOneAfterTheOther)
+{
+    // p(t) = (t^2, 1 + t, 0) over 1 s, then continued from its end as a cubic over 2 s
+    std::vector<PolynomialSegment> segments(2);
+    segments[0].duration = 1.0;
+    segments[0].coefficients.setZero(3, 3);
+    segments[0].coefficients.col(0) << 0.0, 1.0, 0.0;
+    segments[0].coefficients.col(1) << 0.0, 1.0, 0.0;
+    segments[0].coefficients.col(2) << 1.0, 0.0, 0.0;
+    segments[1].duration = 2.0;
+    segments[1].coefficients.setZero(3, 4);
+    segments[1].coefficients.col(0) << 1.0, 2.0, 0.0;
+    segments[1].coefficients.col(1) << 2.0, 1.0, 0.0;
+    segments[1].coefficients.col(2) << 1.0, 0.0, 0.0;
+    segments[1].coefficients.col(3) << 0.0, 0.0, 0.5;
+
+    PolynomialTrajectory trajectory;
+    EXPECT_TRUE(trajectory.empty());
+    ASSERT_TRUE(trajectory.set(10.0, segments));
+    EXPECT_DOUBLE_EQ(trajectory.start_time(), 10.0);
+    EXPECT_DOUBLE_EQ(trajectory.end_time(), 13.0);
+
+    const std::vector<double> offsets = {-0.5, 0.0, 0.5, 1.0 - 1e-9, 1.0, 1.5, 3.0, 3.5};
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    trajectory.evaluate(10.0, offsets, positions, velocities, &accelerations);
+
+    // held at the first position before the start
+    EXPECT_EQ(positions.col(0), Eigen::Vector3d(0.0, 1.0, 0.0));
+    EXPECT_EQ(velocities.col(0), Eigen::Vector3d::Zero());
+    EXPECT_EQ(accelerations.col(0), Eigen::Vector3d::Zero());
+    // the first segment from its start
+    EXPECT_EQ(positions.col(1), Eigen::Vector3d(0.0, 1.0, 0.0));
+    EXPECT_EQ(velocities.col(1), Eigen::Vector3d(0.0, 1.0, 0.0));
+    EXPECT_EQ(accelerations.col(1), Eigen::Vector3d(2.0, 0.0, 0.0));
+    EXPECT_LT((positions.col(2) - Eigen::Vector3d(0.25, 1.5, 0.0)).norm(), 1e-15);
+    // continuous through the boundary, which belongs to the second segment
+    EXPECT_LT((positions.col(3) - positions.col(4)).norm(), 1e-8);
+    EXPECT_LT((velocities.col(3) - velocities.col(4)).norm(), 1e-8);
+    EXPECT_EQ(positions.col(4), Eigen::Vector3d(1.0, 2.0, 0.0));
+    EXPECT_EQ(velocities.col(4), Eigen::Vector3d(2.0, 1.0, 0.0));
+    EXPECT_EQ(accelerations.col(4), Eigen::Vector3d(2.0, 0.0, 0.0));
+    // the second segment 0.5 s in
+    EXPECT_LT((positions.col(5) - Eigen::Vector3d(2.25, 2.5, 0.0625)).norm(), 1e-15);
+    EXPECT_LT((velocities.col(5) - Eigen::Vector3d(3.0, 1.0, 0.375)).norm(), 1e-15);
+    EXPECT_LT((accelerations.col(5) - Eigen::Vector3d(2.0, 0.0, 1.5)).norm(), 1e-15);
+    // the end of the last segment at the end time, held after it
+    EXPECT_LT((positions.col(6) - Eigen::Vector3d(9.0, 4.0, 4.0)).norm(), 1e-12);
+    EXPECT_LT((velocities.col(6) - Eigen::Vector3d(6.0, 1.0, 6.0)).norm(), 1e-12);
+    EXPECT_LT((positions.col(7) - positions.col(6)).norm(), 1e-12);
+    EXPECT_EQ(velocities.col(7), Eigen::Vector3d::Zero());
+    EXPECT_EQ(accelerations.col(7), Eigen::Vector3d::Zero());
+}
+
+TEST(PolynomialTrajectory, BoundaryBelongsToTheNextSegment)
+{
+    const Eigen::Vector3d a(0.0, 0.0, 1.0), b(1.0, 0.0, 1.0), c(1.0, 1.0, 1.0);
+    PolynomialTrajectory trajectory;
+    ASSERT_TRUE(trajectory.set(0.0, {constant_segment(0.5, a), constant_segment(0.25, b), constant_segment(1.0, c)}));
+    Eigen::Matrix3Xd positions, velocities;
+    trajectory.evaluate(0.0, {0.0, 0.5 - 1e-12, 0.5, 0.75 - 1e-12, 0.75, 1.75, 2.0}, positions, velocities);
+    EXPECT_EQ(positions.col(0), a);
+    EXPECT_EQ(positions.col(1), a);
+    EXPECT_EQ(positions.col(2), b);
+    EXPECT_EQ(positions.col(3), b);
+    EXPECT_EQ(positions.col(4), c);
+    EXPECT_EQ(positions.col(5), c);
+    EXPECT_EQ(positions.col(6), c);
+    EXPECT_EQ(velocities, Eigen::Matrix3Xd::Zero(3, 7));
+
+    // the first evaluated stage may fall into any segment
+    trajectory.evaluate(0.6, {0.0, 0.15, 0.5}, positions, velocities);
+    EXPECT_EQ(positions.col(0), b);
+    EXPECT_EQ(positions.col(1), c);
+    EXPECT_EQ(positions.col(2), c);
+    EXPECT_TRUE(trajectory.stationary(0.8, 2.0, 1e-9));
+    EXPECT_FALSE(trajectory.stationary(0.0, 1.0, 1e-3));
+}
+
+TEST(PolynomialTrajectory, RejectsInvalidSegments)
+{
+    PolynomialTrajectory trajectory;
+    ASSERT_TRUE(trajectory.set(1.0, {constant_segment(2.0, Eigen::Vector3d::Ones())}));
+    EXPECT_FALSE(trajectory.set(0.0, std::vector<PolynomialSegment>()));
+    EXPECT_FALSE(trajectory.set(0.0, {constant_segment(0.0, Eigen::Vector3d::Zero())}));
+    PolynomialSegment no_coefficients;
+    no_coefficients.duration = 1.0;
+    EXPECT_FALSE(trajectory.set(0.0, {constant_segment(1.0, Eigen::Vector3d::Zero()), no_coefficients}));
+    // the last trajectory is kept
+    EXPECT_DOUBLE_EQ(trajectory.start_time(), 1.0);
+    EXPECT_DOUBLE_EQ(trajectory.end_time(), 3.0);
+    trajectory.clear();
+    EXPECT_TRUE(trajectory.empty());
+}
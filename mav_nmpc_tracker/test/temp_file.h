@@ -0,0 +1,53 @@
+#ifndef MAV_NMPC_TRACKER_TEST_TEMP_FILE_H
+#define MAV_NMPC_TRACKER_TEST_TEMP_FILE_H
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Files written by the tests of the memory-mapped formats
+
+namespace mav_nmpc_tracker {
+namespace test {
+
+// a new empty file, removed again with the object
+class TempFile {
+public:
+    TempFile()
+    {
+        char path[] = "/tmp/mav_nmpc_tracker_test_XXXXXX";
+        const int fd = mkstemp(path);
+        if (fd >= 0)
+            close(fd);
+        path_ = path;
+    }
+    ~TempFile() { unlink(path_.c_str()); }
+
+    TempFile(const TempFile &) = delete;
+    TempFile &operator=(const TempFile &) = delete;
+
+    const std::string &path() const { return path_; }
+
+    // replaces the content
+    void write(const std::string &content) const
+    {
+        std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), content.size());
+    }
+    std::string read() const
+    {
+        std::ifstream file(path_, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+private:
+    std::string path_;
+};
+
+}  // namespace test
+}  // namespace mav_nmpc_tracker
+
+#endif  // MAV_NMPC_TRACKER_TEST_TEMP_FILE_H
@@ -0,0 +1,163 @@
+// The ring buffer of trajectory samples: replacing from the first new sample, dropping the past, and the
+// interpolation staying exact on a cubic while the samples wrap around the end of the ring.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mav_nmpc_tracker/trajectory_buffer.h"
+
+using namespace mav_nmpc_tracker;
+
+namespace {
+
+// a cubic in time, reproduced exactly by the cubic Hermite interpolation of its samples
+Eigen::Vector3d cubic_position(double t)
+{
+    return Eigen::Vector3d(0.1 * t * t * t - t, 2.0 * t + 1.0, -0.5 * t * t);
+}
+
+Eigen::Vector3d cubic_velocity(double t)
+{
+    return Eigen::Vector3d(0.3 * t * t - 1.0, 2.0, -t);
+}
+
+Eigen::Vector3d cubic_acceleration(double t)
+{
+    return Eigen::Vector3d(0.6 * t, 0.0, -1.0);
+}
+
+// samples of the cubic at first, first + step, ...
+std::vector<TrajectorySample> cubic_samples(double first, double step, int count)
+{
+    std::vector<TrajectorySample> samples(count);
+    for (int i = 0; i < count; i++) {
+        samples[i].time = first + step * i;
+        samples[i].position = cubic_position(samples[i].time);
+        samples[i].velocity = cubic_velocity(samples[i].time);
+    }
+    return samples;
+}
+
+}  // namespace
+
+TEST(TrajectoryBuffer, InsertReplacesFromFirstNewSample)
+{
+    TrajectoryBuffer buffer(16);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.insert(cubic_samples(0.0, 1.0, 10)), 10);
+    EXPECT_EQ(buffer.size(), 10);
+    EXPECT_DOUBLE_EQ(buffer.start_time(), 0.0);
+    EXPECT_DOUBLE_EQ(buffer.end_time(), 9.0);
+
+    // the samples from 5 s on are replaced, the earlier ones kept
+    std::vector<TrajectorySample> replan = cubic_samples(5.0, 0.5, 4);
+    for (TrajectorySample &sample : replan)
+        sample.position.z() += 1.0;
+    EXPECT_EQ(buffer.insert(replan), 4);
+    EXPECT_EQ(buffer.size(), 9);
+    EXPECT_DOUBLE_EQ(buffer.end_time(), 6.5);
+    Eigen::Vector3d position;
+    buffer.evaluate(4.0, &position);
+    EXPECT_LT((position - cubic_position(4.0)).norm(), 1e-12);
+    buffer.evaluate(6.0, &position);
+    EXPECT_LT((position - cubic_position(6.0) - Eigen::Vector3d::UnitZ()).norm(), 1e-12);
+}
+
+TEST(TrajectoryBuffer, InsertSkipsNonIncreasingAndStopsAtCapacity)
+{
+    TrajectoryBuffer buffer(8);
+    std::vector<TrajectorySample> samples = cubic_samples(0.0, 1.0, 6);
+    samples[3].time = samples[2].time;
+    EXPECT_EQ(buffer.insert(samples), 5);
+    EXPECT_EQ(buffer.size(), 5);
+
+    // only as many as there is room for
+    EXPECT_EQ(buffer.insert(cubic_samples(10.0, 1.0, 6)), 3);
+    EXPECT_EQ(buffer.size(), 8);
+    EXPECT_DOUBLE_EQ(buffer.end_time(), 12.0);
+
+    EXPECT_EQ(buffer.insert(std::vector<TrajectorySample>()), 0);
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(TrajectoryBuffer, DropBeforeKeepsTheSegmentOfTheCut)
+{
+    TrajectoryBuffer buffer(16, 0.5);
+    buffer.insert(cubic_samples(0.0, 1.0, 10));
+    // cut at 4.7 s, the sample at 4 s stays for the segment to 5 s
+    buffer.drop_before(5.2);
+    EXPECT_EQ(buffer.size(), 6);
+    EXPECT_DOUBLE_EQ(buffer.start_time(), 4.0);
+    Eigen::Vector3d position;
+    buffer.evaluate(4.7, &position);
+    EXPECT_LT((position - cubic_position(4.7)).norm(), 1e-12);
+
+    // before the start nothing is dropped
+    buffer.drop_before(4.1);
+    EXPECT_EQ(buffer.size(), 6);
+}
+
+TEST(TrajectoryBuffer, WrapsAroundTheRing)
+{
+    const int capacity = 8;
+    TrajectoryBuffer buffer(capacity, 0.0);
+    buffer.insert(cubic_samples(0.0, 0.25, capacity));
+    buffer.drop_before(1.1);
+    EXPECT_DOUBLE_EQ(buffer.start_time(), 1.0);
+    // the new samples go to the front of the ring, the buffer is full again
+    EXPECT_EQ(buffer.insert(cubic_samples(2.0, 0.25, 4)), 4);
+    EXPECT_EQ(buffer.size(), capacity);
+    EXPECT_DOUBLE_EQ(buffer.end_time(), 2.75);
+
+    // exact on the cubic at and in between the samples, across the wrap
+    std::vector<double> offsets;
+    for (double offset = 0.0; offset <= 1.75; offset += 0.05)
+        offsets.push_back(offset);
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    buffer.evaluate(1.0, offsets, positions, velocities, &accelerations);
+    for (size_t i = 0; i < offsets.size(); i++) {
+        const double t = 1.0 + offsets[i];
+        EXPECT_LT((positions.col(i) - cubic_position(t)).norm(), 1e-12) << t;
+        EXPECT_LT((velocities.col(i) - cubic_velocity(t)).norm(), 1e-12) << t;
+        EXPECT_LT((accelerations.col(i) - cubic_acceleration(t)).norm(), 1e-9) << t;
+        Eigen::Vector3d position, velocity;
+        buffer.evaluate(t, &position, &velocity);
+        EXPECT_EQ(position, positions.col(i));
+        EXPECT_EQ(velocity, velocities.col(i));
+    }
+}
+
+TEST(TrajectoryBuffer, HeldOutsideTheSamples)
+{
+    TrajectoryBuffer buffer;
+    buffer.insert(cubic_samples(1.0, 0.5, 5));
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    buffer.evaluate(0.0, {0.0, 0.5, 3.0, 4.0}, positions, velocities, &accelerations);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(positions.col(i), cubic_position(i < 2 ? 1.0 : 3.0));
+        EXPECT_EQ(velocities.col(i), Eigen::Vector3d::Zero());
+        EXPECT_EQ(accelerations.col(i), Eigen::Vector3d::Zero());
+    }
+    EXPECT_TRUE(buffer.stationary(3.0, 5.0, 1e-9));
+    EXPECT_FALSE(buffer.stationary(2.0, 5.0, 1e-3));
+}
+
+TEST(TrajectoryBuffer, EstimatedVelocities)
+{
+    // central differences, exact on a quadratic in the middle
+    std::vector<TrajectorySample> samples(3);
+    for (int i = 0; i < 3; i++) {
+        samples[i].time = i;
+        samples[i].position = Eigen::Vector3d(i * i, 2.0 * i, 0.0);
+    }
+    estimate_velocities(samples);
+    EXPECT_EQ(samples[0].velocity, Eigen::Vector3d(1.0, 2.0, 0.0));
+    EXPECT_EQ(samples[1].velocity, Eigen::Vector3d(2.0, 2.0, 0.0));
+    EXPECT_EQ(samples[2].velocity, Eigen::Vector3d(3.0, 2.0, 0.0));
+
+    samples.resize(1);
+    estimate_velocities(samples);
+    EXPECT_EQ(samples[0].velocity, Eigen::Vector3d::Zero());
+}
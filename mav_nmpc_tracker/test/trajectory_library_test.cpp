@@ -0,0 +1,213 @@
+// The memory-mapped trajectory library: what is rejected when written and when mapped, the lookups by
+// segment, and the quintic interpolation, exact on a quintic.
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mav_nmpc_tracker/trajectory_library.h"
+#include "temp_file.h"
+
+using namespace mav_nmpc_tracker;
+using mav_nmpc_tracker::test::TempFile;
+
+namespace {
+
+// per axis ascending powers of a quintic in time
+const double kQuintic[3][6] = {
+    {1.0, -0.5, 0.25, 0.1, -0.02, 0.001},
+    {-2.0, 1.0, 0.0, -0.05, 0.01, 0.0005},
+    {0.5, 0.0, -0.3, 0.02, 0.003, -0.0004},
+};
+
+void quintic(double t, double position[3], double velocity[3], double acceleration[3])
+{
+    for (int axis = 0; axis < 3; axis++) {
+        const double *c = kQuintic[axis];
+        position[axis] = c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))));
+        velocity[axis] = c[1] + t * (2.0 * c[2] + t * (3.0 * c[3] + t * (4.0 * c[4] + t * 5.0 * c[5])));
+        acceleration[axis] = 2.0 * c[2] + t * (6.0 * c[3] + t * (12.0 * c[4] + t * 20.0 * c[5]));
+    }
+}
+
+// samples of the quintic at the times
+std::vector<LibrarySample> quintic_samples(const std::vector<double> &times)
+{
+    std::vector<LibrarySample> samples(times.size());
+    for (size_t i = 0; i < times.size(); i++) {
+        samples[i].time = times[i];
+        quintic(times[i], samples[i].position, samples[i].velocity, samples[i].acceleration);
+        samples[i].yaw = 0.1 * times[i];
+    }
+    return samples;
+}
+
+// 0, 0.5, ..., irregular in between
+std::vector<double> sample_times(int count)
+{
+    std::vector<double> times(count);
+    for (int i = 0; i < count; i++)
+        times[i] = 0.5 * i + (i % 3 == 1 ? 0.2 : 0.0);
+    return times;
+}
+
+}  // namespace
+
+TEST(TrajectoryLibrary, WriteRejectsInvalidSamples)
+{
+    TempFile file;
+    const std::vector<LibrarySample> samples = quintic_samples(sample_times(6));
+    EXPECT_THROW(TrajectoryLibrary::write(file.path(), std::vector<LibrarySample>(), {0}), std::runtime_error);
+    EXPECT_THROW(TrajectoryLibrary::write(file.path(), samples, {}), std::runtime_error);
+    EXPECT_THROW(TrajectoryLibrary::write(file.path(), samples, {1}), std::runtime_error);
+    EXPECT_THROW(TrajectoryLibrary::write(file.path(), samples, {0, 3, 3}), std::runtime_error);
+    EXPECT_THROW(TrajectoryLibrary::write(file.path(), samples, {0, 6}), std::runtime_error);
+    std::vector<LibrarySample> unordered = samples;
+    unordered[4].time = unordered[3].time;
+    EXPECT_THROW(TrajectoryLibrary::write(file.path(), unordered, {0}), std::runtime_error);
+    EXPECT_NO_THROW(TrajectoryLibrary::write(file.path(), samples, {0, 3}));
+}
+
+TEST(TrajectoryLibrary, MapRejectsInvalidFiles)
+{
+    EXPECT_THROW(TrajectoryLibrary("/nonexistent/mav_nmpc_tracker.traj"), std::runtime_error);
+
+    TempFile file;
+    TrajectoryLibrary::write(file.path(), quintic_samples(sample_times(6)), {0, 3});
+    const std::string valid = file.read();
+    EXPECT_NO_THROW(TrajectoryLibrary library(file.path()));
+
+    // shorter than a header
+    file.write(valid.substr(0, sizeof(TrajectoryLibraryHeader) - 1));
+    EXPECT_THROW(TrajectoryLibrary library(file.path()), std::runtime_error);
+    // not the magic
+    std::string content = valid;
+    content[0] = 'X';
+    file.write(content);
+    EXPECT_THROW(TrajectoryLibrary library(file.path()), std::runtime_error);
+    // fewer samples than the header says
+    file.write(valid.substr(0, valid.size() - sizeof(LibrarySample) / 2));
+    EXPECT_THROW(TrajectoryLibrary library(file.path()), std::runtime_error);
+    // a segment index not increasing
+    content = valid;
+    LibrarySegment segment;
+    const size_t second_segment = sizeof(TrajectoryLibraryHeader) + sizeof(LibrarySegment);
+    std::memcpy(&segment, content.data() + second_segment, sizeof(segment));
+    segment.first_sample = 0;
+    std::memcpy(&content[second_segment], &segment, sizeof(segment));
+    file.write(content);
+    EXPECT_THROW(TrajectoryLibrary library(file.path()), std::runtime_error);
+}
+
+TEST(TrajectoryLibrary, SegmentsAndSearches)
+{
+    TempFile file;
+    const std::vector<double> times = sample_times(12);
+    TrajectoryLibrary::write(file.path(), quintic_samples(times), {0, 4, 8});
+    TrajectoryLibrary library(file.path());
+    EXPECT_EQ(library.sample_count(), 12);
+    EXPECT_EQ(library.segment_count(), 3);
+    EXPECT_DOUBLE_EQ(library.start_time(), times.front());
+    EXPECT_DOUBLE_EQ(library.end_time(), times.back());
+    EXPECT_EQ(library.segment(-0.1), -1);
+    EXPECT_EQ(library.segment(times[0]), 0);
+    EXPECT_EQ(library.segment(times[4] - 1e-9), 0);
+    EXPECT_EQ(library.segment(times[4]), 1);
+    EXPECT_EQ(library.segment(times[11] + 10.0), 2);
+
+    // the first lookup searches, the next cycles walk on, a seek back searches again
+    Eigen::Matrix3Xd positions, velocities;
+    library.evaluate(0.1, {0.0, 0.5, 1.0}, positions, velocities);
+    EXPECT_EQ(library.searches(), 1u);
+    library.evaluate(0.6, {0.0, 0.5, 1.0}, positions, velocities);
+    library.evaluate(1.1, {0.0, 0.5, 1.0}, positions, velocities);
+    EXPECT_EQ(library.searches(), 1u);
+    library.evaluate(0.2, {0.0}, positions, velocities);
+    EXPECT_EQ(library.searches(), 2u);
+}
+
+TEST(TrajectoryLibrary, QuinticInterpolation)
+{
+    TempFile file;
+    const std::vector<double> times = sample_times(10);
+    TrajectoryLibrary::write(file.path(), quintic_samples(times), {0, 5});
+    TrajectoryLibrary library(file.path());
+
+    std::vector<double> offsets;
+    for (double offset = 0.0; offset <= times.back(); offset += 0.037)
+        offsets.push_back(offset);
+    Eigen::Matrix3Xd positions, velocities, accelerations;
+    Eigen::VectorXd yaws;
+    library.evaluate(0.0, offsets, positions, velocities, &accelerations, &yaws);
+    for (size_t i = 0; i < offsets.size(); i++) {
+        double position[3], velocity[3], acceleration[3];
+        quintic(offsets[i], position, velocity, acceleration);
+        EXPECT_LT((positions.col(i) - Eigen::Map<Eigen::Vector3d>(position)).norm(), 1e-12) << offsets[i];
+        EXPECT_LT((velocities.col(i) - Eigen::Map<Eigen::Vector3d>(velocity)).norm(), 1e-11) << offsets[i];
+        EXPECT_LT((accelerations.col(i) - Eigen::Map<Eigen::Vector3d>(acceleration)).norm(), 1e-10) << offsets[i];
+        EXPECT_NEAR(yaws(i), 0.1 * offsets[i], 1e-12);
+    }
+
+    // held at the first and the last sample outside of them
+    library.evaluate(0.0, {-1.0, times.back() + 1.0}, positions, velocities, &accelerations, &yaws);
+    double position[3], velocity[3], acceleration[3];
+    quintic(times.front(), position, velocity, acceleration);
+    EXPECT_EQ(positions.col(0), Eigen::Map<Eigen::Vector3d>(position));
+    quintic(times.back(), position, velocity, acceleration);
+    EXPECT_EQ(positions.col(1), Eigen::Map<Eigen::Vector3d>(position));
+    EXPECT_EQ(velocities, Eigen::Matrix3Xd::Zero(3, 2));
+    EXPECT_EQ(accelerations, Eigen::Matrix3Xd::Zero(3, 2));
+}
+
+TEST(TrajectoryLibrary, YawTakesTheShortWay)
+{
+    std::vector<LibrarySample> samples = quintic_samples({0.0, 1.0});
+    samples[0].yaw = 3.0;
+    samples[1].yaw = -3.0;
+    TempFile file;
+    TrajectoryLibrary::write(file.path(), samples, {0});
+    TrajectoryLibrary library(file.path());
+    Eigen::Matrix3Xd positions, velocities;
+    Eigen::VectorXd yaws;
+    library.evaluate(0.0, {0.25, 0.5, 0.75}, positions, velocities, nullptr, &yaws);
+    EXPECT_NEAR(yaws(0), 3.0 + 0.25 * (2.0 * M_PI - 6.0), 1e-12);
+    EXPECT_NEAR(std::abs(yaws(1)), M_PI, 1e-12);
+    EXPECT_NEAR(yaws(2), -3.0 - 0.25 * (2.0 * M_PI - 6.0), 1e-12);
+}
+
+TEST(TrajectoryLibrary, HeldYawWrapped)
+{
+    // a library written with unwrapped yaws holds a wrapped one outside of its samples, as in between them
+    std::vector<LibrarySample> samples = quintic_samples({0.0, 1.0});
+    samples[0].yaw = -2.0 * M_PI - 0.5;
+    samples[1].yaw = 4.0 * M_PI + 0.5;
+    TempFile file;
+    TrajectoryLibrary::write(file.path(), samples, {0});
+    TrajectoryLibrary library(file.path());
+    Eigen::Matrix3Xd positions, velocities;
+    Eigen::VectorXd yaws;
+    library.evaluate(0.0, {-1.0, 2.0}, positions, velocities, nullptr, &yaws);
+    EXPECT_NEAR(yaws(0), -0.5, 1e-12);
+    EXPECT_NEAR(yaws(1), 0.5, 1e-12);
+}
+
+TEST(LibraryPlayback, MissionTimeOverTheClock)
+{
+    LibraryPlayback playback;
+    EXPECT_FALSE(playback.playing());
+    EXPECT_DOUBLE_EQ(playback.mission_time(5.0), 0.0);
+    EXPECT_TRUE(std::isinf(playback.clock_time(1.0)));
+    playback.start(10.0);
+    EXPECT_DOUBLE_EQ(playback.mission_time(12.5), 2.5);
+    EXPECT_DOUBLE_EQ(playback.clock_time(4.0), 14.0);
+    playback.pause(13.0);
+    EXPECT_DOUBLE_EQ(playback.mission_time(20.0), 3.0);
+    playback.seek(1.0, 20.0);
+    EXPECT_FALSE(playback.playing());
+    playback.start(21.0);
+    EXPECT_DOUBLE_EQ(playback.mission_time(22.0), 2.0);
+}